@@ -519,6 +519,13 @@ namespace awh {
 				 * @param settings список настроек протокола HTTP/2
 				 */
 				void settings(const std::map <awh::http2_t::settings_t, uint32_t> & settings = {}) noexcept;
+			public:
+				/**
+				 * @brief Метод HTTP/2 получения состояния управления потоком сессии
+				 *
+				 * @return размеры окон, время приёма-передачи и оценка BDP
+				 */
+				awh::http2_t::flow_t flow2() const noexcept;
 			public:
 				/**
 				 * @brief Метод установки размера чанка
@@ -749,6 +749,20 @@ namespace awh {
 				 * @param size   размер буфера данных для отправки
 				 */
 				void sendSignal(const uint8_t * buffer, const size_t size) noexcept;
+				/**
+				 * @brief Метод обратного вызова при отправки данных HTTP/2 без копирования
+				 *
+				 * @param buffer буфер бинарных данных
+				 * @param size   размер буфера данных для отправки
+				 * @param owner  владелец буфера, удерживающий данные до их отправки
+				 */
+				void writeSignal(const uint8_t * buffer, const size_t size, const std::shared_ptr <const void> & owner) noexcept;
+				/**
+				 * @brief Метод обратного вызова при получении объёма памяти доступной для буферов отправки
+				 *
+				 * @return количество байт доступной памяти
+				 */
+				size_t memorySignal() const noexcept;
 			protected:
 				/**
 				 * @brief Метод обратного вызова при получении фрейма заголовков прокси-сервера HTTP/2
@@ -918,6 +932,17 @@ namespace awh {
 				 * @return       результат отправки данных указанному клиенту
 				 */
 				bool send(const int32_t sid, const char * buffer, const size_t size, const http2_t::flag_t flag) noexcept;
+				/**
+				 * @brief Метод отправки сообщения на сервер без копирования
+				 *
+				 * @param sid    идентификатор потока
+				 * @param buffer буфер бинарных данных передаваемых на сервер
+				 * @param size   размер сообщения в байтах
+				 * @param owner  владелец буфера, удерживающий данные до их отправки
+				 * @param flag   флаг передаваемого потока по сети
+				 * @return       результат отправки данных указанному клиенту
+				 */
+				bool send(const int32_t sid, const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const http2_t::flag_t flag) noexcept;
 			public:
 				/**
 				 * @brief Метод отправки заголовков на сервер
@@ -942,6 +967,13 @@ namespace awh {
 				 * @param settings список настроек протокола HTTP/2
 				 */
 				virtual void settings(const std::map <http2_t::settings_t, uint32_t> & settings = {}) noexcept;
+			public:
+				/**
+				 * @brief Метод получения состояния управления потоком сессии
+				 *
+				 * @return размеры окон, время приёма-передачи и оценка BDP
+				 */
+				http2_t::flow_t flow() const noexcept;
 			public:
 				/**
 				 * @brief Метод установки размера чанка
@@ -22,7 +22,7 @@
 #include "web.hpp"
 #include "../../ws/frame.hpp"
 #include "../../ws/client.hpp"
-#include "../../sys/threadpool.hpp"
+#include "../../sys/executor.hpp"
 
 /**
  * @brief пространство имён
@@ -131,7 +131,7 @@ namespace awh {
 				ws1_t _ws1;
 			private:
 				// Объект тредпула для работы с потоками
-				thr_t _thr;
+				exec_t _thr;
 				// Объект для работы с HTTP-протколом
 				ws_t _http;
 				// Объект хэширования
@@ -19,6 +19,7 @@
  * Стандартные библиотеки
  */
 #include <map>
+#include <tuple>
 #include <vector>
 #include <thread>
 #include <string>
@@ -40,6 +41,7 @@
  * Наши модули
  */
 #include "cmp.hpp"
+#include "ring.hpp"
 #include "../sys/fmk.hpp"
 #include "../sys/log.hpp"
 #include "../sys/callback.hpp"
@@ -66,8 +68,17 @@ namespace awh {
 			 * Режим обмена сообщениям
 			 */
 			enum class transfer_t : uint8_t {
-				PIPE = 0x00, // Передача сообщений через Shared Memory
-				IPC  = 0x01  // Передача сообщений через Unix-socket
+				PIPE = 0x00, // Передача сообщений через пару связанных сокетов (socketpair)
+				IPC  = 0x01, // Передача сообщений через Unix-socket
+				SHM  = 0x02  // Передача сообщений через кольцевой буфер в разделяемой памяти
+			};
+			/**
+			 * Режим распределения подключений между дочерними процессами
+			 */
+			enum class distribution_t : uint8_t {
+				SHARED    = 0x00, // Все процессы принимают подключения с общего слушающего сокета
+				REUSEPORT = 0x01, // Каждый процесс принимает подключения со своего слушающего сокета (SO_REUSEPORT)
+				MASTER    = 0x02  // Родительский процесс принимает подключения и передаёт их наименее загруженному процессу
 			};
 			/**
 			 * События работы кластера
@@ -92,7 +103,8 @@ namespace awh {
 			enum class message_t : uint8_t {
 				NONE    = 0x00, // Тип сообщения не установлен
 				HELLO   = 0x01, // Тип сообщения рукопожатия
-				GENERAL = 0x02  // Тип сообщения общего назначения
+				GENERAL = 0x02, // Тип сообщения общего назначения
+				LOAD    = 0x03  // Тип сообщения сведений о нагрузке дочернего процесса
 			};
 		public:
 			/**
@@ -203,6 +215,25 @@ namespace awh {
 				 */
 				Peer() noexcept : size(0), addr{} {}
 			} peer_t;
+			/**
+			 * @brief Структура нагрузки дочернего процесса
+			 *
+			 */
+			typedef struct Load {
+				// Задержка цикла событий (мкс)
+				uint32_t lag;
+				// Количество переданных процессу подключений
+				uint32_t sent;
+				// Количество подключений полученных процессом
+				uint32_t received;
+				// Количество активных подключений процесса
+				uint32_t connections;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Load() noexcept : lag(0), sent(0), received(0), connections(0) {}
+			} load_t;
 			/**
 			 * @brief Структура клиента
 			 *
@@ -262,13 +293,16 @@ namespace awh {
 				 *
 				 */
 				typedef struct Broker {
-					bool stop;          // Флаг завершения работы процессом
-					pid_t pid;          // Идентификатор активного процесса
-					uint64_t date;      // Время начала жизни процесса
-					SOCKET mfds[2];     // Список файловых дескрипторов родительского процесса
-					SOCKET cfds[2];     // Список файловых дескрипторов дочернего процесса
-					awh::event_t read;  // Объект события на получения сообщений
-					awh::event_t write; // Объект события на запись сообщений
+					bool stop;            // Флаг завершения работы процессом
+					pid_t pid;            // Идентификатор активного процесса
+					uint64_t date;        // Время начала жизни процесса
+					SOCKET mfds[2];       // Список файловых дескрипторов родительского процесса
+					SOCKET cfds[2];       // Список файловых дескрипторов дочернего процесса
+					SOCKET hfds[2];       // Список файловых дескрипторов канала передачи подключений
+					awh::event_t read;    // Объект события на получения сообщений
+					awh::event_t write;   // Объект события на запись сообщений
+					awh::event_t handoff; // Объект события на получение переданных подключений
+					cmp::ring_t ring;     // Кольцевой буфер в разделяемой памяти
 					/**
 					 * @brief Конструктор
 					 *
@@ -279,8 +313,10 @@ namespace awh {
 					 stop(false), pid(::getpid()), date(0),
 					 mfds{INVALID_SOCKET, INVALID_SOCKET},
 					 cfds{INVALID_SOCKET, INVALID_SOCKET},
+					 hfds{INVALID_SOCKET, INVALID_SOCKET},
 					 read(awh::event_t::type_t::EVENT, fmk, log),
-					 write(awh::event_t::type_t::EVENT, fmk, log) {}
+					 write(awh::event_t::type_t::EVENT, fmk, log),
+					 handoff(awh::event_t::type_t::EVENT, fmk, log), ring(log) {}
 					/**
 					 * @brief Деструктор
 					 *
@@ -325,6 +361,17 @@ namespace awh {
 		private:
 			// Режим передачи данных
 			transfer_t _transfer;
+		private:
+			// Размер кольцевого буфера разделяемой памяти
+			size_t _ringSize;
+			// Политика поведения при переполнении кольцевого буфера
+			cmp::ring_t::overflow_t _overflow;
+		private:
+			// Режим распределения подключений
+			distribution_t _distribution;
+		private:
+			// Количество подключений полученных от родительского процесса
+			uint32_t _received;
 		private:
 			// Параметры пропускной способности
 			bandwidth_t _bandwidth;
@@ -352,6 +399,8 @@ namespace awh {
 			std::map <uint16_t, std::unique_ptr <worker_t>> _workers;
 			// Список энкодеров для кодирования сообщений
 			std::map <pid_t, std::unique_ptr <cmp::encoder_t>> _encoders;
+			// Список нагрузки дочерних процессов
+			std::map <pid_t, load_t> _loads;
 			// Список дочерних брокеров
 			std::map <uint16_t, vector <std::unique_ptr <broker_t>>> _brokers;
 		private:
@@ -389,6 +438,86 @@ namespace awh {
 				 */
 				static void child(int32_t signal, siginfo_t * info, void * ctx) noexcept;
 			#endif
+		private:
+			/**
+			 * Для операционной системы не являющейся MS Windows
+			 */
+			#if !_WIN32 && !_WIN64
+				/**
+				 * @brief Метод пробуждения соседнего процесса
+				 *
+				 * @param sock сетевой сокет соседнего процесса
+				 */
+				void doorbell(const SOCKET sock) const noexcept;
+				/**
+				 * @brief Метод записи сообщения в кольцевой буфер разделяемой памяти
+				 *
+				 * @param broker брокер через которого передаётся сообщение
+				 * @param buffer бинарный буфер для отправки сообщения
+				 * @param size   размер бинарного буфера для отправки сообщения
+				 * @param mid    идентификатор типа сообщения
+				 */
+				void enqueue(broker_t * broker, const char * buffer, const size_t size, const message_t mid = message_t::GENERAL) noexcept;
+				/**
+				 * @brief Метод извлечения сообщений из кольцевого буфера разделяемой памяти
+				 *
+				 * @param wid  идентификатор воркера
+				 * @param sock сетевой сокет пробуждения
+				 */
+				void receive(const uint16_t wid, const SOCKET sock) noexcept;
+			#endif
+		private:
+			/**
+			 * Для операционной системы не являющейся MS Windows
+			 */
+			#if !_WIN32 && !_WIN64
+				/**
+				 * @brief Метод создания канала передачи подключений (вызывается до создания дочернего процесса)
+				 *
+				 * @param broker брокер для которого создаётся канал
+				 * @return       результат выполнения операции
+				 */
+				bool pair(broker_t * broker) noexcept;
+				/**
+				 * @brief Метод закрытия канала передачи подключений
+				 *
+				 * @param broker брокер канал которого необходимо закрыть
+				 */
+				void release(broker_t * broker) noexcept;
+				/**
+				 * @brief Метод привязки канала передачи подключений к текущему процессу (вызывается после создания дочернего процесса)
+				 *
+				 * @param wid    идентификатор воркера
+				 * @param broker брокер созданного дочернего процесса
+				 */
+				void attach(const uint16_t wid, broker_t * broker) noexcept;
+				/**
+				 * @brief Метод обратного вызова получения переданных подключений
+				 *
+				 * @param wid   идентификатор воркера
+				 * @param sock  сетевой сокет канала передачи подключений
+				 * @param event произошедшее событие
+				 */
+				void descriptor(const uint16_t wid, const SOCKET sock, const base_t::event_type_t event) noexcept;
+			#endif
+		private:
+			/**
+			 * @brief Метод учёта сведений о нагрузке дочернего процесса
+			 *
+			 * @param pid    идентификатор процесса
+			 * @param buffer бинарный буфер сведений о нагрузке
+			 * @param size   размер бинарного буфера сведений о нагрузке
+			 */
+			void report(const pid_t pid, const char * buffer, const size_t size) noexcept;
+			/**
+			 * @brief Метод отправки сообщения указанного типа родительскому процессу
+			 *
+			 * @param wid    идентификатор воркера
+			 * @param mid    идентификатор типа сообщения
+			 * @param buffer бинарный буфер для отправки сообщения
+			 * @param size   размер бинарного буфера для отправки сообщения
+			 */
+			void dispatch(const uint16_t wid, const message_t mid, const char * buffer, const size_t size) noexcept;
 		private:
 			/**
 			 * @brief Метод активации прослушивания сокета
@@ -465,6 +594,41 @@ namespace awh {
 			 * @return    список дочерних процессов
 			 */
 			std::set <pid_t> pids(const uint16_t wid) const noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества активных подключений каждого дочернего процесса
+			 *
+			 * @param wid идентификатор воркера
+			 * @return    список количества подключений по идентификаторам процессов
+			 */
+			std::map <pid_t, size_t> connections(const uint16_t wid) const noexcept;
+		public:
+			/**
+			 * @brief Метод получения наименее загруженного дочернего процесса
+			 *
+			 * @param wid идентификатор воркера
+			 * @return    идентификатор процесса (0 если процесс не найден)
+			 */
+			pid_t least(const uint16_t wid) const noexcept;
+		public:
+			/**
+			 * @brief Метод передачи принятого подключения дочернему процессу
+			 *
+			 * @param wid идентификатор воркера
+			 * @param pid идентификатор процесса получателя подключения
+			 * @param fd  файловый дескриптор принятого подключения (при успешной передаче закрывается)
+			 * @return    результат выполнения операции
+			 */
+			bool handoff(const uint16_t wid, const pid_t pid, const SOCKET fd) noexcept;
+		public:
+			/**
+			 * @brief Метод отправки родительскому процессу сведений о нагрузке
+			 *
+			 * @param wid         идентификатор воркера
+			 * @param connections количество активных подключений
+			 * @param lag         задержка цикла событий (мкс)
+			 */
+			void load(const uint16_t wid, const size_t connections, const uint32_t lag) noexcept;
 		public:
 			/**
 			 * @brief Метод отправки сообщения родительскому процессу
@@ -580,6 +744,32 @@ namespace awh {
 			 * @param transfer режим передачи данных
 			 */
 			void transfer(const transfer_t transfer) noexcept;
+		public:
+			/**
+			 * @brief Метод установки размера кольцевого буфера разделяемой памяти
+			 *
+			 * @param size размер буфера одного направления в байтах
+			 */
+			void ringSize(const size_t size) noexcept;
+			/**
+			 * @brief Метод установки политики поведения при переполнении кольцевого буфера
+			 *
+			 * @param overflow политика поведения при переполнении
+			 */
+			void overflow(const cmp::ring_t::overflow_t overflow) noexcept;
+		public:
+			/**
+			 * @brief Метод получения режима распределения подключений
+			 *
+			 * @return режим распределения подключений
+			 */
+			distribution_t distribution() const noexcept;
+			/**
+			 * @brief Метод установки режима распределения подключений
+			 *
+			 * @param distribution режим распределения подключений
+			 */
+			void distribution(const distribution_t distribution) noexcept;
 		public:
 			/**
 			 * @brief Метод установки соли шифрования
@@ -30,6 +30,7 @@
 #include "../sys/fmk.hpp"
 #include "../sys/log.hpp"
 #include "../sys/hash.hpp"
+#include "../sys/codec.hpp"
 #include "../sys/queue.hpp"
 #include "../sys/buffer.hpp"
 
@@ -88,6 +89,8 @@ namespace awh {
 			private:
 				// Объект работы с хэшированием
 				hash_t _hash;
+				// Потоковый компрессор переиспользуемый между сообщениями
+				codec_t _codec;
 				// Заголовок полученного сообщения
 				header_t _header;
 				// Объект буфера данных
@@ -0,0 +1,283 @@
+/**
+ * @file: ring.hpp
+ * @date: 2025-03-24
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_CLUSTER_RING__
+#define __AWH_CLUSTER_RING__
+
+/**
+ * Стандартные модули
+ */
+#include <new>
+#include <deque>
+#include <atomic>
+#include <vector>
+#include <cstring>
+#include <functional>
+
+/**
+ * Для операционной системы не являющейся MS Windows
+ */
+#if !_WIN32 && !_WIN64
+	/**
+	 * Стандартные модули
+	 */
+	#include <sys/mman.h>
+#endif
+
+/**
+ * Наши модули
+ */
+#include "../sys/log.hpp"
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief пространство имён Cluster Message Protocol (CMP)
+	 *
+	 */
+	namespace cmp {
+		/**
+		 * @brief Класс кольцевого буфера в разделяемой памяти (один писатель - один читатель на направление)
+		 *
+		 */
+		typedef class AWHSHARED_EXPORT Ring {
+			public:
+				/**
+				 * Политика поведения при переполнении буфера
+				 */
+				enum class overflow_t : uint8_t {
+					WAIT = 0x00, // Удерживать сообщение в локальной очереди до освобождения места (не более AWH_CLUSTER_RING_BACKLOG байт)
+					DROP = 0x01  // Отбрасывать сообщение которое не помещается в буфер
+				};
+				/**
+				 * Статус выполнения операции
+				 */
+				enum class status_t : uint8_t {
+					NONE = 0x00, // Будить соседний процесс не требуется
+					WAKE = 0x01, // Требуется разбудить соседний процесс
+					DROP = 0x02  // Сообщение отброшено из-за переполнения
+				};
+			public:
+				// Размер заголовка записи
+				static constexpr size_t HEADER = 0x08;
+				// Минимальная ёмкость одного направления
+				static constexpr size_t MIN_CAPACITY = 0x1000;
+			private:
+				/**
+				 * Флаги записи
+				 */
+				enum class flag_t : uint8_t {
+					NONE = 0x00, // Флаг не установлен
+					FIN  = 0x01, // Последний фрагмент сообщения
+					PAD  = 0x02  // Запись-заполнитель до конца буфера
+				};
+			private:
+				/**
+				 * @brief Структура заголовка записи
+				 *
+				 */
+				typedef struct Record {
+					// Размер полезной нагрузки
+					uint32_t size;
+					// Идентификатор сообщения
+					uint8_t mid;
+					// Флаги записи
+					uint8_t flags;
+					// Зарезервированное поле
+					uint16_t reserved;
+				} __attribute__((packed)) record_t;
+				/**
+				 * @brief Структура канала одного направления
+				 *
+				 */
+				typedef struct Channel {
+					// Позиция записи (изменяется только писателем)
+					alignas(64) std::atomic <uint64_t> head;
+					// Позиция чтения (изменяется только читателем)
+					alignas(64) std::atomic <uint64_t> tail;
+					// Флаг ожидания читателем новых данных
+					alignas(64) std::atomic <uint32_t> idle;
+					// Флаг ожидания писателем освобождения места
+					std::atomic <uint32_t> blocked;
+				} channel_t;
+				/**
+				 * @brief Структура сообщения ожидающего места в буфере
+				 *
+				 */
+				typedef struct Pending {
+					// Идентификатор сообщения
+					uint8_t mid;
+					// Смещение уже записанных данных
+					size_t offset;
+					// Данные сообщения
+					vector <char> data;
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Pending() noexcept : mid(0), offset(0) {}
+				} pending_t;
+			private:
+				// Флаг стороны родительского процесса
+				bool _master;
+			private:
+				// Ёмкость одного направления
+				size_t _capacity;
+				// Общий размер отображённой памяти
+				size_t _length;
+			private:
+				// Политика поведения при переполнении
+				overflow_t _overflow;
+			private:
+				// Адрес отображённой разделяемой памяти
+				void * _memory;
+			private:
+				// Буфер сборки фрагментированного сообщения
+				vector <char> _fragments;
+			private:
+				// Объём данных сообщений ожидающих места в буфере
+				size_t _waiting;
+				// Очередь сообщений ожидающих места в буфере
+				std::deque <pending_t> _backlog;
+			private:
+				// Объект работы с логами
+				const log_t * _log;
+			private:
+				/**
+				 * @brief Метод получения канала по индексу
+				 *
+				 * @param index индекс канала (0 - от родителя к ребёнку, 1 - от ребёнка к родителю)
+				 * @return      канал для работы
+				 */
+				channel_t * channel(const uint8_t index) const noexcept;
+				/**
+				 * @brief Метод получения области данных канала
+				 *
+				 * @param index индекс канала
+				 * @return      адрес области данных
+				 */
+				char * area(const uint8_t index) const noexcept;
+			private:
+				/**
+				 * @brief Метод записи части сообщения в буфер
+				 *
+				 * @param mid    идентификатор сообщения
+				 * @param buffer буфер данных для записи
+				 * @param size   размер буфера данных
+				 * @param offset смещение уже записанных данных
+				 * @param check  флаг только проверки наличия места без записи
+				 * @return       результат записи сообщения целиком
+				 */
+				bool write(const uint8_t mid, const char * buffer, const size_t size, size_t & offset, const bool check = false) noexcept;
+			private:
+				/**
+				 * @brief Метод оповещения читателя о новых данных
+				 *
+				 * @param head позиция записи до начала операции
+				 * @return     статус необходимости пробуждения читателя
+				 */
+				status_t notify(const uint64_t head) const noexcept;
+			public:
+				/**
+				 * @brief Метод проверки инициализации буфера
+				 *
+				 * @return результат проверки
+				 */
+				bool created() const noexcept;
+			public:
+				/**
+				 * @brief Метод создания разделяемой памяти (вызывается до создания дочернего процесса)
+				 *
+				 * @param capacity ёмкость одного направления в байтах
+				 * @return         результат выполнения операции
+				 */
+				bool create(const size_t capacity) noexcept;
+			public:
+				/**
+				 * @brief Метод освобождения разделяемой памяти
+				 *
+				 */
+				void destroy() noexcept;
+			public:
+				/**
+				 * @brief Метод записи сообщения в буфер
+				 *
+				 * @param mid    идентификатор сообщения
+				 * @param buffer буфер данных сообщения
+				 * @param size   размер буфера данных сообщения
+				 * @return       статус выполнения операции
+				 */
+				status_t push(const uint8_t mid, const char * buffer, const size_t size) noexcept;
+			public:
+				/**
+				 * @brief Метод дозаписи отложенных сообщений
+				 *
+				 * @return статус выполнения операции
+				 */
+				status_t flush() noexcept;
+			public:
+				/**
+				 * @brief Метод извлечения всех доступных сообщений
+				 *
+				 * @param callback функция обратного вызова для каждого сообщения
+				 * @return         статус необходимости пробуждения писателя
+				 */
+				status_t pop(function <void (const uint8_t, const char *, const size_t)> callback) noexcept;
+			public:
+				/**
+				 * @brief Метод получения количества отложенных сообщений
+				 *
+				 * @return количество отложенных сообщений
+				 */
+				size_t pending() const noexcept;
+			public:
+				/**
+				 * @brief Метод установки стороны работы с буфером
+				 *
+				 * @param mode флаг стороны родительского процесса
+				 */
+				void master(const bool mode) noexcept;
+			public:
+				/**
+				 * @brief Метод установки политики поведения при переполнении
+				 *
+				 * @param overflow политика поведения при переполнении
+				 */
+				void overflow(const overflow_t overflow) noexcept;
+			public:
+				/**
+				 * @brief Конструктор
+				 *
+				 * @param log объект для работы с логами
+				 */
+				Ring(const log_t * log) noexcept :
+				 _master(true), _capacity(0), _length(0),
+				 _overflow(overflow_t::WAIT), _memory(nullptr), _waiting(0), _log(log) {}
+				/**
+				 * @brief Деструктор
+				 *
+				 */
+				~Ring() noexcept;
+		} ring_t;
+	};
+};
+
+#endif // __AWH_CLUSTER_RING__
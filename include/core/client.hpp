@@ -69,6 +69,7 @@ namespace awh {
 					std::recursive_mutex proxy;   // Для работы с прокси-сервером
 					std::recursive_mutex connect; // Для выполнения подключения
 					std::recursive_mutex receive; // Для работы с таймаутами ожидания получения данных
+					std::recursive_mutex session; // Для работы с сохранёнными сессиями TLS
 					std::recursive_mutex timeout; // Для создания нового таймаута
 				} mtx_t;
 			private:
@@ -85,6 +86,22 @@ namespace awh {
 				std::map <uint64_t, uint16_t> _receive;
 				// Список активных таймаутов
 				std::map <uint16_t, uint16_t> _timeouts;
+			private:
+				// Список сохранённых сессий TLS для возобновления подключений по хосту
+				std::map <string, vector <uint8_t>> _sessions;
+			private:
+				/**
+				 * @brief Метод сохранения сессии TLS подключения для последующего возобновления
+				 *
+				 * @param broker объект брокера подключения
+				 */
+				void store(const awh::scheme_t::broker_t * broker) noexcept;
+				/**
+				 * @brief Метод установки сохранённой сессии TLS для возобновления подключения
+				 *
+				 * @param broker объект брокера подключения
+				 */
+				void resume(awh::scheme_t::broker_t * broker) noexcept;
 			private:
 				/**
 				 * @brief Метод создания подключения к удаленному серверу
@@ -222,6 +239,16 @@ namespace awh {
 				 * @return       результат отправки сообщения
 				 */
 				bool send(const char * buffer, const size_t size, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод асинхронной отправки буфера данных в сокет без копирования
+				 *
+				 * @param buffer буфер для записи данных
+				 * @param size   размер записываемых данных
+				 * @param owner  владелец буфера, удерживающий данные до их отправки
+				 * @param bid    идентификатор брокера
+				 * @return       результат отправки сообщения
+				 */
+				bool send(const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const uint64_t bid) noexcept;
 			private:
 				/**
 				 * @brief Метод чтения данных для брокера
@@ -245,6 +272,15 @@ namespace awh {
 				 * @return       количество отправленных байт
 				 */
 				size_t write(const char * buffer, const size_t size, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод векторной записи списка буферов данных в сокет
+				 *
+				 * @param records список записей данных для записи
+				 * @param count   количество записей в списке
+				 * @param bid     идентификатор брокера
+				 * @return        количество отправленных байт
+				 */
+				size_t write(const chain_t::record_t * records, const size_t count, const uint64_t bid) noexcept;
 			private:
 				/**
 				 * @brief Метод запуска работы подключения клиента
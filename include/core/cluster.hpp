@@ -117,6 +117,20 @@ namespace awh {
 				 * @return список дочерних процессов
 				 */
 				std::set <pid_t> pids() const noexcept;
+			public:
+				/**
+				 * @brief Метод получения количества активных подключений каждого дочернего процесса
+				 *
+				 * @return список количества подключений по идентификаторам процессов
+				 */
+				std::map <pid_t, size_t> connections() const noexcept;
+				/**
+				 * @brief Метод отправки родительскому процессу сведений о нагрузке
+				 *
+				 * @param connections количество активных подключений
+				 * @param lag         задержка цикла событий (мкс)
+				 */
+				void load(const size_t connections, const uint32_t lag) noexcept;
 			public:
 				/**
 				 * @brief Метод размещения нового воркера
@@ -246,6 +260,18 @@ namespace awh {
 				 * @param transfer режим передачи данных
 				 */
 				void transfer(const cluster_t::transfer_t transfer) noexcept;
+				/**
+				 * @brief Метод установки размера кольцевого буфера разделяемой памяти
+				 *
+				 * @param size размер буфера одного направления в байтах
+				 */
+				void ringSize(const size_t size) noexcept;
+				/**
+				 * @brief Метод установки политики поведения при переполнении кольцевого буфера
+				 *
+				 * @param overflow политика поведения при переполнении
+				 */
+				void overflow(const cmp::ring_t::overflow_t overflow) noexcept;
 			public:
 				/**
 				 * @brief Метод установки пропускной способности сети
@@ -82,6 +82,9 @@ namespace awh {
 				private:
 					// Мютекс для блокировки потока
 					std::mutex _mtx;
+				private:
+					// Ячейка базы событий с которой работает модуль
+					base_t ** _base;
 				private:
 					// Флаг работы модуля
 					std::atomic_bool _work;
@@ -89,6 +92,8 @@ namespace awh {
 					std::atomic_bool _init;
 					// Флаг виртуальной базы данных
 					std::atomic_bool _virt;
+					// Флаг отдельной базы событий потока
+					std::atomic_bool _isolated;
 				private:
 					/**
 					 * Функция обратного вызова при запуске модуля
@@ -149,6 +154,19 @@ namespace awh {
 					 * @param msec время ожидания событий в миллисекундах
 					 */
 					void rate(const uint8_t msec = 10) noexcept;
+				public:
+					/**
+					 * @brief Метод получения базы событий
+					 *
+					 * @return база событий с которой работает модуль
+					 */
+					base_t * base() const noexcept;
+					/**
+					 * @brief Метод проверки работы с отдельной базой событий потока
+					 *
+					 * @return результат проверки
+					 */
+					bool isolated() const noexcept;
 				public:
 					/**
 					 * @brief Метод установки функции обратного вызова
@@ -375,6 +393,22 @@ namespace awh {
 			 * @return инициализированная база событий
 			 */
 			base_t * base() noexcept;
+			/**
+			 * @brief Метод проверки работы с отдельной базой событий потока
+			 *
+			 * @return результат проверки
+			 */
+			bool isolated() const noexcept;
+		public:
+			/**
+			 * @brief Метод выделения отдельной базы событий для текущего потока
+			 *
+			 * Все сетевые ядра, созданные в потоке после активации, работают с собственной базой событий потока,
+			 * а не с общей базой событий процесса
+			 *
+			 * @param mode флаг активации
+			 */
+			static void isolation(const bool mode = true) noexcept;
 		public:
 			/**
 			 * @brief Метод активации простого режима чтения базы событий
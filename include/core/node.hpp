@@ -32,6 +32,7 @@
 #include "../net/uri.hpp"
 #include "../net/dns.hpp"
 #include "../net/engine.hpp"
+#include "../sys/chain.hpp"
 #include "../sys/buffer.hpp"
 #include "../scheme/core.hpp"
 
@@ -66,6 +67,16 @@ namespace awh {
 				public:
 					// Флаг выполнения валидации доменного имени
 					bool verify;
+					// Флаг разрешения шифрования на уровне ядра (kTLS)
+					bool ktls;
+				public:
+					// Время жизни сессии TLS и период ротации ключей сессионных билетов в секундах
+					uint32_t lifetime;
+				public:
+					// Минимальная версия протокола TLS (TLS1_2_VERSION / TLS1_3_VERSION)
+					int32_t minVersion;
+					// Максимальная версия протокола TLS (TLS1_2_VERSION / TLS1_3_VERSION)
+					int32_t maxVersion;
 				public:
 					// Ключ SSL-сертификата
 					string key;
@@ -171,6 +182,41 @@ namespace awh {
 				 sockname{""}, sockpath{"/tmp"},
 				 network{"0.0.0.0","[::]"} {}
 			} settings_t;
+			/**
+			 * @brief Класс аренды буфера чтения потока
+			 *
+			 * Буферы чтения принадлежат потоку и выдаются только на время чтения данных
+			 * из сокета и вызова функции обратного вызова, вложенные чтения получают свой буфер
+			 *
+			 */
+			typedef class AWHSHARED_EXPORT Lease {
+				private:
+					// Индекс арендованного буфера в пуле потока
+					size_t _index;
+				private:
+					// Объект работы с логами
+					const log_t * _log;
+				public:
+					/**
+					 * @brief Метод получения арендованного буфера
+					 *
+					 * @param size минимальный размер буфера
+					 * @return     арендованный буфер чтения
+					 */
+					char * get(const size_t size) noexcept;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 * @param log объект для работы с логами
+					 */
+					Lease(const log_t * log) noexcept;
+					/**
+					 * @brief Деструктор
+					 *
+					 */
+					~Lease() noexcept;
+			} lease_t;
 		protected:
 			// Мютекс для блокировки потоков
 			mtx_t _mtx;
@@ -205,7 +251,7 @@ namespace awh {
 			// Список брокеров подключения
 			std::map <uint64_t, const scheme_t::broker_t *> _brokers;
 			// Буферы отправляемой полезной нагрузки
-			std::map <uint64_t, std::unique_ptr <buffer_t>> _payloads;
+			std::map <uint64_t, std::unique_ptr <chain_t>> _payloads;
 		protected:
 			// Объект DNS-резолвера
 			const dns_t * _dns;
@@ -257,6 +303,12 @@ namespace awh {
 			 * @param bid идентификатор брокера
 			 */
 			void initBuffer(const uint64_t bid) noexcept;
+			/**
+			 * @brief Метод завершения чтения в буфер полезной нагрузки с применением отложенной переинициализации
+			 *
+			 * @param bid идентификатор брокера
+			 */
+			void releaseBuffer(const uint64_t bid) noexcept;
 			/**
 			 * @brief Метод освобождение памяти занятой для хранение полезной нагрузки брокера
 			 *
@@ -264,6 +316,18 @@ namespace awh {
 			 * @param size размер байт удаляемых из буфера
 			 */
 			void erase(const uint64_t bid, const size_t size) noexcept;
+		protected:
+			/**
+			 * @brief Метод вывода функции обратного вызова записи данных в сокет (один вызов на операцию записи)
+			 *
+			 * @param name    название функции обратного вызова
+			 * @param records список записанных записей данных
+			 * @param count   количество записей в списке
+			 * @param bytes   количество отправленных байт
+			 * @param bid     идентификатор брокера
+			 * @param sid     идентификатор схемы сети
+			 */
+			void written(const char * name, const chain_t::record_t * records, const size_t count, const size_t bytes, const uint64_t bid, const uint16_t sid) noexcept;
 		protected:
 			/**
 			 * @brief Метод извлечения брокера подключения
@@ -287,6 +351,12 @@ namespace awh {
 			 * @param ssl параметры SSL для установки
 			 */
 			void ssl(const ssl_t & ssl) noexcept;
+			/**
+			 * @brief Метод получения статистики возобновления сессий TLS
+			 *
+			 * @return статистика возобновления сессий (общая для всех процессов кластера)
+			 */
+			engine_t::resumption_t resumption() const noexcept;
 		public:
 			/**
 			 * @brief Метод установки объекта DNS-резолвера
@@ -323,6 +393,13 @@ namespace awh {
 			 * @return    активный протокол подключения (RAW, HTTP1, HTTP1_1, HTTP2, HTTP3)
 			 */
 			engine_t::proto_t proto(const uint64_t bid) const noexcept;
+			/**
+			 * @brief Метод проверки активации шифрования на уровне ядра (kTLS)
+			 *
+			 * @param bid идентификатор брокера
+			 * @return    результат проверки (запись данных выполняется ядром)
+			 */
+			bool ktls(const uint64_t bid) const noexcept;
 			/**
 			 * @brief Метод установки поддерживаемого протокола подключения
 			 *
@@ -418,6 +495,16 @@ namespace awh {
 			 * @return     результат выполенния операции
 			 */
 			bool nodelay(const uint64_t bid, const engine_t::mode_t mode) noexcept;
+			/**
+			 * @brief Метод включения/отключения собственного буфера чтения брокера
+			 *
+			 * По умолчанию чтение выполняется в буфер потока, собственный буфер нужен
+			 * только протоколам, которые сохраняют указатель на прочитанные данные
+			 *
+			 * @param bid  идентификатор брокера
+			 * @param mode режим применимой операции
+			 */
+			void retain(const uint64_t bid, const engine_t::mode_t mode) noexcept;
 		public:
 			/**
 			 * @brief Метод асинхронной отправки буфера данных в сокет
@@ -428,6 +515,16 @@ namespace awh {
 			 * @return       результат отправки сообщения
 			 */
 			virtual bool send(const char * buffer, const size_t size, const uint64_t bid) noexcept;
+			/**
+			 * @brief Метод асинхронной отправки буфера данных в сокет без копирования
+			 *
+			 * @param buffer буфер для записи данных
+			 * @param size   размер записываемых данных
+			 * @param owner  владелец буфера, удерживающий данные до их отправки
+			 * @param bid    идентификатор брокера
+			 * @return       результат отправки сообщения
+			 */
+			virtual bool send(const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const uint64_t bid) noexcept;
 		public:
 			/**
 			 * @brief Метод установки пропускной способности сети
@@ -0,0 +1,150 @@
+/**
+ * @file: reactor.hpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_CORE_REACTOR__
+#define __AWH_CORE_REACTOR__
+
+/**
+ * Стандартные модули
+ */
+#include <thread>
+
+/**
+ * Наши модули
+ */
+#include "core.hpp"
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief Класс многопоточного запуска баз событий
+	 *
+	 * Каждый цикл работает в собственном потоке с отдельной базой событий, сетевые ядра созданные в потоке цикла
+	 * работают только с ней, а серверы разделяют порт между потоками через SO_REUSEPORT
+	 *
+	 */
+	typedef class AWHSHARED_EXPORT Reactor {
+		private:
+			/**
+			 * @brief Структура цикла базы событий
+			 *
+			 */
+			typedef struct Loop {
+				// Сокет межпотокового передатчика цикла
+				SOCKET sock;
+				// Мютекс для блокировки очереди задач
+				std::mutex mtx;
+				// Поток цикла
+				std::thread thread;
+				// Сетевое ядро владеющее базой событий потока
+				std::unique_ptr <core_t> core;
+				// Очередь задач для выполнения в потоке цикла
+				vector <function <void (void)>> tasks;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Loop() noexcept : sock(INVALID_SOCKET), core(nullptr) {}
+			} loop_t;
+		private:
+			// Мютекс для блокировки основного потока
+			std::recursive_mutex _mtx;
+		private:
+			// Список циклов баз событий
+			vector <std::unique_ptr <loop_t>> _loops;
+		private:
+			// Объект фреймворка
+			const fmk_t * _fmk;
+			// Объект работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * @brief Метод выполнения задач цикла
+			 *
+			 * @param index индекс цикла базы событий
+			 */
+			void process(const uint16_t index) noexcept;
+		private:
+			/**
+			 * @brief Метод работы потока цикла
+			 *
+			 * @param index    индекс цикла базы событий
+			 * @param callback функция обратного вызова запуска сетевых ядер цикла
+			 */
+			void run(const uint16_t index, function <void (const uint16_t)> callback) noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества циклов
+			 *
+			 * @return количество циклов баз событий
+			 */
+			uint16_t size() const noexcept;
+			/**
+			 * @brief Метод получения индекса цикла текущего потока
+			 *
+			 * @return индекс цикла или -1, если поток не принадлежит циклам
+			 */
+			int32_t index() const noexcept;
+		public:
+			/**
+			 * @brief Метод передачи задачи на выполнение в поток цикла
+			 *
+			 * @param index индекс цикла базы событий
+			 * @param task  задача для выполнения
+			 * @return      результат постановки задачи
+			 */
+			bool post(const uint16_t index, function <void (void)> task) noexcept;
+			/**
+			 * @brief Метод передачи задачи на выполнение во все циклы
+			 *
+			 * @param task задача для выполнения
+			 */
+			void broadcast(function <void (void)> task) noexcept;
+		public:
+			/**
+			 * @brief Метод остановки всех циклов
+			 *
+			 */
+			void stop() noexcept;
+			/**
+			 * @brief Метод запуска циклов баз событий (блокирует поток до остановки всех циклов)
+			 *
+			 * @param count    количество циклов (0 - по количеству ядер процессора)
+			 * @param callback функция создания и запуска сетевых ядер цикла, вызывается в потоке цикла
+			 */
+			void start(const uint16_t count, function <void (const uint16_t)> callback) noexcept;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param fmk объект фреймворка
+			 * @param log объект для работы с логами
+			 */
+			Reactor(const fmk_t * fmk, const log_t * log) noexcept : _fmk(fmk), _log(log) {}
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Reactor() noexcept;
+	} reactor_t;
+};
+
+#endif // __AWH_CORE_REACTOR__
@@ -99,6 +99,8 @@ namespace awh {
 				int16_t _clusterSize;
 				// Флаг автоматического перезапуска упавших процессов
 				bool _clusterAutoRestart;
+				// Флаг распределения подключений SO_REUSEPORT по ядрам процессора
+				bool _clusterSteering;
 			private:
 				// Флаг активации/деактивации кластера
 				awh::scheme_t::mode_t _clusterMode;
@@ -113,6 +115,8 @@ namespace awh {
 				std::map <uint64_t, uint16_t> _receive;
 				// Список активных таймаутов
 				std::map <uint16_t, uint16_t> _timeouts;
+				// Список меток времени последнего замера нагрузки процесса
+				std::map <uint16_t, uint64_t> _clusterLoads;
 			private:
 				// Список подключённых брокеров
 				std::map <uint16_t, std::unique_ptr <awh::scheme_t::broker_t>> _brokers;
@@ -124,6 +128,14 @@ namespace awh {
 				 * @param sid  идентификатор схемы сети
 				 */
 				void accept(const SOCKET sock, const uint16_t sid) noexcept;
+				/**
+				 * @brief Метод вызова при подключении к серверу
+				 *
+				 * @param sock сетевой сокет подключившегося клиента
+				 * @param sid  идентификатор схемы сети
+				 * @param fd   файловый дескриптор уже принятого подключения
+				 */
+				void accept(const SOCKET sock, const uint16_t sid, const SOCKET fd) noexcept;
 				/**
 				 * @brief Метод вызова при активации DTLS-подключения
 				 *
@@ -131,6 +143,22 @@ namespace awh {
 				 * @param bid идентификатор брокера
 				 */
 				void accept(const uint16_t sid, const uint64_t bid) noexcept;
+			private:
+				/**
+				 * @brief Метод приёма подключения родительским процессом и передачи его дочернему процессу
+				 *
+				 * @param sock сетевой сокет сервера
+				 * @param sid  идентификатор схемы сети
+				 */
+				void distribute(const SOCKET sock, const uint16_t sid) noexcept;
+			private:
+				/**
+				 * @brief Метод создания собственного слушающего сокета дочернего процесса
+				 *
+				 * @param sid идентификатор схемы сети
+				 * @return    результат создания слушающего сокета
+				 */
+				bool listen(const uint16_t sid) noexcept;
 			private:
 				/**
 				 * @brief Метод вызова при активации базы событий
@@ -210,6 +238,20 @@ namespace awh {
 				 * @param size   размер буфера бинарных данных
 				 */
 				void clusterMessageCallback(const uint16_t sid, const pid_t pid, const char * buffer, const size_t size) noexcept;
+			private:
+				/**
+				 * @brief Метод получения подключения переданного родительским процессом
+				 *
+				 * @param sid идентификатор схемы сети
+				 * @param fd  файловый дескриптор принятого подключения
+				 */
+				void clusterHandoffCallback(const uint16_t sid, const SOCKET fd) noexcept;
+				/**
+				 * @brief Метод отправки родительскому процессу сведений о нагрузке
+				 *
+				 * @param sid идентификатор схемы сети
+				 */
+				void clusterLoadCallback(const uint16_t sid) noexcept;
 			private:
 				/**
 				 * @brief Метод инициализации DTLS-брокера
@@ -308,6 +350,16 @@ namespace awh {
 				 * @return       результат отправки сообщения
 				 */
 				bool send(const char * buffer, const size_t size, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод асинхронной отправки буфера данных в сокет без копирования
+				 *
+				 * @param buffer буфер для записи данных
+				 * @param size   размер записываемых данных
+				 * @param owner  владелец буфера, удерживающий данные до их отправки
+				 * @param bid    идентификатор брокера
+				 * @return       результат отправки сообщения
+				 */
+				bool send(const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const uint64_t bid) noexcept;
 			public:
 				/**
 				 * @brief Метод отправки сообщения родительскому процессу
@@ -378,6 +430,15 @@ namespace awh {
 				 * @return       количество отправленных байт
 				 */
 				size_t write(const char * buffer, const size_t size, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод векторной записи списка буферов данных в сокет
+				 *
+				 * @param records список записей данных для записи
+				 * @param count   количество записей в списке
+				 * @param bid     идентификатор брокера
+				 * @return        количество отправленных байт
+				 */
+				size_t write(const chain_t::record_t * records, const size_t count, const uint64_t bid) noexcept;
 			private:
 				/**
 				 * @brief Метод активации параметров запуска сервера
@@ -463,6 +524,28 @@ namespace awh {
 				 * @param transfer режим передачи данных
 				 */
 				void clusterTransfer(const cluster_t::transfer_t transfer) noexcept;
+			public:
+				/**
+				 * @brief Метод получения режима распределения подключений между процессами
+				 *
+				 * @return режим распределения подключений используемый сервером
+				 */
+				cluster_t::distribution_t clusterDistribution() const noexcept;
+				/**
+				 * @brief Метод установки режима распределения подключений между процессами
+				 *
+				 * @param distribution режим распределения подключений
+				 * @param steering     флаг распределения подключений SO_REUSEPORT по ядрам процессора
+				 */
+				void clusterDistribution(const cluster_t::distribution_t distribution, const bool steering = false) noexcept;
+			public:
+				/**
+				 * @brief Метод получения количества подключений дочерних процессов
+				 *
+				 * @param sid идентификатор схемы сети
+				 * @return    список количества подключений по идентификаторам процессов
+				 */
+				std::map <pid_t, size_t> clusterConnections(const uint16_t sid) const noexcept;
 			public:
 				/**
 				 * @brief Метод установки пропускной способности сети кластера
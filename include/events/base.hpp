@@ -23,6 +23,10 @@
 	 * Подключаем системные заголовки
 	 */
 	#include <sys/epoll.h>
+	/**
+	 * Подключаем движок событий io_uring
+	 */
+	#include "uring.hpp"
 /**
  * Для операционной системы Sun Solaris
  */
@@ -204,6 +208,28 @@ namespace awh {
 				vector <struct epoll_event> _change;
 				// Список активных событий
 				vector <struct epoll_event> _events;
+			private:
+				// Флаг использования движка io_uring
+				bool _iouring;
+				// Количество системных вызовов движка событий
+				uint64_t _syscalls;
+			private:
+				// Список отслеживаемых событий применённых в EPoll
+				std::map <SOCKET, uint32_t> _applied;
+				// Список отложенных изменений событий EPoll
+				std::map <SOCKET, struct epoll_event> _dirty;
+				/**
+				 * Если сборка выполнена с поддержкой io_uring
+				 */
+				#if defined(AWH_IOURING)
+					// Объект движка событий io_uring
+					uring_t _uring;
+				#endif
+			private:
+				// Участник часов колеса таймеров
+				peer_t _clock;
+				// Список сработавших таймеров
+				vector <SOCKET> _expired;
 			/**
 			 * Для операционной системы MacOS Xб FreeBSD, NetBSD или OpenBSD
 			 */
@@ -271,6 +297,34 @@ namespace awh {
 			 * @param event входящее событие от межпотокового передатчика
 			 */
 			void stream(const SOCKET sock, const uint64_t event) noexcept;
+		private:
+			/**
+			 * Для операционной системы Linux
+			 */
+			#if __linux__
+				/**
+				 * @brief Метод обработки сработавших таймеров колеса
+				 *
+				 */
+				void timers() noexcept;
+			private:
+				/**
+				 * @brief Метод изменения отслеживаемых событий активным движком (epoll_ctl или io_uring)
+				 *
+				 * @param op    операция EPOLL_CTL_ADD, EPOLL_CTL_MOD или EPOLL_CTL_DEL
+				 * @param sock  файловый дескриптор
+				 * @param event параметры события
+				 * @return      0 при успешном выполнении или -1 при ошибке
+				 */
+				int32_t ctl(const int32_t op, const SOCKET sock, struct epoll_event * event) noexcept;
+				/**
+				 * @brief Метод ожидания событий активным движком (epoll_wait или io_uring)
+				 *
+				 * @param timeout время ожидания в миллисекундах
+				 * @return        количество полученных событий или -1 при ошибке
+				 */
+				int32_t wait(const int32_t timeout) noexcept;
+			#endif
 		private:
 			/**
 			 * @brief Метод удаления файлового дескриптора из базы событий
@@ -373,6 +427,28 @@ namespace awh {
 			 * @param msec время ожидания событий в миллисекундах
 			 */
 			void rate(const uint32_t msec = 10) noexcept;
+			/**
+			 * @brief Метод установки разрешения таймеров базы событий
+			 *
+			 * @param usec разрешение таймеров в микросекундах
+			 */
+			void resolution(const uint32_t usec = 1000) noexcept;
+		public:
+			/**
+			 * @brief Метод выбора движка io_uring вместо EPoll (только для Linux)
+			 *
+			 * Если ядро не поддерживает io_uring, база событий продолжает работать через EPoll
+			 *
+			 * @param mode флаг использования io_uring
+			 * @return     результат переключения движка
+			 */
+			bool uring(const bool mode) noexcept;
+			/**
+			 * @brief Метод получения количества системных вызовов движка событий
+			 *
+			 * @return количество системных вызовов (только для Linux)
+			 */
+			uint64_t syscalls() const noexcept;
 		public:
 			/**
 			 * @brief Метод отправки сообщения между потоками
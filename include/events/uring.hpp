@@ -0,0 +1,273 @@
+/**
+ * @file: uring.hpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_EVENT_URING__
+#define __AWH_EVENT_URING__
+
+/**
+ * Для операционной системы Linux собранной с поддержкой io_uring
+ */
+#if __linux__ && defined(AWH_IOURING)
+
+/**
+ * Подключаем системные заголовки
+ */
+#include <sys/mman.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/**
+ * Стандартные модули
+ */
+#include <map>
+#include <mutex>
+#include <vector>
+
+/**
+ * Наши модули
+ */
+#include "../net/socket.hpp"
+
+/**
+ * Если размер очереди io_uring не передан
+ */
+#ifndef AWH_URING_ENTRIES
+	/**
+	 * Устанавливаем размер очереди отправки io_uring 4096
+	 */
+	#define AWH_URING_ENTRIES 0x1000
+#endif
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief Класс движка событий io_uring
+	 *
+	 * Повторяет семантику epoll_ctl/epoll_wait: интерес к сокету регистрируется однократным
+	 * IORING_OP_POLL_ADD, который перевзводится после каждого срабатывания (эмуляция level-triggered).
+	 * Все изменения интереса накапливаются в очереди отправки и уходят в ядро одним вызовом
+	 * io_uring_enter вместе с ожиданием событий, а ещё не отправленные запросы правятся на месте.
+	 * Изменения интереса из других потоков защищены мютексом и, пока поток событий ожидает в ядре,
+	 * отправляются отдельным неблокирующим вызовом io_uring_enter
+	 *
+	 */
+	typedef class AWHSHARED_EXPORT URing {
+		private:
+			/**
+			 * @brief Структура интереса к файловому дескриптору
+			 *
+			 */
+			typedef struct Interest {
+				// Флаг взведённого опроса
+				bool armed;
+				// Флаг опроса ещё не отправленного в ядро
+				bool queued;
+				// Поколение опроса
+				uint32_t gen;
+				// Индекс запроса в очереди отправки
+				uint32_t index;
+				// Отслеживаемые события
+				uint32_t events;
+				// Пользовательские данные события
+				epoll_data_t data;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Interest() noexcept :
+				 armed(false), queued(false),
+				 gen(0), index(0), events(0) {
+					// Заполняем пользовательские данные нулями
+					this->data.u64 = 0;
+				}
+			} interest_t;
+		private:
+			// Файловый дескриптор io_uring
+			SOCKET _fd;
+		private:
+			// Флаг ожидания событий в ядре
+			bool _waiting;
+		private:
+			// Мютекс для блокировки очереди отправки и списка интересов
+			std::recursive_mutex _mtx;
+		private:
+			// Счётчик поколений опросов
+			uint32_t _gen;
+			// Количество неотправленных запросов
+			uint32_t _pending;
+			// Количество выполненных системных вызовов
+			uint64_t _syscalls;
+		private:
+			// Кольцо очереди отправки
+			void * _sq;
+			// Кольцо очереди завершения
+			void * _cq;
+			// Размер кольца очереди отправки
+			size_t _sqSize;
+			// Размер кольца очереди завершения
+			size_t _cqSize;
+			// Размер массива запросов
+			size_t _sqesSize;
+		private:
+			// Голова очереди отправки
+			uint32_t * _sqHead;
+			// Хвост очереди отправки
+			uint32_t * _sqTail;
+			// Маска очереди отправки
+			uint32_t * _sqMask;
+			// Количество записей очереди отправки
+			uint32_t _sqEntries;
+			// Голова очереди завершения
+			uint32_t * _cqHead;
+			// Хвост очереди завершения
+			uint32_t * _cqTail;
+			// Маска очереди завершения
+			uint32_t * _cqMask;
+		private:
+			// Массив запросов очереди отправки
+			struct io_uring_sqe * _sqes;
+			// Массив событий очереди завершения
+			struct io_uring_cqe * _cqes;
+		private:
+			// Список сокетов с неотправленными запросами
+			vector <SOCKET> _queued;
+			// Список интересов к файловым дескрипторам
+			std::map <SOCKET, interest_t> _interests;
+		private:
+			// Объект работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * @brief Метод получения свободного запроса очереди отправки
+			 *
+			 * @return свободный запрос очереди отправки
+			 */
+			struct io_uring_sqe * sqe() noexcept;
+		private:
+			/**
+			 * @brief Метод взведения опроса файлового дескриптора
+			 *
+			 * @param sock     файловый дескриптор для опроса
+			 * @param interest интерес к файловому дескриптору
+			 * @return         результат работы функции
+			 */
+			bool arm(const SOCKET sock, interest_t & interest) noexcept;
+			/**
+			 * @brief Метод снятия опроса файлового дескриптора
+			 *
+			 * @param sock     файловый дескриптор опроса
+			 * @param interest интерес к файловому дескриптору
+			 * @return         результат работы функции
+			 */
+			bool disarm(const SOCKET sock, interest_t & interest) noexcept;
+		private:
+			/**
+			 * @brief Метод извлечения событий из очереди завершения
+			 *
+			 * @param events список для получения событий
+			 * @param max    максимальное количество событий
+			 * @return       количество полученных событий
+			 */
+			int32_t reap(struct epoll_event * events, const int32_t max) noexcept;
+			/**
+			 * @brief Метод отправки накопленных запросов и ожидания событий
+			 *
+			 * @param wait    минимальное количество ожидаемых событий
+			 * @param timeout время ожидания в миллисекундах
+			 * @return        результат работы функции
+			 */
+			int32_t enter(const uint32_t wait, const int32_t timeout) noexcept;
+			/**
+			 * @brief Метод отправки накопленных запросов во время ожидания событий потоком событий
+			 *
+			 * @return результат работы функции
+			 */
+			int32_t submit() noexcept;
+		public:
+			/**
+			 * @brief Метод проверки активности движка
+			 *
+			 * @return результат проверки
+			 */
+			bool active() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества выполненных системных вызовов
+			 *
+			 * @return количество системных вызовов
+			 */
+			uint64_t syscalls() const noexcept;
+		public:
+			/**
+			 * @brief Метод закрытия движка
+			 *
+			 */
+			void close() noexcept;
+			/**
+			 * @brief Метод инициализации движка
+			 *
+			 * @param entries размер очереди отправки
+			 * @return        результат инициализации (false если ядро не поддерживает io_uring)
+			 */
+			bool init(const uint32_t entries = AWH_URING_ENTRIES) noexcept;
+		public:
+			/**
+			 * @brief Метод изменения интереса к файловому дескриптору (аналог epoll_ctl)
+			 *
+			 * @param op    операция EPOLL_CTL_ADD, EPOLL_CTL_MOD или EPOLL_CTL_DEL
+			 * @param sock  файловый дескриптор
+			 * @param event параметры события
+			 * @return      0 при успешном выполнении или -1 при ошибке
+			 */
+			int32_t ctl(const int32_t op, const SOCKET sock, struct epoll_event * event) noexcept;
+			/**
+			 * @brief Метод ожидания событий (аналог epoll_wait)
+			 *
+			 * @param events  список для получения событий
+			 * @param max     максимальное количество событий
+			 * @param timeout время ожидания в миллисекундах
+			 * @return        количество полученных событий или -1 при ошибке
+			 */
+			int32_t wait(struct epoll_event * events, const int32_t max, const int32_t timeout) noexcept;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param log объект для работы с логами
+			 */
+			URing(const log_t * log) noexcept :
+			 _fd(INVALID_SOCKET), _waiting(false), _gen(0), _pending(0), _syscalls(0),
+			 _sq(nullptr), _cq(nullptr), _sqSize(0), _cqSize(0), _sqesSize(0),
+			 _sqHead(nullptr), _sqTail(nullptr), _sqMask(nullptr), _sqEntries(0),
+			 _cqHead(nullptr), _cqTail(nullptr), _cqMask(nullptr),
+			 _sqes(nullptr), _cqes(nullptr), _log(log) {}
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~URing() noexcept;
+	} uring_t;
+};
+
+#endif // __linux__ && AWH_IOURING
+
+#endif // __AWH_EVENT_URING__
@@ -15,12 +15,23 @@
 #ifndef __AWH_EVENT_WATCH__
 #define __AWH_EVENT_WATCH__
 
+/**
+ * Для операционной системы Linux
+ */
+#if __linux__
+	/**
+	 * Подключаем системные заголовки
+	 */
+	#include <sys/timerfd.h>
+#endif
+
 /**
  * Стандартные модули
  */
 #include <set>
 #include <map>
 #include <mutex>
+#include <vector>
 
 /**
  * Наши модули
@@ -28,6 +39,31 @@
 #include "notifier.hpp"
 #include "../sys/screen.hpp"
 
+/**
+ * Если количество слотов колеса таймеров не передано
+ */
+#ifndef AWH_WATCH_SLOTS
+	/**
+	 * Устанавливаем количество слотов колеса таймеров 4096
+	 */
+	#define AWH_WATCH_SLOTS 0x1000
+#endif
+
+/**
+ * Если разрешение колеса таймеров не передано
+ */
+#ifndef AWH_WATCH_RESOLUTION
+	/**
+	 * Устанавливаем разрешение колеса таймеров в микросекундах
+	 */
+	#define AWH_WATCH_RESOLUTION 1000
+#endif
+
+/**
+ * Устанавливаем начальное значение идентификаторов таймеров (за пределами допустимых файловых дескрипторов)
+ */
+#define AWH_WATCH_TIMER_ID 0x40000000
+
 /**
  * @brief пространство имён
  *
@@ -44,31 +80,95 @@ namespace awh {
 	typedef class AWHSHARED_EXPORT Watch {
 		private:
 			/**
-			 * @brief структура участника обмена данными
-			 *
+			 * Для операционной системы Linux
 			 */
-			typedef struct Unit {
-				// Файловый дескрипторв (сокет)
-				SOCKET sock;
-				// Время задержки работы таймера
-				uint64_t delay;
+			#if __linux__
 				/**
-				 * @brief Конструктор
+				 * @brief структура таймера колеса
 				 *
 				 */
-				Unit() noexcept : sock(INVALID_SOCKET), delay(0) {}
-			} __attribute__((packed)) unit_t;
+				typedef struct Unit {
+					// Флаг занятого таймера
+					bool used;
+					// Флаг взведённого таймера
+					bool armed;
+					// Предыдущий таймер в слоте колеса
+					uint32_t prev;
+					// Следующий таймер в слоте колеса
+					uint32_t next;
+					// Номер тика срабатывания таймера
+					uint64_t target;
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Unit() noexcept :
+					 used(false), armed(false),
+					 prev(UINT32_MAX), next(UINT32_MAX), target(0) {}
+				} unit_t;
+			/**
+			 * Для всех остальных операционных систем
+			 */
+			#else
+				/**
+				 * @brief структура участника обмена данными
+				 *
+				 */
+				typedef struct Unit {
+					// Файловый дескрипторв (сокет)
+					SOCKET sock;
+					// Время задержки работы таймера
+					uint64_t delay;
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Unit() noexcept : sock(INVALID_SOCKET), delay(0) {}
+				} __attribute__((packed)) unit_t;
+			#endif
 		private:
 			// Мютекс для блокировки потока
 			std::mutex _mtx;
 		private:
-			// Объект экрана для работы в дочернем потоке
-			screen_t <unit_t> _screen;
-		private:
-			// Список существующих уведомителей
-			std::map <SOCKET, std::unique_ptr <notifier_t>> _notifiers;
-			// Список активных таймеров
-			std::multimap <std::pair <uint64_t, uint64_t>, SOCKET> _timers;
+			/**
+			 * Для операционной системы Linux
+			 */
+			#if __linux__
+				// Файловый дескриптор часов колеса таймеров
+				SOCKET _fd;
+			private:
+				// Количество взведённых таймеров
+				size_t _count;
+			private:
+				// Текущий тик колеса таймеров
+				uint64_t _tick;
+				// Время текущего тика в наносекундах
+				uint64_t _last;
+				// Тик на который взведены часы
+				uint64_t _deadline;
+				// Разрешение колеса таймеров в наносекундах
+				uint64_t _resolution;
+			private:
+				// Список таймеров колеса
+				vector <unit_t> _units;
+				// Список освобождённых таймеров
+				vector <uint32_t> _free;
+				// Список первых таймеров в слотах колеса
+				vector <uint32_t> _slots;
+				// Битовая карта занятых слотов колеса
+				vector <uint64_t> _bits;
+			/**
+			 * Для всех остальных операционных систем
+			 */
+			#else
+				// Объект экрана для работы в дочернем потоке
+				screen_t <unit_t> _screen;
+			private:
+				// Список существующих уведомителей
+				std::map <SOCKET, std::unique_ptr <notifier_t>> _notifiers;
+				// Список активных таймеров
+				std::multimap <std::pair <uint64_t, uint64_t>, SOCKET> _timers;
+			#endif
 		private:
 			// Объект фреймворка
 			const fmk_t * _fmk;
@@ -76,16 +176,58 @@ namespace awh {
 			const log_t * _log;
 		private:
 			/**
-			 * @brief Метод обработки событий триггера
-			 *
+			 * Для операционной системы Linux
 			 */
-			void trigger() noexcept;
+			#if __linux__
+				/**
+				 * @brief Метод получения монотонного времени в наносекундах
+				 *
+				 * @return текущее монотонное время
+				 */
+				uint64_t now() const noexcept;
+			private:
+				/**
+				 * @brief Метод привязки таймера к слоту колеса
+				 *
+				 * @param index индекс таймера
+				 */
+				void link(const uint32_t index) noexcept;
+				/**
+				 * @brief Метод отвязки таймера от слота колеса
+				 *
+				 * @param index индекс таймера
+				 */
+				void unlink(const uint32_t index) noexcept;
+			private:
+				/**
+				 * @brief Метод извлечения сработавших таймеров слота
+				 *
+				 * @param slot   номер слота колеса
+				 * @param timers список сработавших таймеров
+				 */
+				void sweep(const size_t slot, vector <SOCKET> & timers) noexcept;
+			private:
+				/**
+				 * @brief Метод взведения часов на ближайший занятый слот колеса
+				 *
+				 */
+				void schedule() noexcept;
 			/**
-			 * @brief Метод обработки процесса добавления таймеров
-			 *
-			 * @param unit параметры участника
+			 * Для всех остальных операционных систем
 			 */
-			void process(const unit_t unit) noexcept;
+			#else
+				/**
+				 * @brief Метод обработки событий триггера
+				 *
+				 */
+				void trigger() noexcept;
+				/**
+				 * @brief Метод обработки процесса добавления таймеров
+				 *
+				 * @param unit параметры участника
+				 */
+				void process(const unit_t unit) noexcept;
+			#endif
 		public:
 			/**
 			 * @brief Метод остановки работы таймера
@@ -112,6 +254,30 @@ namespace awh {
 			 * @return     идентификатор события
 			 */
 			uint64_t event(const SOCKET sock) noexcept;
+		public:
+			/**
+			 * Для операционной системы Linux
+			 */
+			#if __linux__
+				/**
+				 * @brief Метод получения файлового дескриптора часов колеса таймеров
+				 *
+				 * @return файловый дескриптор часов
+				 */
+				SOCKET fd() const noexcept;
+				/**
+				 * @brief Метод извлечения сработавших таймеров
+				 *
+				 * @param timers список сработавших таймеров
+				 */
+				void expired(vector <SOCKET> & timers) noexcept;
+				/**
+				 * @brief Метод установки разрешения колеса таймеров
+				 *
+				 * @param usec разрешение колеса в микросекундах
+				 */
+				void resolution(const uint32_t usec) noexcept;
+			#endif
 		public:
 			/**
 			 * @brief Метод убрать таймер из отслеживания
@@ -119,6 +285,12 @@ namespace awh {
 			 * @param sock файловый дескриптор таймера
 			 */
 			void away(const SOCKET sock) noexcept;
+			/**
+			 * @brief Метод отмены ожидания таймера без его удаления
+			 *
+			 * @param sock файловый дескриптор таймера
+			 */
+			void cancel(const SOCKET sock) noexcept;
 			/**
 			 * @brief Метод ожидания указанного промежутка времени
 			 *
@@ -253,6 +253,14 @@ namespace awh {
 			 * @param web    объект HTTP-парсера
 			 */
 			void chunking(const uint64_t id, const vector <char> & buffer, const web_t * web) noexcept;
+		private:
+			/**
+			 * @brief Метод формирования даты в формате IMF-fixdate (RFC 9110)
+			 *
+			 * @param date   дата в формате UnixTimestamp (в секундах)
+			 * @param result строка для записи сформированной даты
+			 */
+			void fixdate(const time_t date, string & result) const noexcept;
 		protected:
 			/**
 			 * @brief Метод выполнения шифрования полезной нагрузки
@@ -552,6 +560,8 @@ namespace awh {
 			/**
 			 * @brief Метод получения текущей даты для HTTP-запроса
 			 *
+			 * Текущая дата формируется не чаще одного раза в секунду и кэшируется для каждого потока
+			 *
 			 * @param date дата в формате UnixTimestamp
 			 * @return     штамп времени в текстовом виде
 			 */
@@ -19,6 +19,7 @@
  * Стандартные модули
  */
 #include <map>
+#include <set>
 #include <cmath>
 #include <queue>
 #include <string>
@@ -47,6 +48,7 @@
 #include "errors.hpp"
 #include "../sys/fmk.hpp"
 #include "../sys/log.hpp"
+#include "../sys/chain.hpp"
 #include "../sys/buffer.hpp"
 #include "../sys/callback.hpp"
 #include "../net/socket.hpp"
@@ -129,7 +131,8 @@ namespace awh {
 				PAYLOAD_SIZE      = 0x06, // Максимальный размер буфера полезной нагурзки
 				ENABLE_ALTSVC     = 0x07, // Разрешение передавать расширения ALTSVC
 				ENABLE_ORIGIN     = 0x08, // Разрешение передавать расширение ORIGIN
-				HEADER_TABLE_SIZE = 0x09  // Максимальный размер таблицы заголовков
+				HEADER_TABLE_SIZE = 0x09, // Максимальный размер таблицы заголовков
+				WINDOW_LIMIT      = 0x0A  // Максимальный размер окна при автоматической подстройке по BDP
 			};
 			/**
 			 * Флаги ошибок протокола HTTP/2
@@ -150,6 +153,41 @@ namespace awh {
 				FLOW_CONTROL_ERROR  = 0x0C, // Ошибка превышения предела управления потоком
 				INADEQUATE_SECURITY = 0x0D  // Согласованные параметры SSL не приемлемы
 			};
+		public:
+			/**
+			 * @brief Структура приоритета потока (RFC 9218)
+			 *
+			 */
+			typedef struct Priority {
+				bool fixed;       // Флаг запрета изменения приоритета клиентом
+				bool incremental; // Флаг инкрементальной обработки ответа
+				uint8_t urgency;  // Срочность ответа от 0 (наивысшая) до 7 (низшая)
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Priority() noexcept :
+				 fixed(false), incremental(false),
+				 urgency(NGHTTP2_EXTPRI_DEFAULT_URGENCY) {}
+			} priority_t;
+			/**
+			 * @brief Структура состояния управления потоком сессии
+			 *
+			 */
+			typedef struct Flow {
+				uint32_t rtt;    // Время приёма-передачи в микросекундах
+				uint32_t bdp;    // Оценка произведения пропускной способности на задержку
+				uint32_t limit;  // Максимальный размер окна при автоматической подстройке
+				uint32_t window; // Текущий размер окна подключения
+				uint32_t stream; // Текущий размер окна потоков
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Flow() noexcept :
+				 rtt(0), bdp(0), limit(0),
+				 window(0), stream(0) {}
+			} flow_t;
 		public:
 			/**
 			 * Количество потоков по умолчанию
@@ -175,6 +213,14 @@ namespace awh {
 			 * Максимальный размер фрейма по умолчанию
 			 */
 			static constexpr uint32_t MAX_FRAME_SIZE_MAX = 0xFFFFFF;
+			/**
+			 * Размер заголовка фрейма
+			 */
+			static constexpr uint32_t FRAME_HEADER_SIZE = 0x09;
+			/**
+			 * Объём данных в очереди отправки, после которого планировщик приостанавливает выдачу фреймов данных
+			 */
+			static constexpr uint32_t SEND_WATERMARK = 0x10000;
 		private:
 			/**
 			 * Событие обмена данными
@@ -193,6 +239,24 @@ namespace awh {
 				SEND_TRAILERS = 0x0A, // Событие отправки трейлеров
 				SEND_SHUTDOWN = 0x0B  // Событие отправки сообщения о завершении работы
 			};
+			/**
+			 * @brief Структура замера задержки пингом
+			 *
+			 */
+			typedef struct Probe {
+				bool wait;       // Флаг ожидания ответа на пинг
+				uint64_t stamp;  // Время отправки пинга в микросекундах
+				uint64_t bytes;  // Количество байт полученных с момента отправки пинга
+				uint32_t window; // Начальный размер окна подключения
+				uint32_t stream; // Начальный размер окна потоков
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Probe() noexcept :
+				 wait(false), stamp(0), bytes(0),
+				 window(0), stream(0) {}
+			} probe_t;
 		private:
 			// Флаг требования закрыть подключение
 			bool _close;
@@ -215,9 +279,19 @@ namespace awh {
 			std::unordered_multimap <string, string> _altsvc;
 		private:
 			// Буферы отправляемой полезной нагрузки
-			std::map <int32_t, std::unique_ptr <buffer_t>> _payloads;
+			std::map <int32_t, std::unique_ptr <chain_t>> _payloads;
 			// Список подготовленных для отправки записей
 			std::map <int32_t, std::queue <std::pair <size_t, flag_t>>> _records;
+		private:
+			// Последний обслуженный инкрементальный поток
+			int32_t _turn;
+			// Список приоритетов потоков
+			std::map <int32_t, priority_t> _priorities;
+		private:
+			// Состояние управления потоком
+			flow_t _flow;
+			// Параметры замера задержки
+			probe_t _probe;
 		private:
 			// Ессия HTTP/2 подключения
 			nghttp2_session * _session;
@@ -342,6 +416,18 @@ namespace awh {
 			 * @return        количество отправленных байт
 			 */
 			static ssize_t send(nghttp2_session * session, const int32_t sid, uint8_t * buffer, const size_t size, uint32_t * flags, nghttp2_data_source * source, void * ctx) noexcept;
+			/**
+			 * @brief Функция отправки фрейма данных без копирования полезной нагрузки в буфер NgHttp2
+			 *
+			 * @param session объект сессии
+			 * @param frame   объект фрейма данных
+			 * @param head    заголовок фрейма
+			 * @param size    размер полезной нагрузки фрейма
+			 * @param source  объект промежуточных данных локального подключения
+			 * @param ctx     передаваемый промежуточный контекст
+			 * @return        статус полученного события
+			 */
+			static int32_t send(nghttp2_session * session, nghttp2_frame * frame, const uint8_t * head, const size_t size, nghttp2_data_source * source, void * ctx) noexcept;
 		private:
 			/**
 			 * @brief Метод проверки сколько байт доступно для отправки
@@ -350,6 +436,22 @@ namespace awh {
 			 * @return    количество байт доступных для отправки
 			 */
 			size_t available(const int32_t sid) const noexcept;
+		private:
+			/**
+			 * @brief Метод извлечения приоритета из значения заголовка Priority
+			 *
+			 * @param buffer буфер значения заголовка
+			 * @param size   размер значения заголовка
+			 * @return       полученный приоритет потока
+			 */
+			priority_t parse(const char * buffer, const size_t size) const noexcept;
+			/**
+			 * @brief Метод выбора потока, данные которого следует отправить следующими
+			 *
+			 * @param skip список потоков исключённых из выбора
+			 * @return     идентификатор выбранного потока
+			 */
+			int32_t next(const std::set <int32_t> & skip) const noexcept;
 		private:
 			/**
 			 * @brief Метод применения изменений
@@ -383,6 +485,19 @@ namespace awh {
 			 * @return     результат установки размера офна фрейма
 			 */
 			bool windowUpdate(const int32_t sid, const int32_t size) noexcept;
+		private:
+			/**
+			 * @brief Метод учёта полученных данных и отправки пинга замера задержки
+			 *
+			 * @param size размер полученных данных
+			 */
+			void probe(const size_t size) noexcept;
+			/**
+			 * @brief Метод подстройки размеров окон по результатам замера задержки
+			 *
+			 * @param data данные полученного ответа на пинг
+			 */
+			void tune(const uint8_t * data) noexcept;
 		public:
 			/**
 			 * @brief Метод выполнения пинга
@@ -390,6 +505,21 @@ namespace awh {
 			 * @return результат работы пинга
 			 */
 			bool ping() noexcept;
+		public:
+			/**
+			 * @brief Метод получения состояния управления потоком сессии
+			 *
+			 * @return состояние управления потоком
+			 */
+			flow_t flow() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества байт ожидающих отправки в потоке
+			 *
+			 * @param sid идентификатор потока
+			 * @return    количество байт полезной нагрузки в очереди потока
+			 */
+			size_t pending(const int32_t sid) const noexcept;
 		public:
 			/**
 			 * @brief Метод запрещения получения данных с клиента
@@ -446,6 +576,40 @@ namespace awh {
 			 * @return       результат отправки данных фрейма
 			 */
 			bool sendData(const int32_t id, const uint8_t * buffer, const size_t size, const flag_t flag) noexcept;
+			/**
+			 * @brief Метод отправки бинарных данных без копирования
+			 *
+			 * @param id     идентификатор потока
+			 * @param buffer буфер бинарных данных передаваемых
+			 * @param size   размер передаваемых данных в байтах
+			 * @param owner  владелец буфера, удерживающий данные до их отправки
+			 * @param flag   флаг передаваемого потока по сети
+			 * @return       результат отправки данных фрейма
+			 */
+			bool sendData(const int32_t id, const uint8_t * buffer, const size_t size, const std::shared_ptr <const void> & owner, const flag_t flag) noexcept;
+		public:
+			/**
+			 * @brief Метод отправки подготовленных записей в порядке приоритетов потоков
+			 *
+			 * @return результат отправки данных
+			 */
+			bool dispatch() noexcept;
+		public:
+			/**
+			 * @brief Метод получения приоритета потока
+			 *
+			 * @param sid идентификатор потока
+			 * @return    приоритет потока
+			 */
+			priority_t priority(const int32_t sid) const noexcept;
+			/**
+			 * @brief Метод установки приоритета потока
+			 *
+			 * @param sid         идентификатор потока
+			 * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+			 * @param incremental флаг инкрементальной обработки ответа
+			 */
+			void priority(const int32_t sid, const uint8_t urgency, const bool incremental) noexcept;
 		public:
 			/**
 			 * @brief Метод отправки push-уведомлений
@@ -648,7 +812,7 @@ namespace awh {
 			 */
 			Http2(const fmk_t * fmk, const log_t * log) noexcept :
 			 _close(false), _mode(mode_t::NONE), _event(event_t::NONE),
-			 _socket(fmk, log), _callback(log), _session(nullptr), _fmk(fmk), _log(log) {}
+			 _socket(fmk, log), _callback(log), _turn(0), _session(nullptr), _fmk(fmk), _log(log) {}
 			/**
 			 * @brief Деструктор
 			 *
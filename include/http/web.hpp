@@ -58,6 +58,66 @@ namespace awh {
 				CLIENT = 0x01, // HTTP-модуль является клиентом
 				SERVER = 0x02  // HTTP-модуль является сервером
 			};
+			/**
+			 * Идентификаторы известных заголовков
+			 */
+			enum class header_t : uint8_t {
+				NONE                     = 0x00, // Заголовок не является известным
+				TE                       = 0x01, // Заголовок te
+				AGE                      = 0x02, // Заголовок age
+				VIA                      = 0x03, // Заголовок via
+				DNT                      = 0x04, // Заголовок dnt
+				DATE                     = 0x05, // Заголовок date
+				HOST                     = 0x06, // Заголовок host
+				ETAG                     = 0x07, // Заголовок etag
+				LINK                     = 0x08, // Заголовок link
+				VARY                     = 0x09, // Заголовок vary
+				FROM                     = 0x0A, // Заголовок from
+				RANGE                    = 0x0B, // Заголовок range
+				ALLOW                    = 0x0C, // Заголовок allow
+				ACCEPT                   = 0x0D, // Заголовок accept
+				COOKIE                   = 0x0E, // Заголовок cookie
+				ORIGIN                   = 0x0F, // Заголовок origin
+				SERVER                   = 0x10, // Заголовок server
+				PRAGMA                   = 0x11, // Заголовок pragma
+				EXPECT                   = 0x12, // Заголовок expect
+				EXPIRES                  = 0x13, // Заголовок expires
+				REFERER                  = 0x14, // Заголовок referer
+				TRAILER                  = 0x15, // Заголовок trailer
+				UPGRADE                  = 0x16, // Заголовок upgrade
+				LOCATION                 = 0x17, // Заголовок location
+				KEEP_ALIVE               = 0x18, // Заголовок keep-alive
+				USER_AGENT               = 0x19, // Заголовок user-agent
+				SET_COOKIE               = 0x1A, // Заголовок set-cookie
+				CONNECTION               = 0x1B, // Заголовок connection
+				RETRY_AFTER              = 0x1C, // Заголовок retry-after
+				CONTENT_TYPE             = 0x1D, // Заголовок content-type
+				X_POWERED_BY             = 0x1E, // Заголовок x-powered-by
+				CACHE_CONTROL            = 0x1F, // Заголовок cache-control
+				LAST_MODIFIED            = 0x20, // Заголовок last-modified
+				AUTHORIZATION            = 0x21, // Заголовок authorization
+				ACCEPT_RANGES            = 0x22, // Заголовок accept-ranges
+				IF_NONE_MATCH            = 0x23, // Заголовок if-none-match
+				CONTENT_RANGE            = 0x24, // Заголовок content-range
+				CONTENT_LENGTH           = 0x25, // Заголовок content-length
+				ACCEPT_CHARSET           = 0x26, // Заголовок accept-charset
+				HTTP2_SETTINGS           = 0x27, // Заголовок http2-settings
+				ACCEPT_ENCODING          = 0x28, // Заголовок accept-encoding
+				ACCEPT_LANGUAGE          = 0x29, // Заголовок accept-language
+				CONTENT_ENCODING         = 0x2A, // Заголовок content-encoding
+				PROXY_CONNECTION         = 0x2B, // Заголовок proxy-connection
+				WWW_AUTHENTICATE         = 0x2C, // Заголовок www-authenticate
+				X_AWH_ENCRYPTION         = 0x2D, // Заголовок x-awh-encryption
+				IF_MODIFIED_SINCE        = 0x2E, // Заголовок if-modified-since
+				TRANSFER_ENCODING        = 0x2F, // Заголовок transfer-encoding
+				SEC_WEBSOCKET_KEY        = 0x30, // Заголовок sec-websocket-key
+				PROXY_AUTHENTICATE       = 0x31, // Заголовок proxy-authenticate
+				SEC_WEBSOCKET_ACCEPT     = 0x32, // Заголовок sec-websocket-accept
+				PROXY_AUTHORIZATION      = 0x33, // Заголовок proxy-authorization
+				SEC_WEBSOCKET_VERSION    = 0x34, // Заголовок sec-websocket-version
+				SEC_WEBSOCKET_PROTOCOL   = 0x35, // Заголовок sec-websocket-protocol
+				SEC_WEBSOCKET_EXTENSIONS = 0x36  // Заголовок sec-websocket-extensions
+			};
 			/**
 			 * Версии протоколов соответствия
 			 */
@@ -403,6 +463,8 @@ namespace awh {
 			std::unordered_set <string> _trailers;
 			// Полученные HTTP заголовки
 			std::unordered_multimap <string, string> _headers;
+			// Битовая маска присутствующих известных заголовков
+			uint64_t _known;
 			// Список стандартных заголовков
 			std::unordered_map <string, std::set <proto_t>> _standardHeaders;
 		private:
@@ -427,6 +489,26 @@ namespace awh {
 			 * @return       размер обработанных данных
 			 */
 			size_t readHeaders(const char * buffer, const size_t size) noexcept;
+		private:
+			/**
+			 * @brief Метод пометки известного заголовка как присутствующего
+			 *
+			 * @param key ключ заголовка
+			 */
+			void known(const string & key) noexcept;
+		private:
+			/**
+			 * @brief Метод поиска символа в буфере данных
+			 *
+			 * Поиск выполняется блоками по 32 байта (AVX2) или по 16 байт (SSE2),
+			 * при отсутствии векторных инструкций используется системный memchr
+			 *
+			 * @param buffer буфер данных для поиска
+			 * @param size   размер буфера данных для поиска
+			 * @param letter искомый символ
+			 * @return       указатель на найденный символ или nullptr
+			 */
+			const char * seek(const char * buffer, const size_t size, const char letter) const noexcept;
 		private:
 			/**
 			 * @brief Метод препарирования HTTP заголовков
@@ -528,6 +610,32 @@ namespace awh {
 			 * @return    результат проверки
 			 */
 			bool isStandard(const string & key) const noexcept;
+		public:
+			/**
+			 * @brief Метод получения идентификатора известного заголовка
+			 *
+			 * @param key ключ заголовка
+			 * @return    идентификатор заголовка
+			 */
+			header_t intern(const string & key) const noexcept;
+			/**
+			 * @brief Метод получения идентификатора известного заголовка
+			 *
+			 * Идентификатор определяется без копирования и приведения ключа к нижнему регистру:
+			 * кандидат выбирается по длине названия и одному символу, затем сверяется полностью
+			 *
+			 * @param key  ключ заголовка
+			 * @param size размер ключа заголовка
+			 * @return     идентификатор заголовка
+			 */
+			header_t intern(const char * key, const size_t size) const noexcept;
+			/**
+			 * @brief Метод получения названия известного заголовка
+			 *
+			 * @param header идентификатор заголовка
+			 * @return       название заголовка в нижнем регистре
+			 */
+			const string & name(const header_t header) const noexcept;
 		public:
 			/**
 			 * @brief Метод очистки данных тела
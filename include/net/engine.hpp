@@ -36,6 +36,10 @@
 /**
  * Стандартные модули
  */
+#include <map>
+#include <new>
+#include <mutex>
+#include <atomic>
 #include <random>
 #include <thread>
 #include <cstdio>
@@ -51,6 +55,9 @@
  */
 #if !_WIN32 && !_WIN64
 	#include <sys/un.h>
+	#include <sys/uio.h>
+	#include <pthread.h>
+	#include <sys/mman.h>
 #endif
 
 /**
@@ -62,6 +69,7 @@
 #include "../sys/fs.hpp"
 #include "../sys/fmk.hpp"
 #include "../sys/log.hpp"
+#include "../sys/chain.hpp"
 
 /**
  * Подключаем OpenSSL
@@ -72,6 +80,18 @@
 #include <openssl/rand.h>
 #include <openssl/x509v3.h>
 
+/**
+ * Если версия OpenSSL соответствует или выше версии 3.0.0
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	#include <openssl/core_names.h>
+/**
+ * Если версия OpenSSL ниже версии 3.0.0
+ */
+#else
+	#include <openssl/hmac.h>
+#endif
+
 /**
  * @brief пространство имён
  *
@@ -189,9 +209,21 @@ namespace awh {
 					bool _async;
 					// Флаг инициализации шифрования
 					bool _encrypted;
+				private:
+					// Сокет которому принадлежат закэшированные параметры
+					SOCKET _cached;
+					// Установленный таймаут на чтение в миллисекундах
+					uint32_t _rtimeout;
+					// Установленный таймаут на запись в миллисекундах
+					uint32_t _wtimeout;
+					// Размер буфера сокета на запись
+					int32_t _wbuffer;
 				public:
 					// Статус подключения
 					status_t status;
+				public:
+					// Флаг разделения порта между несколькими слушающими сокетами
+					bool reuseport;
 				public:
 					// Порт клиента
 					uint32_t port;
@@ -244,6 +276,11 @@ namespace awh {
 					 *
 					 */
 					void client() noexcept;
+					/**
+					 * @brief Метод настройки параметров принятого подключения
+					 *
+					 */
+					void prepare() noexcept;
 				public:
 					/**
 					 * @brief Метод активации прослушивания сокета
@@ -295,6 +332,13 @@ namespace awh {
 					 * @return       результат выполнения операции
 					 */
 					bool accept(const SOCKET sock, const int32_t family) noexcept;
+					/**
+					 * @brief Метод согласования подключения принятого другим процессом
+					 *
+					 * @param sock сетевой сокет принятого подключения
+					 * @return     результат выполнения операции
+					 */
+					bool adopt(const SOCKET sock) noexcept;
 				public:
 					/**
 					 * @brief Метод установки параметров сокета
@@ -331,8 +375,9 @@ namespace awh {
 					 */
 					Address(const fmk_t * fmk, const log_t * log) noexcept :
 					 sock(INVALID_SOCKET), _type(SOCK_STREAM), _protocol(IPPROTO_TCP),
-					 _async(false), _encrypted(false), status(status_t::DISCONNECTED),
-					 port(0), ip{""}, mac{""}, _fs(fmk, log), _ifnet(fmk, log),
+					 _async(false), _encrypted(false), _cached(INVALID_SOCKET),
+					 _rtimeout(UINT32_MAX), _wtimeout(UINT32_MAX), _wbuffer(0), status(status_t::DISCONNECTED),
+					 reuseport(false), port(0), ip{""}, mac{""}, _fs(fmk, log), _ifnet(fmk, log),
 					 _socket(fmk, log), _bio(nullptr), _fmk(fmk), _log(log) {}
 					/**
 					 * @brief Деструктор
@@ -377,6 +422,84 @@ namespace awh {
 				 */
 				Verify(const string & host = "", const Engine * engine = nullptr) noexcept : host{host}, engine(engine) {}
 			} verify_t;
+			/**
+			 * @brief Структура ячейки общего кэша сессий TLS
+			 *
+			 */
+			typedef struct Session {
+				/**
+				 * Если операционной системой является Linux или FreeBSD
+				 */
+				#if __linux__ || __FreeBSD__
+					// Межпроцессный мютекс ячейки, освобождается при завершении процесса-владельца
+					pthread_mutex_t mtx;
+				/**
+				 * Для остальных операционных систем
+				 */
+				#else
+					// Флаг блокировки ячейки
+					std::atomic_flag lock;
+				#endif
+				// Время жизни сессии
+				time_t expires;
+				// Размер идентификатора сессии
+				uint32_t id;
+				// Размер сериализованной сессии
+				uint32_t size;
+				// Идентификатор сессии
+				uint8_t sid[SSL_MAX_SSL_SESSION_ID_LENGTH];
+				// Данные сериализованной сессии
+				uint8_t data[AWH_TLS_SESSION_SIZE];
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Session() noexcept;
+			} session_t;
+			/**
+			 * @brief Структура общего хранилища сессий TLS (размещается в разделяемой памяти и доступна всем процессам кластера)
+			 *
+			 */
+			typedef struct Storage {
+				// Идентификатор процесса создавшего хранилище
+				pid_t pid;
+				// Секретный ключ для генерации ключей сессионных билетов
+				uint8_t secret[32];
+				// Количество возобновлённых сессий
+				std::atomic <uint64_t> hits;
+				// Количество полных рукопожатий
+				std::atomic <uint64_t> misses;
+				// Ячейки кэша сессий
+				session_t sessions[AWH_TLS_SESSIONS];
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Storage() noexcept : pid(0), secret{0}, hits{0}, misses{0} {}
+			} storage_t;
+			/**
+			 * Типы подготавливаемых контекстов SSL
+			 */
+			enum class prepare_t : uint8_t {
+				NONE    = 0x00, // Тип контекста не установлен
+				SERVER  = 0x01, // Контекст сервера принимающего подключения
+				CLIENT  = 0x02, // Контекст клиента подключающегося к хосту
+				GENERIC = 0x03  // Контекст клиента/сервера для произвольного типа сокета
+			};
+		public:
+			/**
+			 * @brief Структура статистики возобновления сессий TLS
+			 *
+			 */
+			typedef struct Resumption {
+				uint64_t hits;   // Количество возобновлённых сессий
+				uint64_t misses; // Количество полных рукопожатий
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Resumption() noexcept : hits(0), misses(0) {}
+			} resumption_t;
 		public:
 			/**
 			 * @brief Класс контекста двигателя
@@ -400,6 +523,9 @@ namespace awh {
 				private:
 					// Протокол подключения
 					proto_t _proto;
+				private:
+					// Хост удалённого сервера
+					string _host;
 				private:
 					BIO * _bio;     // Объект BIO
 					SSL * _ssl;     // Объект SSL
@@ -446,6 +572,13 @@ namespace awh {
 					 * @param crl CRL-файл сертификат
 					 */
 					void crl(const X509_CRL * crl) noexcept;
+				public:
+					/**
+					 * @brief Метод получения хоста удалённого сервера
+					 *
+					 * @return хост удалённого сервера
+					 */
+					const string & host() const noexcept;
 				public:
 					/**
 					 * @brief Метод чтения данных из сокета
@@ -463,6 +596,14 @@ namespace awh {
 					 * @return       количество записанных байт
 					 */
 					int64_t write(const char * buffer, const size_t size) noexcept;
+					/**
+					 * @brief Метод векторной записи данных в сокет
+					 *
+					 * @param records список записей данных для записи
+					 * @param count   количество записей в списке
+					 * @return        количество записанных байт
+					 */
+					int64_t write(const chain_t::record_t * records, const size_t count) noexcept;
 				public:
 					/**
 					 * @brief Метод проверки на то, является ли сокет заблокированным
@@ -560,7 +701,7 @@ namespace awh {
 					 */
 					Context(const fmk_t * fmk, const log_t * log) noexcept :
 					 _verb(false), _encrypted(false),
-					 _type(type_t::NONE), _proto(proto_t::RAW),
+					 _type(type_t::NONE), _proto(proto_t::RAW), _host{""},
 					 _bio(nullptr), _ssl(nullptr), _ctx(nullptr),
 					 _addr(nullptr), _verify(nullptr), _fmk(fmk), _log(log), _crl(nullptr) {}
 					/**
@@ -583,6 +724,24 @@ namespace awh {
 		private:
 			// Флаг проверки сертификата доменного имени
 			bool _verify;
+			// Флаг разрешения шифрования на уровне ядра (kTLS)
+			bool _ktls;
+		private:
+			// Время жизни сессии TLS в секундах
+			uint32_t _lifetime;
+		private:
+			// Минимальная версия протокола TLS
+			int32_t _minVersion;
+			// Максимальная версия протокола TLS
+			int32_t _maxVersion;
+		private:
+			// Общее хранилище сессий TLS (создаётся при первом включении кэширования сессий сервером)
+			storage_t * _storage;
+		private:
+			// Количество возобновлённых сессий без общего хранилища
+			mutable std::atomic <uint64_t> _hits;
+			// Количество полных рукопожатий без общего хранилища
+			mutable std::atomic <uint64_t> _misses;
 		private:
 			// Объект работы с файловой системой
 			fs_t _fs;
@@ -592,6 +751,12 @@ namespace awh {
 		private:
 			// Объект файлов сертификатов
 			mutable cert_t _cert;
+		private:
+			// Мютекс для блокировки основного потока
+			std::recursive_mutex _mtx;
+		private:
+			// Список подготовленных контекстов SSL
+			std::map <string, SSL_CTX *> _contexts;
 		private:
 			// Флаг инициализации куков
 			static bool _cookieInit;
@@ -755,6 +920,75 @@ namespace awh {
 			 * @return       результат проверки
 			 */
 			static int32_t verifyStatelessCookie(SSL * ssl, const uint8_t * cookie, size_t size) noexcept;
+		private:
+			/**
+			 * @brief Функция обратного вызова сохранения новой сессии в общий кэш
+			 *
+			 * @param ssl     объект SSL
+			 * @param session объект сессии SSL
+			 * @return        результат сохранения сессии
+			 */
+			static int32_t newSession(SSL * ssl, SSL_SESSION * session) noexcept;
+			/**
+			 * @brief Функция обратного вызова извлечения сессии из общего кэша
+			 *
+			 * @param ssl  объект SSL
+			 * @param id   идентификатор сессии
+			 * @param size размер идентификатора сессии
+			 * @param copy флаг увеличения счётчика ссылок сессии
+			 * @return     объект сессии SSL
+			 */
+			static SSL_SESSION * getSession(SSL * ssl, const uint8_t * id, int32_t size, int32_t * copy) noexcept;
+			/**
+			 * @brief Функция обратного вызова удаления сессии из общего кэша
+			 *
+			 * @param ctx     объект контекста SSL
+			 * @param session объект сессии SSL
+			 */
+			static void removeSession(SSL_CTX * ctx, SSL_SESSION * session) noexcept;
+		private:
+			/**
+			 * @brief Функция обратного вызова получения состояния подключения
+			 *
+			 * @param ssl   объект SSL
+			 * @param where место вызова функции
+			 * @param ret   код возврата
+			 */
+			static void handshake(const SSL * ssl, int32_t where, int32_t ret) noexcept;
+		private:
+			/**
+			 * Если версия OpenSSL соответствует или выше версии 3.0.0
+			 */
+			#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+				/**
+				 * @brief Функция обратного вызова шифрования сессионных билетов
+				 *
+				 * @param ssl  объект SSL
+				 * @param name название ключа билета
+				 * @param iv   вектор инициализации
+				 * @param ctx  контекст шифрования билета
+				 * @param hctx контекст подписи билета
+				 * @param enc  флаг шифрования билета
+				 * @return     результат работы функции
+				 */
+				static int32_t ticket(SSL * ssl, uint8_t * name, uint8_t * iv, EVP_CIPHER_CTX * ctx, EVP_MAC_CTX * hctx, int32_t enc) noexcept;
+			/**
+			 * Если версия OpenSSL ниже версии 3.0.0
+			 */
+			#else
+				/**
+				 * @brief Функция обратного вызова шифрования сессионных билетов
+				 *
+				 * @param ssl  объект SSL
+				 * @param name название ключа билета
+				 * @param iv   вектор инициализации
+				 * @param ctx  контекст шифрования билета
+				 * @param hctx контекст подписи билета
+				 * @param enc  флаг шифрования билета
+				 * @return     результат работы функции
+				 */
+				static int32_t ticket(SSL * ssl, uint8_t * name, uint8_t * iv, EVP_CIPHER_CTX * ctx, HMAC_CTX * hctx, int32_t enc) noexcept;
+			#endif
 		private:
 			/**
 			 * @brief Метод проверки доменного имени по данным из сертификата
@@ -796,6 +1030,113 @@ namespace awh {
 			 * @return    результат инициализации
 			 */
 			bool storeCRL(SSL_CTX * ctx) const noexcept;
+		private:
+			/**
+			 * @brief Метод получения общего хранилища сессий TLS (создаётся при первом обращении)
+			 *
+			 * @return общее хранилище сессий TLS
+			 */
+			storage_t * storage() const noexcept;
+			/**
+			 * @brief Метод инициализации общего кэша сессий и сессионных билетов
+			 *
+			 * @param ctx  объект контекста SSL
+			 * @param type тип активного приложения
+			 */
+			void sessions(SSL_CTX * ctx, const type_t type) const noexcept;
+			/**
+			 * @brief Метод генерации ключей сессионного билета для указанной эпохи
+			 *
+			 * @param epoch номер эпохи ротации ключей
+			 * @param name  название ключа билета (16 байт)
+			 * @param aes   ключ шифрования билета (32 байта)
+			 * @param hmac  ключ подписи билета (32 байта)
+			 * @return      результат генерации ключей
+			 */
+			bool ticketKey(const uint64_t epoch, uint8_t * name, uint8_t * aes, uint8_t * hmac) const noexcept;
+			/**
+			 * @brief Метод получения индекса ячейки кэша сессий
+			 *
+			 * @param id   идентификатор сессии
+			 * @param size размер идентификатора сессии
+			 * @return     индекс ячейки кэша сессий
+			 */
+			size_t index(const uint8_t * id, const uint32_t size) const noexcept;
+		private:
+			/**
+			 * @brief Функция блокировки ячейки общего кэша сессий
+			 *
+			 * @param cell ячейка кэша сессий
+			 * @return     результат блокировки ячейки
+			 */
+			static bool lock(session_t & cell) noexcept;
+			/**
+			 * @brief Функция разблокировки ячейки общего кэша сессий
+			 *
+			 * @param cell ячейка кэша сессий
+			 */
+			static void unlock(session_t & cell) noexcept;
+		private:
+			/**
+			 * @brief Метод установки функций обратного вызова выбора протокола
+			 *
+			 * @param ctx  объект контекста SSL
+			 * @param type тип активного приложения
+			 */
+			void alpn(SSL_CTX * ctx, const type_t type) const noexcept;
+		private:
+			/**
+			 * @brief Метод создания контекста SSL сервера принимающего подключения
+			 *
+			 * @param protocol протокол сокета (IPPROTO_TCP / IPPROTO_UDP / IPPROTO_SCTP)
+			 * @param proto    желаемый протокол подключения
+			 * @return         объект контекста SSL
+			 */
+			SSL_CTX * server(const int32_t protocol, const proto_t proto) noexcept;
+			/**
+			 * @brief Метод создания контекста SSL клиента подключающегося к хосту
+			 *
+			 * @param protocol протокол сокета (IPPROTO_TCP / IPPROTO_UDP / IPPROTO_SCTP)
+			 * @param proto    желаемый протокол подключения
+			 * @return         объект контекста SSL
+			 */
+			SSL_CTX * client(const int32_t protocol, const proto_t proto) noexcept;
+			/**
+			 * @brief Метод создания контекста SSL клиента/сервера для произвольного типа сокета
+			 *
+			 * @param type  тип активного приложения
+			 * @param sonet тип сокета (SOCK_STREAM / SOCK_DGRAM)
+			 * @param proto желаемый протокол подключения
+			 * @return      объект контекста SSL
+			 */
+			SSL_CTX * generic(const type_t type, const int32_t sonet, const proto_t proto) noexcept;
+		private:
+			/**
+			 * @brief Метод извлечения подготовленного контекста SSL
+			 *
+			 * @param prepare  тип подготавливаемого контекста
+			 * @param type     тип активного приложения
+			 * @param sonet    тип сокета (SOCK_STREAM / SOCK_DGRAM)
+			 * @param protocol протокол сокета (IPPROTO_TCP / IPPROTO_UDP / IPPROTO_SCTP)
+			 * @param proto    желаемый протокол подключения
+			 * @return         объект контекста SSL с увеличенным счётчиком ссылок
+			 */
+			SSL_CTX * prepare(const prepare_t prepare, const type_t type, const int32_t sonet, const int32_t protocol, const proto_t proto) noexcept;
+		public:
+			/**
+			 * @brief Метод очистки списка подготовленных контекстов SSL
+			 *
+			 */
+			void flush() noexcept;
+		public:
+			/**
+			 * @brief Метод предварительной подготовки контекста SSL сервера
+			 *
+			 * @param address объект подключения сервера
+			 * @param proto   желаемый протокол подключения
+			 * @return        результат подготовки контекста
+			 */
+			bool init(const addr_t * address, const proto_t proto) noexcept;
 		public:
 			/**
 			 * @brief Метод ожидания рукопожатия
@@ -827,6 +1168,15 @@ namespace awh {
 			 * @return       метод активного протокола
 			 */
 			proto_t proto(ctx_t & target) const noexcept;
+		public:
+			/**
+			 * @brief Метод проверки активации шифрования на уровне ядра (kTLS)
+			 *
+			 * @param target контекст подключения
+			 * @param method метод передачи данных для проверки (READ / WRITE)
+			 * @return       результат проверки
+			 */
+			bool ktls(const ctx_t & target, const method_t method = method_t::WRITE) const noexcept;
 		private:
 			/**
 			 * @brief Метод активации протокола HTTP
@@ -889,6 +1239,29 @@ namespace awh {
 			 * @return        объект SSL контекста
 			 */
 			void wrap(ctx_t & target, addr_t * address, const string & host) noexcept;
+		public:
+			/**
+			 * @brief Метод получения сериализованной сессии TLS для последующего возобновления
+			 *
+			 * @param target контекст подключения
+			 * @return       сериализованная сессия TLS
+			 */
+			vector <uint8_t> session(const ctx_t & target) const noexcept;
+			/**
+			 * @brief Метод установки сохранённой сессии TLS для возобновления подключения
+			 *
+			 * @param target  контекст подключения
+			 * @param session сериализованная сессия TLS
+			 * @return        результат установки сессии
+			 */
+			bool session(ctx_t & target, const vector <uint8_t> & session) const noexcept;
+		public:
+			/**
+			 * @brief Метод получения статистики возобновления сессий TLS
+			 *
+			 * @return статистика возобновления сессий
+			 */
+			resumption_t resumption() const noexcept;
 		public:
 			/**
 			 * @brief Метод разрешающий или запрещающий, выполнять проверку соответствия, сертификата домену
@@ -924,6 +1297,27 @@ namespace awh {
 			 * @param key приватный ключ сертификата (если требуется)
 			 */
 			void certificate(const string & pem, const string & key = "") noexcept;
+		public:
+			/**
+			 * @brief Метод установки времени жизни сессии TLS
+			 *
+			 * @param sec время жизни сессии и период ротации ключей билетов в секундах
+			 */
+			void lifetime(const uint32_t sec) noexcept;
+			/**
+			 * @brief Метод установки допустимых версий протокола TLS
+			 *
+			 * @param min минимальная версия протокола (TLS1_2_VERSION / TLS1_3_VERSION)
+			 * @param max максимальная версия протокола (TLS1_2_VERSION / TLS1_3_VERSION)
+			 */
+			void version(const int32_t min, const int32_t max) noexcept;
+		public:
+			/**
+			 * @brief Метод разрешения шифрования на уровне ядра (kTLS)
+			 *
+			 * @param mode флаг разрешения шифрования на уровне ядра
+			 */
+			void ktls(const bool mode) noexcept;
 		public:
 			/**
 			 * @brief Конструктор
@@ -58,6 +58,13 @@
 	#include <sys/resource.h>
 #endif
 
+/**
+ * Если операционной системой является Linux
+ */
+#if __linux__
+	#include <linux/filter.h>
+#endif
+
 /**
  * Если операционной системой является Linux или FreeBSD
  */
@@ -135,6 +142,21 @@ namespace awh {
 			 * @return     результат работы функции
 			 */
 			bool reuseable(const SOCKET sock) const noexcept;
+			/**
+			 * @brief Метод разрешающий нескольким сокетам слушать один и тот же порт
+			 *
+			 * @param sock сетевой сокет
+			 * @return     результат работы функции
+			 */
+			bool reusePort(const SOCKET sock) const noexcept;
+			/**
+			 * @brief Метод установки программы распределения подключений группы SO_REUSEPORT по ядрам процессора
+			 *
+			 * @param sock  сетевой сокет
+			 * @param count количество сокетов в группе
+			 * @return      результат работы функции
+			 */
+			bool steering(const SOCKET sock, const uint16_t count) const noexcept;
 			/**
 			 * @brief Метод разрешения закрывать сокет, после запуска
 			 *
@@ -141,13 +141,17 @@ namespace awh {
 			 *
 			 */
 			typedef struct Buffer {
+				bool retain;                    // Флаг собственного буфера брокера (иначе используется буфер чтения потока)
+				bool paused;                    // Флаг приостановки чтения данных из сокета
+				bool reading;                   // Флаг выполнения чтения данных в буфер
+				bool deferred;                  // Флаг отложенной переинициализации буфера
 				size_t size;                    // Размер буфера
 				std::unique_ptr <char []> data; // Данные буфера
 				/**
 				 * @brief Конструктор
 				 *
 				 */
-				Buffer() noexcept : size(0), data(nullptr) {}
+				Buffer() noexcept : retain(false), paused(false), reading(false), deferred(false), size(0), data(nullptr) {}
 				/**
 				 * @brief Деструктор
 				 *
@@ -20,12 +20,14 @@
  */
 #include <map>
 #include <vector>
+#include <functional>
 
 /**
  * Наши модули
  */
 #include "server.hpp"
 #include "../http/server.hpp"
+#include "../sys/codec.hpp"
 #include "../sys/buffer.hpp"
 
 /**
@@ -52,6 +54,11 @@ namespace awh {
 			 *
 			 */
 			typedef struct AWHSHARED_EXPORT WEB : public scheme_t {
+				public:
+					/**
+					 * Функция чтения тела ответа (возвращает количество записанных байт, 0 - конец тела)
+					 */
+					typedef function <size_t (char *, const size_t)> reader_t;
 				public:
 					/**
 					 * @brief Структура параметров активного клиента
@@ -61,16 +68,28 @@ namespace awh {
 						bool mode;                       // Флаг открытия подключения
 						bool alive;                      // Флаг долгоживущего подключения
 						bool close;                      // Флаг требования закрыть брокера
+						bool paused;                     // Флаг приостановки чтения данных
+						bool chunked;                    // Флаг передачи тела ответа чанками
 						bool crypted;                    // Флаг шифрования сообщений
+						bool parsing;                    // Флаг выполнения обработки данных
+						bool pending;                    // Флаг ожидания следующего фрагмента тела ответа
+						bool pulling;                    // Флаг выполнения чтения тела ответа
 						bool stopped;                    // Флаг принудительной остановки
+						bool suspended;                  // Флаг приостановки чтения данных приложением
 						int32_t sid;                     // Идентификатор потока
+						uint16_t queued;                 // Количество полностью полученных запросов в буфере
 						uint32_t requests;               // Количество выполненных запросов
+						size_t scanned;                  // Объём данных буфера с подсчитанными запросами
+						uint64_t length;                 // Размер непереданного тела ответа
 						uint64_t respPong;               // Контрольная точка ответа на пинг
 						http_t http;                     // Объект для работы с HTTP
 						awh::buffer_t buffer;            // Буфер бинарных необработанных данных
+						awh::web_t probe;                // Парсер подсчёта запросов конвейера в буфере
 						hash_t::cipher_t cipher;         // Формат шифрования
 						engine_t::proto_t proto;         // Активный прототип интернета
 						http_t::compressor_t compressor; // Метод компрессии данных
+						reader_t reader;                 // Функция чтения тела ответа
+						codec_t codec;                   // Потоковый компрессор тела ответа
 						/**
 						 * @brief Конструктор
 						 *
@@ -79,12 +98,17 @@ namespace awh {
 						 */
 						Options(const fmk_t * fmk, const log_t * log) noexcept :
 						 mode(false), alive(false), close(false),
-						 crypted(false), stopped(false),
-						 sid(1), requests(0), respPong(0),
-						 http(fmk, log), buffer(log),
+						 paused(false), chunked(false), crypted(false),
+						 parsing(false), pending(false), pulling(false),
+						 stopped(false), suspended(false),
+						 sid(1), queued(0), requests(0), scanned(0), length(0), respPong(0),
+						 http(fmk, log), buffer(log), probe(fmk, log),
 						 cipher(hash_t::cipher_t::AES128),
 						 proto(engine_t::proto_t::HTTP1_1),
-						 compressor(awh::http_t::compressor_t::NONE) {}
+						 compressor(awh::http_t::compressor_t::NONE), reader(nullptr), codec(log) {
+							// Устанавливаем тип парсера подсчёта запросов конвейера
+							this->probe.hid(awh::web_t::hid_t::SERVER);
+						}
 						/**
 						 * @brief Деструктор
 						 *
@@ -60,6 +60,8 @@ namespace awh {
 			private:
 				// Максимальное количество запросов
 				uint32_t _maxRequests;
+				// Максимальная глубина конвейера запросов
+				uint16_t _pipelineDepth;
 			private:
 				// Идентичность протокола
 				http_t::identity_t _identity;
@@ -106,6 +108,28 @@ namespace awh {
 				 * @param sid    идентификатор схемы сети
 				 */
 				void writeEvents(const char * buffer, const size_t size, const uint64_t bid, const uint16_t sid) noexcept;
+			private:
+				/**
+				 * @brief Метод обработки конвейера запросов накопленных в буфере клиента
+				 *
+				 * @param bid идентификатор брокера
+				 * @param sid идентификатор схемы сети
+				 */
+				void pipeline(const uint64_t bid, const uint16_t sid) noexcept;
+				/**
+				 * @brief Метод контроля глубины конвейера запросов ожидающих ответа
+				 *
+				 * @param bid     идентификатор брокера
+				 * @param release флаг снятия приостановки чтения (подключение переходит на другой протокол)
+				 */
+				void backlog(const uint64_t bid, const bool release) noexcept;
+			private:
+				/**
+				 * @brief Метод чтения и отправки очередного фрагмента тела ответа
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				void pulling(const uint64_t bid) noexcept;
 			private:
 				/**
 				 * @brief Метод отлавливания событий контейнера функций обратного вызова
@@ -259,6 +283,30 @@ namespace awh {
 				 * @param headers HTTP заголовки сообщения
 				 */
 				void send(const uint64_t bid, const uint32_t code = 200, const string & mess = "", const vector <char> & entity = {}, const std::unordered_multimap <string, string> & headers = {}) noexcept;
+				/**
+				 * @brief Метод отправки ответа, тело которого читается по мере отправки
+				 *
+				 * @param bid     идентификатор брокера
+				 * @param code    код сообщения для брокера
+				 * @param mess    отправляемое сообщение об ошибке
+				 * @param reader  функция чтения очередного фрагмента тела (возвращает количество байт, 0 - конец тела)
+				 * @param headers HTTP заголовки сообщения
+				 * @return        результат отправки заголовков ответа
+				 */
+				bool stream(const uint64_t bid, const uint32_t code, const string & mess, const scheme::web_t::reader_t & reader, const std::unordered_multimap <string, string> & headers = {}) noexcept;
+			public:
+				/**
+				 * @brief Метод приостановки чтения данных клиента
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				void pause(const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод возобновления чтения данных клиента
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				void resume(const uint64_t bid) noexcept;
 			public:
 				/**
 				 * @brief Метод установки функций обратного вызова
@@ -451,6 +499,12 @@ namespace awh {
 				 * @param max максимальное количество запросов
 				 */
 				void maxRequests(const uint32_t max) noexcept;
+				/**
+				 * @brief Метод установки максимальной глубины конвейера запросов
+				 *
+				 * @param depth максимальное количество запросов ожидающих ответа
+				 */
+				void pipelineDepth(const uint16_t depth) noexcept;
 			public:
 				/**
 				 * @brief Метод получения флага шифрования
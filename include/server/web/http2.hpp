@@ -341,6 +341,31 @@ namespace awh {
 				 * @param headers HTTP заголовки сообщения
 				 */
 				void send(const int32_t sid, const uint64_t bid, const uint32_t code = 200, const string & mess = "", const vector <char> & entity = {}, const std::unordered_multimap <string, string> & headers = {}) noexcept;
+				/**
+				 * @brief Метод отправки ответа, тело которого читается по мере отправки
+				 *
+				 * @param sid     идентификатор потока HTTP
+				 * @param bid     идентификатор брокера
+				 * @param code    код сообщения для брокера
+				 * @param mess    отправляемое сообщение об ошибке
+				 * @param reader  функция чтения очередного фрагмента тела (возвращает количество байт, 0 - конец тела)
+				 * @param headers HTTP заголовки сообщения
+				 * @return        результат отправки заголовков ответа
+				 */
+				bool stream(const int32_t sid, const uint64_t bid, const uint32_t code, const string & mess, const scheme::web_t::reader_t & reader, const std::unordered_multimap <string, string> & headers = {}) noexcept;
+			public:
+				/**
+				 * @brief Метод приостановки чтения данных клиента
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				void pause(const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод возобновления чтения данных клиента
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				void resume(const uint64_t bid) noexcept;
 			public:
 				/**
 				 * @brief Метод HTTP/2 отправки клиенту сообщения корректного завершения
@@ -359,6 +384,16 @@ namespace awh {
 				 * @return      результат отправки сообщения
 				 */
 				bool reject2(const int32_t sid, const uint64_t bid, const awh::http2_t::error_t error) noexcept;
+				/**
+				 * @brief Метод HTTP/2 установки приоритета потока (RFC 9218)
+				 *
+				 * @param sid         идентификатор потока
+				 * @param bid         идентификатор брокера
+				 * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+				 * @param incremental флаг инкрементальной обработки ответа
+				 * @return            результат установки приоритета
+				 */
+				bool priority2(const int32_t sid, const uint64_t bid, const uint8_t urgency, const bool incremental) noexcept;
 			public:
 				/**
 				 * @brief Метод HTTP/2 отправки сообщения закрытия всех потоков
@@ -624,6 +659,12 @@ namespace awh {
 				 * @param max максимальное количество запросов
 				 */
 				void maxRequests(const uint32_t max) noexcept;
+				/**
+				 * @brief Метод установки максимальной глубины конвейера запросов
+				 *
+				 * @param depth максимальное количество запросов ожидающих ответа
+				 */
+				void pipelineDepth(const uint16_t depth) noexcept;
 			public:
 				/**
 				 * @brief Метод установки идентификации сервера
@@ -89,7 +89,8 @@ namespace awh {
 					TAKEOVER_CLIENT       = 0x05, // Флаг ожидания входящих сообщений для клиента
 					TAKEOVER_SERVER       = 0x06, // Флаг ожидания входящих сообщений для сервера
 					WEBSOCKET_ENABLE      = 0x07, // Флаг разрешения использования Websocket-сервера
-					CONNECT_METHOD_ENABLE = 0x08  // Флаг разрешающий метод CONNECT для сервера
+					CONNECT_METHOD_ENABLE = 0x08, // Флаг разрешающий метод CONNECT для сервера
+					STREAM_BODY_ENABLE    = 0x09  // Флаг потоковой передачи тела запроса без накопления
 				};
 			protected:
 				/**
@@ -170,6 +171,8 @@ namespace awh {
 				bool _pinging;
 				// Флаг остановки работы базы событий
 				bool _complete;
+				// Флаг потоковой передачи тела запроса
+				bool _streaming;
 			protected:
 				// Размер одного чанка
 				size_t _chunkSize;
@@ -260,6 +263,14 @@ namespace awh {
 				 * @param http  объект модуля HTTP
 				 */
 				virtual void chunking(const uint64_t bid, const vector <char> & chunk, const awh::http_t * http) noexcept;
+			protected:
+				/**
+				 * @brief Метод проверки разрешения потоковой передачи тела запроса
+				 *
+				 * @param http объект модуля HTTP
+				 * @return     результат проверки
+				 */
+				bool streaming(const awh::http_t * http) const noexcept;
 			protected:
 				/**
 				 * @brief Метод отлавливания событий контейнера функций обратного вызова
@@ -649,7 +660,27 @@ namespace awh {
 				 * @param status флаг запуска/остановки
 				 */
 				void statusEvents(const awh::core_t::status_t status) noexcept;
+				/**
+				 * @brief Метод обратного вызова при освобождении очереди отправки брокера
+				 *
+				 * @param bid  идентификатор брокера
+				 * @param size количество байт оставшихся в очереди отправки
+				 */
+				void drainEvents(const uint64_t bid, const size_t size) noexcept;
 			protected:
+				/**
+				 * @brief Метод обратного вызова при получении объёма данных ожидающих отправки HTTP/2
+				 *
+				 * @param bid идентификатор брокера
+				 * @return    количество байт в очереди отправки брокера
+				 */
+				size_t pendingSignal(const uint64_t bid) const noexcept;
+				/**
+				 * @brief Метод обратного вызова при получении объёма памяти доступной для буферов отправки
+				 *
+				 * @return количество байт доступной памяти
+				 */
+				size_t memorySignal() const noexcept;
 				/**
 				 * @brief Метод обратного вызова при отправки данных HTTP/2
 				 *
@@ -658,6 +689,15 @@ namespace awh {
 				 * @param size   размер буфера данных для отправки
 				 */
 				void sendSignal(const uint64_t bid, const uint8_t * buffer, const size_t size) noexcept;
+				/**
+				 * @brief Метод обратного вызова при отправки данных HTTP/2 без копирования
+				 *
+				 * @param bid    идентификатор брокера
+				 * @param buffer буфер бинарных данных
+				 * @param size   размер буфера данных для отправки
+				 * @param owner  владелец буфера, удерживающий данные до их отправки
+				 */
+				void writeSignal(const uint64_t bid, const uint8_t * buffer, const size_t size, const std::shared_ptr <const void> & owner) noexcept;
 			protected:
 				/**
 				 * @brief Метод начала получения фрейма заголовков HTTP/2
@@ -740,6 +780,24 @@ namespace awh {
 				 * @return      результат отправки сообщения
 				 */
 				bool reject(const int32_t sid, const uint64_t bid, http2_t::error_t error) noexcept;
+				/**
+				 * @brief Метод установки приоритета потока (RFC 9218)
+				 *
+				 * @param sid         идентификатор потока
+				 * @param bid         идентификатор брокера
+				 * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+				 * @param incremental флаг инкрементальной обработки ответа
+				 * @return            результат установки приоритета
+				 */
+				bool priority(const int32_t sid, const uint64_t bid, const uint8_t urgency, const bool incremental) noexcept;
+			public:
+				/**
+				 * @brief Метод получения состояния управления потоком сессии
+				 *
+				 * @param bid идентификатор брокера
+				 * @return    размеры окон, время приёма-передачи и оценка BDP
+				 */
+				http2_t::flow_t flow(const uint64_t bid) const noexcept;
 			public:
 				/**
 				 * @brief Метод отправки сообщения закрытия всех потоков
@@ -773,6 +831,18 @@ namespace awh {
 				 * @return       результат отправки данных указанному клиенту
 				 */
 				bool send(const int32_t sid, const uint64_t bid, const char * buffer, const size_t size, const http2_t::flag_t flag) noexcept;
+				/**
+				 * @brief Метод отправки сообщения клиенту без копирования
+				 *
+				 * @param sid    идентификатор потока
+				 * @param bid    идентификатор брокера
+				 * @param buffer буфер бинарных данных передаваемых
+				 * @param size   размер сообщения в байтах
+				 * @param owner  владелец буфера, удерживающий данные до их отправки
+				 * @param flag   флаг передаваемого потока по сети
+				 * @return       результат отправки данных указанному клиенту
+				 */
+				bool send(const int32_t sid, const uint64_t bid, const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const http2_t::flag_t flag) noexcept;
 			public:
 				/**
 				 * @brief Метод отправки заголовков
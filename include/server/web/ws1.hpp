@@ -20,9 +20,10 @@
  */
 #include "web.hpp"
 #include "../../ws/frame.hpp"
+#include "../../ws/topics.hpp"
 #include "../../ws/server.hpp"
 #include "../../scheme/ws.hpp"
-#include "../../sys/threadpool.hpp"
+#include "../../sys/executor.hpp"
 
 /**
  * @brief пространство имён
@@ -82,10 +83,13 @@ namespace awh {
 				uint32_t _waitPong;
 			private:
 				// Объект тредпула для работы с потоками
-				thr_t _thr;
+				exec_t _thr;
 			private:
 				// Объект рабочего
 				scheme::ws_t _scheme;
+			private:
+				// Объект реестра тем рассылки
+				ws::topics_t _topics;
 			private:
 				// Объект партнёра клиента
 				scheme::ws_t::partner_t _client;
@@ -134,6 +138,14 @@ namespace awh {
 				 * @param sid    идентификатор схемы сети
 				 */
 				void writeEvents(const char * buffer, const size_t size, const uint64_t bid, const uint16_t sid) noexcept;
+			private:
+				/**
+				 * @brief Метод обратного вызова при освобождении очереди отправки брокера
+				 *
+				 * @param bid  идентификатор брокера
+				 * @param size количество байт оставшихся в очереди отправки
+				 */
+				void drainEvents(const uint64_t bid, const size_t size) noexcept;
 			private:
 				/**
 				 * @brief Метод вывода сообщений об ошибках работы брокера
@@ -181,6 +193,37 @@ namespace awh {
 				 * @param tid идентификатор таймера
 				 */
 				void pinging(const uint16_t tid) noexcept;
+			private:
+				/**
+				 * @brief Метод компрессии полезной нагрузки сообщения
+				 *
+				 * @param options параметры активного клиента
+				 * @param message буфер полезной нагрузки сообщения
+				 * @param size    размер полезной нагрузки сообщения
+				 * @param buffer  буфер для записи сжатых данных (пустой, если сжатие не выполнено)
+				 */
+				void compress(scheme::ws_t::options_t * options, const char * message, const size_t size, vector <char> & buffer) const noexcept;
+			private:
+				/**
+				 * @brief Метод получения фреймов публикуемого сообщения
+				 *
+				 * Фреймы формируются один раз для каждого набора параметров компрессии и фрагментации,
+				 * подписчики с шифрованием или скользящим контекстом сжатия получают индивидуальные фреймы
+				 *
+				 * @param options параметры активного клиента
+				 * @param message публикуемое сообщение
+				 * @return        фреймы сообщения (пустое значение, если фреймы не могут быть общими)
+				 */
+				std::shared_ptr <const vector <char>> frames(scheme::ws_t::options_t * options, const std::shared_ptr <ws::topics_t::message_t> & message) const noexcept;
+			private:
+				/**
+				 * @brief Метод постановки публикуемого сообщения в очередь подписчика
+				 *
+				 * @param bid     идентификатор брокера
+				 * @param message публикуемое сообщение
+				 * @return        результат постановки сообщения в очередь
+				 */
+				bool push(const uint64_t bid, const std::shared_ptr <ws::topics_t::message_t> & message) noexcept;
 			public:
 				/**
 				 * @brief Метод инициализации Websocket-сервера
@@ -235,6 +278,58 @@ namespace awh {
 				 * @return       результат отправки сообщения
 				 */
 				bool send(const uint64_t bid, const char * buffer, const size_t size) noexcept;
+			public:
+				/**
+				 * @brief Метод подписки брокера на тему рассылки
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 * @return      результат подписки
+				 */
+				bool subscribe(const string & topic, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод отписки брокера от темы рассылки
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 */
+				void unsubscribe(const string & topic, const uint64_t bid) noexcept;
+			public:
+				/**
+				 * @brief Метод установки политики обработки медленных подписчиков темы
+				 *
+				 * @param topic  название темы
+				 * @param policy политика обработки медленных подписчиков
+				 * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+				 */
+				void policy(const string & topic, const ws::topics_t::policy_t policy, const size_t limit) noexcept;
+				/**
+				 * @brief Метод получения статистики темы рассылки
+				 *
+				 * @param topic название темы
+				 * @return      статистика темы
+				 */
+				ws::topics_t::stat_t topic(const string & topic) const noexcept;
+			public:
+				/**
+				 * @brief Метод публикации сообщения всем подписчикам темы
+				 *
+				 * @param topic   название темы
+				 * @param message передаваемое сообщения в бинарном виде
+				 * @param text    данные передаются в текстовом виде
+				 * @return        количество подписчиков в очередь которых поставлено сообщение
+				 */
+				size_t publish(const string & topic, const vector <char> & message, const bool text = true) noexcept;
+				/**
+				 * @brief Метод публикации сообщения всем подписчикам темы
+				 *
+				 * @param topic   название темы
+				 * @param message передаваемое сообщения в бинарном виде
+				 * @param size    размер передаваемого сообещния
+				 * @param text    данные передаются в текстовом виде
+				 * @return        количество подписчиков в очередь которых поставлено сообщение
+				 */
+				size_t publish(const string & topic, const char * message, const size_t size, const bool text = true) noexcept;
 			public:
 				/**
 				 * @brief Метод установки функций обратного вызова
@@ -344,6 +439,12 @@ namespace awh {
 				 * @param mode  флаг активации/деактивации мультипоточности
 				 */
 				void multiThreads(const uint16_t count = 0, const bool mode = true) noexcept;
+				/**
+				 * @brief Метод получения метрик пула потоков извлечения сообщений
+				 *
+				 * @return метрики пула потоков
+				 */
+				exec_t::stat_t executor() const noexcept;
 			public:
 				/**
 				 * @brief Метод установки максимального количества одновременных подключений
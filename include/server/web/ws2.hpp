@@ -23,7 +23,7 @@
 #include "../../ws/frame.hpp"
 #include "../../ws/server.hpp"
 #include "../../scheme/ws.hpp"
-#include "../../sys/threadpool.hpp"
+#include "../../sys/executor.hpp"
 
 /**
  * @brief пространство имён
@@ -66,12 +66,15 @@ namespace awh {
 				uint32_t _waitPong;
 			private:
 				// Объект тредпула для работы с потоками
-				thr_t _thr;
+				exec_t _thr;
 				// Объект работы с Websocket-клиентом HTTP/1.1
 				ws1_t _ws1;
 			private:
 				// Объект рабочего
 				scheme::ws_t _scheme;
+			private:
+				// Объект реестра тем рассылки
+				ws::topics_t _topics;
 			private:
 				// Объект партнёра клиента
 				scheme::ws_t::partner_t _client;
@@ -120,6 +123,14 @@ namespace awh {
 				 * @param sid    идентификатор схемы сети
 				 */
 				void writeEvents(const char * buffer, const size_t size, const uint64_t bid, const uint16_t sid) noexcept;
+			private:
+				/**
+				 * @brief Метод обратного вызова при освобождении очереди отправки брокера
+				 *
+				 * @param bid  идентификатор брокера
+				 * @param size количество байт оставшихся в очереди отправки
+				 */
+				void drainEvents(const uint64_t bid, const size_t size) noexcept;
 			private:
 				/**
 				 * @brief Метод отлавливания событий контейнера функций обратного вызова
@@ -231,6 +242,22 @@ namespace awh {
 				 * @param tid идентификатор таймера
 				 */
 				void pinging(const uint16_t tid) noexcept;
+			private:
+				/**
+				 * @brief Метод получения количества байт ожидающих отправки подписчику
+				 *
+				 * @param bid идентификатор брокера
+				 * @return    количество байт в очереди брокера и в очереди потока HTTP/2
+				 */
+				size_t queued(const uint64_t bid) const noexcept;
+				/**
+				 * @brief Метод постановки публикуемого сообщения в очередь подписчика
+				 *
+				 * @param bid     идентификатор брокера
+				 * @param message публикуемое сообщение
+				 * @return        результат постановки сообщения в очередь
+				 */
+				bool push(const uint64_t bid, const std::shared_ptr <ws::topics_t::message_t> & message) noexcept;
 			public:
 				/**
 				 * @brief Метод инициализации Websocket-сервера
@@ -285,6 +312,58 @@ namespace awh {
 				 * @return       результат отправки сообщения
 				 */
 				bool send(const uint64_t bid, const char * buffer, const size_t size) noexcept;
+			public:
+				/**
+				 * @brief Метод подписки брокера на тему рассылки
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 * @return      результат подписки
+				 */
+				bool subscribe(const string & topic, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод отписки брокера от темы рассылки
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 */
+				void unsubscribe(const string & topic, const uint64_t bid) noexcept;
+			public:
+				/**
+				 * @brief Метод установки политики обработки медленных подписчиков темы
+				 *
+				 * @param topic  название темы
+				 * @param policy политика обработки медленных подписчиков
+				 * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+				 */
+				void policy(const string & topic, const ws::topics_t::policy_t policy, const size_t limit) noexcept;
+				/**
+				 * @brief Метод получения статистики темы рассылки
+				 *
+				 * @param topic название темы
+				 * @return      статистика темы
+				 */
+				ws::topics_t::stat_t topic(const string & topic) const noexcept;
+			public:
+				/**
+				 * @brief Метод публикации сообщения всем подписчикам темы
+				 *
+				 * @param topic   название темы
+				 * @param message передаваемое сообщения в бинарном виде
+				 * @param text    данные передаются в текстовом виде
+				 * @return        количество подписчиков в очередь которых поставлено сообщение
+				 */
+				size_t publish(const string & topic, const vector <char> & message, const bool text = true) noexcept;
+				/**
+				 * @brief Метод публикации сообщения всем подписчикам темы
+				 *
+				 * @param topic   название темы
+				 * @param message передаваемое сообщения в бинарном виде
+				 * @param size    размер передаваемого сообещния
+				 * @param text    данные передаются в текстовом виде
+				 * @return        количество подписчиков в очередь которых поставлено сообщение
+				 */
+				size_t publish(const string & topic, const char * message, const size_t size, const bool text = true) noexcept;
 			public:
 				/**
 				 * @brief Метод установки функций обратного вызова
@@ -394,6 +473,12 @@ namespace awh {
 				 * @param mode  флаг активации/деактивации мультипоточности
 				 */
 				void multiThreads(const uint16_t count = 0, const bool mode = true) noexcept;
+				/**
+				 * @brief Метод получения метрик пула потоков извлечения сообщений
+				 *
+				 * @return метрики пула потоков
+				 */
+				exec_t::stat_t executor() const noexcept;
 			public:
 				/**
 				 * @brief Метод установки максимального количества одновременных подключений
@@ -101,6 +101,58 @@ namespace awh {
 				 * @return        результат отправки сообщения
 				 */
 				bool sendMessage(const uint64_t bid, const char * message, const size_t size, const bool text = true) noexcept;
+			public:
+				/**
+				 * @brief Метод подписки брокера на тему рассылки
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 * @return      результат подписки
+				 */
+				bool subscribe(const string & topic, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод отписки брокера от темы рассылки
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 */
+				void unsubscribe(const string & topic, const uint64_t bid) noexcept;
+			public:
+				/**
+				 * @brief Метод установки политики обработки медленных подписчиков темы
+				 *
+				 * @param topic  название темы
+				 * @param policy политика обработки медленных подписчиков
+				 * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+				 */
+				void policy(const string & topic, const ws::topics_t::policy_t policy, const size_t limit) noexcept;
+				/**
+				 * @brief Метод получения статистики темы рассылки
+				 *
+				 * @param topic название темы
+				 * @return      статистика темы
+				 */
+				ws::topics_t::stat_t topic(const string & topic) const noexcept;
+			public:
+				/**
+				 * @brief Метод публикации сообщения всем подписчикам темы
+				 *
+				 * @param topic   название темы
+				 * @param message передаваемое сообщения в бинарном виде
+				 * @param text    данные передаются в текстовом виде
+				 * @return        количество подписчиков в очередь которых поставлено сообщение
+				 */
+				size_t publish(const string & topic, const vector <char> & message, const bool text = true) noexcept;
+				/**
+				 * @brief Метод публикации сообщения всем подписчикам темы
+				 *
+				 * @param topic   название темы
+				 * @param message передаваемое сообщения в бинарном виде
+				 * @param size    размер передаваемого сообещния
+				 * @param text    данные передаются в текстовом виде
+				 * @return        количество подписчиков в очередь которых поставлено сообщение
+				 */
+				size_t publish(const string & topic, const char * message, const size_t size, const bool text = true) noexcept;
 			public:
 				/**
 				 * @brief Метод установки функций обратного вызова
@@ -293,6 +345,12 @@ namespace awh {
 				 * @param mode  флаг активации/деактивации мультипоточности
 				 */
 				void multiThreads(const uint16_t threads = 0, const bool mode = true) noexcept;
+				/**
+				 * @brief Метод получения метрик пула потоков извлечения сообщений
+				 *
+				 * @return метрики пула потоков
+				 */
+				exec_t::stat_t executor() const noexcept;
 			public:
 				/**
 				 * @brief Метод установки максимального количества одновременных подключений
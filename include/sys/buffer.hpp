@@ -39,11 +39,19 @@ namespace awh {
 	/**
 	 * @brief Класс создания очереди
 	 *
+	 * Удаление данных из начала очереди выполняется сдвигом курсора чтения за O(1),
+	 * неотправленные данные не перемещаются. Освободившееся место в начале буфера
+	 * возвращается только когда очередь полностью прочитана, либо при добавлении данных,
+	 * если прочитанная часть не меньше оставшейся (амортизированно O(1) на байт)
+	 *
 	 */
 	typedef class AWHSHARED_EXPORT Buffer {
 		private:
 			// Мютекс для блокировки потока
 			std::mutex _mtx;
+		private:
+			// Смещение курсора чтения
+			size_t _offset;
 		private:
 			// Объект буфера данных
 			vector <uint8_t> _buffer;
@@ -162,6 +170,12 @@ namespace awh {
 			 * @return указатель на элемент очереди
 			 */
 			const uint8_t * get() const noexcept;
+			/**
+			 * @brief Получения данных очереди для изменения на месте
+			 *
+			 * @return указатель на элемент очереди
+			 */
+			uint8_t * get() noexcept;
 		public:
 			/**
 			 * @brief Метод удаления указанного количества байт
@@ -254,7 +268,7 @@ namespace awh {
 			 *
 			 * @param log объект для работы с логами
 			 */
-			Buffer(const log_t * log) noexcept : _log(log) {}
+			Buffer(const log_t * log) noexcept : _offset(0), _log(log) {}
 			/**
 			 * @brief Деструктор
 			 *
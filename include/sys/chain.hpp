@@ -0,0 +1,196 @@
+/**
+ * @file: chain.hpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_CHAIN__
+#define __AWH_CHAIN__
+
+/**
+ * Если максимальный размер сегмента для объединения копируемых данных не указан
+ */
+#ifndef AWH_CHAIN_SEGMENT
+	/**
+	 * Устанавливаем максимальный размер сегмента 16Kb (размер записи TLS)
+	 */
+	#define AWH_CHAIN_SEGMENT 0x4000
+#endif
+
+/**
+ * Если максимальное количество записей для векторной отправки не указано
+ */
+#ifndef AWH_CHAIN_RECORDS
+	/**
+	 * Устанавливаем максимальное количество записей 64
+	 */
+	#define AWH_CHAIN_RECORDS 0x40
+#endif
+
+/**
+ * Стандартные библиотеки
+ */
+#include <deque>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Подключаем наши заголовочные файлы
+ */
+#include "log.hpp"
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief Класс цепочки сегментов для векторной отправки данных
+	 *
+	 * Данные хранятся списком сегментов: мелкие копируемые данные объединяются в собственные
+	 * сегменты, а переданные вместе с владельцем данные хранятся по ссылке без копирования.
+	 * Удаление прочитанных данных выполняется за O(1) и не перемещает оставшиеся данные
+	 *
+	 */
+	typedef class AWHSHARED_EXPORT Chain {
+		public:
+			// Запись сегмента для векторной отправки (указатель на данные и их размер)
+			typedef std::pair <const void *, size_t> record_t;
+		private:
+			/**
+			 * @brief Структура сегмента данных
+			 *
+			 */
+			typedef struct Segment {
+				// Смещение прочитанных данных
+				size_t offset;
+				// Размер данных сегмента
+				size_t size;
+				// Указатель на данные сегмента
+				const char * data;
+				// Собственный буфер скопированных данных
+				vector <char> buffer;
+				// Владелец данных переданных по ссылке
+				std::shared_ptr <const void> owner;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Segment() noexcept : offset(0), size(0), data(nullptr) {}
+			} segment_t;
+		private:
+			// Размер всех непрочитанных данных
+			size_t _size;
+		private:
+			// Список сегментов данных
+			std::deque <segment_t> _segments;
+		private:
+			// Объект для работы с логами
+			const log_t * _log;
+		public:
+			/**
+			 * @brief Метод очистки всех данных цепочки
+			 *
+			 */
+			void clear() noexcept;
+		public:
+			/**
+			 * @brief Метод проверки на заполненность цепочки
+			 *
+			 * @return результат проверки
+			 */
+			bool empty() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения размера непрочитанных данных
+			 *
+			 * @return размер всех непрочитанных данных
+			 */
+			size_t size() const noexcept;
+			/**
+			 * @brief Метод получения количества сегментов
+			 *
+			 * @return количество сегментов в цепочке
+			 */
+			size_t count() const noexcept;
+		public:
+			/**
+			 * @brief Метод получения данных первого сегмента
+			 *
+			 * @return указатель на непрочитанные данные первого сегмента
+			 */
+			const char * get() const noexcept;
+			/**
+			 * @brief Метод получения размера первого сегмента
+			 *
+			 * @return размер непрочитанных данных первого сегмента
+			 */
+			size_t front() const noexcept;
+			/**
+			 * @brief Метод получения владельца данных первого сегмента
+			 *
+			 * @return владелец данных (пустое значение, если данные скопированы в цепочку)
+			 */
+			std::shared_ptr <const void> owner() const noexcept;
+		public:
+			/**
+			 * @brief Метод удаления указанного количества прочитанных байт
+			 *
+			 * @param size количество байт для удаления
+			 */
+			void erase(const size_t size) noexcept;
+		public:
+			/**
+			 * @brief Метод экспорта сегментов для векторной отправки
+			 *
+			 * @param records список записей для заполнения
+			 * @param max     максимальное количество записей
+			 * @param limit   максимальный размер экспортируемых данных
+			 * @return        количество заполненных записей
+			 */
+			size_t records(record_t * records, const size_t max, const size_t limit) const noexcept;
+		public:
+			/**
+			 * @brief Метод добавления данных в цепочку с копированием
+			 *
+			 * @param buffer бинарный буфер для добавления
+			 * @param size   размер бинарного буфера
+			 */
+			void push(const void * buffer, const size_t size) noexcept;
+			/**
+			 * @brief Метод добавления данных в цепочку по ссылке без копирования
+			 *
+			 * @param buffer бинарный буфер для добавления
+			 * @param size   размер бинарного буфера
+			 * @param owner  владелец данных, удерживающий их до отправки (если не передан или данные меньше 4Kb, данные копируются)
+			 */
+			void push(const void * buffer, const size_t size, const std::shared_ptr <const void> & owner) noexcept;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param log объект для работы с логами
+			 */
+			Chain(const log_t * log) noexcept : _size(0), _log(log) {}
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Chain() noexcept {}
+	} chain_t;
+};
+
+#endif // __AWH_CHAIN__
@@ -0,0 +1,286 @@
+/**
+ * @file: codec.hpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_CODEC__
+#define __AWH_CODEC__
+
+/**
+ * Стандартные модули
+ */
+#include <vector>
+#include <cstdint>
+
+/**
+ * Подключаем потоковый LZ4
+ */
+#include <lz4frame.h>
+
+/**
+ * Наши модули
+ */
+#include "log.hpp"
+#include "hash.hpp"
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief Класс потокового компрессора данных
+	 *
+	 * В отличие от одноразовых методов hash_t::compress()/decompress(), сохраняет контекст
+	 * компрессии между вызовами: данные сжимаются по мере их появления, а сам контекст
+	 * переиспользуется для последующих сообщений без повторного выделения памяти
+	 *
+	 */
+	typedef class AWHSHARED_EXPORT Codec {
+		private:
+			/**
+			 * Режимы обработки данных
+			 */
+			enum class mode_t : uint8_t {
+				WRITE  = 0x01, // Обработка данных без сброса
+				FLUSH  = 0x02, // Обработка данных со сбросом буферов
+				FINISH = 0x03  // Обработка данных с завершением сообщения
+			};
+		private:
+			// Флаг инициализации контекста
+			bool _init;
+			// Флаг завершения текущего сообщения
+			bool _end;
+			// Флаг начала текущего сообщения
+			bool _begin;
+		private:
+			// Размер скользящего окна
+			int16_t _wbit;
+		private:
+			// Событие выполнения операции
+			hash_t::event_t _event;
+			// Уровень компрессии
+			hash_t::level_t _level;
+			// Метод компрессии
+			hash_t::method_t _method;
+		private:
+			// Буфер промежуточных данных
+			vector <char> _buffer;
+		private:
+			// Поток ZLib (GZip и Deflate)
+			z_stream _zlib;
+			// Поток BZip2
+			bz_stream _bzip2;
+			// Поток LZma
+			lzma_stream _lzma;
+		private:
+			// Контекст компрессора LZ4
+			LZ4F_cctx * _lz4c;
+			// Контекст декомпрессора LZ4
+			LZ4F_dctx * _lz4d;
+			// Параметры компрессора LZ4
+			LZ4F_preferences_t _lz4p;
+		private:
+			// Контекст компрессора Zstandard
+			ZSTD_CStream * _zstdc;
+			// Контекст декомпрессора Zstandard
+			ZSTD_DStream * _zstdd;
+		private:
+			// Стейт энкодера Brotli
+			BrotliEncoderState * _brotlie;
+			// Стейт декодера Brotli
+			BrotliDecoderState * _brotlid;
+		private:
+			// Объект работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * @brief Метод создания контекста компрессии
+			 *
+			 * @return результат создания контекста
+			 */
+			bool open() noexcept;
+			/**
+			 * @brief Метод освобождения контекста компрессии
+			 *
+			 */
+			void close() noexcept;
+			/**
+			 * @brief Метод подготовки контекста компрессии к новому сообщению
+			 *
+			 * @return результат подготовки контекста
+			 */
+			bool restart() noexcept;
+		private:
+			/**
+			 * @brief Метод получения уровня компрессии для активного метода
+			 *
+			 * @return уровень компрессии библиотеки
+			 */
+			int32_t level() const noexcept;
+		private:
+			/**
+			 * @brief Метод обработки данных активным методом компрессии
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool process(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+		private:
+			/**
+			 * @brief Метод обработки данных компрессором LZ4
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool lz4(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+			/**
+			 * @brief Метод обработки данных компрессором LZma
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool lzma(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+			/**
+			 * @brief Метод обработки данных компрессором Zstandard
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool zstd(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+			/**
+			 * @brief Метод обработки данных компрессором ZLib (GZip и Deflate)
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool zlib(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+			/**
+			 * @brief Метод обработки данных компрессором BZip2
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool bzip2(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+			/**
+			 * @brief Метод обработки данных компрессором Brotli
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param mode   режим обработки данных
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool brotli(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept;
+		public:
+			/**
+			 * @brief Метод инициализации потокового компрессора
+			 *
+			 * @param method метод компрессии
+			 * @param event  событие выполнения операции (компрессия или декомпрессия)
+			 * @param level  уровень компрессии
+			 * @return       результат инициализации
+			 */
+			bool init(const hash_t::method_t method, const hash_t::event_t event, const hash_t::level_t level = hash_t::level_t::NORMAL) noexcept;
+		public:
+			/**
+			 * @brief Метод сброса текущего сообщения
+			 *
+			 */
+			void reset() noexcept;
+			/**
+			 * @brief Метод очистки контекста компрессора
+			 *
+			 */
+			void clear() noexcept;
+		public:
+			/**
+			 * @brief Метод добавления данных в поток
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool write(const char * buffer, const size_t size, vector <char> & result) noexcept;
+			/**
+			 * @brief Метод сброса буферов потока (все переданные данные становятся доступны получателю)
+			 *
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных
+			 */
+			bool flush(vector <char> & result) noexcept;
+			/**
+			 * @brief Метод завершения текущего сообщения (контекст готов к следующему сообщению)
+			 *
+			 * @param result буфер куда следует добавить результат
+			 * @return       результат обработки данных (для декомпрессии, целостность сообщения)
+			 */
+			bool finish(vector <char> & result) noexcept;
+		public:
+			/**
+			 * @brief Метод получения события выполнения операции
+			 *
+			 * @return событие выполнения операции
+			 */
+			hash_t::event_t event() const noexcept;
+			/**
+			 * @brief Метод получения метода компрессии
+			 *
+			 * @return метод компрессии
+			 */
+			hash_t::method_t method() const noexcept;
+		public:
+			/**
+			 * @brief Метод установки размера скользящего окна (применяется при инициализации)
+			 *
+			 * @param wbit размер скользящего окна
+			 */
+			void wbit(const int16_t wbit) noexcept;
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param log объект для работы с логами
+			 */
+			Codec(const log_t * log) noexcept;
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Codec() noexcept;
+	} codec_t;
+};
+
+#endif // __AWH_CODEC__
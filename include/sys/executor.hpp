@@ -0,0 +1,589 @@
+/**
+ * @file: executor.hpp
+ * @date: 2025-03-11
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_EXECUTOR__
+#define __AWH_EXECUTOR__
+
+/**
+ * Стандартные модули
+ */
+#include <new>
+#include <deque>
+#include <mutex>
+#include <tuple>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <unordered_map>
+#include <condition_variable>
+
+/**
+ * Разрешаем сборку под Windows
+ */
+#include "global.hpp"
+
+/**
+ * Наши модули
+ */
+#include "log.hpp"
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief Класс исполнителя задач с перехватом работы
+	 *
+	 * Каждый поток владеет собственной очередью задач, свободные потоки забирают задачи
+	 * из очередей занятых потоков. Задачи с одинаковым ключом исполняются строго
+	 * в порядке добавления и никогда не исполняются параллельно
+	 *
+	 */
+	typedef class AWHSHARED_EXPORT Exec {
+		public:
+			/**
+			 * @brief Класс перемещаемой задачи с хранением небольших объектов без выделения памяти
+			 *
+			 */
+			typedef class Task {
+				public:
+					// Размер встроенного хранилища объекта задачи
+					static constexpr size_t SIZE = 64;
+				private:
+					/**
+					 * @brief Структура операций над объектом задачи
+					 *
+					 */
+					typedef struct Operations {
+						// Функция исполнения объекта задачи
+						void (* invoke)(void *);
+						// Функция удаления объекта задачи
+						void (* destroy)(void *) noexcept;
+						// Функция перемещения объекта задачи
+						void (* move)(void *, void *) noexcept;
+					} operations_t;
+					/**
+					 * @brief Шаблон операций над объектом, размещённым во встроенном хранилище
+					 *
+					 * @tparam Func тип объекта задачи
+					 */
+					template <typename Func>
+					/**
+					 * @brief Структура операций над объектом, размещённым во встроенном хранилище
+					 *
+					 */
+					struct Inline {
+						/**
+						 * @brief Метод исполнения объекта задачи
+						 *
+						 * @param storage хранилище объекта задачи
+						 */
+						static void invoke(void * storage){
+							// Выполняем объект задачи
+							(* reinterpret_cast <Func *> (storage))();
+						}
+						/**
+						 * @brief Метод удаления объекта задачи
+						 *
+						 * @param storage хранилище объекта задачи
+						 */
+						static void destroy(void * storage) noexcept {
+							// Выполняем удаление объекта задачи
+							reinterpret_cast <Func *> (storage)->~Func();
+						}
+						/**
+						 * @brief Метод перемещения объекта задачи
+						 *
+						 * @param to   хранилище в которое перемещается объект задачи
+						 * @param from хранилище из которого перемещается объект задачи
+						 */
+						static void move(void * to, void * from) noexcept {
+							// Выполняем перемещение объекта задачи
+							::new(to) Func(std::move(* reinterpret_cast <Func *> (from)));
+							// Выполняем удаление перемещённого объекта задачи
+							reinterpret_cast <Func *> (from)->~Func();
+						}
+						// Список операций над объектом задачи
+						static constexpr operations_t operations = {&Inline::invoke, &Inline::destroy, &Inline::move};
+					};
+					/**
+					 * @brief Шаблон операций над объектом, размещённым в динамической памяти
+					 *
+					 * @tparam Func тип объекта задачи
+					 */
+					template <typename Func>
+					/**
+					 * @brief Структура операций над объектом, размещённым в динамической памяти
+					 *
+					 */
+					struct Heap {
+						/**
+						 * @brief Метод исполнения объекта задачи
+						 *
+						 * @param storage хранилище указателя на объект задачи
+						 */
+						static void invoke(void * storage){
+							// Выполняем объект задачи
+							(** reinterpret_cast <Func **> (storage))();
+						}
+						/**
+						 * @brief Метод удаления объекта задачи
+						 *
+						 * @param storage хранилище указателя на объект задачи
+						 */
+						static void destroy(void * storage) noexcept {
+							// Выполняем удаление объекта задачи
+							delete (* reinterpret_cast <Func **> (storage));
+						}
+						/**
+						 * @brief Метод перемещения объекта задачи
+						 *
+						 * @param to   хранилище в которое перемещается указатель на объект задачи
+						 * @param from хранилище из которого перемещается указатель на объект задачи
+						 */
+						static void move(void * to, void * from) noexcept {
+							// Выполняем перемещение указателя на объект задачи
+							(* reinterpret_cast <Func **> (to)) = (* reinterpret_cast <Func **> (from));
+						}
+						// Список операций над объектом задачи
+						static constexpr operations_t operations = {&Heap::invoke, &Heap::destroy, &Heap::move};
+					};
+				private:
+					// Операции над объектом задачи
+					const operations_t * _operations;
+				private:
+					// Встроенное хранилище объекта задачи
+					alignas(std::max_align_t) unsigned char _storage[SIZE];
+				public:
+					/**
+					 * @brief Оператор проверки наличия объекта задачи
+					 *
+					 * @return результат проверки
+					 */
+					explicit operator bool() const noexcept {
+						// Выводим результат проверки
+						return (this->_operations != nullptr);
+					}
+					/**
+					 * @brief Оператор исполнения задачи
+					 *
+					 */
+					void operator()(){
+						// Выполняем объект задачи
+						this->_operations->invoke(this->_storage);
+					}
+				public:
+					/**
+					 * @brief Оператор перемещения
+					 *
+					 * @param task задача для перемещения
+					 * @return     текущая задача
+					 */
+					Task & operator = (Task && task) noexcept {
+						// Если задача не является текущей
+						if(this != &task){
+							// Если объект задачи существует
+							if(this->_operations != nullptr)
+								// Выполняем удаление объекта задачи
+								this->_operations->destroy(this->_storage);
+							// Выполняем перемещение операций над объектом задачи
+							this->_operations = task._operations;
+							// Если объект задачи существует
+							if(this->_operations != nullptr)
+								// Выполняем перемещение объекта задачи
+								this->_operations->move(this->_storage, task._storage);
+							// Сбрасываем операции перемещённой задачи
+							task._operations = nullptr;
+						}
+						// Выводим текущую задачу
+						return (* this);
+					}
+					/**
+					 * Запрещаем копирование задачи
+					 */
+					Task & operator = (const Task &) = delete;
+				public:
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Task() noexcept : _operations(nullptr) {}
+					/**
+					 * @brief Конструктор перемещения
+					 *
+					 * @param task задача для перемещения
+					 */
+					Task(Task && task) noexcept : _operations(task._operations) {
+						// Если объект задачи существует
+						if(this->_operations != nullptr)
+							// Выполняем перемещение объекта задачи
+							this->_operations->move(this->_storage, task._storage);
+						// Сбрасываем операции перемещённой задачи
+						task._operations = nullptr;
+					}
+					/**
+					 * Запрещаем копирование задачи
+					 */
+					Task(const Task &) = delete;
+					/**
+					 * @brief Шаблон конструктора задачи из функционального объекта
+					 *
+					 * @tparam Func тип функционального объекта
+					 */
+					template <typename Func, typename = typename enable_if <!is_same <typename decay <Func>::type, Task>::value>::type>
+					/**
+					 * @brief Конструктор задачи из функционального объекта
+					 *
+					 * @param func функциональный объект
+					 */
+					Task(Func && func) : _operations(nullptr) {
+						// Устанавливаем тип функционального объекта
+						using type_t = typename decay <Func>::type;
+						/**
+						 * Если объект помещается во встроенное хранилище
+						 */
+						if constexpr((sizeof(type_t) <= SIZE) && (alignof(type_t) <= alignof(std::max_align_t)) && is_nothrow_move_constructible <type_t>::value){
+							// Размещаем объект задачи во встроенном хранилище
+							::new(this->_storage) type_t(std::forward <Func> (func));
+							// Устанавливаем операции над объектом задачи
+							this->_operations = &Inline <type_t>::operations;
+						// Если объект не помещается во встроенное хранилище
+						} else {
+							// Размещаем объект задачи в динамической памяти
+							(* reinterpret_cast <type_t **> (this->_storage)) = new type_t(std::forward <Func> (func));
+							// Устанавливаем операции над объектом задачи
+							this->_operations = &Heap <type_t>::operations;
+						}
+					}
+					/**
+					 * @brief Деструктор
+					 *
+					 */
+					~Task() noexcept {
+						// Если объект задачи существует
+						if(this->_operations != nullptr)
+							// Выполняем удаление объекта задачи
+							this->_operations->destroy(this->_storage);
+					}
+			} task_t;
+			/**
+			 * @brief Структура метрик исполнителя
+			 *
+			 */
+			typedef struct Stat {
+				uint64_t stolen;     // Количество задач забранных из очередей других потоков
+				uint64_t pending;    // Количество задач ожидающих исполнения
+				uint64_t submitted;  // Количество добавленных задач
+				uint64_t completed;  // Количество исполненных задач
+				uint64_t delay;      // Суммарное время от добавления задачи до начала исполнения в наносекундах
+				uint64_t latency;    // Суммарное время от добавления задачи до завершения исполнения в наносекундах
+				uint64_t delayMax;   // Максимальное время от добавления задачи до начала исполнения в наносекундах
+				uint64_t latencyMax; // Максимальное время от добавления задачи до завершения исполнения в наносекундах
+				/**
+				 * @brief Оператор объединения метрик
+				 *
+				 * @param stat метрики для объединения
+				 * @return     текущие метрики
+				 */
+				Stat & operator += (const Stat & stat) noexcept {
+					// Объединяем количество забранных задач
+					this->stolen += stat.stolen;
+					// Объединяем количество ожидающих задач
+					this->pending += stat.pending;
+					// Объединяем количество добавленных задач
+					this->submitted += stat.submitted;
+					// Объединяем количество исполненных задач
+					this->completed += stat.completed;
+					// Объединяем суммарное время ожидания
+					this->delay += stat.delay;
+					// Объединяем суммарное время исполнения
+					this->latency += stat.latency;
+					// Выбираем максимальное время ожидания
+					this->delayMax = std::max(this->delayMax, stat.delayMax);
+					// Выбираем максимальное время исполнения
+					this->latencyMax = std::max(this->latencyMax, stat.latencyMax);
+					// Выводим текущие метрики
+					return (* this);
+				}
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Stat() noexcept :
+				 stolen(0), pending(0), submitted(0), completed(0),
+				 delay(0), latency(0), delayMax(0), latencyMax(0) {}
+			} stat_t;
+		private:
+			// Максимальное количество задач одного ключа, исполняемых подряд без возврата в очередь
+			static constexpr size_t BATCH = 32;
+		private:
+			/**
+			 * @brief Структура задания в очереди
+			 *
+			 */
+			typedef struct Job {
+				// Флаг задания исполнения цепочки задач ключа
+				bool strand;
+				// Ключ цепочки задач
+				uint64_t key;
+				// Время добавления задачи в наносекундах
+				uint64_t stamp;
+				// Объект задачи
+				task_t task;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Job() noexcept : strand(false), key(0), stamp(0) {}
+			} job_t;
+			/**
+			 * @brief Структура рабочего потока
+			 *
+			 */
+			typedef struct Worker {
+				// Мютекс для блокировки очереди заданий
+				std::mutex mtx;
+				// Очередь заданий рабочего потока
+				std::deque <job_t> jobs;
+			} worker_t;
+		private:
+			// Количество потоков
+			uint16_t _threads;
+		private:
+			// Флаг завершения работы исполнителя
+			std::atomic_bool _stop;
+			// Флаг ожидания завершения работы всех задач
+			std::atomic_bool _wait;
+		private:
+			// Индекс очереди для добавления заданий из внешних потоков
+			std::atomic <size_t> _index;
+			// Количество заданий в очередях рабочих потоков
+			std::atomic <size_t> _pending;
+			// Количество ожидающих рабочих потоков
+			std::atomic <size_t> _sleeping;
+		private:
+			// Количество забранных задач
+			std::atomic <uint64_t> _stolen;
+			// Количество задач ожидающих исполнения
+			std::atomic <uint64_t> _queued;
+			// Количество добавленных задач
+			std::atomic <uint64_t> _submitted;
+			// Количество исполненных задач
+			std::atomic <uint64_t> _completed;
+			// Суммарное время ожидания исполнения задач
+			std::atomic <uint64_t> _delay;
+			// Суммарное время исполнения задач
+			std::atomic <uint64_t> _latency;
+			// Максимальное время ожидания исполнения задачи
+			std::atomic <uint64_t> _delayMax;
+			// Максимальное время исполнения задачи
+			std::atomic <uint64_t> _latencyMax;
+		private:
+			// Мютекс для блокировки ожидания рабочих потоков
+			std::mutex _locker;
+			// Мютекс для блокировки цепочек задач
+			std::mutex _strandMtx;
+			// Условная переменная ожидания заданий
+			std::condition_variable _cv;
+		private:
+			// Список рабочих потоков
+			vector <std::thread> _workers;
+			// Список очередей рабочих потоков
+			vector <unique_ptr <worker_t>> _queues;
+		private:
+			// Список активных цепочек задач по ключам
+			std::unordered_map <uint64_t, std::deque <job_t>> _strands;
+		private:
+			// Объект для работы с логами
+			const log_t * _log;
+		private:
+			/**
+			 * @brief Метод получения текущего времени в наносекундах
+			 *
+			 * @return текущее время в наносекундах
+			 */
+			static uint64_t now() noexcept;
+		private:
+			/**
+			 * @brief Метод обработки очереди заданий в одном потоке
+			 *
+			 * @param index индекс рабочего потока
+			 */
+			void work(const size_t index) noexcept;
+			/**
+			 * @brief Метод исполнения задачи
+			 *
+			 * @param job задание для исполнения
+			 */
+			void execute(job_t & job) noexcept;
+			/**
+			 * @brief Метод исполнения цепочки задач ключа
+			 *
+			 * @param key ключ цепочки задач
+			 */
+			void drain(const uint64_t key) noexcept;
+			/**
+			 * @brief Метод добавления задания в очередь рабочего потока
+			 *
+			 * @param job задание для добавления
+			 */
+			void schedule(job_t && job) noexcept;
+		private:
+			/**
+			 * @brief Метод извлечения задания из собственной очереди
+			 *
+			 * @param index индекс рабочего потока
+			 * @param job   извлечённое задание
+			 * @return      результат извлечения
+			 */
+			bool pop(const size_t index, job_t & job) noexcept;
+			/**
+			 * @brief Метод извлечения задания из очереди другого рабочего потока
+			 *
+			 * @param index индекс рабочего потока
+			 * @param job   извлечённое задание
+			 * @return      результат извлечения
+			 */
+			bool steal(const size_t index, job_t & job) noexcept;
+		private:
+			/**
+			 * @brief Метод добавления задачи
+			 *
+			 * @param strand флаг задачи с ключом
+			 * @param key    ключ цепочки задач
+			 * @param task   объект задачи
+			 * @return       результат добавления
+			 */
+			bool submit(const bool strand, const uint64_t key, task_t && task) noexcept;
+		public:
+			/**
+			 * @brief Метод получения метрик исполнителя
+			 *
+			 * @return метрики исполнителя
+			 */
+			stat_t stat() const noexcept;
+		public:
+			/**
+			 * @brief Метод проверки на инициализацию исполнителя
+			 *
+			 * @return результат проверки
+			 */
+			bool initialized() const noexcept;
+		public:
+			/**
+			 * @brief Метод ожидания выполнения задач
+			 *
+			 */
+			void wait() noexcept;
+			/**
+			 * @brief Метод завершения выполнения задач
+			 *
+			 * Рабочие потоки перед завершением исполняют все задачи, оставшиеся в очередях
+			 *
+			 */
+			void stop() noexcept;
+		public:
+			/**
+			 * @brief Метод инициализации работы исполнителя
+			 *
+			 * @param count количество потоков
+			 */
+			void init(const uint16_t count = 0) noexcept;
+		public:
+			/**
+			 * @brief Шаблон метода добавления задачи
+			 *
+			 * @tparam Func тип данных функции обратного вызова
+			 * @tparam Args аргумента функции обратного вызова
+			 */
+			template <class Func, class ... Args>
+			/**
+			 * @brief Метод добавления задачи без ограничений порядка исполнения
+			 *
+			 * @param func функция для обработки
+			 * @param args аргументы для передачи в функцию
+			 * @return     результат добавления задачи
+			 */
+			bool push(Func && func, Args && ... args) noexcept {
+				// Выполняем добавление задачи
+				return this->submit(false, 0, wrap(std::forward <Func> (func), std::forward <Args> (args)...));
+			}
+			/**
+			 * @brief Шаблон метода добавления задачи с ключом
+			 *
+			 * @tparam Func тип данных функции обратного вызова
+			 * @tparam Args аргумента функции обратного вызова
+			 */
+			template <class Func, class ... Args>
+			/**
+			 * @brief Метод добавления задачи с ключом, задачи одного ключа исполняются по очереди
+			 *
+			 * @param key  ключ цепочки задач (например идентификатор брокера)
+			 * @param func функция для обработки
+			 * @param args аргументы для передачи в функцию
+			 * @return     результат добавления задачи
+			 */
+			bool serial(const uint64_t key, Func && func, Args && ... args) noexcept {
+				// Выполняем добавление задачи
+				return this->submit(true, key, wrap(std::forward <Func> (func), std::forward <Args> (args)...));
+			}
+		private:
+			/**
+			 * @brief Шаблон метода создания задачи
+			 *
+			 * @tparam Func тип данных функции обратного вызова
+			 * @tparam Args аргумента функции обратного вызова
+			 */
+			template <class Func, class ... Args>
+			/**
+			 * @brief Метод создания задачи, аргументы перемещаются в задачу и передаются в функцию при исполнении
+			 *
+			 * @param func функция для обработки
+			 * @param args аргументы для передачи в функцию
+			 * @return     объект задачи
+			 */
+			static task_t wrap(Func && func, Args && ... args) noexcept {
+				// Создаём задачу из функции и её аргументов
+				return task_t([func = std::forward <Func> (func), args = std::make_tuple(std::forward <Args> (args)...)]() mutable {
+					// Выполняем функцию с аргументами задачи
+					std::apply(func, std::move(args));
+				});
+			}
+		public:
+			/**
+			 * @brief Конструктор
+			 *
+			 * @param log   объект для работы с логами
+			 * @param count количество потоков
+			 */
+			Exec(const log_t * log, const uint16_t count = 0) noexcept;
+			/**
+			 * @brief Деструктор
+			 *
+			 */
+			~Exec() noexcept;
+	} exec_t;
+};
+
+#endif // __AWH_EXECUTOR__
@@ -18,6 +18,9 @@
 /**
  * Стандартные модули
  */
+#include <mutex>
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <cstdio>
@@ -163,6 +166,37 @@ namespace awh {
 				SHA384 = 0x05, // Хэш SHA384
 				SHA512 = 0x06  // Хэш SHA512
 			};
+		private:
+			/**
+			 * @brief Структура контекста ZLib в пуле готовых контекстов
+			 *
+			 */
+			typedef struct Context {
+				// Размер скользящего окна
+				int16_t wbit;
+				// Уровень компрессии
+				int32_t level;
+				// Событие выполнения операции
+				event_t event;
+				// Поток ZLib
+				z_stream * stream;
+				/**
+				 * @brief Конструктор
+				 *
+				 */
+				Context() noexcept : wbit(0), level(0), event(event_t::NONE), stream(nullptr) {}
+			} context_t;
+		private:
+			// Мютекс для блокировки пула контекстов
+			static std::mutex _mtx;
+			// Время простоя контекста компрессии до его освобождения
+			static std::atomic <time_t> _idle;
+			// Максимальный размер пула контекстов
+			static size_t _capacity;
+			// Пул готовых контекстов ZLib
+			static vector <context_t> _pool;
+			// Количество созданных контекстов ZLib
+			static std::atomic <size_t> _contexts;
 		private:
 			// Стейт шифрования
 			state_t _state;
@@ -186,13 +220,52 @@ namespace awh {
 			// Хвостовой буфер для удаления из финального сообщения
 			const char _btype[4];
 		private:
-			// Создаем поток ZLib для декомпрессии
-			mutable z_stream _zinf;
-			// Создаем поток ZLib для компрессии
-			mutable z_stream _zdef;
+			// Время последнего использования контекста компрессии
+			mutable uint64_t _used;
+		private:
+			// Поток ZLib для декомпрессии (создаётся при первом использовании)
+			mutable z_stream * _zinf;
+			// Поток ZLib для компрессии (создаётся при первом использовании)
+			mutable z_stream * _zdef;
 		private:
 			// Объект работы с логами
 			const log_t * _log;
+		private:
+			/**
+			 * @brief Метод получения контекста ZLib из пула или создания нового
+			 *
+			 * @param event событие выполнения операции
+			 * @param wbit  размер скользящего окна
+			 * @param level уровень компрессии
+			 * @param log   объект для работы с логами
+			 * @return      поток ZLib
+			 */
+			static z_stream * acquire(const event_t event, const int16_t wbit, const int32_t level, const log_t * log) noexcept;
+			/**
+			 * @brief Метод возврата контекста ZLib в пул или его освобождения
+			 *
+			 * @param stream поток ZLib
+			 * @param event  событие выполнения операции
+			 * @param wbit   размер скользящего окна
+			 * @param level  уровень компрессии
+			 */
+			static void release(z_stream * stream, const event_t event, const int16_t wbit, const int32_t level) noexcept;
+		private:
+			/**
+			 * @brief Шаблон метода компрессии и декомпрессии методом Deflate
+			 *
+			 * @tparam T тип буфера результата
+			 */
+			template <typename T>
+			/**
+			 * @brief Метод компрессии и декомпрессии методом Deflate
+			 *
+			 * @param buffer буфер данных для обработки
+			 * @param size   размер данных для обработки
+			 * @param event  событие выполнения операции
+			 * @param result буфер куда следует положить результат
+			 */
+			void deflate(const char * buffer, const size_t size, const event_t event, T & result) const noexcept;
 		private:
 			/**
 			 * @brief Метод инициализации AES шифрования
@@ -462,6 +535,35 @@ namespace awh {
 			 * @param flag флаг переиспользования контекста декомпрессии
 			 */
 			void takeoverDecompress(const bool flag) noexcept;
+		public:
+			/**
+			 * @brief Метод освобождения контекста компрессии, простаивающего дольше допустимого
+			 *
+			 * Контекст декомпрессии не освобождается, так-как при переиспользовании контекста
+			 * удалённая сторона может ссылаться на ранее переданные данные. Вызывается под той же
+			 * блокировкой, под которой выполняется компрессия сообщений
+			 */
+			void trim() noexcept;
+		public:
+			/**
+			 * @brief Метод получения количества созданных контекстов ZLib (включая контексты в пуле)
+			 *
+			 * @return количество созданных контекстов
+			 */
+			static size_t contexts() noexcept;
+		public:
+			/**
+			 * @brief Метод установки времени простоя контекста компрессии до его освобождения
+			 *
+			 * @param msec время простоя в миллисекундах (0 - контекст не освобождается)
+			 */
+			static void idle(const time_t msec) noexcept;
+			/**
+			 * @brief Метод установки максимального размера пула готовых контекстов ZLib
+			 *
+			 * @param size максимальный размер пула (0 - пул не используется)
+			 */
+			static void pool(const size_t size) noexcept;
 		public:
 			/**
 			 * @brief Конструктор
@@ -66,6 +66,8 @@
 #define DIGEST_ALIVE_NONCE 1800000
 // Максимальный размер файла логов в байтах
 #define MAX_SIZE_LOGFILE 0xFA000
+// Время жизни сессии TLS и период ротации ключей сессионных билетов в секундах
+#define TLS_SESSION_LIFETIME 3600
 
 /**
  * Размеры буферов данных
@@ -85,6 +87,20 @@
 #define AWH_BUFFER_SIZE_RCV 0x8000
 // Размер буфера на запись
 #define AWH_BUFFER_SIZE_SND 0x8000
+// Размер кольцевого буфера кластера в разделяемой памяти (на одно направление)
+#define AWH_CLUSTER_RING_SIZE 0x100000
+// Максимальный объём сообщений кластера ожидающих освобождения места в кольцевом буфере
+#define AWH_CLUSTER_RING_BACKLOG 0x4000000
+// Интервал отправки дочерним процессом сведений о нагрузке (мс)
+#define AWH_CLUSTER_LOAD_INTERVAL 0x3E8
+// Задержка цикла событий после которой дочерний процесс считается перегруженным (мкс)
+#define AWH_CLUSTER_LAG_LIMIT 0xC350
+// Количество ячеек общего кэша сессий TLS
+#define AWH_TLS_SESSIONS 0x400
+// Максимальный размер сериализованной сессии TLS
+#define AWH_TLS_SESSION_SIZE 0x800
+// Количество попыток захвата ячейки общего кэша сессий TLS
+#define AWH_TLS_SESSION_SPINS 0x400
 
 /**
  * HTTP заголовки по умолчанию
@@ -158,6 +174,10 @@
 #define SERVER_HOST "127.0.0.1"
 // Максимальное количество запросов к серверу на одно подключение
 #define SERVER_MAX_REQUESTS 0
+// Максимальная глубина конвейера HTTP-запросов ожидающих ответа на одно подключение
+#define SERVER_PIPELINE_DEPTH 16
+// Максимальный объём данных конвейера HTTP-запросов накопленных в буфере подключения
+#define SERVER_PIPELINE_SIZE 0x100000
 // Количество максимальных подключений к серверу
 #define SERVER_TOTAL_CONNECT 1000
 
@@ -128,6 +128,11 @@ namespace awh {
 				 * Устанавливаем максимальную версию фрейма
 				 */
 				static constexpr uint32_t MAX_FRAME_SIZE = numeric_limits <uint32_t>::max();
+			public:
+				/**
+				 * Максимальный размер заголовка фрейма вместе с ключом маски
+				 */
+				static constexpr size_t MAX_HEAD_SIZE = 14;
 			public:
 				/**
 				 * Состояние фрейма
@@ -180,6 +185,30 @@ namespace awh {
 				const fmk_t * _fmk;
 				// Объект работы с логами
 				const log_t * _log;
+			private:
+				/**
+				 * @brief Метод разбора заголовка фрейма и проверки его целостности
+				 *
+				 * @param head   заголовки фрейма
+				 * @param buffer бинарные данные фрейма
+				 * @param size   размер передаваемого буфера
+				 * @param key    буфер для записи ключа маски
+				 * @return       смещение полезной нагрузки в буфере (0, если фрейм получен не полностью или испорчен)
+				 */
+				size_t parse(head_t & head, const void * buffer, const size_t size, uint8_t * key) const noexcept;
+			public:
+				/**
+				 * @brief Метод наложения маски на данные
+				 *
+				 * Данные обрабатываются векторами AVX2, SSE2 или NEON (в зависимости от архитектуры)
+				 * и машинными словами по 64 бита, входной и выходной буферы могут совпадать
+				 *
+				 * @param output буфер для записи результата
+				 * @param input  буфер данных для маскирования
+				 * @param size   размер данных для маскирования
+				 * @param key    ключ маски из 4-х байт
+				 */
+				static void mask(void * output, const void * input, const size_t size, const uint8_t * key) noexcept;
 			public:
 				/**
 				 * @brief Метод создание фрейма сообщения
@@ -260,6 +289,27 @@ namespace awh {
 				 * @return       бинарные данные фрейма
 				 */
 				vector <char> set(const head_t & head, const void * buffer, const size_t size) const noexcept;
+			public:
+				/**
+				 * @brief Метод извлечения данных фрейма с размаскированием внутри переданного буфера
+				 *
+				 * @param head   заголовки фрейма
+				 * @param buffer бинарные данные фрейма для извлечения
+				 * @param size   размер передаваемого буфера
+				 * @return       указатель на полезную нагрузку размером head.payload внутри буфера
+				 */
+				const char * decode(head_t & head, void * buffer, const size_t size) const noexcept;
+				/**
+				 * @brief Метод создания фрейма в буфере вызывающей стороны
+				 *
+				 * @param head     заголовки фрейма
+				 * @param buffer   бинарные данные полезной нагрузки
+				 * @param size     размер передаваемого буфера
+				 * @param output   буфер для записи фрейма (достаточно size + MAX_HEAD_SIZE байт)
+				 * @param capacity размер буфера для записи фрейма
+				 * @return         размер записанного фрейма (0, если места в буфере недостаточно)
+				 */
+				size_t encode(const head_t & head, const void * buffer, const size_t size, void * output, const size_t capacity) const noexcept;
 			public:
 				/**
 				 * @brief Конструктор
@@ -0,0 +1,238 @@
+/**
+ * @file: topics.hpp
+ * @date: 2025-03-10
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+#ifndef __AWH_WS_TOPICS__
+#define __AWH_WS_TOPICS__
+
+/**
+ * Стандартные модули
+ */
+#include <set>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Наши модули
+ */
+#include "../sys/log.hpp"
+
+/**
+ * @brief пространство имён
+ *
+ */
+namespace awh {
+	/**
+	 * Подписываемся на стандартное пространство имён
+	 */
+	using namespace std;
+	/**
+	 * @brief пространство имён
+	 *
+	 */
+	namespace ws {
+		/**
+		 * @brief Класс реестра тем рассылки сообщений подписчикам
+		 *
+		 * Сообщение темы создаётся один раз и разделяется между всеми подписчиками, фреймы
+		 * сообщения кэшируются по параметрам компрессии и фрагментации, поэтому подписчики
+		 * с одинаковыми согласованными параметрами получают один и тот же буфер
+		 *
+		 */
+		typedef class AWHSHARED_EXPORT Topics {
+			public:
+				/**
+				 * Политики обработки медленных подписчиков
+				 */
+				enum class policy_t : uint8_t {
+					NONE     = 0x00, // Сообщение ставится в очередь подписчика без ограничений
+					DROP     = 0x01, // Сообщение пропускается, если очередь подписчика переполнена
+					COALESCE = 0x02  // Сохраняется только последнее сообщение, оно отправляется после освобождения очереди
+				};
+			public:
+				/**
+				 * @brief Структура публикуемого сообщения
+				 *
+				 */
+				typedef struct Message {
+					// Флаг текстового сообщения
+					bool text;
+					// Полезная нагрузка сообщения
+					vector <char> payload;
+					// Мютекс для блокировки кэша фреймов
+					std::mutex mtx;
+					// Кэш сформированных фреймов по параметрам компрессии и фрагментации
+					std::map <uint64_t, std::shared_ptr <const vector <char>>> frames;
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Message() noexcept : text(true) {}
+				} message_t;
+				/**
+				 * @brief Структура статистики темы
+				 *
+				 */
+				typedef struct Stat {
+					uint64_t sent;      // Количество сообщений поставленных в очередь подписчиков
+					uint64_t dropped;   // Количество сообщений пропущенных для медленных подписчиков
+					uint64_t published; // Количество опубликованных сообщений
+					uint64_t coalesced; // Количество сообщений заменённых более новыми
+					size_t subscribers; // Количество подписчиков темы
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Stat() noexcept : sent(0), dropped(0), published(0), coalesced(0), subscribers(0) {}
+				} stat_t;
+			private:
+				/**
+				 * @brief Структура темы рассылки
+				 *
+				 */
+				typedef struct Topic {
+					// Максимальный размер очереди подписчика
+					size_t limit;
+					// Объект статистики темы
+					stat_t stat;
+					// Политика обработки медленных подписчиков
+					policy_t policy;
+					// Список подписчиков темы
+					std::set <uint64_t> subscribers;
+					/**
+					 * @brief Конструктор
+					 *
+					 */
+					Topic() noexcept : limit(0), policy(policy_t::NONE) {}
+				} topic_t;
+			private:
+				// Мютекс для блокировки потока
+				mutable std::recursive_mutex _mtx;
+			private:
+				// Список тем рассылки
+				std::unordered_map <string, topic_t> _topics;
+				// Список тем на которые подписан брокер
+				std::unordered_map <uint64_t, std::set <string>> _brokers;
+				// Список отложенных сообщений брокеров
+				std::unordered_map <uint64_t, std::map <string, std::shared_ptr <message_t>>> _deferred;
+			private:
+				// Объект работы с логами
+				const log_t * _log;
+			public:
+				/**
+				 * @brief Метод очистки реестра тем
+				 *
+				 */
+				void clear() noexcept;
+			public:
+				/**
+				 * @brief Метод удаления брокера из всех тем
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				void erase(const uint64_t bid) noexcept;
+			public:
+				/**
+				 * @brief Метод подписки брокера на тему
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 * @return      результат подписки
+				 */
+				bool subscribe(const string & topic, const uint64_t bid) noexcept;
+				/**
+				 * @brief Метод отписки брокера от темы
+				 *
+				 * @param topic название темы
+				 * @param bid   идентификатор брокера
+				 */
+				void unsubscribe(const string & topic, const uint64_t bid) noexcept;
+			public:
+				/**
+				 * @brief Метод установки политики обработки медленных подписчиков
+				 *
+				 * @param topic  название темы
+				 * @param policy политика обработки медленных подписчиков
+				 * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+				 */
+				void policy(const string & topic, const policy_t policy, const size_t limit) noexcept;
+			public:
+				/**
+				 * @brief Метод получения статистики темы
+				 *
+				 * @param topic название темы
+				 * @return      статистика темы
+				 */
+				stat_t stat(const string & topic) const noexcept;
+			public:
+				/**
+				 * @brief Метод создания публикуемого сообщения
+				 *
+				 * @param topic  название темы
+				 * @param buffer буфер полезной нагрузки сообщения
+				 * @param size   размер полезной нагрузки сообщения
+				 * @param text   данные передаются в текстовом виде
+				 * @return       публикуемое сообщение (пустое значение, если у темы нет подписчиков)
+				 */
+				std::shared_ptr <message_t> message(const string & topic, const char * buffer, const size_t size, const bool text) noexcept;
+			public:
+				/**
+				 * @brief Метод получения списка подписчиков темы
+				 *
+				 * @param topic название темы
+				 * @return      список идентификаторов брокеров подписчиков
+				 */
+				vector <uint64_t> subscribers(const string & topic) const noexcept;
+			public:
+				/**
+				 * @brief Метод проверки допуска сообщения в очередь подписчика
+				 *
+				 * Если очередь подписчика переполнена, сообщение пропускается или откладывается
+				 * в соответствии с политикой темы
+				 *
+				 * @param topic   название темы
+				 * @param bid     идентификатор брокера подписчика
+				 * @param queued  количество байт в очереди отправки подписчика
+				 * @param message публикуемое сообщение
+				 * @return        сообщение следует отправить подписчику немедленно
+				 */
+				bool admit(const string & topic, const uint64_t bid, const size_t queued, const std::shared_ptr <message_t> & message) noexcept;
+				/**
+				 * @brief Метод извлечения отложенных сообщений подписчика
+				 *
+				 * @param bid    идентификатор брокера подписчика
+				 * @param queued количество байт в очереди отправки подписчика
+				 * @return       список сообщений, которые можно отправить подписчику
+				 */
+				vector <std::shared_ptr <message_t>> release(const uint64_t bid, const size_t queued) noexcept;
+			public:
+				/**
+				 * @brief Конструктор
+				 *
+				 * @param log объект для работы с логами
+				 */
+				Topics(const log_t * log) noexcept : _log(log) {}
+				/**
+				 * @brief Деструктор
+				 *
+				 */
+				~Topics() noexcept {}
+		} topics_t;
+	};
+};
+
+#endif // __AWH_WS_TOPICS__
@@ -0,0 +1,591 @@
+/**
+ * @file: broadcast.cpp
+ * @date: 2025-03-10
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/epoll.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/resource.h>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <core/timer.hpp>
+#include <server/ws.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Подписываемся на пространство имён заполнителя
+ */
+using namespace placeholders;
+
+/**
+ * Название темы рассылки
+ */
+static const string TOPIC = "ticks";
+
+/**
+ * Режимы рассылки сообщений
+ */
+enum class delivery_t : uint8_t {
+	UNICAST = 0x00, // Сообщение отправляется каждому подписчику отдельно
+	PUBLISH = 0x01, // Сообщение публикуется в тему один раз
+	DROP    = 0x02  // Сообщение публикуется в тему с пропуском для медленных подписчиков
+};
+
+/**
+ * @brief Функция получения текущего времени в наносекундах
+ *
+ * @return время монотонных часов в наносекундах, общее для всех процессов
+ */
+static uint64_t now() noexcept {
+	// Выводим текущее время
+	return static_cast <uint64_t> (chrono::duration_cast <chrono::nanoseconds> (chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Класс объекта сервера замеров
+ *
+ */
+class Server {
+	private:
+		// Режим рассылки сообщений
+		delivery_t _mode;
+	private:
+		// Количество подписчиков
+		uint32_t _subscribers;
+		// Количество сообщений для рассылки
+		uint32_t _messages;
+		// Количество отключившихся подписчиков
+		uint32_t _disconnected;
+		// Количество разосланных сообщений
+		uint32_t _published;
+	private:
+		// Полезная нагрузка сообщения
+		vector <char> _payload;
+		// Список подписчиков
+		vector <uint64_t> _brokers;
+	private:
+		// Объект таймера рассылки
+		awh::timer_t * _timer;
+		// Объект сетевого ядра
+		server::core_t * _core;
+		// Объект Websocket-сервера
+		server::websocket_t * _ws;
+	public:
+		/**
+		 * @brief Метод события запуска сервера
+		 *
+		 * @param host хост сервера
+		 * @param port порт сервера
+		 */
+		void launched([[maybe_unused]] const string & host, [[maybe_unused]] const uint32_t port){
+			// Выполняем биндинг таймера рассылки
+			this->_core->bind(this->_timer);
+		}
+		/**
+		 * @brief Метод идентификации активности на сервере
+		 *
+		 * @param bid  идентификатор брокера
+		 * @param mode режим события подключения
+		 */
+		void active([[maybe_unused]] const uint64_t bid, const server::web_t::mode_t mode){
+			// Если все подписчики отключились, замеры завершены
+			if((mode == server::web_t::mode_t::DISCONNECT) && (++this->_disconnected == this->_subscribers))
+				// Выполняем остановку сервера
+				this->_core->stop();
+		}
+		/**
+		 * @brief Метод получения сообщения подписки
+		 *
+		 * @param bid     идентификатор брокера
+		 * @param message сообщение подписчика
+		 * @param text    данные переданы в текстовом виде
+		 */
+		void message(const uint64_t bid, [[maybe_unused]] const vector <char> & message, [[maybe_unused]] const bool text){
+			// Выполняем подписку брокера на тему
+			this->_ws->subscribe(TOPIC, bid);
+			// Добавляем брокера в список подписчиков
+			this->_brokers.push_back(bid);
+			// Если подписались все подписчики
+			if(this->_brokers.size() == static_cast <size_t> (this->_subscribers)){
+				// Устанавливаем интервал рассылки сообщений
+				const uint16_t tid = this->_timer->interval(1);
+				// Выполняем добавление функции обратного вызова
+				this->_timer->on(tid, &Server::tick, this, tid);
+			}
+		}
+		/**
+		 * @brief Метод рассылки очередного сообщения
+		 *
+		 * @param tid идентификатор таймера
+		 */
+		void tick(const uint16_t tid){
+			// Если все сообщения разосланы
+			if(this->_published++ >= this->_messages){
+				// Останавливаем таймер рассылки
+				this->_timer->clear(tid);
+				// Выходим из функции
+				return;
+			}
+			// Устанавливаем время отправки сообщения
+			const uint64_t stamp = now();
+			// Копируем время отправки в начало полезной нагрузки
+			::memcpy(this->_payload.data(), &stamp, sizeof(stamp));
+			// Если сообщение отправляется каждому подписчику отдельно
+			if(this->_mode == delivery_t::UNICAST){
+				// Выполняем перебор всех подписчиков
+				for(auto & bid : this->_brokers)
+					// Отправляем сообщение подписчику
+					this->_ws->sendMessage(bid, this->_payload, false);
+			// Выполняем публикацию сообщения в тему
+			} else this->_ws->publish(TOPIC, this->_payload, false);
+		}
+	public:
+		/**
+		 * @brief Метод вывода статистики темы
+		 *
+		 * @param log объект для работы с логами
+		 */
+		void print(const log_t * log) const {
+			// Получаем статистику темы
+			const auto & stat = this->_ws->topic(TOPIC);
+			// Выводим статистику темы
+			log->print("Topic: published: %llu, sent: %llu, dropped: %llu", log_t::flag_t::INFO, stat.published, stat.sent, stat.dropped);
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param mode        режим рассылки сообщений
+		 * @param subscribers количество подписчиков
+		 * @param messages    количество сообщений для рассылки
+		 * @param size        размер сообщения
+		 * @param timer       объект таймера рассылки
+		 * @param core        объект сетевого ядра
+		 * @param ws          объект Websocket-сервера
+		 */
+		Server(const delivery_t mode, const uint32_t subscribers, const uint32_t messages, const size_t size, awh::timer_t * timer, server::core_t * core, server::websocket_t * ws) :
+		 _mode(mode), _subscribers(subscribers), _messages(messages), _disconnected(0), _published(0),
+		 _payload(std::max(size, sizeof(uint64_t)), 'x'), _timer(timer), _core(core), _ws(ws) {}
+};
+
+/**
+ * @brief Класс объекта подписчиков замеров
+ *
+ */
+class Subscribers {
+	private:
+		// Файловый дескриптор epoll
+		int32_t _efd;
+		// Количество сообщений, которые должен получить каждый подписчик
+		uint32_t _messages;
+	private:
+		// Список сокетов подписчиков
+		vector <int32_t> _sockets;
+		// Список буферов входящих данных подписчиков
+		vector <vector <char>> _buffers;
+	private:
+		// Список задержек доставки сообщений в наносекундах
+		vector <uint64_t> _latencies;
+	private:
+		// Время получения первого и последнего сообщения
+		uint64_t _first, _last;
+	private:
+		/**
+		 * @brief Метод разбора фреймов сервера
+		 *
+		 * @param buffer буфер входящих данных подписчика
+		 */
+		void frames(vector <char> & buffer){
+			// Смещение в буфере
+			size_t offset = 0;
+			/**
+			 * Выполняем разбор всех полностью полученных фреймов
+			 */
+			while((buffer.size() - offset) >= 2){
+				// Получаем данные фрейма
+				const uint8_t * data = reinterpret_cast <const uint8_t *> (buffer.data() + offset);
+				// Размер заголовка и полезной нагрузки
+				size_t head = 2, size = (data[1] & 0x7F);
+				// Если размер полезной нагрузки передан двумя байтами
+				if(size == 126){
+					// Если заголовок получен не полностью
+					if((buffer.size() - offset) < 4)
+						// Выходим из цикла
+						break;
+					// Получаем размер полезной нагрузки
+					size = ((static_cast <size_t> (data[2]) << 8) | data[3]);
+					// Увеличиваем размер заголовка
+					head = 4;
+				// Если размер полезной нагрузки передан восемью байтами
+				} else if(size == 127) {
+					// Если заголовок получен не полностью
+					if((buffer.size() - offset) < 10)
+						// Выходим из цикла
+						break;
+					// Сбрасываем размер полезной нагрузки
+					size = 0;
+					// Выполняем чтение размера полезной нагрузки
+					for(uint8_t i = 0; i < 8; i++)
+						// Добавляем очередной байт размера
+						size = ((size << 8) | data[2 + i]);
+					// Увеличиваем размер заголовка
+					head = 10;
+				}
+				// Если фрейм получен не полностью
+				if((buffer.size() - offset) < (head + size))
+					// Выходим из цикла
+					break;
+				// Если получен бинарный фрейм с временем отправки
+				if(((data[0] & 0x0F) == 0x02) && (size >= sizeof(uint64_t))){
+					// Время отправки сообщения
+					uint64_t stamp = 0;
+					// Получаем время отправки сообщения
+					::memcpy(&stamp, data + head, sizeof(stamp));
+					// Запоминаем время получения сообщения
+					this->_last = now();
+					// Если это первое полученное сообщение
+					if(this->_first == 0)
+						// Запоминаем время получения первого сообщения
+						this->_first = stamp;
+					// Запоминаем задержку доставки сообщения
+					this->_latencies.push_back(this->_last - stamp);
+				}
+				// Увеличиваем смещение в буфере
+				offset += (head + size);
+			}
+			// Удаляем разобранные фреймы
+			buffer.erase(buffer.begin(), buffer.begin() + offset);
+		}
+	public:
+		/**
+		 * @brief Метод подключения подписчиков к серверу
+		 *
+		 * @param port  порт сервера
+		 * @param count количество подписчиков
+		 * @return      результат подключения
+		 */
+		bool connect(const uint32_t port, const uint32_t count){
+			// Создаём объект адреса сервера
+			struct sockaddr_in addr;
+			// Выполняем очистку адреса сервера
+			::memset(&addr, 0, sizeof(addr));
+			// Устанавливаем семейство протоколов
+			addr.sin_family = AF_INET;
+			// Устанавливаем порт сервера
+			addr.sin_port = htons(static_cast <uint16_t> (port));
+			// Устанавливаем адрес сервера
+			addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			// Запрос рукопожатия Websocket
+			const string request = "GET / HTTP/1.1\r\nHost: 127.0.0.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+			                       "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+			// Маскированный текстовый фрейм подписки (ключ маски нулевой)
+			const char subscribe[] = {'\x81', '\x89', '\x00', '\x00', '\x00', '\x00', 's', 'u', 'b', 's', 'c', 'r', 'i', 'b', 'e'};
+			// Выполняем подключение всех подписчиков
+			for(uint32_t i = 0; i < count; i++){
+				// Создаём сокет подписчика
+				const int32_t fd = ::socket(AF_INET, SOCK_STREAM, 0);
+				// Если сокет не создан или подключение не выполнено
+				if((fd < 0) || (::connect(fd, reinterpret_cast <struct sockaddr *> (&addr), sizeof(addr)) < 0))
+					// Сообщаем, что подключение не выполнено
+					return false;
+				// Отключаем алгоритм Нейгла
+				const int32_t nodelay = 1;
+				// Устанавливаем параметры сокета
+				::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+				// Отправляем запрос рукопожатия
+				if(::send(fd, request.data(), request.size(), 0) != static_cast <ssize_t> (request.size()))
+					// Сообщаем, что подключение не выполнено
+					return false;
+				// Ответ сервера
+				string response = "";
+				// Буфер для чтения ответа
+				char buffer[1024];
+				/**
+				 * Выполняем чтение ответа пока не получим все заголовки
+				 */
+				while(response.find("\r\n\r\n") == string::npos){
+					// Выполняем чтение ответа
+					const ssize_t bytes = ::recv(fd, buffer, sizeof(buffer), 0);
+					// Если подключение закрыто
+					if(bytes <= 0)
+						// Сообщаем, что подключение не выполнено
+						return false;
+					// Добавляем полученные данные
+					response.append(buffer, bytes);
+				}
+				// Если рукопожатие не выполнено
+				if(response.find(" 101 ") == string::npos)
+					// Сообщаем, что подключение не выполнено
+					return false;
+				// Отправляем сообщение подписки
+				::send(fd, subscribe, sizeof(subscribe), 0);
+				// Переводим сокет в неблокирующий режим
+				::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+				// Создаём событие чтения
+				struct epoll_event event;
+				// Устанавливаем тип события
+				event.events = EPOLLIN;
+				// Устанавливаем индекс подписчика
+				event.data.u32 = static_cast <uint32_t> (this->_sockets.size());
+				// Добавляем сокет в epoll
+				::epoll_ctl(this->_efd, EPOLL_CTL_ADD, fd, &event);
+				// Добавляем сокет в список подписчиков
+				this->_sockets.push_back(fd);
+				// Добавляем буфер подписчика, остаток ответа уже может содержать фреймы
+				this->_buffers.emplace_back(response.begin() + (response.find("\r\n\r\n") + 4), response.end());
+			}
+			// Сообщаем, что подключение выполнено
+			return true;
+		}
+		/**
+		 * @brief Метод получения сообщений
+		 *
+		 */
+		void receive(){
+			// Количество ожидаемых сообщений
+			const size_t total = (static_cast <size_t> (this->_messages) * this->_sockets.size());
+			// Резервируем память для задержек доставки
+			this->_latencies.reserve(total);
+			// Список полученных событий
+			vector <struct epoll_event> events(256);
+			// Буфер для чтения данных
+			vector <char> buffer(0x10000);
+			// Выполняем разбор данных, полученных вместе с ответом рукопожатия
+			for(auto & item : this->_buffers)
+				// Выполняем разбор фреймов
+				this->frames(item);
+			/**
+			 * Выполняем чтение сообщений пока все они не получены или сервер не замолчит на 3 секунды
+			 */
+			while(this->_latencies.size() < total){
+				// Ожидаем событий чтения
+				const int32_t count = ::epoll_wait(this->_efd, events.data(), static_cast <int32_t> (events.size()), 3000);
+				// Если событий нет
+				if(count <= 0)
+					// Выходим из цикла
+					break;
+				// Выполняем перебор всех событий
+				for(int32_t i = 0; i < count; i++){
+					// Получаем индекс подписчика
+					const uint32_t index = events[i].data.u32;
+					/**
+					 * Выполняем чтение всех доступных данных
+					 */
+					for(;;){
+						// Выполняем чтение данных
+						const ssize_t bytes = ::recv(this->_sockets[index], buffer.data(), buffer.size(), 0);
+						// Если данные не получены
+						if(bytes <= 0)
+							// Выходим из цикла
+							break;
+						// Добавляем полученные данные в буфер подписчика
+						this->_buffers[index].insert(this->_buffers[index].end(), buffer.data(), buffer.data() + bytes);
+					}
+					// Выполняем разбор фреймов
+					this->frames(this->_buffers[index]);
+				}
+			}
+		}
+	public:
+		/**
+		 * @brief Метод вывода результата замеров
+		 *
+		 * @param name название режима рассылки
+		 * @param log  объект для работы с логами
+		 */
+		void print(const char * name, const log_t * log){
+			// Количество ожидаемых сообщений
+			const size_t total = (static_cast <size_t> (this->_messages) * this->_sockets.size());
+			// Если сообщения не получены
+			if(this->_latencies.empty()){
+				// Выводим сообщение об ошибке
+				log->print("Mode: %s, no messages received", log_t::flag_t::CRITICAL, name);
+				// Выходим из функции
+				return;
+			}
+			// Выполняем сортировку задержек доставки
+			std::sort(this->_latencies.begin(), this->_latencies.end());
+			// Получаем время рассылки в секундах
+			const double seconds = (static_cast <double> (this->_last - this->_first) / 1000000000.);
+			// Получаем медианную задержку доставки
+			const double p50 = (this->_latencies[this->_latencies.size() / 2] / 1000000.);
+			// Получаем задержку доставки 99-го перцентиля
+			const double p99 = (this->_latencies[(this->_latencies.size() * 99) / 100] / 1000000.);
+			// Выводим результат замеров
+			log->print("Mode: %s, delivered: %zu of %zu, rate: %.0f msg/s, p50: %.2f ms, p99: %.2f ms", log_t::flag_t::INFO, name, this->_latencies.size(), total, (seconds > 0. ? (this->_latencies.size() / seconds) : 0.), p50, p99);
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param messages количество сообщений, которые должен получить каждый подписчик
+		 */
+		Subscribers(const uint32_t messages) :
+		 _efd(::epoll_create1(0)), _messages(messages), _first(0), _last(0) {}
+		/**
+		 * @brief Деструктор
+		 *
+		 */
+		~Subscribers(){
+			// Выполняем закрытие всех сокетов подписчиков
+			for(auto & fd : this->_sockets)
+				// Закрываем сокет подписчика
+				::close(fd);
+			// Закрываем файловый дескриптор epoll
+			::close(this->_efd);
+		}
+};
+
+/**
+ * @brief Функция запуска Websocket-сервера в дочернем процессе
+ *
+ * @param port        порт сервера
+ * @param mode        режим рассылки сообщений
+ * @param subscribers количество подписчиков
+ * @param messages    количество сообщений для рассылки
+ * @param size        размер сообщения
+ */
+static void run(const uint32_t port, const delivery_t mode, const uint32_t subscribers, const uint32_t messages, const size_t size) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Создаём объект таймера рассылки
+	awh::timer_t timer(&fmk, &log);
+	// Создаём объект сетевого ядра
+	server::core_t core(&fmk, &log);
+	// Создаём объект Websocket-сервера
+	server::websocket_t ws(&core, &fmk, &log);
+	// Создаём объект сервера замеров
+	Server executor(mode, subscribers, messages, size, &timer, &core, &ws);
+	// Устанавливаем название сервиса
+	log.name("BROADCAST Benchmark");
+	// Запрещаем вывод информационных сообщений и выполнение пингов
+	ws.mode({
+		server::web_t::flag_t::NOT_INFO,
+		server::web_t::flag_t::NOT_PING
+	});
+	// Устанавливаем активный протокол подключения
+	core.proto(awh::engine_t::proto_t::HTTP1_1);
+	// Устанавливаем тип сокета
+	core.sonet(awh::scheme_t::sonet_t::TCP);
+	// Запрещаем перехват сигналов
+	core.signalInterception(awh::scheme_t::mode_t::DISABLED);
+	// Устанавливаем максимальное количество одновременных подключений
+	ws.total(static_cast <uint16_t> (std::min(subscribers + 1, 0xFFFFu)));
+	// Выполняем инициализацию Websocket-сервера
+	ws.init(port, "127.0.0.1");
+	// Если медленные подписчики пропускают сообщения
+	if(mode == delivery_t::DROP)
+		// Устанавливаем политику пропуска сообщений при очереди больше 64Kb
+		ws.policy(TOPIC, awh::ws::topics_t::policy_t::DROP, 0x10000);
+	// Установливаем функцию обратного вызова для выполнения события запуска сервера
+	ws.on <void (const string &, const uint32_t)> ("launched", &Server::launched, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие запуска или остановки подключения
+	ws.on <void (const uint64_t, const server::web_t::mode_t)> ("active", &Server::active, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие получения сообщений
+	ws.on <void (const uint64_t, const vector <char> &, const bool)> ("messageWebsocket", &Server::message, &executor, _1, _2, _3);
+	// Выполняем запуск Websocket-сервера
+	ws.start();
+	// Если сообщения публиковались в тему
+	if(mode != delivery_t::UNICAST)
+		// Выводим статистику темы
+		executor.print(&log);
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Порт сервера для замеров
+	const uint32_t port = 2229;
+	// Количество подписчиков
+	const uint32_t subscribers = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 1000);
+	// Количество сообщений для рассылки
+	const uint32_t messages = (argc > 2 ? static_cast <uint32_t> (::atoi(argv[2])) : 1000);
+	// Размер сообщения
+	const size_t size = (argc > 3 ? static_cast <size_t> (::atoll(argv[3])) : 0x100);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("BROADCAST Benchmark");
+	// Объект ограничения количества файловых дескрипторов
+	struct rlimit limit;
+	// Если ограничение получено
+	if(::getrlimit(RLIMIT_NOFILE, &limit) == 0){
+		// Увеличиваем ограничение до максимально допустимого, подписчики и сервер открывают сокеты
+		limit.rlim_cur = limit.rlim_max;
+		// Устанавливаем новое ограничение
+		::setrlimit(RLIMIT_NOFILE, &limit);
+	}
+	// Список режимов рассылки сообщений
+	const std::pair <const char *, delivery_t> modes[] = {
+		{"unicast", delivery_t::UNICAST},
+		{"publish", delivery_t::PUBLISH},
+		{"drop", delivery_t::DROP}
+	};
+	// Выполняем замеры для каждого режима рассылки
+	for(auto & mode : modes){
+		// Создаём дочерний процесс сервера
+		const pid_t pid = ::fork();
+		// Если процесс не создан
+		if(pid < 0)
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		// Если это дочерний процесс
+		else if(pid == 0){
+			// Выполняем запуск сервера
+			run(port, mode.second, subscribers, messages, size);
+			// Выходим из дочернего процесса
+			::exit(EXIT_SUCCESS);
+		}
+		// Ожидаем запуска сервера
+		this_thread::sleep_for(1s);
+		{
+			// Создаём объект подписчиков
+			Subscribers executor(messages);
+			// Если подписчики подключены
+			if(executor.connect(port, subscribers)){
+				// Выполняем получение сообщений
+				executor.receive();
+				// Выводим результат замеров
+				executor.print(mode.first, &log);
+			// Выводим сообщение об ошибке
+			} else log.print("Mode: %s, subscribers are not connected", log_t::flag_t::CRITICAL, mode.first);
+		}
+		// Ожидаем завершения сервера
+		::waitpid(pid, nullptr, 0);
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
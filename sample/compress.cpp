@@ -0,0 +1,229 @@
+/**
+ * @file: compress.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <sys/fmk.hpp>
+#include <sys/log.hpp>
+#include <sys/codec.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Размер фрагмента данных передаваемого компрессору (размер чанка HTTP)
+ */
+static constexpr size_t CHUNK = 0x4000;
+
+/**
+ * @brief Структура результата замеров
+ *
+ */
+typedef struct Result {
+	// Степень сжатия
+	double ratio;
+	// Скорость компрессии в мегабайтах в секунду
+	double encode;
+	// Скорость декомпрессии в мегабайтах в секунду
+	double decode;
+	/**
+	 * @brief Конструктор
+	 *
+	 */
+	Result() noexcept : ratio(0.), encode(0.), decode(0.) {}
+} result_t;
+
+/**
+ * @brief Функция формирования JSON-данных
+ *
+ * @param size размер формируемых данных
+ * @return     сформированные данные
+ */
+static vector <char> json(const size_t size) noexcept {
+	// Результат работы функции
+	string result = "[";
+	// Выполняем формирование записей пока не достигнут нужный размер
+	for(uint32_t i = 0; result.size() < size; i++)
+		// Добавляем очередную запись
+		result.append("{\"id\":" + to_string(i) + ",\"login\":\"user" + to_string((i * 7919) % 100000) + "\",\"active\":" + ((i % 3) ? "true" : "false") + ",\"balance\":" + to_string((i * 31337) % 1000000) + ".25,\"tags\":[\"alpha\",\"beta\"]},");
+	// Завершаем массив записей
+	result.back() = ']';
+	// Выводим результат
+	return vector <char> (result.begin(), result.end());
+}
+/**
+ * @brief Функция формирования бинарных данных (смесь счётчиков, замеров и шума)
+ *
+ * @param size размер формируемых данных
+ * @return     сформированные данные
+ */
+static vector <char> binary(const size_t size) noexcept {
+	// Результат работы функции
+	vector <char> result(size, 0);
+	// Состояние генератора псевдослучайных чисел
+	uint32_t state = 0x2545F491;
+	// Выполняем заполнение данных записями по 16 байт
+	for(size_t i = 0; (i + 16) <= size; i += 16){
+		// Вычисляем следующее псевдослучайное число
+		state = (state * 1103515245 + 12345);
+		// Порядковый номер записи
+		const uint32_t index = static_cast <uint32_t> (i / 16);
+		// Значение замера, медленно изменяющееся во времени
+		const float value = (100.f + static_cast <float> (index % 360) * 0.5f);
+		// Копируем номер записи
+		::memcpy(result.data() + i, &index, sizeof(index));
+		// Копируем значение замера
+		::memcpy(result.data() + i + 4, &value, sizeof(value));
+		// Копируем случайные данные
+		::memcpy(result.data() + i + 8, &state, sizeof(state));
+		// Копируем флаги записи
+		result[i + 12] = static_cast <char> (state >> 28);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Функция замера скорости потоковой компрессии и декомпрессии
+ *
+ * @param log     объект для работы с логами
+ * @param payload данные для компрессии
+ * @param method  метод компрессии
+ * @param level   уровень компрессии
+ * @param rounds  количество повторов
+ * @return        результат замеров
+ */
+static result_t bench(const log_t * log, const vector <char> & payload, const hash_t::method_t method, const hash_t::level_t level, const uint32_t rounds) noexcept {
+	// Результат работы функции
+	result_t result;
+	// Создаём объекты компрессора и декомпрессора
+	codec_t encoder(log), decoder(log);
+	// Если компрессор и декомпрессор инициализированы
+	if(encoder.init(method, hash_t::event_t::ENCODE, level) && decoder.init(method, hash_t::event_t::DECODE)){
+		// Сжатые и извлечённые данные
+		vector <char> compressed, extracted;
+		// Выделяем память для данных
+		compressed.reserve(payload.size());
+		extracted.reserve(payload.size());
+		// Запоминаем время начала замеров компрессии
+		auto start = chrono::steady_clock::now();
+		// Выполняем заданное количество повторов
+		for(uint32_t i = 0; i < rounds; i++){
+			// Выполняем очистку сжатых данных
+			compressed.clear();
+			// Выполняем компрессию данных фрагментами, как это делает кодировщик чанков HTTP
+			for(size_t offset = 0; offset < payload.size(); offset += CHUNK){
+				// Добавляем фрагмент данных в поток
+				encoder.write(payload.data() + offset, std::min(CHUNK, payload.size() - offset), compressed);
+				// Выполняем сброс буферов, чтобы фрагмент был доступен получателю
+				encoder.flush(compressed);
+			}
+			// Завершаем сообщение, контекст переиспользуется в следующем повторе
+			encoder.finish(compressed);
+		}
+		// Получаем затраченное время в секундах
+		double seconds = chrono::duration <double> (chrono::steady_clock::now() - start).count();
+		// Вычисляем скорость компрессии
+		result.encode = (seconds > 0. ? (payload.size() * rounds) / seconds / 1048576. : 0.);
+		// Вычисляем степень сжатия
+		result.ratio = (static_cast <double> (compressed.size()) / payload.size());
+		// Запоминаем время начала замеров декомпрессии
+		start = chrono::steady_clock::now();
+		// Выполняем заданное количество повторов
+		for(uint32_t i = 0; i < rounds; i++){
+			// Выполняем очистку извлечённых данных
+			extracted.clear();
+			// Выполняем декомпрессию данных фрагментами
+			for(size_t offset = 0; offset < compressed.size(); offset += CHUNK)
+				// Добавляем фрагмент сжатых данных в поток
+				decoder.write(compressed.data() + offset, std::min(CHUNK, compressed.size() - offset), extracted);
+			// Если сообщение получено не целиком
+			if(!decoder.finish(extracted))
+				// Очищаем извлечённые данные
+				extracted.clear();
+		}
+		// Получаем затраченное время в секундах
+		seconds = chrono::duration <double> (chrono::steady_clock::now() - start).count();
+		// Вычисляем скорость декомпрессии
+		result.decode = (seconds > 0. ? (payload.size() * rounds) / seconds / 1048576. : 0.);
+		// Если извлечённые данные не совпадают с исходными
+		if(extracted != payload)
+			// Сбрасываем результат замеров
+			result = result_t();
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Количество повторов замеров
+	const uint32_t rounds = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 5);
+	// Размер данных для компрессии
+	const size_t size = (argc > 2 ? static_cast <size_t> (::atoll(argv[2])) : 0x100000);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("COMPRESS Benchmark");
+	// Список данных для замеров
+	const std::pair <const char *, vector <char>> payloads[] = {
+		{"json", json(size)},
+		{"binary", binary(size)}
+	};
+	// Список методов компрессии
+	const std::pair <const char *, hash_t::method_t> methods[] = {
+		{"lz4", hash_t::method_t::LZ4},
+		{"zstd", hash_t::method_t::ZSTD},
+		{"gzip", hash_t::method_t::GZIP},
+		{"deflate", hash_t::method_t::DEFLATE},
+		{"brotli", hash_t::method_t::BROTLI},
+		{"bzip2", hash_t::method_t::BZIP2},
+		{"xz", hash_t::method_t::LZMA}
+	};
+	// Список уровней компрессии
+	const std::pair <const char *, hash_t::level_t> levels[] = {
+		{"speed", hash_t::level_t::SPEED},
+		{"normal", hash_t::level_t::NORMAL},
+		{"best", hash_t::level_t::BEST}
+	};
+	// Выполняем перебор всех данных для замеров
+	for(auto & payload : payloads){
+		// Выполняем перебор всех методов компрессии
+		for(auto & method : methods){
+			// Выполняем перебор всех уровней компрессии
+			for(auto & level : levels){
+				// Выполняем замеры
+				const result_t & result = bench(&log, payload.second, method.second, level.second, std::max(rounds, 1u));
+				// Выводим результат замеров
+				log.print("Payload: %s, method: %s, level: %s, ratio: %.3f, compress: %.1f MB/s, decompress: %.1f MB/s", log_t::flag_t::INFO, payload.first, method.first, level.first, result.ratio, result.encode, result.decode);
+			}
+		}
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file: handshake.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <csignal>
+#include <sys/wait.h>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <server/sample.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * @brief Функция запуска TLS-сервера в дочернем процессе
+ *
+ * @param port порт сервера
+ */
+static void run(const uint32_t port) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Создаём объект параметров SSL-шифрования
+	node_t::ssl_t ssl;
+	// Объект DNS-резолвера
+	dns_t dns(&fmk, &log);
+	// Создаём объект сетевого ядра
+	server::core_t core(&dns, &fmk, &log);
+	// Создаём объект сервера
+	server::sample_t sample(&core, &fmk, &log);
+	// Устанавливаем название сервиса
+	log.name("HANDSHAKE Server");
+	// Запрещаем вывод информационных сообщений
+	sample.mode({server::sample_t::flag_t::NOT_INFO});
+	// Отключаем валидацию сертификата
+	ssl.verify = false;
+	// Устанавливаем SSL сертификаты сервера
+	ssl.key  = "./certs/certificates/server-key.pem";
+	ssl.cert = "./certs/certificates/server-cert.pem";
+	// Выполняем установку параметров SSL-шифрования
+	core.ssl(ssl);
+	// Устанавливаем тип сокета
+	core.sonet(awh::scheme_t::sonet_t::TLS);
+	// Выполняем инициализацию Sample сервера
+	sample.init(port, "127.0.0.1");
+	// Выполняем запуск SAMPLE сервер
+	sample.start();
+}
+/**
+ * @brief Функция выполнения одного рукопожатия TLS
+ *
+ * @param ctx     контекст SSL клиента
+ * @param port    порт сервера
+ * @param session сессия TLS для возобновления (nullptr если возобновление не требуется)
+ * @return        результат рукопожатия
+ */
+static bool handshake(SSL_CTX * ctx, const uint32_t port, SSL_SESSION ** session = nullptr) noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Создаём сокет подключения
+	const int32_t sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	// Если сокет создан
+	if(sock != INVALID_SOCKET){
+		// Создаём объект адреса сервера
+		struct sockaddr_in addr;
+		// Заполняем структуру нулями
+		::memset(&addr, 0, sizeof(addr));
+		// Устанавливаем семейство протоколов
+		addr.sin_family = AF_INET;
+		// Устанавливаем порт сервера
+		addr.sin_port = htons(static_cast <uint16_t> (port));
+		// Устанавливаем адрес сервера
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		// Выполняем подключение к серверу
+		if(::connect(sock, reinterpret_cast <struct sockaddr *> (&addr), sizeof(addr)) == 0){
+			// Создаём объект SSL
+			SSL * ssl = ::SSL_new(ctx);
+			// Если объект SSL создан
+			if(ssl != nullptr){
+				// Устанавливаем сокет подключения
+				::SSL_set_fd(ssl, sock);
+				// Если сессия для возобновления передана
+				if((session != nullptr) && ((* session) != nullptr))
+					// Выполняем установку сессии для возобновления
+					::SSL_set_session(ssl, (* session));
+				// Выполняем рукопожатие
+				result = (::SSL_connect(ssl) == 1);
+				// Если необходимо получить сессию для возобновления
+				if(result && (session != nullptr) && ((* session) == nullptr)){
+					// Буфер ответа сервера
+					char buffer[16];
+					// Отправляем сообщение серверу, чтобы получить сессионные билеты TLS 1.3
+					::SSL_write(ssl, "ping", 4);
+					// Получаем ответ сервера вместе с сессионными билетами
+					::SSL_read(ssl, buffer, sizeof(buffer));
+					// Получаем сессию для возобновления
+					(* session) = ::SSL_get1_session(ssl);
+				}
+				// Выключаем подключение
+				::SSL_shutdown(ssl);
+				// Освобождаем объект SSL
+				::SSL_free(ssl);
+			}
+		}
+		// Закрываем сокет подключения
+		::close(sock);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Порт сервера для замеров
+	const uint32_t port = 2223;
+	// Количество выполняемых рукопожатий
+	const uint32_t count = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 1000);
+	// Создаём дочерний процесс сервера
+	const pid_t pid = ::fork();
+	// Если процесс не создан
+	if(pid < 0)
+		// Выходим из приложения
+		return EXIT_FAILURE;
+	// Если это дочерний процесс
+	else if(pid == 0){
+		// Выполняем запуск сервера
+		run(port);
+		// Выходим из дочернего процесса
+		::exit(EXIT_SUCCESS);
+	}
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("HANDSHAKE Benchmark");
+	// Ожидаем запуска сервера
+	this_thread::sleep_for(1s);
+	// Создаём контекст SSL клиента
+	SSL_CTX * ctx = ::SSL_CTX_new(::TLS_client_method());
+	// Отключаем проверку сертификата сервера
+	::SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, nullptr);
+	// Отключаем возобновление сессий, замеряются только полные рукопожатия
+	::SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+	// Количество удачных рукопожатий
+	uint32_t success = 0;
+	// Запоминаем время начала замеров
+	const auto start = chrono::steady_clock::now();
+	// Выполняем заданное количество рукопожатий
+	for(uint32_t i = 0; i < count; i++)
+		// Увеличиваем количество удачных рукопожатий
+		success += static_cast <uint32_t> (handshake(ctx, port));
+	// Получаем затраченное время в секундах
+	double seconds = chrono::duration <double> (chrono::steady_clock::now() - start).count();
+	// Выводим результат замеров
+	log.print("Full handshakes: %u of %u, time: %.3f sec, rate: %.1f handshakes/sec", log_t::flag_t::INFO, success, count, seconds, (seconds > 0. ? success / seconds : 0.));
+	// Сессия TLS для возобновления
+	SSL_SESSION * session = nullptr;
+	// Выполняем рукопожатие для получения сессии
+	handshake(ctx, port, &session);
+	// Сбрасываем количество удачных рукопожатий
+	success = 0;
+	// Запоминаем время начала замеров
+	const auto resumed = chrono::steady_clock::now();
+	// Выполняем заданное количество рукопожатий с возобновлением сессии
+	for(uint32_t i = 0; i < count; i++)
+		// Увеличиваем количество удачных рукопожатий
+		success += static_cast <uint32_t> (handshake(ctx, port, &session));
+	// Получаем затраченное время в секундах
+	seconds = chrono::duration <double> (chrono::steady_clock::now() - resumed).count();
+	// Выводим результат замеров
+	log.print("Resumed handshakes: %u of %u, time: %.3f sec, rate: %.1f handshakes/sec", log_t::flag_t::INFO, success, count, seconds, (seconds > 0. ? success / seconds : 0.));
+	// Если сессия получена
+	if(session != nullptr)
+		// Освобождаем сессию
+		::SSL_SESSION_free(session);
+	// Освобождаем контекст SSL клиента
+	::SSL_CTX_free(ctx);
+	// Останавливаем сервер
+	::kill(pid, SIGTERM);
+	// Ожидаем завершения сервера
+	::waitpid(pid, nullptr, 0);
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,287 @@
+/**
+ * @file: idle.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <server/sample.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Подписываемся на пространство имён заполнителя
+ */
+using namespace placeholders;
+
+/**
+ * @brief Класс объекта исполнителя замеров
+ *
+ */
+class Bench {
+	private:
+		// Флаг собственного буфера чтения брокера
+		bool _retain;
+	private:
+		// Объект сетевого ядра
+		server::core_t * _core;
+	public:
+		/**
+		 * @brief Метод идентификации активности на сервере
+		 *
+		 * @param bid  идентификатор брокера
+		 * @param mode режим события подключения
+		 */
+		void active(const uint64_t bid, const server::sample_t::mode_t mode){
+			// Если клиент подключился и необходим собственный буфер чтения
+			if(this->_retain && (mode == server::sample_t::mode_t::CONNECT))
+				// Выполняем выделение собственного буфера чтения брокера
+				this->_core->retain(bid, engine_t::mode_t::ENABLED);
+		}
+		/**
+		 * @brief Метод получения сообщений
+		 *
+		 * @param bid    идентификатор брокера
+		 * @param buffer буфер входящих данных
+		 * @param sample объект активного сервера
+		 */
+		void message(const uint64_t bid, const vector <char> & buffer, server::sample_t * sample){
+			// Отправляем сообщение обратно
+			sample->send(bid, buffer.data(), buffer.size());
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param retain флаг собственного буфера чтения брокера
+		 * @param core   объект сетевого ядра
+		 */
+		Bench(const bool retain, server::core_t * core) : _retain(retain), _core(core) {}
+};
+
+/**
+ * @brief Функция увеличения лимита открытых файловых дескрипторов
+ *
+ */
+static void unlimit() noexcept {
+	// Объект лимитов процесса
+	struct rlimit limit;
+	// Если лимиты получены
+	if(::getrlimit(RLIMIT_NOFILE, &limit) == 0){
+		// Устанавливаем максимально допустимый лимит
+		limit.rlim_cur = limit.rlim_max;
+		// Выполняем установку лимита
+		::setrlimit(RLIMIT_NOFILE, &limit);
+	}
+}
+/**
+ * @brief Функция получения резидентной памяти процесса
+ *
+ * @param pid идентификатор процесса
+ * @return    размер резидентной памяти в килобайтах
+ */
+static uint64_t rss(const pid_t pid) noexcept {
+	// Результат работы функции
+	uint64_t result = 0;
+	// Открываем файл статуса процесса
+	ifstream file("/proc/" + to_string(pid) + "/status");
+	// Если файл открыт
+	if(file.is_open()){
+		// Строка статуса процесса
+		string line = "";
+		// Выполняем чтение статуса процесса
+		while(getline(file, line)){
+			// Если получен размер резидентной памяти
+			if(line.find("VmRSS:") == 0){
+				// Получаем размер резидентной памяти
+				result = static_cast <uint64_t> (::stoull(line.substr(6)));
+				// Выходим из цикла
+				break;
+			}
+		}
+		// Закрываем файл
+		file.close();
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Функция запуска эхо-сервера в дочернем процессе
+ *
+ * @param port   порт сервера
+ * @param retain флаг собственного буфера чтения брокера
+ */
+static void run(const uint32_t port, const bool retain) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Объект DNS-резолвера
+	dns_t dns(&fmk, &log);
+	// Создаём объект сетевого ядра
+	server::core_t core(&dns, &fmk, &log);
+	// Создаём объект сервера
+	server::sample_t sample(&core, &fmk, &log);
+	// Создаём объект исполнителя замеров
+	Bench executor(retain, &core);
+	// Устанавливаем название сервиса
+	log.name("IDLE Server");
+	// Запрещаем вывод информационных сообщений
+	sample.mode({server::sample_t::flag_t::NOT_INFO});
+	// Устанавливаем тип сокета
+	core.sonet(awh::scheme_t::sonet_t::TCP);
+	// Увеличиваем лимит открытых файловых дескрипторов
+	unlimit();
+	// Выполняем инициализацию Sample сервера
+	sample.init(port, "127.0.0.1");
+	// Установливаем функцию обратного вызова на событие запуска или остановки подключения
+	sample.on <void (const uint64_t, const server::sample_t::mode_t)> ("active", &Bench::active, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие получения сообщений
+	sample.on <void (const uint64_t, const vector <char> &)> ("message", &Bench::message, &executor, _1, _2, &sample);
+	// Выполняем запуск SAMPLE сервер
+	sample.start();
+}
+/**
+ * @brief Функция открытия простаивающих подключений
+ *
+ * @param port    порт сервера
+ * @param count   количество подключений
+ * @param size    размер сообщения отправляемого при подключении
+ * @param sockets список открытых сокетов
+ */
+static void connect(const uint32_t port, const uint32_t count, const size_t size, vector <int32_t> & sockets) noexcept {
+	// Создаём объект адреса сервера
+	struct sockaddr_in addr;
+	// Заполняем структуру нулями
+	::memset(&addr, 0, sizeof(addr));
+	// Устанавливаем семейство протоколов
+	addr.sin_family = AF_INET;
+	// Устанавливаем порт сервера
+	addr.sin_port = htons(static_cast <uint16_t> (port));
+	// Устанавливаем адрес сервера
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	// Буфер сообщения для отправки
+	vector <char> buffer(size, 'x');
+	// Выполняем открытие заданного количества подключений
+	for(uint32_t i = 0; i < count; i++){
+		// Создаём сокет подключения
+		const int32_t sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		// Если сокет не создан
+		if(sock == INVALID_SOCKET)
+			// Выходим из цикла
+			break;
+		// Если подключение не выполнено
+		if(::connect(sock, reinterpret_cast <struct sockaddr *> (&addr), sizeof(addr)) != 0){
+			// Закрываем сокет подключения
+			::close(sock);
+			// Выходим из цикла
+			break;
+		}
+		// Отправляем сообщение серверу, как при рукопожатии протокола
+		::send(sock, buffer.data(), buffer.size(), 0);
+		// Количество полученных байт ответа
+		size_t bytes = 0;
+		// Выполняем чтение ответа целиком
+		while(bytes < buffer.size()){
+			// Выполняем чтение ответа сервера
+			const ssize_t received = ::recv(sock, buffer.data(), buffer.size(), 0);
+			// Если соединение закрыто
+			if(received <= 0)
+				// Выходим из цикла
+				break;
+			// Увеличиваем количество полученных байт
+			bytes += static_cast <size_t> (received);
+		}
+		// Добавляем сокет в список открытых
+		sockets.push_back(sock);
+	}
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Порт сервера для замеров
+	const uint32_t port = 2226;
+	// Количество простаивающих подключений
+	const uint32_t count = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 5000);
+	// Размер сообщения отправляемого при подключении
+	const size_t size = (argc > 2 ? static_cast <size_t> (::atoi(argv[2])) : 0x4000);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("IDLE Benchmark");
+	// Увеличиваем лимит открытых файловых дескрипторов
+	unlimit();
+	// Выполняем замеры сначала с буферами потока, затем с собственными буферами брокеров
+	for(const bool retain : {false, true}){
+		// Создаём дочерний процесс сервера
+		const pid_t pid = ::fork();
+		// Если процесс не создан
+		if(pid < 0)
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		// Если это дочерний процесс
+		else if(pid == 0){
+			// Выполняем запуск сервера
+			run(port, retain);
+			// Выходим из дочернего процесса
+			::exit(EXIT_SUCCESS);
+		}
+		// Ожидаем запуска сервера
+		this_thread::sleep_for(1s);
+		// Получаем размер резидентной памяти сервера до подключений
+		const uint64_t before = rss(pid);
+		// Список открытых сокетов
+		vector <int32_t> sockets;
+		// Выполняем открытие простаивающих подключений
+		connect(port, count, size, sockets);
+		// Ожидаем обработки всех подключений
+		this_thread::sleep_for(1s);
+		// Получаем размер резидентной памяти сервера с простаивающими подключениями
+		const uint64_t after = rss(pid);
+		// Выводим результат замеров
+		log.print(
+			"Buffers: %s, connections: %zu, RSS: %llu Kb -> %llu Kb, per connection: %.2f Kb", log_t::flag_t::INFO,
+			(retain ? "per broker" : "per thread"), sockets.size(), before, after,
+			(!sockets.empty() ? (static_cast <double> (after) - static_cast <double> (before)) / sockets.size() : 0.)
+		);
+		// Выполняем закрытие всех подключений
+		for(auto sock : sockets)
+			// Закрываем сокет подключения
+			::close(sock);
+		// Останавливаем сервер
+		::kill(pid, SIGTERM);
+		// Ожидаем завершения сервера
+		::waitpid(pid, nullptr, 0);
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
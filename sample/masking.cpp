@@ -0,0 +1,177 @@
+/**
+ * @file: masking.cpp
+ * @date: 2025-03-09
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <sys/fmk.hpp>
+#include <sys/log.hpp>
+#include <ws/frame.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * @brief Функция побайтового наложения маски (эталонная реализация)
+ *
+ * @param buffer буфер данных для маскирования
+ * @param size   размер данных для маскирования
+ * @param key    ключ маски из 4-х байт
+ */
+static void bytewise(char * buffer, const size_t size, const uint8_t * key) noexcept {
+	// Выполняем перебор всех байт передаваемых данных
+	for(size_t i = 0; i < size; i++)
+		// Накладываем маску на байт данных
+		buffer[i] ^= key[i % 4];
+}
+/**
+ * @brief Функция вычисления скорости обработки данных
+ *
+ * @param start время начала замеров
+ * @param bytes количество обработанных байт
+ * @return      скорость обработки в гигабайтах в секунду
+ */
+static double speed(const chrono::steady_clock::time_point & start, const double bytes) noexcept {
+	// Получаем затраченное время в секундах
+	const double seconds = chrono::duration <double> (chrono::steady_clock::now() - start).count();
+	// Выводим скорость обработки данных
+	return (seconds > 0. ? (bytes / seconds / 1073741824.) : 0.);
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Количество повторов замеров
+	const uint32_t rounds = std::max((argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 2000u), 1u);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Создаём объект для работы с фреймами
+	ws::frame_t frame(&fmk, &log);
+	// Устанавливаем название сервиса
+	log.name("MASKING Benchmark");
+	// Ключ маски
+	const uint8_t key[4] = {0x37, 0xFA, 0x21, 0x3D};
+	{
+		/**
+		 * Маскированный бинарный фрейм с 64-битным размером полезной нагрузки 0xFFFFFFFFFFFFFFF8,
+		 * сумма которого с размером заголовка переполняется до небольшого значения
+		 */
+		char hostile[] = {
+			static_cast <char> (0x82), static_cast <char> (0xFF),
+			static_cast <char> (0xFF), static_cast <char> (0xFF), static_cast <char> (0xFF), static_cast <char> (0xFF),
+			static_cast <char> (0xFF), static_cast <char> (0xFF), static_cast <char> (0xFF), static_cast <char> (0xF8),
+			0x37, static_cast <char> (0xFA), 0x21, 0x3D, 'a', 'w', 'h', '!'
+		};
+		// Заголовок извлекаемого фрейма
+		ws::frame_t::head_t head;
+		// Если фрейм с недопустимым размером полезной нагрузки не отклонён
+		if((frame.decode(head, hostile, sizeof(hostile)) != nullptr) || (head.state != ws::frame_t::state_t::BAD) || (frame.message(head, 1005, false).code != 1009)){
+			// Выводим сообщение об ошибке
+			log.print("Frame with payload length %llu is not rejected", log_t::flag_t::CRITICAL, static_cast <unsigned long long> (head.payload));
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		}
+	}
+	// Выполняем перебор размеров сообщений
+	for(const size_t size : {static_cast <size_t> (0xC800), static_cast <size_t> (0x7A120)}){
+		// Полезная нагрузка сообщения и буфер для маскирования
+		vector <char> payload(size), buffer(size);
+		// Выполняем заполнение полезной нагрузки
+		for(size_t i = 0; i < size; i++)
+			// Устанавливаем очередной байт полезной нагрузки
+			payload[i] = static_cast <char> ((i * 131) + 7);
+		// Буфер для записи фрейма
+		vector <char> output(size + ws::frame_t::MAX_HEAD_SIZE);
+		// Общий объём обработанных данных
+		const double bytes = (static_cast <double> (size) * rounds);
+		// Запоминаем время начала замеров побайтового маскирования
+		auto start = chrono::steady_clock::now();
+		// Выполняем заданное количество повторов
+		for(uint32_t i = 0; i < rounds; i++)
+			// Выполняем побайтовое маскирование
+			bytewise(buffer.data(), buffer.size(), key);
+		// Получаем скорость побайтового маскирования
+		const double bytewiseSpeed = speed(start, bytes);
+		// Запоминаем время начала замеров векторного маскирования
+		start = chrono::steady_clock::now();
+		// Выполняем заданное количество повторов
+		for(uint32_t i = 0; i < rounds; i++)
+			// Выполняем векторное маскирование на месте
+			ws::frame_t::mask(buffer.data(), buffer.data(), buffer.size(), key);
+		// Получаем скорость векторного маскирования
+		const double vectorSpeed = speed(start, bytes);
+		// Создаём заголовок маскированного бинарного фрейма
+		ws::frame_t::head_t head(true, true);
+		// Устанавливаем опкод фрейма
+		head.optcode = ws::frame_t::opcode_t::BINARY;
+		// Размер записанного фрейма
+		size_t length = 0;
+		// Запоминаем время начала замеров создания фреймов в буфере вызывающей стороны
+		start = chrono::steady_clock::now();
+		// Выполняем заданное количество повторов
+		for(uint32_t i = 0; i < rounds; i++)
+			// Выполняем создание фрейма
+			length = frame.encode(head, payload.data(), payload.size(), output.data(), output.size());
+		// Получаем скорость создания фреймов
+		const double encodeSpeed = speed(start, bytes);
+		// Заголовок извлекаемого фрейма
+		ws::frame_t::head_t result;
+		// Запоминаем время начала замеров извлечения фреймов на месте
+		start = chrono::steady_clock::now();
+		/**
+		 * Выполняем заданное количество повторов, повторное снятие маски
+		 * возвращает полезную нагрузку в исходное состояние, поэтому фрейм не пересоздаётся
+		 */
+		for(uint32_t i = 0; i < rounds; i++)
+			// Выполняем извлечение фрейма с размаскированием в буфере
+			frame.decode(result, output.data(), length);
+		// Получаем скорость извлечения фреймов
+		const double decodeSpeed = speed(start, bytes);
+		// Запоминаем время начала замеров создания и извлечения фреймов с выделением памяти
+		start = chrono::steady_clock::now();
+		// Выполняем заданное количество повторов
+		for(uint32_t i = 0; i < rounds; i++){
+			// Выполняем создание фрейма
+			const auto & encoded = frame.set(head, payload.data(), payload.size());
+			// Выполняем извлечение полезной нагрузки фрейма
+			const auto & data = frame.get(result, encoded.data(), encoded.size());
+			// Если полезная нагрузка извлечена неверно
+			if(data.size() != payload.size()){
+				// Выводим сообщение об ошибке
+				log.print("Frame of %zu bytes is corrupted", log_t::flag_t::CRITICAL, size);
+				// Выходим из приложения
+				return EXIT_FAILURE;
+			}
+		}
+		// Получаем скорость создания и извлечения фреймов с выделением памяти
+		const double copySpeed = speed(start, bytes * 2);
+		// Выводим результат замеров
+		log.print("Payload: %zu bytes, bytewise: %.2f GB/s, vector: %.2f GB/s, encode: %.2f GB/s, decode: %.2f GB/s, set/get: %.2f GB/s", log_t::flag_t::INFO, size, bytewiseSpeed, vectorSpeed, encodeSpeed, decodeSpeed, copySpeed);
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
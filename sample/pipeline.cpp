@@ -0,0 +1,493 @@
+/**
+ * @file: pipeline.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <thread>
+#include <sys/wait.h>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <core/timer.hpp>
+#include <server/awh.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Подписываемся на пространство имён заполнителя
+ */
+using namespace placeholders;
+
+/**
+ * Шаблон запроса отправляемого серверу
+ */
+static const char * request = "GET /ping HTTP/1.1\r\n"
+                              "Host: 127.0.0.1\r\n"
+                              "User-Agent: pipeline/1.0\r\n"
+                              "\r\n";
+/**
+ * Начало строки ответа сервера
+ */
+static const char * status = "HTTP/1.1 200";
+
+/**
+ * @brief Класс объекта исполнителя замеров
+ *
+ */
+class Bench {
+	private:
+		// Флаг удержания ответа на первый запрос
+		bool _hold;
+	private:
+		// Идентификатор потока удерживаемого запроса
+		int32_t _sid;
+		// Идентификатор брокера удерживаемого запроса
+		uint64_t _bid;
+	private:
+		// Объём данных прочитанных сервером
+		size_t _received;
+		// Объём данных прочитанных сервером до отправки удерживаемого ответа
+		size_t _stalled;
+	private:
+		// Объект таймера удержания ответа
+		awh::timer_t * _timer;
+		// Объект сетевого ядра
+		server::core_t * _core;
+		// Объект AWH-сервера
+		server::awh_t * _awh;
+	public:
+		/**
+		 * @brief Метод получения объёма данных прочитанных до отправки удерживаемого ответа
+		 *
+		 * @return объём прочитанных данных
+		 */
+		size_t stalled() const {
+			// Выводим результат
+			return this->_stalled;
+		}
+	public:
+		/**
+		 * @brief Метод события запуска сервера
+		 *
+		 * @param host хост сервера
+		 * @param port порт сервера
+		 */
+		void launched([[maybe_unused]] const string & host, [[maybe_unused]] const uint32_t port){
+			// Выполняем биндинг таймера удержания ответа
+			this->_core->bind(this->_timer);
+		}
+		/**
+		 * @brief Метод идентификации активности на сервере
+		 *
+		 * @param bid  идентификатор брокера
+		 * @param mode режим события подключения
+		 */
+		void active([[maybe_unused]] const uint64_t bid, const server::web_t::mode_t mode){
+			// Если клиент отключился, замеры завершены
+			if(mode == server::web_t::mode_t::DISCONNECT)
+				// Выполняем остановку сервера
+				this->_core->stop();
+		}
+		/**
+		 * @brief Метод получения сырых данных от клиента
+		 *
+		 * @param bid    идентификатор брокера
+		 * @param buffer буфер полученных данных
+		 * @param size   размер полученных данных
+		 * @return       результат обработки данных
+		 */
+		bool raw([[maybe_unused]] const uint64_t bid, [[maybe_unused]] const char * buffer, const size_t size){
+			// Увеличиваем объём прочитанных данных
+			this->_received += size;
+			// Выполняем обработку данных сервером
+			return true;
+		}
+		/**
+		 * @brief Метод отправки удерживаемого ответа
+		 *
+		 */
+		void release(){
+			// Запоминаем объём данных прочитанных за время удержания ответа
+			this->_stalled = this->_received;
+			// Тело ответа сервера
+			static const string body = "pong";
+			// Отправляем удерживаемый ответ клиенту
+			this->_awh->send(this->_sid, this->_bid, 200, "OK", vector <char> (body.begin(), body.end()));
+		}
+		/**
+		 * @brief Метод получения запроса целиком
+		 *
+		 * @param sid     идентификатор потока
+		 * @param bid     идентификатор брокера
+		 * @param method  метод запроса
+		 * @param url     URL-адрес запроса
+		 * @param entity  тело запроса
+		 * @param headers заголовки запроса
+		 * @param awh     объект сервера
+		 */
+		void complete(const int32_t sid, const uint64_t bid, [[maybe_unused]] const awh::web_t::method_t method, [[maybe_unused]] const uri_t::url_t & url, [[maybe_unused]] const vector <char> & entity, [[maybe_unused]] const unordered_multimap <string, string> & headers){
+			// Если ответ на первый запрос необходимо удержать
+			if(this->_hold){
+				// Снимаем флаг удержания ответа
+				this->_hold = false;
+				// Запоминаем идентификатор потока
+				this->_sid = sid;
+				// Запоминаем идентификатор брокера
+				this->_bid = bid;
+				// Устанавливаем таймаут удержания ответа
+				const uint16_t tid = this->_timer->timeout(500);
+				// Выполняем добавление функции обратного вызова
+				this->_timer->on(tid, &Bench::release, this);
+				// Выходим из функции
+				return;
+			}
+			// Тело ответа сервера
+			static const string body = "pong";
+			// Отправляем ответ клиенту
+			this->_awh->send(sid, bid, 200, "OK", vector <char> (body.begin(), body.end()));
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param hold  флаг удержания ответа на первый запрос
+		 * @param timer объект таймера удержания ответа
+		 * @param core  объект сетевого ядра
+		 * @param awh   объект AWH-сервера
+		 */
+		Bench(const bool hold, awh::timer_t * timer, server::core_t * core, server::awh_t * awh) :
+		 _hold(hold), _sid(0), _bid(0), _received(0), _stalled(0), _timer(timer), _core(core), _awh(awh) {}
+};
+
+/**
+ * @brief Функция запуска HTTP-сервера в дочернем процессе
+ *
+ * @param port  порт сервера
+ * @param depth глубина конвейера запросов сервера (0 - используется значение по умолчанию)
+ * @param hold  флаг удержания ответа на первый запрос
+ * @return      объём данных прочитанных сервером за время удержания ответа
+ */
+static size_t run(const uint32_t port, const uint16_t depth, const bool hold) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Создаём объект таймера удержания ответа
+	awh::timer_t timer(&fmk, &log);
+	// Создаём объект сетевого ядра
+	server::core_t core(&fmk, &log);
+	// Создаём объект AWH-сервера
+	server::awh_t awh(&core, &fmk, &log);
+	// Создаём объект исполнителя замеров
+	Bench executor(hold, &timer, &core, &awh);
+	// Устанавливаем название сервиса
+	log.name("PIPELINE Benchmark");
+	// Запрещаем вывод информационных сообщений
+	awh.mode({server::web_t::flag_t::NOT_INFO});
+	// Устанавливаем активный протокол подключения
+	core.proto(awh::engine_t::proto_t::HTTP1_1);
+	// Устанавливаем тип сокета
+	core.sonet(awh::scheme_t::sonet_t::TCP);
+	// Запрещаем перехват сигналов
+	core.signalInterception(awh::scheme_t::mode_t::DISABLED);
+	// Устанавливаем долгоживущее подключение
+	awh.alive(true);
+	// Если глубина конвейера запросов передана
+	if(depth > 0)
+		// Устанавливаем глубину конвейера запросов
+		awh.pipelineDepth(depth);
+	// Выполняем инициализацию Web-сервера
+	awh.init(port, "127.0.0.1");
+	// Установливаем функцию обратного вызова для выполнения события запуска сервера
+	awh.on <void (const string &, const uint32_t)> ("launched", &Bench::launched, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие запуска или остановки подключения
+	awh.on <void (const uint64_t, const server::web_t::mode_t)> ("active", &Bench::active, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие получения сырых данных
+	awh.on <bool (const uint64_t, const char *, const size_t)> ("raw", &Bench::raw, &executor, _1, _2, _3);
+	// Установливаем функцию обратного вызова на событие получения запроса целиком
+	awh.on <void (const int32_t, const uint64_t, const awh::web_t::method_t, const uri_t::url_t &, const vector <char> &, const unordered_multimap <string, string> &)> ("complete", &Bench::complete, &executor, _1, _2, _3, _4, _5, _6);
+	// Выполняем запуск Web-сервера
+	awh.start();
+	// Выводим результат
+	return executor.stalled();
+}
+/**
+ * @brief Функция подсчёта ответов сервера в полученных данных
+ *
+ * @param responses накопленные данные ответов сервера
+ * @return          количество найденных ответов
+ */
+static uint32_t answers(string & responses) noexcept {
+	// Результат работы функции
+	uint32_t result = 0;
+	// Получаем длину начала строки ответа
+	const size_t length = ::strlen(status);
+	// Смещение в накопленных данных
+	size_t offset = 0, position = 0;
+	// Выполняем подсчёт полученных ответов
+	while((position = responses.find(status, offset)) != string::npos){
+		// Увеличиваем количество полученных ответов
+		result++;
+		// Выполняем смещение за найденный ответ
+		offset = (position + length);
+	}
+	// Удаляем обработанные данные, оставляя хвост для неполной строки ответа
+	responses.erase(0, std::max(offset, (responses.size() > length ? responses.size() - length : 0)));
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Функция выполнения конвейерных запросов к серверу
+ *
+ * @param port  порт сервера
+ * @param count количество запросов
+ * @param depth количество запросов отправляемых без ожидания ответа
+ * @return      количество полученных ответов
+ */
+static uint32_t requests(const uint32_t port, const uint32_t count, const uint32_t depth) noexcept {
+	// Результат работы функции
+	uint32_t result = 0;
+	// Создаём сокет подключения
+	const int32_t sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	// Если сокет создан
+	if(sock != INVALID_SOCKET){
+		// Создаём объект адреса сервера
+		struct sockaddr_in addr;
+		// Заполняем структуру нулями
+		::memset(&addr, 0, sizeof(addr));
+		// Устанавливаем семейство протоколов
+		addr.sin_family = AF_INET;
+		// Устанавливаем порт сервера
+		addr.sin_port = htons(static_cast <uint16_t> (port));
+		// Устанавливаем адрес сервера
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		// Выполняем подключение к серверу
+		if(::connect(sock, reinterpret_cast <struct sockaddr *> (&addr), sizeof(addr)) == 0){
+			// Буфер ответа сервера
+			char buffer[16384];
+			// Пакет конвейерных запросов
+			string batch = "";
+			// Накопленные данные ответов сервера
+			string responses = "";
+			// Формируем пакет из указанного количества запросов
+			for(uint32_t i = 0; i < depth; i++)
+				// Добавляем запрос в пакет
+				batch.append(request);
+			// Выполняем отправку пакетов пока не выполнено нужное количество запросов
+			while(result < count){
+				// Отправляем пакет запросов серверу одной записью
+				if(::send(sock, batch.data(), batch.size(), 0) != static_cast <ssize_t> (batch.size()))
+					// Выходим из цикла
+					break;
+				// Количество полученных ответов пакета
+				uint32_t received = 0;
+				// Выполняем чтение ответов на все запросы пакета
+				while(received < depth){
+					// Выполняем чтение ответа сервера
+					const ssize_t size = ::recv(sock, buffer, sizeof(buffer), 0);
+					// Если соединение закрыто
+					if(size <= 0)
+						// Выходим из цикла
+						break;
+					// Добавляем полученные данные
+					responses.append(buffer, static_cast <size_t> (size));
+					// Выполняем подсчёт полученных ответов
+					received += answers(responses);
+				}
+				// Увеличиваем количество полученных ответов
+				result += received;
+				// Если получены не все ответы
+				if(received < depth)
+					// Выходим из цикла
+					break;
+			}
+		}
+		// Закрываем сокет подключения
+		::close(sock);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Функция отправки серверу конвейера запросов одной непрерывной записью
+ *
+ * @param port  порт сервера
+ * @param total количество запросов
+ * @return      количество полученных ответов
+ */
+static uint32_t flood(const uint32_t port, const uint32_t total) noexcept {
+	// Результат работы функции
+	uint32_t result = 0;
+	// Создаём сокет подключения
+	const int32_t sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	// Если сокет создан
+	if(sock != INVALID_SOCKET){
+		// Создаём объект адреса сервера
+		struct sockaddr_in addr;
+		// Заполняем структуру нулями
+		::memset(&addr, 0, sizeof(addr));
+		// Устанавливаем семейство протоколов
+		addr.sin_family = AF_INET;
+		// Устанавливаем порт сервера
+		addr.sin_port = htons(static_cast <uint16_t> (port));
+		// Устанавливаем адрес сервера
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		// Выполняем подключение к серверу
+		if(::connect(sock, reinterpret_cast <struct sockaddr *> (&addr), sizeof(addr)) == 0){
+			// Буфер ответа сервера
+			char buffer[16384];
+			// Пакет конвейерных запросов
+			string batch = "";
+			// Накопленные данные ответов сервера
+			string responses = "";
+			// Формируем пакет из указанного количества запросов
+			for(uint32_t i = 0; i < total; i++)
+				// Добавляем запрос в пакет
+				batch.append(request);
+			// Запускаем отправку пакета в отдельном потоке, так как сервер перестаёт читать данные
+			std::thread sender([sock, &batch]{
+				// Смещение в отправляемом пакете
+				size_t offset = 0;
+				// Выполняем отправку пакета до конца
+				while(offset < batch.size()){
+					// Выполняем отправку оставшихся данных пакета
+					const ssize_t bytes = ::send(sock, batch.data() + offset, batch.size() - offset, 0);
+					// Если данные не отправлены
+					if(bytes <= 0)
+						// Выходим из цикла
+						break;
+					// Увеличиваем смещение в пакете
+					offset += static_cast <size_t> (bytes);
+				}
+			});
+			// Выполняем чтение ответов на все запросы пакета
+			while(result < total){
+				// Выполняем чтение ответа сервера
+				const ssize_t size = ::recv(sock, buffer, sizeof(buffer), 0);
+				// Если соединение закрыто
+				if(size <= 0)
+					// Выходим из цикла
+					break;
+				// Добавляем полученные данные
+				responses.append(buffer, static_cast <size_t> (size));
+				// Выполняем подсчёт полученных ответов
+				result += answers(responses);
+			}
+			// Выполняем остановку отправки данных
+			::shutdown(sock, SHUT_RDWR);
+			// Ожидаем завершения потока отправки
+			sender.join();
+		}
+		// Закрываем сокет подключения
+		::close(sock);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Порт сервера для замеров
+	const uint32_t port = 2227;
+	// Количество выполняемых запросов
+	const uint32_t count = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 100000);
+	// Количество запросов отправляемых без ожидания ответа
+	const uint32_t depth = (argc > 2 ? static_cast <uint32_t> (::atoi(argv[2])) : 16);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("PIPELINE Benchmark");
+	// Выполняем замеры сначала без конвейера, затем с конвейером указанной глубины
+	for(const uint32_t pipeline : {1u, std::max(depth, 1u)}){
+		// Создаём дочерний процесс сервера
+		const pid_t pid = ::fork();
+		// Если процесс не создан
+		if(pid < 0)
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		// Если это дочерний процесс
+		else if(pid == 0){
+			// Выполняем запуск сервера
+			run(port, 0, false);
+			// Выходим из дочернего процесса
+			::exit(EXIT_SUCCESS);
+		}
+		// Ожидаем запуска сервера
+		this_thread::sleep_for(1s);
+		// Запоминаем время начала замеров
+		const auto start = chrono::steady_clock::now();
+		// Выполняем запросы к серверу
+		const uint32_t success = requests(port, count, pipeline);
+		// Получаем затраченное время в секундах
+		const double seconds = chrono::duration <double> (chrono::steady_clock::now() - start).count();
+		// Выводим результат замеров
+		log.print("Pipeline depth: %u, responses: %u of %u, rate: %.1f requests/sec", log_t::flag_t::INFO, pipeline, success, count, (seconds > 0. ? success / seconds : 0.));
+		// Ожидаем завершения сервера
+		::waitpid(pid, nullptr, 0);
+	}
+	/**
+	 * Выполняем проверку приостановки чтения при превышении глубины конвейера
+	 */
+	{
+		// Глубина конвейера запросов сервера
+		const uint16_t limit = 4;
+		// Количество запросов отправляемых одной записью (около 4Mb данных)
+		const uint32_t total = static_cast <uint32_t> (0x400000 / ::strlen(request));
+		// Создаём дочерний процесс сервера
+		const pid_t pid = ::fork();
+		// Если процесс не создан
+		if(pid < 0)
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		// Если это дочерний процесс
+		else if(pid == 0){
+			// Выполняем запуск сервера удерживающего ответ на первый запрос
+			const size_t stalled = run(port, limit, true);
+			// Если за время удержания ответа сервер прочитал весь конвейер, чтение не было приостановлено
+			::exit(((stalled > 0) && (stalled < (total * ::strlen(request)))) ? EXIT_SUCCESS : EXIT_FAILURE);
+		}
+		// Статус завершения дочернего процесса
+		int32_t code = 0;
+		// Ожидаем запуска сервера
+		this_thread::sleep_for(1s);
+		// Выполняем отправку конвейера запросов превышающего глубину
+		const uint32_t success = flood(port, total);
+		// Ожидаем завершения сервера
+		::waitpid(pid, &code, 0);
+		// Выводим результат проверки
+		log.print("Pipeline limit: %u, responses: %u of %u", log_t::flag_t::INFO, limit, success, total);
+		// Если получены не все ответы или сервер не приостановил чтение
+		if((success != total) || !WIFEXITED(code) || (WEXITSTATUS(code) != EXIT_SUCCESS)){
+			// Выводим сообщение об ошибке
+			log.print("Server did not pause reading once the pipeline depth was reached", log_t::flag_t::CRITICAL);
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		}
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
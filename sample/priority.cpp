@@ -0,0 +1,376 @@
+/**
+ * @file: priority.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <sys/wait.h>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <client/awh.hpp>
+#include <server/awh.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Подписываемся на пространство имён заполнителя
+ */
+using namespace placeholders;
+
+/**
+ * Режимы расстановки приоритетов
+ */
+enum class signal_t : uint8_t {
+	NONE    = 0x00, // Приоритеты не устанавливаются
+	HEADER  = 0x01, // Приоритеты передаются клиентом в заголовке Priority
+	HANDLER = 0x02  // Приоритеты устанавливаются обработчиком запросов сервера
+};
+
+/**
+ * @brief Класс объекта сервера замеров
+ *
+ */
+class Server {
+	private:
+		// Режим расстановки приоритетов
+		signal_t _signal;
+	private:
+		// Тело ответа массовой загрузки
+		vector <char> _bulk;
+		// Тело срочного ответа
+		vector <char> _urgent;
+	private:
+		// Объект сетевого ядра
+		server::core_t * _core;
+	public:
+		/**
+		 * @brief Метод идентификации активности на сервере
+		 *
+		 * @param bid  идентификатор брокера
+		 * @param mode режим события подключения
+		 */
+		void active([[maybe_unused]] const uint64_t bid, const server::web_t::mode_t mode){
+			// Если клиент отключился, замеры завершены
+			if(mode == server::web_t::mode_t::DISCONNECT)
+				// Выполняем остановку сервера
+				this->_core->stop();
+		}
+		/**
+		 * @brief Метод получения запроса целиком
+		 *
+		 * @param sid     идентификатор потока
+		 * @param bid     идентификатор брокера
+		 * @param method  метод запроса
+		 * @param url     URL-адрес запроса
+		 * @param entity  тело запроса
+		 * @param headers заголовки запроса
+		 * @param awh     объект сервера
+		 */
+		void complete(const int32_t sid, const uint64_t bid, [[maybe_unused]] const awh::web_t::method_t method, const uri_t::url_t & url, [[maybe_unused]] const vector <char> & entity, [[maybe_unused]] const unordered_multimap <string, string> & headers, server::awh_t * awh){
+			// Определяем является ли запрос срочным
+			const bool urgent = (!url.path.empty() && (url.path.back() == "urgent"));
+			// Если приоритеты устанавливаются обработчиком запросов
+			if(this->_signal == signal_t::HANDLER)
+				// Устанавливаем приоритет потока
+				awh->priority2(sid, bid, (urgent ? 0 : 7), false);
+			// Отправляем ответ клиенту
+			awh->send(sid, bid, 200, "OK", (urgent ? this->_urgent : this->_bulk));
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param core   объект сетевого ядра
+		 * @param signal режим расстановки приоритетов
+		 * @param size   размер тела ответа массовой загрузки
+		 */
+		Server(server::core_t * core, const signal_t signal, const size_t size) :
+		 _signal(signal), _bulk(size, 'b'), _urgent(0x400, 'u'), _core(core) {}
+};
+
+/**
+ * @brief Класс объекта клиента замеров
+ *
+ */
+class Client {
+	private:
+		// Режим расстановки приоритетов
+		signal_t _signal;
+	private:
+		// Количество запросов массовой загрузки
+		uint32_t _bulk;
+		// Количество срочных запросов
+		uint32_t _urgent;
+		// Количество полученных ответов
+		uint32_t _received;
+	private:
+		// Максимальное время получения срочного ответа
+		double _max;
+		// Суммарное время получения срочных ответов
+		double _total;
+		// Время получения последнего ответа массовой загрузки
+		double _elapsed;
+	private:
+		// Время начала замеров
+		chrono::steady_clock::time_point _start;
+	private:
+		// Список срочных потоков
+		std::set <int32_t> _streams;
+	private:
+		// Объект для работы с логами
+		const log_t * _log;
+	public:
+		/**
+		 * @brief Метод идентификации активности на Web-клиенте
+		 *
+		 * @param mode режим события подключения
+		 * @param awh  объект web-клиента
+		 */
+		void active(const client::web_t::mode_t mode, client::awh_t * awh){
+			// Если подключение выполнено
+			if(mode == client::web_t::mode_t::CONNECT){
+				// Создаём объект запроса
+				client::web_t::request_t request;
+				// Устанавливаем метод запроса
+				request.method = web_t::method_t::GET;
+				// Устанавливаем путь запроса массовой загрузки
+				request.url.path = {"bulk"};
+				// Если приоритеты передаются клиентом
+				if(this->_signal == signal_t::HEADER)
+					// Устанавливаем низкий приоритет массовой загрузки
+					request.headers.emplace("priority", "u=7");
+				// Запоминаем время начала замеров
+				this->_start = chrono::steady_clock::now();
+				// Выполняем отправку запросов массовой загрузки
+				for(uint32_t i = 0; i < this->_bulk; i++){
+					// Сбрасываем идентификатор запроса
+					request.id = 0;
+					// Выполняем отправку запроса
+					awh->send(request);
+				}
+				// Устанавливаем путь срочного запроса
+				request.url.path = {"urgent"};
+				// Если приоритеты передаются клиентом
+				if(this->_signal == signal_t::HEADER){
+					// Удаляем приоритет массовой загрузки
+					request.headers.clear();
+					// Устанавливаем наивысший приоритет срочного запроса
+					request.headers.emplace("priority", "u=0");
+				}
+				// Выполняем отправку срочных запросов
+				for(uint32_t i = 0; i < this->_urgent; i++){
+					// Сбрасываем идентификатор запроса
+					request.id = 0;
+					// Выполняем отправку запроса и запоминаем его поток
+					this->_streams.emplace(awh->send(request));
+				}
+			}
+		}
+		/**
+		 * @brief Метод получения ответа с сервера
+		 *
+		 * @param sid     идентификатор потока
+		 * @param rid     идентификатор запроса
+		 * @param code    код ответа сервера
+		 * @param message сообщение ответа сервера
+		 * @param entity  тело ответа сервера
+		 * @param headers заголовки ответа сервера
+		 * @param awh     объект web-клиента
+		 */
+		void complete(const int32_t sid, [[maybe_unused]] const uint64_t rid, [[maybe_unused]] const uint32_t code, [[maybe_unused]] const string & message, [[maybe_unused]] const vector <char> & entity, [[maybe_unused]] const unordered_multimap <string, string> & headers, client::awh_t * awh){
+			// Получаем время получения ответа в миллисекундах
+			const double elapsed = chrono::duration <double, milli> (chrono::steady_clock::now() - this->_start).count();
+			// Если получен срочный ответ
+			if(this->_streams.find(sid) != this->_streams.end()){
+				// Увеличиваем суммарное время получения срочных ответов
+				this->_total += elapsed;
+				// Запоминаем максимальное время получения срочного ответа
+				this->_max = std::max(this->_max, elapsed);
+			// Запоминаем время получения ответа массовой загрузки
+			} else this->_elapsed = std::max(this->_elapsed, elapsed);
+			// Если получены все ответы
+			if(++this->_received == (this->_bulk + this->_urgent))
+				// Выполняем остановку клиента
+				awh->stop();
+		}
+	public:
+		/**
+		 * @brief Метод вывода результата замеров
+		 *
+		 * @param name название режима расстановки приоритетов
+		 */
+		void print(const char * name) const {
+			// Выводим результат замеров
+			this->_log->print("Priority: %s, responses: %u of %u, urgent avg: %.2f ms, urgent max: %.2f ms, bulk done: %.2f ms", log_t::flag_t::INFO, name, this->_received, this->_bulk + this->_urgent, (this->_urgent > 0 ? this->_total / this->_urgent : 0.), this->_max, this->_elapsed);
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param signal режим расстановки приоритетов
+		 * @param bulk   количество запросов массовой загрузки
+		 * @param urgent количество срочных запросов
+		 * @param log    объект для работы с логами
+		 */
+		Client(const signal_t signal, const uint32_t bulk, const uint32_t urgent, const log_t * log) :
+		 _signal(signal), _bulk(bulk), _urgent(urgent), _received(0),
+		 _max(0.), _total(0.), _elapsed(0.), _log(log) {}
+};
+
+/**
+ * @brief Функция запуска HTTP/2-сервера в дочернем процессе
+ *
+ * @param port   порт сервера
+ * @param signal режим расстановки приоритетов
+ * @param size   размер тела ответа массовой загрузки
+ */
+static void run(const uint32_t port, const signal_t signal, const size_t size) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Создаём объект параметров SSL-шифрования
+	node_t::ssl_t ssl;
+	// Создаём объект сетевого ядра
+	server::core_t core(&fmk, &log);
+	// Создаём объект AWH-сервера
+	server::awh_t awh(&core, &fmk, &log);
+	// Создаём объект сервера замеров
+	Server executor(&core, signal, size);
+	// Устанавливаем название сервиса
+	log.name("PRIORITY Benchmark");
+	// Запрещаем вывод информационных сообщений
+	awh.mode({server::web_t::flag_t::NOT_INFO});
+	// Отключаем валидацию сертификата
+	ssl.verify = false;
+	// Устанавливаем SSL сертификаты сервера
+	ssl.key  = "./certs/certificates/server-key.pem";
+	ssl.cert = "./certs/certificates/server-cert.pem";
+	// Выполняем установку параметров SSL-шифрования
+	core.ssl(ssl);
+	// Устанавливаем активный протокол подключения
+	core.proto(awh::engine_t::proto_t::HTTP2);
+	// Устанавливаем тип сокета
+	core.sonet(awh::scheme_t::sonet_t::TLS);
+	// Запрещаем перехват сигналов
+	core.signalInterception(awh::scheme_t::mode_t::DISABLED);
+	// Выполняем инициализацию Web-сервера
+	awh.init(port, "127.0.0.1");
+	// Установливаем функцию обратного вызова на событие запуска или остановки подключения
+	awh.on <void (const uint64_t, const server::web_t::mode_t)> ("active", &Server::active, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие получения запроса целиком
+	awh.on <void (const int32_t, const uint64_t, const awh::web_t::method_t, const uri_t::url_t &, const vector <char> &, const unordered_multimap <string, string> &)> ("complete", &Server::complete, &executor, _1, _2, _3, _4, _5, _6, &awh);
+	// Выполняем запуск Web-сервера
+	awh.start();
+}
+/**
+ * @brief Функция выполнения запросов к серверу
+ *
+ * @param port   порт сервера
+ * @param signal режим расстановки приоритетов
+ * @param bulk   количество запросов массовой загрузки
+ * @param urgent количество срочных запросов
+ * @param fmk    объект фреймворка
+ * @param log    объект для работы с логами
+ * @return       объект клиента с результатами замеров
+ */
+static Client requests(const uint32_t port, const signal_t signal, const uint32_t bulk, const uint32_t urgent, const fmk_t * fmk, const log_t * log) noexcept {
+	// Создаём объект клиента замеров
+	Client result(signal, bulk, urgent, log);
+	// Создаём объект параметров SSL-шифрования
+	node_t::ssl_t ssl;
+	// Создаём объект сетевого ядра
+	client::core_t core(fmk, log);
+	// Создаём объект AWH-клиента
+	client::awh_t awh(&core, fmk, log);
+	// Запрещаем вывод информационных сообщений
+	awh.mode({client::web_t::flag_t::NOT_INFO});
+	// Отключаем валидацию сертификата
+	ssl.verify = false;
+	// Выполняем установку параметров SSL-шифрования
+	core.ssl(ssl);
+	// Устанавливаем активный протокол подключения
+	core.proto(awh::engine_t::proto_t::HTTP2);
+	// Запрещаем перехват сигналов
+	core.signalInterception(awh::scheme_t::mode_t::DISABLED);
+	// Устанавливаем метод активации подключения
+	awh.on <void (const client::web_t::mode_t)> ("active", &Client::active, &result, _1, &awh);
+	// Устанавливаем метод получения ответа с сервера
+	awh.on <void (const int32_t, const uint64_t, const uint32_t, const string &, const vector <char> &, const unordered_multimap <string, string> &)> ("complete", &Client::complete, &result, _1, _2, _3, _4, _5, _6, &awh);
+	// Выполняем инициализацию подключения
+	awh.init(fmk->format("https://127.0.0.1:%u", port));
+	// Выполняем запуск работы
+	awh.start();
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Порт сервера для замеров
+	const uint32_t port = 2228;
+	// Количество запросов массовой загрузки
+	const uint32_t bulk = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 8);
+	// Количество срочных запросов
+	const uint32_t urgent = (argc > 2 ? static_cast <uint32_t> (::atoi(argv[2])) : 8);
+	// Размер тела ответа массовой загрузки
+	const size_t size = (argc > 3 ? static_cast <size_t> (::atoll(argv[3])) : 0x400000);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("PRIORITY Benchmark");
+	// Список режимов расстановки приоритетов
+	const std::pair <const char *, signal_t> signals[] = {
+		{"none", signal_t::NONE},
+		{"header", signal_t::HEADER},
+		{"handler", signal_t::HANDLER}
+	};
+	// Выполняем замеры для каждого режима расстановки приоритетов
+	for(auto & signal : signals){
+		// Создаём дочерний процесс сервера
+		const pid_t pid = ::fork();
+		// Если процесс не создан
+		if(pid < 0)
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		// Если это дочерний процесс
+		else if(pid == 0){
+			// Выполняем запуск сервера
+			run(port, signal.second, size);
+			// Выходим из дочернего процесса
+			::exit(EXIT_SUCCESS);
+		}
+		// Ожидаем запуска сервера
+		this_thread::sleep_for(1s);
+		// Выполняем запросы к серверу и выводим результат замеров
+		requests(port, signal.second, bulk, urgent, &fmk, &log).print(signal.first);
+		// Ожидаем завершения сервера
+		::waitpid(pid, nullptr, 0);
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
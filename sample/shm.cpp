@@ -0,0 +1,272 @@
+/**
+ * @file: shm.cpp
+ * @date: 2025-03-24
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <core/cluster.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Подписываемся на пространство имён заполнителя
+ */
+using namespace placeholders;
+
+/**
+ * Размеры сообщений для замера
+ */
+static const size_t SIZES[] = {64, 512, 4096, 16384, 65536};
+
+/**
+ * @brief Класс замера пропускной способности обмена сообщениями кластера
+ *
+ */
+class Bench {
+	private:
+		// Количество сообщений на один процесс
+		size_t _count;
+		// Количество сообщений в полёте на один процесс
+		size_t _window;
+		// Количество дочерних процессов
+		uint16_t _workers;
+	private:
+		// Индекс текущего размера сообщения
+		size_t _index;
+		// Количество полученных ответов
+		size_t _received;
+		// Время начала замера
+		std::chrono::steady_clock::time_point _start;
+	private:
+		// Буфер отправляемого сообщения
+		vector <char> _buffer;
+		// Список задержек круговых обходов (нс)
+		vector <uint64_t> _latencies;
+		// Количество отправленных сообщений каждому дочернему процессу
+		std::map <pid_t, size_t> _sent;
+	private:
+		// Название режима передачи данных
+		string _transfer;
+	private:
+		// Объект логирования
+		log_t * _log;
+	private:
+		/**
+		 * @brief Метод получения текущего времени в наносекундах
+		 *
+		 * @return текущее время монотонных часов
+		 */
+		static uint64_t now() noexcept {
+			// Выводим текущее время
+			return static_cast <uint64_t> (std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+		/**
+		 * @brief Метод отправки очередного сообщения дочернему процессу
+		 *
+		 * @param pid  идентификатор процесса
+		 * @param core объект сетевого ядра
+		 */
+		void push(const pid_t pid, cluster::core_t * core){
+			// Получаем метку времени отправки
+			const uint64_t date = now();
+			// Записываем метку времени в начало сообщения
+			::memcpy(this->_buffer.data(), &date, sizeof(date));
+			// Увеличиваем количество отправленных сообщений
+			this->_sent[pid]++;
+			// Выполняем отправку сообщения
+			core->send(pid, this->_buffer.data(), this->_buffer.size());
+		}
+		/**
+		 * @brief Метод запуска замера для текущего размера сообщения
+		 *
+		 * @param core объект сетевого ядра
+		 */
+		void run(cluster::core_t * core){
+			// Если все размеры обработаны
+			if(this->_index >= (sizeof(SIZES) / sizeof(SIZES[0]))){
+				// Останавливаем работу кластера
+				core->stop();
+				// Выходим из функции
+				return;
+			}
+			// Сбрасываем количество полученных ответов
+			this->_received = 0;
+			// Очищаем список задержек
+			this->_latencies.clear();
+			// Выделяем память для списка задержек
+			this->_latencies.reserve(this->_count * this->_workers);
+			// Формируем буфер сообщения
+			this->_buffer.assign(SIZES[this->_index], 'x');
+			// Запоминаем время начала замера
+			this->_start = std::chrono::steady_clock::now();
+			// Переходим по всем дочерним процессам
+			for(auto & item : this->_sent){
+				// Сбрасываем количество отправленных сообщений
+				item.second = 0;
+				// Заполняем окно сообщений в полёте
+				for(size_t i = 0; i < min(this->_window, this->_count); i++)
+					// Выполняем отправку сообщения
+					this->push(item.first, core);
+			}
+		}
+		/**
+		 * @brief Метод вывода результатов замера
+		 *
+		 */
+		void report(){
+			// Получаем время выполнения замера
+			const double seconds = std::chrono::duration <double> (std::chrono::steady_clock::now() - this->_start).count();
+			// Выполняем сортировку задержек
+			std::sort(this->_latencies.begin(), this->_latencies.end());
+			// Получаем медианную задержку
+			const double p50 = (this->_latencies[this->_latencies.size() / 2] / 1000.);
+			// Получаем задержку 99-го перцентиля
+			const double p99 = (this->_latencies[(this->_latencies.size() * 99) / 100] / 1000.);
+			// Получаем количество сообщений в секунду
+			const double rate = (this->_received / seconds);
+			// Выводим результат замера
+			this->_log->print(
+				"transfer=%s workers=%u size=%zu msgs/sec=%.0f MB/sec=%.1f rtt p50=%.1fus p99=%.1fus",
+				log_t::flag_t::INFO, this->_transfer.c_str(), this->_workers, SIZES[this->_index],
+				rate, ((rate * SIZES[this->_index] * 2) / 1048576.), p50, p99
+			);
+		}
+	public:
+		/**
+		 * @brief Метод готовности дочерних процессов к работе
+		 *
+		 * @param pid  идентификатор процесса
+		 * @param core объект сетевого ядра
+		 */
+		void ready(const pid_t pid, cluster::core_t * core){
+			// Добавляем процесс в список готовых
+			this->_sent.emplace(pid, 0);
+			// Если все дочерние процессы готовы
+			if(this->_sent.size() == static_cast <size_t> (this->_workers))
+				// Запускаем замер
+				this->run(core);
+		}
+		/**
+		 * @brief Метод получения сообщения
+		 *
+		 * @param worker тип активного процесса
+		 * @param pid    идентификатор процесса
+		 * @param buffer буфер данных сообщения
+		 * @param size   размер полученных данных
+		 * @param core   объект сетевого ядра
+		 */
+		void message(const cluster_t::family_t worker, const pid_t pid, const char * buffer, const size_t size, cluster::core_t * core){
+			// Определяем тип воркера
+			switch(static_cast <uint8_t> (worker)){
+				// Если сообщение пришло в родительский процесс
+				case static_cast <uint8_t> (cluster_t::family_t::MASTER): {
+					// Метка времени отправки сообщения
+					uint64_t date = 0;
+					// Извлекаем метку времени отправки сообщения
+					::memcpy(&date, buffer, sizeof(date));
+					// Добавляем задержку кругового обхода
+					this->_latencies.push_back(now() - date);
+					// Если не все сообщения процессу отправлены
+					if(this->_sent[pid] < this->_count)
+						// Выполняем отправку следующего сообщения
+						this->push(pid, core);
+					// Если все ответы получены
+					if(++this->_received == (this->_count * this->_workers)){
+						// Выводим результат замера
+						this->report();
+						// Переходим к следующему размеру сообщения
+						this->_index++;
+						// Запускаем следующий замер
+						this->run(core);
+					}
+				} break;
+				// Если сообщение пришло в дочерний процесс
+				case static_cast <uint8_t> (cluster_t::family_t::CHILDREN):
+					// Отправляем сообщение обратно родительскому процессу
+					core->send(buffer, size);
+				break;
+			}
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param transfer название режима передачи данных
+		 * @param workers  количество дочерних процессов
+		 * @param count    количество сообщений на один процесс
+		 * @param log      объект логирования
+		 */
+		Bench(const string & transfer, const uint16_t workers, const size_t count, log_t * log) :
+		 _count(count), _window(64), _workers(workers), _index(0), _received(0), _transfer(transfer), _log(log) {}
+};
+
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Режим передачи данных (shm, pipe, ipc)
+	const string transfer = (argc > 1 ? argv[1] : "shm");
+	// Количество дочерних процессов
+	const uint16_t workers = (argc > 2 ? static_cast <uint16_t> (::atoi(argv[2])) : 4);
+	// Количество сообщений на один процесс для каждого размера
+	const size_t count = (argc > 3 ? static_cast <size_t> (::atol(argv[3])) : 20000);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Создаём объект замера
+	Bench bench(transfer, workers, count, &log);
+	// Создаём биндинг
+	cluster::core_t core(&fmk, &log);
+	// Устанавливаем название сервиса
+	log.name("Cluster SHM");
+	// Устанавливаем формат времени
+	log.format("%H:%M:%S %d.%m.%Y");
+	// Устанавливаем количество дочерних процессов
+	core.size(workers);
+	// Устанавливаем название кластера
+	core.name("BENCH");
+	// Если выбран режим передачи через разделяемую память
+	if(transfer.compare("shm") == 0)
+		// Переключаем режим передачи данных
+		core.transfer(cluster_t::transfer_t::SHM);
+	// Если выбран режим передачи через unix-сокет
+	else if(transfer.compare("ipc") == 0)
+		// Переключаем режим передачи данных
+		core.transfer(cluster_t::transfer_t::IPC);
+	// Иначе используем пару связанных сокетов
+	else core.transfer(cluster_t::transfer_t::PIPE);
+	// Устанавливаем функцию обратного вызова готовность дочерних процессов
+	core.on <void (const pid_t)> ("ready", &Bench::ready, &bench, _1, &core);
+	// Устанавливаем функцию обработки входящих сообщений
+	core.on <void (const cluster_t::family_t, const pid_t, const char *, const size_t)> ("message", &Bench::message, &bench, _1, _2, _3, _4, &core);
+	// Выполняем запуск кластера
+	core.start();
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
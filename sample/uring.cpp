@@ -0,0 +1,246 @@
+/**
+ * @file: uring.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+#include <sys/wait.h>
+
+/**
+ * Подключаем заголовочный файл проекта
+ */
+#include <server/sample.hpp>
+
+/**
+ * Подписываемся на пространство имён AWH
+ */
+using namespace awh;
+
+/**
+ * Подписываемся на пространство имён заполнителя
+ */
+using namespace placeholders;
+
+/**
+ * @brief Класс объекта исполнителя замеров
+ *
+ */
+class Bench {
+	private:
+		// Флаг использования io_uring
+		bool _uring;
+		// Количество обработанных запросов
+		uint64_t _requests;
+	private:
+		// Объект сетевого ядра
+		server::core_t * _core;
+	private:
+		// Создаём объект работы с логами
+		const log_t * _log;
+	public:
+		/**
+		 * @brief Метод идентификации активности на сервере
+		 *
+		 * @param bid  идентификатор брокера
+		 * @param mode режим события подключения
+		 */
+		void active([[maybe_unused]] const uint64_t bid, const server::sample_t::mode_t mode){
+			// Если клиент отключился, замеры завершены
+			if(mode == server::sample_t::mode_t::DISCONNECT){
+				// Получаем количество системных вызовов движка событий
+				const uint64_t syscalls = this->_core->base()->syscalls();
+				// Выводим результат замеров
+				this->_log->print(
+					"Engine: %s, requests: %llu, syscalls: %llu, syscalls/request: %.2f", log_t::flag_t::INFO,
+					(this->_uring ? "io_uring" : "epoll"), this->_requests, syscalls,
+					(this->_requests > 0 ? static_cast <double> (syscalls) / this->_requests : 0.)
+				);
+				// Выполняем остановку сервера
+				this->_core->stop();
+			}
+		}
+		/**
+		 * @brief Метод получения сообщений
+		 *
+		 * @param bid    идентификатор брокера
+		 * @param buffer буфер входящих данных
+		 * @param sample объект активного сервера
+		 */
+		void message(const uint64_t bid, const vector <char> & buffer, server::sample_t * sample){
+			// Увеличиваем количество обработанных запросов
+			this->_requests++;
+			// Отправляем сообщение обратно
+			sample->send(bid, buffer.data(), buffer.size());
+		}
+	public:
+		/**
+		 * @brief Конструктор
+		 *
+		 * @param uring флаг использования io_uring
+		 * @param core  объект сетевого ядра
+		 * @param log   объект логирования
+		 */
+		Bench(const bool uring, server::core_t * core, const log_t * log) :
+		 _uring(uring), _requests(0), _core(core), _log(log) {}
+};
+
+/**
+ * @brief Функция запуска эхо-сервера в дочернем процессе
+ *
+ * @param port  порт сервера
+ * @param uring флаг использования io_uring
+ */
+static void run(const uint32_t port, const bool uring) noexcept {
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Объект DNS-резолвера
+	dns_t dns(&fmk, &log);
+	// Создаём объект сетевого ядра
+	server::core_t core(&dns, &fmk, &log);
+	// Создаём объект сервера
+	server::sample_t sample(&core, &fmk, &log);
+	// Создаём объект исполнителя замеров
+	Bench executor(uring, &core, &log);
+	// Устанавливаем название сервиса
+	log.name("URING Benchmark");
+	// Запрещаем вывод информационных сообщений
+	sample.mode({server::sample_t::flag_t::NOT_INFO});
+	// Устанавливаем тип сокета
+	core.sonet(awh::scheme_t::sonet_t::TCP);
+	// Запрещаем перехват сигналов
+	core.signalInterception(scheme_t::mode_t::DISABLED);
+	// Выполняем выбор движка событий
+	core.base()->uring(uring);
+	// Выполняем инициализацию Sample сервера
+	sample.init(port, "127.0.0.1");
+	// Установливаем функцию обратного вызова на событие запуска или остановки подключения
+	sample.on <void (const uint64_t, const server::sample_t::mode_t)> ("active", &Bench::active, &executor, _1, _2);
+	// Установливаем функцию обратного вызова на событие получения сообщений
+	sample.on <void (const uint64_t, const vector <char> &)> ("message", &Bench::message, &executor, _1, _2, &sample);
+	// Выполняем запуск SAMPLE сервер
+	sample.start();
+}
+/**
+ * @brief Функция выполнения запросов к эхо-серверу
+ *
+ * @param port  порт сервера
+ * @param count количество запросов
+ * @return      количество удачных запросов
+ */
+static uint32_t requests(const uint32_t port, const uint32_t count) noexcept {
+	// Результат работы функции
+	uint32_t result = 0;
+	// Создаём сокет подключения
+	const int32_t sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	// Если сокет создан
+	if(sock != INVALID_SOCKET){
+		// Создаём объект адреса сервера
+		struct sockaddr_in addr;
+		// Заполняем структуру нулями
+		::memset(&addr, 0, sizeof(addr));
+		// Устанавливаем семейство протоколов
+		addr.sin_family = AF_INET;
+		// Устанавливаем порт сервера
+		addr.sin_port = htons(static_cast <uint16_t> (port));
+		// Устанавливаем адрес сервера
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		// Выполняем подключение к серверу
+		if(::connect(sock, reinterpret_cast <struct sockaddr *> (&addr), sizeof(addr)) == 0){
+			// Буфер ответа сервера
+			char buffer[64];
+			// Выполняем заданное количество запросов
+			for(uint32_t i = 0; i < count; i++){
+				// Отправляем запрос серверу
+				if(::send(sock, "ping", 4, 0) != 4)
+					// Выходим из цикла
+					break;
+				// Количество полученных байт ответа
+				size_t bytes = 0;
+				// Выполняем чтение ответа целиком
+				while(bytes < 4){
+					// Выполняем чтение ответа сервера
+					const ssize_t size = ::recv(sock, buffer, sizeof(buffer), 0);
+					// Если соединение закрыто
+					if(size <= 0)
+						// Выходим из цикла
+						break;
+					// Увеличиваем количество полученных байт
+					bytes += static_cast <size_t> (size);
+				}
+				// Если ответ не получен
+				if(bytes < 4)
+					// Выходим из цикла
+					break;
+				// Увеличиваем количество удачных запросов
+				result++;
+			}
+		}
+		// Закрываем сокет подключения
+		::close(sock);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Главная функция приложения
+ *
+ * @param argc длина массива параметров
+ * @param argv массив параметров
+ * @return     код выхода из приложения
+ */
+int32_t main(int32_t argc, char * argv[]){
+	// Порт сервера для замеров
+	const uint32_t port = 2224;
+	// Количество выполняемых запросов
+	const uint32_t count = (argc > 1 ? static_cast <uint32_t> (::atoi(argv[1])) : 10000);
+	// Создаём объект фреймворка
+	fmk_t fmk;
+	// Создаём объект для работы с логами
+	log_t log(&fmk);
+	// Устанавливаем название сервиса
+	log.name("URING Benchmark");
+	// Выполняем замеры сначала для EPoll, затем для io_uring
+	for(const bool uring : {false, true}){
+		// Создаём дочерний процесс сервера
+		const pid_t pid = ::fork();
+		// Если процесс не создан
+		if(pid < 0)
+			// Выходим из приложения
+			return EXIT_FAILURE;
+		// Если это дочерний процесс
+		else if(pid == 0){
+			// Выполняем запуск сервера
+			run(port, uring);
+			// Выходим из дочернего процесса
+			::exit(EXIT_SUCCESS);
+		}
+		// Ожидаем запуска сервера
+		this_thread::sleep_for(1s);
+		// Запоминаем время начала замеров
+		const auto start = chrono::steady_clock::now();
+		// Выполняем запросы к серверу
+		const uint32_t success = requests(port, count);
+		// Получаем затраченное время в секундах
+		const double seconds = chrono::duration <double> (chrono::steady_clock::now() - start).count();
+		// Выводим результат замеров
+		log.print("Engine: %s, requests: %u of %u, rate: %.1f requests/sec", log_t::flag_t::INFO, (uring ? "io_uring" : "epoll"), success, count, (seconds > 0. ? success / seconds : 0.));
+		// Ожидаем завершения сервера, он выводит количество системных вызовов после отключения клиента
+		::waitpid(pid, nullptr, 0);
+	}
+	// Выводим результат
+	return EXIT_SUCCESS;
+}
@@ -1138,6 +1138,15 @@ void awh::client::AWH::settings(const std::map <awh::http2_t::settings_t, uint32
 	// Выполняем установку списока настроек протокола HTTP/2
 	this->_http.settings(settings);
 }
+/**
+ * @brief Метод HTTP/2 получения состояния управления потоком сессии
+ *
+ * @return размеры окон, время приёма-передачи и оценка BDP
+ */
+awh::http2_t::flow_t awh::client::AWH::flow2() const noexcept {
+	// Выводим состояние управления потоком
+	return this->_http.flow();
+}
 /**
  * @brief Метод установки размера чанка
  *
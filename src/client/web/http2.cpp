@@ -1500,8 +1500,10 @@ int32_t awh::client::Http2::send(const request_t & request) noexcept {
 									if(this->_http.empty(awh::http_t::suite_t::BODY))
 										// Устанавливаем флаг завершения потока
 										flag = awh::http2_t::flag_t::END_STREAM;
+									// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+									const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 									// Выполняем отправку тела запроса на сервер
-									if(!web2_t::send(result, entity.data(), entity.size(), flag))
+									if(!web2_t::send(result, chunk->data(), chunk->size(), chunk, flag))
 										// Выходим из функции
 										return -1;
 								}
@@ -1761,8 +1763,10 @@ bool awh::client::Http2::send(const int32_t sid, const char * buffer, const size
 					if(end && this->_http.empty(awh::http_t::suite_t::BODY))
 						// Устанавливаем флаг завершения потока
 						flag = awh::http2_t::flag_t::END_STREAM;
+					// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+					const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 					// Выполняем отправку данных на удалённый сервер
-					result = web2_t::send(sid, entity.data(), entity.size(), flag);
+					result = web2_t::send(sid, chunk->data(), chunk->size(), chunk, flag);
 				}
 			// Если протокол HTTP/2 не активирован, передаём запрос через протокол HTTP/1.1
 			} else result = this->_http1.send(buffer, size, end);
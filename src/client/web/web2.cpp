@@ -39,6 +39,19 @@ void awh::client::Web2::sendSignal(const uint8_t * buffer, const size_t size) no
 		// Выполняем отправку заголовков запроса на сервер
 		const_cast <client::core_t *> (this->_core)->send(reinterpret_cast <const char *> (buffer), size, this->_bid);
 }
+/**
+ * @brief Метод обратного вызова при отправки данных HTTP/2 без копирования
+ *
+ * @param buffer буфер бинарных данных
+ * @param size   размер буфера данных для отправки
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ */
+void awh::client::Web2::writeSignal(const uint8_t * buffer, const size_t size, const std::shared_ptr <const void> & owner) noexcept {
+	// Если сетевое ядро уже инициализированно
+	if(this->_core != nullptr)
+		// Выполняем отправку тела запроса на сервер
+		const_cast <client::core_t *> (this->_core)->send(reinterpret_cast <const char *> (buffer), size, owner, this->_bid);
+}
 /**
  * @brief Метод обратного вызова при получении фрейма заголовков прокси-сервера HTTP/2
  *
@@ -412,6 +425,10 @@ void awh::client::Web2::implementation(const uint64_t bid) noexcept {
 			callback.on <void (const vector <string> &)> ("origin", &web2_t::originCallback, this, _1);
 			// Выполняем установку функции обратного вызова при отправки сообщения на сервер
 			callback.on <void (const uint8_t *, const size_t)> ("send", &web2_t::sendSignal, this, _1, _2);
+			// Выполняем установку функции обратного вызова при отправки данных на сервер без копирования
+			callback.on <void (const uint8_t *, const size_t, const std::shared_ptr <const void> &)> ("write", &web2_t::writeSignal, this, _1, _2, _3);
+			// Выполняем установку функции обратного вызова получения объёма памяти доступной для буферов отправки
+			callback.on <size_t (void)> ("memory", &web2_t::memorySignal, this);
 			// Выполняем установку функции обратного вызова получения альтернативного сервиса от сервера
 			callback.on <void (const string &, const string &)> ("altsvc", &web2_t::altsvcCallback, this, _1, _2);
 			// Выполняем установку функции обратного вызова при закрытии потока
@@ -499,6 +516,19 @@ awh::client::Web::status_t awh::client::Web2::prepareProxy(const int32_t sid, co
 	// Выполняем завершение работы
 	return status_t::STOP;
 }
+/**
+ * @brief Метод обратного вызова при получении объёма памяти доступной для буферов отправки
+ *
+ * @return количество байт доступной памяти
+ */
+size_t awh::client::Web2::memorySignal() const noexcept {
+	// Если сетевое ядро уже инициализированно
+	if(this->_core != nullptr)
+		// Выводим количество байт доступной памяти
+		return this->_core->memoryAvailableSize();
+	// Выводим результат
+	return 0;
+}
 /**
  * @brief Метод выполнения пинга сервера
  *
@@ -533,6 +563,20 @@ void awh::client::Web2::close(const uint64_t bid) noexcept {
  * @return       результат отправки данных указанному клиенту
  */
 bool awh::client::Web2::send(const int32_t sid, const char * buffer, const size_t size, const http2_t::flag_t flag) noexcept {
+	// Выполняем отправку сообщения с копированием
+	return this->send(sid, buffer, size, nullptr, flag);
+}
+/**
+ * @brief Метод отправки сообщения на сервер без копирования
+ *
+ * @param sid    идентификатор потока
+ * @param buffer буфер бинарных данных передаваемых на сервер
+ * @param size   размер сообщения в байтах
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ * @param flag   флаг передаваемого потока по сети
+ * @return       результат отправки данных указанному клиенту
+ */
+bool awh::client::Web2::send(const int32_t sid, const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const http2_t::flag_t flag) noexcept {
 	// Результат работы функции
 	bool result = false;
 	// Создаём объект холдирования
@@ -542,7 +586,7 @@ bool awh::client::Web2::send(const int32_t sid, const char * buffer, const size_
 		// Если флаг инициализации сессии HTTP/2 установлен и подключение выполнено
 		if((result = ((this->_core != nullptr) && this->_core->working() && (buffer != nullptr) && (size > 0)))){
 			// Выполняем отправку тела запроса на сервер
-			if(!(result = this->_http2.sendData(sid, reinterpret_cast <const uint8_t *> (buffer), size, flag))){
+			if(!(result = this->_http2.sendData(sid, reinterpret_cast <const uint8_t *> (buffer), size, owner, flag))){
 				// Выполняем закрытие подключения
 				const_cast <client::core_t *> (this->_core)->close(this->_bid);
 				// Выходим из функции
@@ -623,6 +667,12 @@ void awh::client::Web2::settings(const std::map <http2_t::settings_t, uint32_t>
 	if(this->_settings.find(http2_t::settings_t::PAYLOAD_SIZE) == this->_settings.end())
 		// Выполняем установку максимального размера буфера полезной нагрузки
 		this->_settings.emplace(http2_t::settings_t::PAYLOAD_SIZE, http2_t::MAX_PAYLOAD_SIZE);
+	// Выполняем поиск максимального размера окна при автоматической подстройке
+	auto j = this->_settings.find(http2_t::settings_t::WINDOW_LIMIT);
+	// Если максимальный размер окна больше самого максимального значения
+	if((j != this->_settings.end()) && (j->second > http2_t::MAX_WINDOW_SIZE))
+		// Выполняем корректировку максимального размера окна
+		j->second = http2_t::MAX_WINDOW_SIZE;
 	// Если максимальный размер блока заголовоков не установлен
 	if(this->_settings.find(http2_t::settings_t::HEADER_TABLE_SIZE) == this->_settings.end())
 		// Выполняем установку максимального размера блока заголовоков
@@ -632,6 +682,15 @@ void awh::client::Web2::settings(const std::map <http2_t::settings_t, uint32_t>
 		// Выполняем установку флага отключения принёма push-уведомлений
 		this->_settings.emplace(http2_t::settings_t::ENABLE_PUSH, 0);
 }
+/**
+ * @brief Метод получения состояния управления потоком сессии
+ *
+ * @return размеры окон, время приёма-передачи и оценка BDP
+ */
+awh::http2_t::flow_t awh::client::Web2::flow() const noexcept {
+	// Выводим состояние управления потоком
+	return this->_http2.flow();
+}
 /**
  * @brief Метод установки размера чанка
  *
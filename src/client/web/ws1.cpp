@@ -777,8 +777,10 @@ awh::client::Web::status_t awh::client::Websocket1::prepare(const int32_t sid, c
 		 * Выполняем обработку полученных данных
 		 */
 		while(!this->_close && this->_allow.receive && !this->_buffer.empty()){
-			// Выполняем чтение фрейма Websocket
-			const auto & payload = this->_frame.methods.get(head, reinterpret_cast <const char *> (this->_buffer.get()), this->_buffer.size());
+			// Выполняем чтение фрейма Websocket, полезная нагрузка размаскируется прямо в буфере
+			const char * data = this->_frame.methods.decode(head, this->_buffer.get(), this->_buffer.size());
+			// Получаем полезную нагрузку фрейма без копирования
+			const string_view payload(data, (data != nullptr ? static_cast <size_t> (head.payload) : 0));
 			// Если буфер данных получен
 			if(!payload.empty() || (head.optcode == ws::frame_t::opcode_t::PING) || (head.optcode == ws::frame_t::opcode_t::PONG) || (head.optcode == ws::frame_t::opcode_t::CLOSE)){
 				/**
@@ -863,10 +865,10 @@ awh::client::Web::status_t awh::client::Websocket1::prepare(const int32_t sid, c
 						else {
 							// Если тредпул активирован
 							if(this->_thr.initialized())
-								// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-								this->_thr.push(std::bind(&ws1_t::extraction, this, payload, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT)));
+								// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения извлекаются по порядку
+								this->_thr.serial(0, &ws1_t::extraction, this, vector <char> (payload.begin(), payload.end()), (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 							// Если тредпул не активирован, выполняем извлечение полученных сообщений
-							else this->extraction(payload, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
+							else this->extraction(vector <char> (payload.begin(), payload.end()), (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 						}
 					} break;
 					// Если ответом является CONTINUATION
@@ -879,8 +881,8 @@ awh::client::Web::status_t awh::client::Websocket1::prepare(const int32_t sid, c
 							if(head.fin){
 								// Если тредпул активирован
 								if(this->_thr.initialized())
-									// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-									this->_thr.push(std::bind(&ws1_t::extraction, this, this->_fragments, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT)));
+									// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения извлекаются по порядку
+									this->_thr.serial(0, &ws1_t::extraction, this, std::move(this->_fragments), (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 								// Если тредпул не активирован, выполняем извлечение полученных сообщений
 								else this->extraction(this->_fragments, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 								// Очищаем список фрагментированных сообщений
@@ -1678,7 +1680,7 @@ void awh::client::Websocket1::encryption(const string & pass, const string & sal
 awh::client::Websocket1::Websocket1(const fmk_t * fmk, const log_t * log) noexcept :
  web_t(fmk, log), _sid(-1), _rid(0), _verb(true), _close(false),
  _shake(false), _freeze(false), _crypted(false), _inflate(false),
- _waitPong(_pingInterval * 2), _respPong(0), _http(fmk, log), _hash(log), _frame(fmk, log),
+ _waitPong(_pingInterval * 2), _respPong(0), _thr(log), _http(fmk, log), _hash(log), _frame(fmk, log),
  _cipher(hash_t::cipher_t::AES128), _callback(log), _compressor(awh::http_t::compressor_t::NONE) {
 	// Устанавливаем функцию обработки вызова для вывода полученного заголовка с сервера
 	this->_http.on <void (const uint64_t, const string &, const string &)> ("header", &ws1_t::header, this, _1, _2, _3);
@@ -1701,7 +1703,7 @@ awh::client::Websocket1::Websocket1(const fmk_t * fmk, const log_t * log) noexce
 awh::client::Websocket1::Websocket1(const client::core_t * core, const fmk_t * fmk, const log_t * log) noexcept :
  web_t(core, fmk, log), _sid(-1), _rid(0), _verb(true), _close(false),
  _shake(false), _freeze(false), _crypted(false), _inflate(false),
- _waitPong(_pingInterval * 2), _respPong(0), _http(fmk, log), _hash(log), _frame(fmk, log),
+ _waitPong(_pingInterval * 2), _respPong(0), _thr(log), _http(fmk, log), _hash(log), _frame(fmk, log),
  _callback(log), _cipher(hash_t::cipher_t::AES128), _compressor(awh::http_t::compressor_t::NONE) {
 	// Устанавливаем функцию обработки вызова для вывода полученного заголовка с сервера
 	this->_http.on <void (const uint64_t, const string &, const string &)> ("header", &ws1_t::header, this, _1, _2, _3);
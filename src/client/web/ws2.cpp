@@ -1138,8 +1138,10 @@ awh::client::Web::status_t awh::client::Websocket2::prepare(const int32_t sid, c
 		 * Выполняем обработку полученных данных
 		 */
 		while(!this->_close && this->_allow.receive && !this->_buffer.empty()){
-			// Выполняем чтение фрейма Websocket
-			const auto & payload = this->_frame.methods.get(head, reinterpret_cast <const char *> (this->_buffer.get()), this->_buffer.size());
+			// Выполняем чтение фрейма Websocket, полезная нагрузка размаскируется прямо в буфере
+			const char * data = this->_frame.methods.decode(head, this->_buffer.get(), this->_buffer.size());
+			// Получаем полезную нагрузку фрейма без копирования
+			const string_view payload(data, (data != nullptr ? static_cast <size_t> (head.payload) : 0));
 			// Если буфер данных получен
 			if(!payload.empty() || (head.optcode == ws::frame_t::opcode_t::PING) || (head.optcode == ws::frame_t::opcode_t::PONG) || (head.optcode == ws::frame_t::opcode_t::CLOSE)){
 				/**
@@ -1216,10 +1218,10 @@ awh::client::Web::status_t awh::client::Websocket2::prepare(const int32_t sid, c
 						else {
 							// Если тредпул активирован
 							if(this->_thr.initialized())
-								// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-								this->_thr.push(std::bind(&ws2_t::extraction, this, payload, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT)));
+								// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения извлекаются по порядку
+								this->_thr.serial(0, &ws2_t::extraction, this, vector <char> (payload.begin(), payload.end()), (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 							// Если тредпул не активирован, выполняем извлечение полученных сообщений
-							else this->extraction(payload, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
+							else this->extraction(vector <char> (payload.begin(), payload.end()), (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 						}
 					} break;
 					// Если ответом является CONTINUATION
@@ -1232,8 +1234,8 @@ awh::client::Web::status_t awh::client::Websocket2::prepare(const int32_t sid, c
 							if(head.fin){
 								// Если тредпул активирован
 								if(this->_thr.initialized())
-									// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-									this->_thr.push(std::bind(&ws2_t::extraction, this, this->_fragments, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT)));
+									// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения извлекаются по порядку
+									this->_thr.serial(0, &ws2_t::extraction, this, std::move(this->_fragments), (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 								// Если тредпул не активирован, выполняем извлечение полученных сообщений
 								else this->extraction(this->_fragments, (this->_frame.opcode == ws::frame_t::opcode_t::TEXT));
 								// Очищаем список фрагментированных сообщений
@@ -2123,7 +2125,7 @@ awh::client::Websocket2::Websocket2(const fmk_t * fmk, const log_t * log) noexce
  web2_t(fmk, log), _sid(-1), _rid(0), _verb(true), _close(false),
  _shake(false), _freeze(false), _crypted(false), _inflate(false),
  _threads(0), _waitPong(_pingInterval * 2), _respPong(0), _ws1(fmk, log),
- _http(fmk, log), _hash(log), _frame(fmk, log), _callback(log),
+ _thr(log), _http(fmk, log), _hash(log), _frame(fmk, log), _callback(log),
  _cipher(hash_t::cipher_t::AES128), _proto(engine_t::proto_t::HTTP1_1),
  _compressor(awh::http_t::compressor_t::NONE) {
 	// Если размер фрейма не установлен
@@ -2146,7 +2148,7 @@ awh::client::Websocket2::Websocket2(const client::core_t * core, const fmk_t * f
  web2_t(core, fmk, log), _sid(-1), _rid(0), _verb(true), _close(false),
  _shake(false), _freeze(false), _crypted(false), _inflate(false),
  _threads(0), _waitPong(_pingInterval * 2), _respPong(0), _ws1(fmk, log),
- _http(fmk, log), _hash(log), _frame(fmk, log), _callback(log),
+ _thr(log), _http(fmk, log), _hash(log), _frame(fmk, log), _callback(log),
  _cipher(hash_t::cipher_t::AES128), _proto(engine_t::proto_t::HTTP1_1),
  _compressor(awh::http_t::compressor_t::NONE) {
 	// Если размер фрейма не установлен
@@ -84,7 +84,9 @@ using namespace placeholders;
 							}
 						} break;
 						// Если мы передаём данные через Shared memory
-						case static_cast <uint8_t> (transfer_t::PIPE): {
+						case static_cast <uint8_t> (transfer_t::PIPE):
+						// Если мы передаём данные через разделяемую память
+						case static_cast <uint8_t> (transfer_t::SHM): {
 							// Выполняем поиск текущего брокера
 							auto i = const_cast <cluster_t *> (this->_ctx)->_brokers.find(this->_wid);
 							// Если текущий брокер найден
@@ -135,6 +137,13 @@ using namespace placeholders;
 				} break;
 				// Если выполняется событие чтения данных с сокета
 				case static_cast <uint8_t> (base_t::event_type_t::READ): {
+					// Если мы передаём данные через разделяемую память
+					if(this->_ctx->_transfer == transfer_t::SHM){
+						// Выполняем извлечение сообщений из кольцевого буфера
+						const_cast <cluster_t *> (this->_ctx)->receive(this->_wid, sock);
+						// Выходим из функции
+						return;
+					}
 					// Если буфер данных её не инициализирован
 					if(this->_buffer.size == 0){
 						// Извлекаем размер сформированного буфера
@@ -242,6 +251,11 @@ using namespace placeholders;
 												else this->_ctx->_callback.call <void (const uint16_t, const pid_t, const char *, const size_t)> ("message", this->_wid, i->second->pid(), nullptr, 0);
 											}
 										} break;
+										// Если сообщение содержит сведения о нагрузке дочернего процесса
+										case static_cast <uint8_t> (message_t::LOAD):
+											// Выполняем учёт сведений о нагрузке
+											const_cast <cluster_t *> (this->_ctx)->report(i->second->pid(), message.buffer, message.size);
+										break;
 									}
 									// Выполняем удаление указанной записи
 									i->second->pop();
@@ -290,7 +304,9 @@ using namespace placeholders;
 							}
 						} break;
 						// Если мы передаём данные через Shared memory
-						case static_cast <uint8_t> (transfer_t::PIPE): {
+						case static_cast <uint8_t> (transfer_t::PIPE):
+						// Если мы передаём данные через разделяемую память
+						case static_cast <uint8_t> (transfer_t::SHM): {
 							// Выполняем поиск текущего брокера
 							auto i = this->_ctx->_brokers.find(this->_wid);
 							// Если текущий брокер найден
@@ -351,6 +367,13 @@ using namespace placeholders;
 							// Выходим из функции
 							return;
 						}
+						// Если мы передаём данные через разделяемую память
+						if(this->_ctx->_transfer == transfer_t::SHM){
+							// Выполняем извлечение сообщений из кольцевого буфера
+							const_cast <cluster_t *> (this->_ctx)->receive(this->_wid, sock);
+							// Выходим из функции
+							return;
+						}
 						// Если буфер данных её не инициализирован
 						if(this->_buffer.size == 0){
 							// Извлекаем размер сформированного буфера
@@ -547,6 +570,12 @@ using namespace placeholders;
 					// Выполняем закрытие файловых дескрипторов
 					this->close(item.first, broker->mfds[0]);
 					this->close(item.first, broker->cfds[1]);
+					// Выполняем освобождение кольцевого буфера разделяемой памяти
+					broker->ring.destroy();
+					// Выполняем закрытие канала передачи подключений
+					this->release(broker.get());
+					// Удаляем сведения о нагрузке процесса
+					this->_loads.erase(pid);
 					// Выводим сообщение об ошибке, о невозможности отправкить сообщение
 					this->_log->print("Child process stopped, PID=%d, STATUS=%d", log_t::flag_t::WARNING, broker->pid, status);
 					// Если статус сигнала, ручной остановкой процесса
@@ -954,6 +983,331 @@ void awh::Cluster::sending(const uint16_t wid, const pid_t pid, const SOCKET soc
 		}
 	#endif
 }
+/**
+ * Для операционной системы не являющейся MS Windows
+ */
+#if !_WIN32 && !_WIN64
+	/**
+	 * @brief Метод пробуждения соседнего процесса
+	 *
+	 * @param sock сетевой сокет соседнего процесса
+	 */
+	void awh::Cluster::doorbell(const SOCKET sock) const noexcept {
+		// Байт пробуждения соседнего процесса
+		const uint8_t signal = 0x01;
+		/**
+		 * Если поддерживается флаг подавления сигнала SIGPIPE
+		 */
+		#if defined(MSG_NOSIGNAL)
+			// Выполняем отправку байта пробуждения (если буфер сокета заполнен, соседний процесс и так будет разбужен)
+			::send(sock, &signal, sizeof(signal), MSG_NOSIGNAL);
+		/**
+		 * Если флаг подавления сигнала не поддерживается (сигнал отключён опцией SO_NOSIGPIPE сокета)
+		 */
+		#else
+			// Выполняем отправку байта пробуждения (если буфер сокета заполнен, соседний процесс и так будет разбужен)
+			::send(sock, &signal, sizeof(signal), 0);
+		#endif
+	}
+	/**
+	 * @brief Метод записи сообщения в кольцевой буфер разделяемой памяти
+	 *
+	 * @param broker брокер через которого передаётся сообщение
+	 * @param buffer бинарный буфер для отправки сообщения
+	 * @param size   размер бинарного буфера для отправки сообщения
+	 * @param mid    идентификатор типа сообщения
+	 */
+	void awh::Cluster::enqueue(broker_t * broker, const char * buffer, const size_t size, const message_t mid) noexcept {
+		// Если кольцевой буфер процесса уже освобождён
+		if(!broker->ring.created())
+			// Выходим из функции
+			return;
+		// Определяем является ли процесс родительским
+		const bool master = (this->_pid == static_cast <pid_t> (::getpid()));
+		/**
+		 * Определяем результат записи сообщения
+		 */
+		switch(static_cast <uint8_t> (broker->ring.push(static_cast <uint8_t> (mid), buffer, size))){
+			// Если необходимо разбудить соседний процесс
+			case static_cast <uint8_t> (cmp::ring_t::status_t::WAKE):
+				// Выполняем пробуждение соседнего процесса
+				this->doorbell(master ? broker->cfds[1] : broker->mfds[1]);
+			break;
+			// Если сообщение отброшено
+			case static_cast <uint8_t> (cmp::ring_t::status_t::DROP):
+				// Выводим сообщение в лог
+				this->_log->print("Cluster [%s] ring buffer of process [%u] is full, message dropped", log_t::flag_t::WARNING, this->_name.c_str(), broker->pid);
+			break;
+		}
+	}
+	/**
+	 * @brief Метод извлечения сообщений из кольцевого буфера разделяемой памяти
+	 *
+	 * @param wid  идентификатор воркера
+	 * @param sock сетевой сокет пробуждения
+	 */
+	void awh::Cluster::receive(const uint16_t wid, const SOCKET sock) noexcept {
+		// Выполняем поиск брокеров
+		auto i = this->_brokers.find(wid);
+		// Если брокер найден
+		if(i != this->_brokers.end()){
+			// Объект текущего брокера
+			broker_t * broker = nullptr;
+			// Определяем является ли процесс родительским
+			const bool master = (this->_pid == static_cast <pid_t> (::getpid()));
+			// Если процесс является родительским
+			if(master){
+				// Переходим по всему списку брокеров
+				for(auto & item : i->second){
+					// Если сетевой сокет соответствует
+					if(item->mfds[0] == sock){
+						// Получаем объект брокера
+						broker = item.get();
+						// Выходим из цикла
+						break;
+					}
+				}
+			// Если процесс является дочерним
+			} else {
+				// Выполняем поиск идентификатор процесса
+				auto j = this->_pids.find(::getpid());
+				// Если идентификатор процесса найден
+				if(j != this->_pids.end())
+					// Получаем объект брокера
+					broker = i->second.at(j->second).get();
+			}
+			// Если брокер не найден
+			if(broker == nullptr)
+				// Выходим из функции
+				return;
+			// Буфер для вычитывания байтов пробуждения
+			uint8_t buffer[256];
+			/**
+			 * Вычитываем все байты пробуждения, сами данные находятся в разделяемой памяти
+			 */
+			while(::recv(sock, buffer, sizeof(buffer), 0) > 0);
+			// Получаем идентификатор процесса отправителя
+			const pid_t pid = (master ? broker->pid : this->_pid);
+			// Получаем сокет пробуждения соседнего процесса
+			const SOCKET peer = (master ? broker->cfds[1] : broker->mfds[1]);
+			// Выполняем извлечение всех сообщений из кольцевого буфера
+			const cmp::ring_t::status_t status = broker->ring.pop([&](const uint8_t mid, const char * data, const size_t size) noexcept -> void {
+				/**
+				 * Определяем тип входящего сообщения
+				 */
+				switch(mid){
+					// Если сообщение соответствует рукопожатию
+					case static_cast <uint8_t> (message_t::HELLO): {
+						// Если процесс является родительским
+						if(master){
+							// Если функция обратного вызова установлена
+							if(this->_callback.is("ready"))
+								// Выполняем функцию обратного вызова
+								this->_callback.call <void (const uint16_t, const pid_t)> ("ready", wid, pid);
+						// Выводим сообщение в лог
+						} else this->_log->print("[%u] Master sends us his regards :=)", log_t::flag_t::WARNING, ::getpid());
+					} break;
+					// Если сообщение соответствует общему формату данных
+					case static_cast <uint8_t> (message_t::GENERAL): {
+						// Если функция обратного вызова установлена
+						if(this->_callback.is("message")){
+							// Если буфер данных получен
+							if((data != nullptr) && (size > 0))
+								// Выполняем функцию обратного вызова
+								this->_callback.call <void (const uint16_t, const pid_t, const char *, const size_t)> ("message", wid, pid, data, size);
+							// Выводим значение по умолчанию
+							else this->_callback.call <void (const uint16_t, const pid_t, const char *, const size_t)> ("message", wid, pid, nullptr, 0);
+						}
+					} break;
+					// Если сообщение содержит сведения о нагрузке дочернего процесса
+					case static_cast <uint8_t> (message_t::LOAD): {
+						// Если процесс является родительским
+						if(master)
+							// Выполняем учёт сведений о нагрузке
+							this->report(pid, data, size);
+					} break;
+				}
+			});
+			// Если соседний процесс ожидает освобождения места
+			if(status == cmp::ring_t::status_t::WAKE)
+				// Выполняем пробуждение соседнего процесса
+				this->doorbell(peer);
+			// Выполняем дозапись отложенных сообщений
+			if(broker->ring.flush() == cmp::ring_t::status_t::WAKE)
+				// Выполняем пробуждение соседнего процесса
+				this->doorbell(peer);
+		}
+	}
+	/**
+	 * @brief Метод создания канала передачи подключений (вызывается до создания дочернего процесса)
+	 *
+	 * @param broker брокер для которого создаётся канал
+	 * @return       результат выполнения операции
+	 */
+	bool awh::Cluster::pair(broker_t * broker) noexcept {
+		// Если подключения не распределяются родительским процессом
+		if(this->_distribution != distribution_t::MASTER)
+			// Канал передачи подключений не требуется
+			return true;
+		// Создаём пару датаграммных сокетов, каждая запись переносит ровно один файловый дескриптор
+		return (::socketpair(AF_UNIX, SOCK_DGRAM, 0, broker->hfds) == 0);
+	}
+	/**
+	 * @brief Метод закрытия канала передачи подключений
+	 *
+	 * @param broker брокер канал которого необходимо закрыть
+	 */
+	void awh::Cluster::release(broker_t * broker) noexcept {
+		// Выполняем остановку получения переданных подключений
+		broker->handoff.stop();
+		/**
+		 * Переходим по всем файловым дескрипторам канала
+		 */
+		for(auto & fd : broker->hfds){
+			// Если файловый дескриптор открыт
+			if(fd != INVALID_SOCKET){
+				// Закрываем файловый дескриптор
+				::close(fd);
+				// Помечаем файловый дескриптор закрытым, чтобы номер не был закрыт повторно в дочерних процессах
+				fd = INVALID_SOCKET;
+			}
+		}
+	}
+	/**
+	 * @brief Метод привязки канала передачи подключений к текущему процессу (вызывается после создания дочернего процесса)
+	 *
+	 * @param wid    идентификатор воркера
+	 * @param broker брокер созданного дочернего процесса
+	 */
+	void awh::Cluster::attach(const uint16_t wid, broker_t * broker) noexcept {
+		// Если канал передачи подключений не создан
+		if((broker->hfds[0] == INVALID_SOCKET) || (broker->hfds[1] == INVALID_SOCKET))
+			// Выходим из функции
+			return;
+		// Если процесс является родительским
+		if(this->_pid == static_cast <pid_t> (::getpid())){
+			// Закрываем сторону канала дочернего процесса
+			::close(broker->hfds[1]);
+			// Помечаем файловый дескриптор закрытым
+			broker->hfds[1] = INVALID_SOCKET;
+			// Делаем сокет неблокирующим, переполненный канал не должен останавливать приём подключений
+			this->_server.socket.blocking(broker->hfds[0], socket_t::mode_t::DISABLED);
+			// Отключаем сигнал записи в оборванное подключение
+			this->_server.socket.noSigPIPE(broker->hfds[0]);
+		// Если процесс является дочерним
+		} else {
+			// Переходим по всем воркерам
+			for(auto & item : this->_brokers){
+				// Переходим по всему списку брокеров
+				for(auto & other : item.second){
+					// Если брокер принадлежит другому процессу
+					if(other.get() != broker)
+						// Закрываем унаследованный канал чужого процесса
+						this->release(other.get());
+				}
+			}
+			// Закрываем сторону канала родительского процесса
+			::close(broker->hfds[0]);
+			// Помечаем файловый дескриптор закрытым
+			broker->hfds[0] = INVALID_SOCKET;
+			// Делаем сокет на чтение неблокирующим
+			this->_server.socket.blocking(broker->hfds[1], socket_t::mode_t::DISABLED);
+			// Устанавливаем базу событий для чтения
+			broker->handoff = this->_core->base();
+			// Устанавливаем сокет для чтения
+			broker->handoff = broker->hfds[1];
+			// Устанавливаем событие на получение переданных подключений
+			broker->handoff = std::bind(&cluster_t::descriptor, this, wid, _1, _2);
+			// Запускаем получение переданных подключений
+			broker->handoff.start();
+			// Выполняем активацию работы события чтения данных с сокета
+			broker->handoff.mode(base_t::event_type_t::READ, base_t::event_mode_t::ENABLED);
+			// Выполняем активацию работы события закрытия подключения
+			broker->handoff.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
+		}
+	}
+	/**
+	 * @brief Метод обратного вызова получения переданных подключений
+	 *
+	 * @param wid   идентификатор воркера
+	 * @param sock  сетевой сокет канала передачи подключений
+	 * @param event произошедшее событие
+	 */
+	void awh::Cluster::descriptor(const uint16_t wid, const SOCKET sock, const base_t::event_type_t event) noexcept {
+		/**
+		 * Определяем тип события
+		 */
+		switch(static_cast <uint8_t> (event)){
+			// Если выполняется событие закрытие подключения
+			case static_cast <uint8_t> (base_t::event_type_t::CLOSE): {
+				// Выполняем поиск брокеров
+				auto i = this->_brokers.find(wid);
+				// Выполняем поиск идентификатор процесса
+				auto j = this->_pids.find(::getpid());
+				// Если брокер текущего процесса найден
+				if((i != this->_brokers.end()) && (j != this->_pids.end()) && (j->second < i->second.size()))
+					// Закрываем канал передачи подключений, завершение работы процесса выполнит основной канал
+					this->release(i->second.at(j->second).get());
+			} break;
+			// Если выполняется событие чтения данных с сокета
+			case static_cast <uint8_t> (base_t::event_type_t::READ): {
+				/**
+				 * Вычитываем все записи находящиеся в канале
+				 */
+				for(;;){
+					// Байт полезной нагрузки записи
+					char payload = 0;
+					// Буфер управляющих данных записи
+					union {
+						// Заголовок управляющих данных (для выравнивания буфера)
+						struct cmsghdr header;
+						// Бинарный буфер управляющих данных
+						char data[CMSG_SPACE(sizeof(SOCKET))];
+					} control;
+					// Создаём объект буфера полезной нагрузки
+					struct iovec iov;
+					// Устанавливаем адрес полезной нагрузки
+					iov.iov_base = &payload;
+					// Устанавливаем размер полезной нагрузки
+					iov.iov_len = sizeof(payload);
+					// Создаём объект записи
+					struct msghdr message;
+					// Зануляем объект записи
+					::memset(&message, 0, sizeof(message));
+					// Устанавливаем буфер полезной нагрузки
+					message.msg_iov = &iov;
+					// Устанавливаем количество буферов полезной нагрузки
+					message.msg_iovlen = 1;
+					// Устанавливаем буфер управляющих данных
+					message.msg_control = control.data;
+					// Устанавливаем размер буфера управляющих данных
+					message.msg_controllen = sizeof(control.data);
+					// Если записей в канале больше нет
+					if(::recvmsg(sock, &message, 0) <= 0)
+						// Выходим из цикла
+						break;
+					// Получаем заголовок управляющих данных
+					struct cmsghdr * header = CMSG_FIRSTHDR(&message);
+					// Если управляющие данные содержат файловый дескриптор
+					if((header != nullptr) && (header->cmsg_level == SOL_SOCKET) && (header->cmsg_type == SCM_RIGHTS)){
+						// Файловый дескриптор переданного подключения
+						SOCKET fd = INVALID_SOCKET;
+						// Извлекаем файловый дескриптор
+						::memcpy(&fd, CMSG_DATA(header), sizeof(fd));
+						// Увеличиваем количество полученных подключений
+						this->_received++;
+						// Если функция обратного вызова установлена
+						if(this->_callback.is("handoff"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const uint16_t, const SOCKET)> ("handoff", wid, fd);
+						// Если подключение принять некому, закрываем его
+						else ::close(fd);
+					}
+				}
+			} break;
+		}
+	}
+#endif
 /**
  * @brief Метод размещения нового дочернего процесса
  *
@@ -981,8 +1335,8 @@ void awh::Cluster::emplace(const uint16_t wid, const pid_t pid) noexcept {
 				if(j != this->_brokers.end()){
 					// Создаём объект брокера
 					std::unique_ptr <broker_t> broker(new broker_t(this->_fmk, this->_log));
-					// Если мы передаём данные через Shared memory
-					if(this->_transfer == transfer_t::PIPE){
+					// Если мы передаём данные через пару сокетов или разделяемую память
+					if((this->_transfer == transfer_t::PIPE) || (this->_transfer == transfer_t::SHM)){
 						// Выполняем подписку на основной канал передачи данных
 						if(::socketpair(AF_UNIX, SOCK_STREAM, 0, broker->mfds) != 0){
 							// Выводим в лог сообщение
@@ -1001,6 +1355,24 @@ void awh::Cluster::emplace(const uint16_t wid, const pid_t pid) noexcept {
 							// Выходим принудительно из приложения
 							::exit(EXIT_FAILURE);
 						}
+						// Если мы передаём данные через разделяемую память, создаём кольцевые буферы до создания процесса
+						if((this->_transfer == transfer_t::SHM) && !broker->ring.create(this->_ringSize)){
+							// Выводим в лог сообщение
+							this->_log->print("Cluster [%s] fork child: %s", log_t::flag_t::CRITICAL, this->_name.c_str(), "shared memory ring could not be created");
+							// Выполняем остановку работы
+							this->clear();
+							// Выходим принудительно из приложения
+							::exit(EXIT_FAILURE);
+						}
+					}
+					// Выполняем создание канала передачи подключений
+					if(!this->pair(broker.get())){
+						// Выводим в лог сообщение
+						this->_log->print("Cluster [%s] fork child: %s", log_t::flag_t::CRITICAL, this->_name.c_str(), this->_server.socket.message(AWH_ERROR()).c_str());
+						// Выполняем остановку работы
+						this->clear();
+						// Выходим принудительно из приложения
+						::exit(EXIT_FAILURE);
 					}
 					// Выполняем добавление брокера в список брокеров
 					j->second.push_back(::move(broker));
@@ -1200,7 +1572,66 @@ void awh::Cluster::emplace(const uint16_t wid, const pid_t pid) noexcept {
 										// Выполняем отправку сообщения мастер-процессу
 										this->write(i->first, this->_pid, broker->mfds[1]);
 									} break;
+									// Если мы передаём данные через разделяемую память
+									case static_cast <uint8_t> (transfer_t::SHM): {
+										// Закрываем файловый дескриптор на запись в дочерний процесс
+										this->close(i->first, broker->cfds[1]);
+										// Закрываем файловый дескриптор на чтение из основного процесса
+										this->close(i->first, broker->mfds[0]);
+										// Выполняем перебор всего списка брокеров
+										for(auto & item : j->second){
+											// Если брокер не является текущим брокером
+											if(item.get() != broker){
+												// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+												if((item->cfds[0] != broker->cfds[0]) && (item->cfds[0] != broker->mfds[1]))
+													// Закрываем ненужный нам сокет
+													this->close(i->first, item->cfds[0]);
+												// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+												if((item->cfds[1] != broker->cfds[0]) && (item->cfds[1] != broker->mfds[1]))
+													// Закрываем ненужный нам сокет
+													this->close(i->first, item->cfds[1]);
+												// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+												if((item->mfds[0] != broker->cfds[0]) && (item->mfds[0] != broker->mfds[1]))
+													// Закрываем ненужный нам сокет
+													this->close(i->first, item->mfds[0]);
+												// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+												if((item->mfds[1] != broker->cfds[0]) && (item->mfds[1] != broker->mfds[1]))
+													// Закрываем ненужный нам сокет
+													this->close(i->first, item->mfds[1]);
+												// Освобождаем чужие кольцевые буферы унаследованные от родительского процесса
+												item->ring.destroy();
+											}
+										}
+										// Делаем сокет на чтение неблокирующим (сокет используется только для пробуждения)
+										this->_server.socket.blocking(broker->cfds[0], socket_t::mode_t::DISABLED);
+										// Делаем сокет на запись неблокирующим (сокет используется только для пробуждения)
+										this->_server.socket.blocking(broker->mfds[1], socket_t::mode_t::DISABLED);
+										// Отключаем сигнал SIGPIPE при пробуждении завершившегося соседнего процесса
+										this->_server.socket.noSigPIPE(broker->mfds[1]);
+										// Устанавливаем сторону дочернего процесса для кольцевого буфера
+										broker->ring.master(false);
+										// Устанавливаем политику поведения при переполнении кольцевого буфера
+										broker->ring.overflow(this->_overflow);
+										// Устанавливаем базу событий для чтения
+										broker->read = this->_core->base();
+										// Устанавливаем сокет для чтения
+										broker->read = broker->cfds[0];
+										// Устанавливаем событие на чтение данных от основного процесса
+										broker->read = std::bind(&worker_t::message, i->second.get(), _1, _2);
+										// Запускаем чтение данных с основного процесса
+										broker->read.start();
+										// Выполняем активацию работы события чтения данных с сокета
+										broker->read.mode(base_t::event_type_t::READ, base_t::event_mode_t::ENABLED);
+										// Выполняем активацию работы события закрытия подключения
+										broker->read.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
+										// Выполняем отправку рукопожатия мастер-процессу через кольцевой буфер
+										if(broker->ring.push(static_cast <uint8_t> (message_t::HELLO), reinterpret_cast <const char *> (&pid), sizeof(pid)) == cmp::ring_t::status_t::WAKE)
+											// Выполняем пробуждение мастер-процесса
+											this->doorbell(broker->mfds[1]);
+									} break;
 								}
+								// Выполняем привязку канала передачи подключений
+								this->attach(i->first, broker);
 								// Если функция обратного вызова установлена
 								if(this->_callback.is("events"))
 									// Выполняем функцию обратного вызова
@@ -1282,7 +1713,38 @@ void awh::Cluster::emplace(const uint16_t wid, const pid_t pid) noexcept {
 								// Выполняем активацию работы события закрытия подключения
 								broker->write.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
 							} break;
+							// Если мы передаём данные через разделяемую память
+							case static_cast <uint8_t> (transfer_t::SHM): {
+								// Закрываем файловый дескриптор на запись в основной процесс
+								this->close(i->first, broker->mfds[1]);
+								// Закрываем файловый дескриптор на чтение из дочернего процесса
+								this->close(i->first, broker->cfds[0]);
+								// Делаем сокет на чтение неблокирующим (сокет используется только для пробуждения)
+								this->_server.socket.blocking(broker->mfds[0], socket_t::mode_t::DISABLED);
+								// Делаем сокет на запись неблокирующим (сокет используется только для пробуждения)
+								this->_server.socket.blocking(broker->cfds[1], socket_t::mode_t::DISABLED);
+								// Отключаем сигнал SIGPIPE при пробуждении завершившегося соседнего процесса
+								this->_server.socket.noSigPIPE(broker->cfds[1]);
+								// Устанавливаем сторону родительского процесса для кольцевого буфера
+								broker->ring.master(true);
+								// Устанавливаем политику поведения при переполнении кольцевого буфера
+								broker->ring.overflow(this->_overflow);
+								// Устанавливаем базу событий для чтения
+								broker->read = this->_core->base();
+								// Устанавливаем сокет для чтения
+								broker->read = broker->mfds[0];
+								// Устанавливаем событие на чтение данных от дочернего процесса
+								broker->read = std::bind(&worker_t::message, i->second.get(), _1, _2);
+								// Выполняем запуск работы чтения данных с дочерних процессов
+								broker->read.start();
+								// Выполняем активацию работы чтения данных с дочерних процессов
+								broker->read.mode(base_t::event_type_t::READ, base_t::event_mode_t::ENABLED);
+								// Выполняем активацию работы события закрытия подключения
+								broker->read.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
+							} break;
 						}
+						// Выполняем привязку канала передачи подключений
+						this->attach(i->first, broker);
 						// Если функция обратного вызова установлена
 						if(this->_callback.is("rebase") && (opid > 0))
 							// Выполняем функцию обратного вызова
@@ -1350,8 +1812,8 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 						for(size_t index = 0; index < i->second->_count; index++){
 							// Создаём объект брокера
 							std::unique_ptr <broker_t> broker(new broker_t(this->_fmk, this->_log));
-							// Если мы передаём данные через Shared memory
-							if(this->_transfer == transfer_t::PIPE){
+							// Если мы передаём данные через пару сокетов или разделяемую память
+							if((this->_transfer == transfer_t::PIPE) || (this->_transfer == transfer_t::SHM)){
 								// Выполняем подписку на основной канал передачи данных
 								if(::socketpair(AF_UNIX, SOCK_STREAM, 0, broker->mfds) != 0){
 									// Выводим в лог сообщение
@@ -1370,6 +1832,24 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 									// Выходим принудительно из приложения
 									::exit(EXIT_FAILURE);
 								}
+								// Если мы передаём данные через разделяемую память, создаём кольцевые буферы до создания процесса
+								if((this->_transfer == transfer_t::SHM) && !broker->ring.create(this->_ringSize)){
+									// Выводим в лог сообщение
+									this->_log->print("Cluster [%s] fork child: %s", log_t::flag_t::CRITICAL, this->_name.c_str(), "shared memory ring could not be created");
+									// Выполняем остановку работы
+									this->clear();
+									// Выходим принудительно из приложения
+									::exit(EXIT_FAILURE);
+								}
+							}
+							// Выполняем создание канала передачи подключений
+							if(!this->pair(broker.get())){
+								// Выводим в лог сообщение
+								this->_log->print("Cluster [%s] fork child: %s", log_t::flag_t::CRITICAL, this->_name.c_str(), this->_server.socket.message(AWH_ERROR()).c_str());
+								// Выполняем остановку работы
+								this->clear();
+								// Выходим принудительно из приложения
+								::exit(EXIT_FAILURE);
 							}
 							// Выполняем добавление брокера в список брокеров
 							j->second.push_back(::move(broker));
@@ -1379,8 +1859,8 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 					if(j->second.at(index)->stop){
 						// Создаём объект брокера
 						std::unique_ptr <broker_t> broker(new broker_t(this->_fmk, this->_log));
-						// Если мы передаём данные через Shared memory
-						if(this->_transfer == transfer_t::PIPE){
+						// Если мы передаём данные через пару сокетов или разделяемую память
+						if((this->_transfer == transfer_t::PIPE) || (this->_transfer == transfer_t::SHM)){
 							// Выполняем подписку на основной канал передачи данных
 							if(::socketpair(AF_UNIX, SOCK_STREAM, 0, broker->mfds) != 0){
 								// Выводим в лог сообщение
@@ -1413,6 +1893,38 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 								// Выходим принудительно из приложения
 								::exit(EXIT_FAILURE);
 							}
+							// Если мы передаём данные через разделяемую память, создаём кольцевые буферы до создания процесса
+							if((this->_transfer == transfer_t::SHM) && !broker->ring.create(this->_ringSize)){
+								// Выводим в лог сообщение
+								this->_log->print("Cluster [%s] fork: %s", log_t::flag_t::CRITICAL, this->_name.c_str(), "shared memory ring could not be created");
+								// Выполняем поиск завершившегося процесса
+								for(auto & broker : j->second){
+									// Выполняем остановку чтение сообщений
+									broker->read.stop();
+									// Выполняем остановку записи сообщений
+									broker->write.stop();
+								}
+								// Выполняем остановку работы
+								this->clear();
+								// Выходим принудительно из приложения
+								::exit(EXIT_FAILURE);
+							}
+						}
+						// Выполняем создание канала передачи подключений
+						if(!this->pair(broker.get())){
+							// Выводим в лог сообщение
+							this->_log->print("Cluster [%s] fork: %s", log_t::flag_t::CRITICAL, this->_name.c_str(), this->_server.socket.message(AWH_ERROR()).c_str());
+							// Выполняем поиск завершившегося процесса
+							for(auto & broker : j->second){
+								// Выполняем остановку чтение сообщений
+								broker->read.stop();
+								// Выполняем остановку записи сообщений
+								broker->write.stop();
+							}
+							// Выполняем остановку работы
+							this->clear();
+							// Выходим принудительно из приложения
+							::exit(EXIT_FAILURE);
 						}
 						// Устанавливаем нового брокера
 						j->second.at(index) = ::move(broker);
@@ -1605,7 +2117,66 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 											// Выполняем отправку сообщения мастер-процессу
 											this->write(i->first, this->_pid, broker->mfds[1]);
 										} break;
+										// Если мы передаём данные через разделяемую память
+										case static_cast <uint8_t> (transfer_t::SHM): {
+											// Закрываем файловый дескриптор на запись в дочерний процесс
+											this->close(i->first, broker->cfds[1]);
+											// Закрываем файловый дескриптор на чтение из основного процесса
+											this->close(i->first, broker->mfds[0]);
+											// Выполняем перебор всего списка брокеров
+											for(auto & item : j->second){
+												// Если брокер не является текущим брокером
+												if(item.get() != broker){
+													// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+													if((item->cfds[0] != broker->cfds[0]) && (item->cfds[0] != broker->mfds[1]))
+														// Закрываем ненужный нам сокет
+														this->close(i->first, item->cfds[0]);
+													// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+													if((item->cfds[1] != broker->cfds[0]) && (item->cfds[1] != broker->mfds[1]))
+														// Закрываем ненужный нам сокет
+														this->close(i->first, item->cfds[1]);
+													// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+													if((item->mfds[0] != broker->cfds[0]) && (item->mfds[0] != broker->mfds[1]))
+														// Закрываем ненужный нам сокет
+														this->close(i->first, item->mfds[0]);
+													// Если мы нашли брокера который не совпадает с нашими файловыми дескрипторами
+													if((item->mfds[1] != broker->cfds[0]) && (item->mfds[1] != broker->mfds[1]))
+														// Закрываем ненужный нам сокет
+														this->close(i->first, item->mfds[1]);
+													// Освобождаем чужие кольцевые буферы унаследованные от родительского процесса
+													item->ring.destroy();
+												}
+											}
+											// Делаем сокет на чтение неблокирующим (сокет используется только для пробуждения)
+											this->_server.socket.blocking(broker->cfds[0], socket_t::mode_t::DISABLED);
+											// Делаем сокет на запись неблокирующим (сокет используется только для пробуждения)
+											this->_server.socket.blocking(broker->mfds[1], socket_t::mode_t::DISABLED);
+											// Отключаем сигнал SIGPIPE при пробуждении завершившегося соседнего процесса
+											this->_server.socket.noSigPIPE(broker->mfds[1]);
+											// Устанавливаем сторону дочернего процесса для кольцевого буфера
+											broker->ring.master(false);
+											// Устанавливаем политику поведения при переполнении кольцевого буфера
+											broker->ring.overflow(this->_overflow);
+											// Устанавливаем базу событий для чтения
+											broker->read = this->_core->base();
+											// Устанавливаем сокет для чтения
+											broker->read = broker->cfds[0];
+											// Устанавливаем событие на чтение данных от основного процесса
+											broker->read = std::bind(&worker_t::message, i->second.get(), _1, _2);
+											// Запускаем чтение данных с основного процесса
+											broker->read.start();
+											// Выполняем активацию работы события чтения данных с сокета
+											broker->read.mode(base_t::event_type_t::READ, base_t::event_mode_t::ENABLED);
+											// Выполняем активацию работы события закрытия подключения
+											broker->read.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
+											// Выполняем отправку рукопожатия мастер-процессу через кольцевой буфер
+											if(broker->ring.push(static_cast <uint8_t> (message_t::HELLO), reinterpret_cast <const char *> (&pid), sizeof(pid)) == cmp::ring_t::status_t::WAKE)
+												// Выполняем пробуждение мастер-процесса
+												this->doorbell(broker->mfds[1]);
+										} break;
 									}
+									// Выполняем привязку канала передачи подключений
+									this->attach(i->first, broker);
 									// Если функция обратного вызова установлена
 									if(this->_callback.is("events"))
 										// Выполняем функцию обратного вызова
@@ -1662,7 +2233,34 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 									// Выполняем запуск работы записи данных дочернему процессу
 									broker->write.start();
 								} break;
+								// Если мы передаём данные через разделяемую память
+								case static_cast <uint8_t> (transfer_t::SHM): {
+									// Закрываем файловый дескриптор на запись в основной процесс
+									this->close(i->first, broker->mfds[1]);
+									// Закрываем файловый дескриптор на чтение из дочернего процесса
+									this->close(i->first, broker->cfds[0]);
+									// Делаем сокет на чтение неблокирующим (сокет используется только для пробуждения)
+									this->_server.socket.blocking(broker->mfds[0], socket_t::mode_t::DISABLED);
+									// Делаем сокет на запись неблокирующим (сокет используется только для пробуждения)
+									this->_server.socket.blocking(broker->cfds[1], socket_t::mode_t::DISABLED);
+									// Отключаем сигнал SIGPIPE при пробуждении завершившегося соседнего процесса
+									this->_server.socket.noSigPIPE(broker->cfds[1]);
+									// Устанавливаем сторону родительского процесса для кольцевого буфера
+									broker->ring.master(true);
+									// Устанавливаем политику поведения при переполнении кольцевого буфера
+									broker->ring.overflow(this->_overflow);
+									// Устанавливаем базу событий для чтения
+									broker->read = this->_core->base();
+									// Устанавливаем сокет для чтения
+									broker->read = broker->mfds[0];
+									// Устанавливаем событие на чтение данных от дочернего процесса
+									broker->read = std::bind(&worker_t::message, i->second.get(), _1, _2);
+									// Выполняем запуск работы чтения данных с дочерних процессов
+									broker->read.start();
+								} break;
 							}
+							// Выполняем привязку канала передачи подключений
+							this->attach(i->first, broker);
 							// Выполняем создание новых процессов
 							this->create(i->first, index + 1);
 						}
@@ -1726,9 +2324,19 @@ void awh::Cluster::create(const uint16_t wid, const uint16_t index) noexcept {
 									broker->write.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
 								}
 							} break;
+							// Если мы передаём данные через разделяемую память
+							case static_cast <uint8_t> (transfer_t::SHM): {
+								// Выполняем перебор всех доступных брокеров
+								for(auto & broker : j->second){
+									// Выполняем активацию работы чтения данных с дочерних процессов
+									broker->read.mode(base_t::event_type_t::READ, base_t::event_mode_t::ENABLED);
+									// Выполняем активацию работы события закрытия подключения
+									broker->read.mode(base_t::event_type_t::CLOSE, base_t::event_mode_t::ENABLED);
+								}
+							} break;
 						}
-						// Если мы передаём данные через PIPE
-						if(this->_transfer == transfer_t::PIPE)
+						// Если мы передаём данные через PIPE или разделяемую память
+						if((this->_transfer == transfer_t::PIPE) || (this->_transfer == transfer_t::SHM))
 							// Выводим информацию о запущенном сервере на PIPE
 							this->_log->print("Cluster [%s] has been started successfully", log_t::flag_t::INFO, this->_name.c_str());
 						// Если функция обратного вызова установлена
@@ -1811,6 +2419,271 @@ std::set <pid_t> awh::Cluster::pids(const uint16_t wid) const noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод получения количества активных подключений каждого дочернего процесса
+ *
+ * @param wid идентификатор воркера
+ * @return    список количества подключений по идентификаторам процессов
+ */
+std::map <pid_t, size_t> awh::Cluster::connections(const uint16_t wid) const noexcept {
+	// Результат работы функции
+	std::map <pid_t, size_t> result;
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Выполняем поиск брокеров
+		auto i = this->_brokers.find(wid);
+		// Если брокер найден и процесс является родительским
+		if((i != this->_brokers.end()) && (this->_pid == static_cast <pid_t> (::getpid()))){
+			// Переходим по всему списку брокеров
+			for(auto & broker : i->second){
+				// Если процесс завершил работу или ещё не создан
+				if(broker->stop || (broker->pid == this->_pid))
+					// Пропускаем процесс
+					continue;
+				// Выполняем поиск сведений о нагрузке процесса
+				auto j = this->_loads.find(broker->pid);
+				// Если сведения о нагрузке найдены
+				if(j != this->_loads.end())
+					// Добавляем отчитанные процессом подключения и подключения ещё находящиеся в канале передачи
+					result.emplace(broker->pid, static_cast <size_t> (j->second.connections) + static_cast <uint32_t> (j->second.sent - j->second.received));
+				// Если процесс ещё не отчитывался о нагрузке
+				else result.emplace(broker->pid, 0);
+			}
+		}
+	#endif
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения наименее загруженного дочернего процесса
+ *
+ * @param wid идентификатор воркера
+ * @return    идентификатор процесса (0 если процесс не найден)
+ */
+pid_t awh::Cluster::least(const uint16_t wid) const noexcept {
+	// Результат работы функции
+	pid_t result = 0;
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Выполняем поиск брокеров
+		auto i = this->_brokers.find(wid);
+		// Если брокер найден и процесс является родительским
+		if((i != this->_brokers.end()) && (this->_pid == static_cast <pid_t> (::getpid()))){
+			// Вес выбранного процесса (перегрузка, количество подключений, задержка цикла событий)
+			std::tuple <bool, size_t, uint32_t> weight(true, SIZE_MAX, UINT32_MAX);
+			// Переходим по всему списку брокеров
+			for(auto & broker : i->second){
+				// Если процесс завершил работу или ещё не создан
+				if(broker->stop || (broker->pid == this->_pid))
+					// Пропускаем процесс
+					continue;
+				// Сведения о нагрузке процесса
+				load_t load;
+				// Выполняем поиск сведений о нагрузке процесса
+				auto j = this->_loads.find(broker->pid);
+				// Если сведения о нагрузке найдены
+				if(j != this->_loads.end())
+					// Получаем сведения о нагрузке
+					load = j->second;
+				// Получаем вес текущего процесса, перегруженный процесс выбирается только если перегружены все
+				const std::tuple <bool, size_t, uint32_t> current(
+					(load.lag > AWH_CLUSTER_LAG_LIMIT),
+					static_cast <size_t> (load.connections) + static_cast <uint32_t> (load.sent - load.received),
+					load.lag
+				);
+				// Если процесс ещё не выбран или текущий процесс загружен меньше
+				if((result == 0) || (current < weight)){
+					// Запоминаем вес процесса
+					weight = current;
+					// Запоминаем идентификатор процесса
+					result = broker->pid;
+				}
+			}
+		}
+	#endif
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод передачи принятого подключения дочернему процессу
+ *
+ * @param wid идентификатор воркера
+ * @param pid идентификатор процесса получателя подключения
+ * @param fd  файловый дескриптор принятого подключения (при успешной передаче закрывается)
+ * @return    результат выполнения операции
+ */
+bool awh::Cluster::handoff(const uint16_t wid, const pid_t pid, const SOCKET fd) noexcept {
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Если процесс является родительским и подключение передано
+		if((this->_pid == static_cast <pid_t> (::getpid())) && (fd != INVALID_SOCKET)){
+			// Выполняем поиск брокеров
+			auto i = this->_brokers.find(wid);
+			// Выполняем поиск идентификатор процесса
+			auto j = this->_pids.find(pid);
+			// Если брокер процесса найден
+			if((i != this->_brokers.end()) && (j != this->_pids.end()) && (j->second < i->second.size())){
+				// Получаем объект брокера
+				broker_t * broker = i->second.at(j->second).get();
+				// Если канал передачи подключений процесса открыт
+				if(!broker->stop && (broker->hfds[0] != INVALID_SOCKET)){
+					// Байт полезной нагрузки записи
+					char payload = 0;
+					// Буфер управляющих данных записи
+					union {
+						// Заголовок управляющих данных (для выравнивания буфера)
+						struct cmsghdr header;
+						// Бинарный буфер управляющих данных
+						char data[CMSG_SPACE(sizeof(SOCKET))];
+					} control;
+					// Зануляем буфер управляющих данных
+					::memset(&control, 0, sizeof(control));
+					// Создаём объект буфера полезной нагрузки
+					struct iovec iov;
+					// Устанавливаем адрес полезной нагрузки
+					iov.iov_base = &payload;
+					// Устанавливаем размер полезной нагрузки
+					iov.iov_len = sizeof(payload);
+					// Создаём объект записи
+					struct msghdr message;
+					// Зануляем объект записи
+					::memset(&message, 0, sizeof(message));
+					// Устанавливаем буфер полезной нагрузки
+					message.msg_iov = &iov;
+					// Устанавливаем количество буферов полезной нагрузки
+					message.msg_iovlen = 1;
+					// Устанавливаем буфер управляющих данных
+					message.msg_control = control.data;
+					// Устанавливаем размер буфера управляющих данных
+					message.msg_controllen = sizeof(control.data);
+					// Получаем заголовок управляющих данных
+					struct cmsghdr * header = CMSG_FIRSTHDR(&message);
+					// Устанавливаем уровень управляющих данных
+					header->cmsg_level = SOL_SOCKET;
+					// Устанавливаем тип управляющих данных (передача прав на файловый дескриптор)
+					header->cmsg_type = SCM_RIGHTS;
+					// Устанавливаем размер управляющих данных
+					header->cmsg_len = CMSG_LEN(sizeof(fd));
+					// Копируем файловый дескриптор подключения
+					::memcpy(CMSG_DATA(header), &fd, sizeof(fd));
+					// Если запись отправлена дочернему процессу
+					if(::sendmsg(broker->hfds[0], &message, 0) > 0){
+						// Закрываем копию подключения в родительском процессе
+						::close(fd);
+						/**
+						 * Выполняем отлов ошибок
+						 */
+						try {
+							// Увеличиваем количество переданных процессу подключений
+							this->_loads[pid].sent++;
+						/**
+						 * Если возникает ошибка
+						 */
+						} catch(const bad_alloc &) {
+							/**
+							 * Если включён режим отладки
+							 */
+							#if DEBUG_MODE
+								// Выводим сообщение об ошибке
+								this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(wid, pid, fd), log_t::flag_t::CRITICAL, "Memory allocation error");
+							/**
+							* Если режим отладки не включён
+							*/
+							#else
+								// Выводим сообщение об ошибке
+								this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+							#endif
+							// Выходим из приложения
+							::exit(EXIT_FAILURE);
+						}
+						// Выводим результат
+						return true;
+					}
+					// Выводим сообщение в лог
+					this->_log->print("Cluster [%s] connection could not be handed off to process [%u]: %s", log_t::flag_t::WARNING, this->_name.c_str(), pid, this->_server.socket.message(AWH_ERROR()).c_str());
+				}
+			}
+		}
+	#endif
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод отправки родительскому процессу сведений о нагрузке
+ *
+ * @param wid         идентификатор воркера
+ * @param connections количество активных подключений
+ * @param lag         задержка цикла событий (мкс)
+ */
+void awh::Cluster::load(const uint16_t wid, const size_t connections, const uint32_t lag) noexcept {
+	// Если процесс является дочерним
+	if(this->_pid != static_cast <pid_t> (::getpid())){
+		// Сведения о нагрузке процесса
+		load_t load;
+		// Устанавливаем задержку цикла событий
+		load.lag = lag;
+		// Устанавливаем количество полученных от родительского процесса подключений
+		load.received = this->_received;
+		// Устанавливаем количество активных подключений
+		load.connections = static_cast <uint32_t> (connections);
+		// Выполняем отправку сведений о нагрузке родительскому процессу
+		this->dispatch(wid, message_t::LOAD, reinterpret_cast <const char *> (&load), sizeof(load));
+	}
+}
+/**
+ * @brief Метод учёта сведений о нагрузке дочернего процесса
+ *
+ * @param pid    идентификатор процесса
+ * @param buffer бинарный буфер сведений о нагрузке
+ * @param size   размер бинарного буфера сведений о нагрузке
+ */
+void awh::Cluster::report(const pid_t pid, const char * buffer, const size_t size) noexcept {
+	// Если сведения о нагрузке получены полностью
+	if((buffer != nullptr) && (size == sizeof(load_t))){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Сведения о нагрузке процесса
+			load_t load;
+			// Извлекаем сведения о нагрузке
+			::memcpy(&load, buffer, sizeof(load));
+			// Получаем учтённые сведения о нагрузке процесса
+			load_t & item = this->_loads[pid];
+			// Устанавливаем задержку цикла событий
+			item.lag = load.lag;
+			// Устанавливаем количество полученных процессом подключений
+			item.received = load.received;
+			// Устанавливаем количество активных подключений
+			item.connections = load.connections;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(pid, size), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+}
 /**
  * @brief Метод отправки сообщения родительскому процессу
  *
@@ -1830,6 +2703,18 @@ void awh::Cluster::send(const uint16_t wid) noexcept {
  * @param size   размер бинарного буфера для отправки сообщения
  */
 void awh::Cluster::send(const uint16_t wid, const char * buffer, const size_t size) noexcept {
+	// Выполняем отправку сообщения общего назначения
+	this->dispatch(wid, message_t::GENERAL, buffer, size);
+}
+/**
+ * @brief Метод отправки сообщения указанного типа родительскому процессу
+ *
+ * @param wid    идентификатор воркера
+ * @param mid    идентификатор типа сообщения
+ * @param buffer бинарный буфер для отправки сообщения
+ * @param size   размер бинарного буфера для отправки сообщения
+ */
+void awh::Cluster::dispatch(const uint16_t wid, const message_t mid, const char * buffer, const size_t size) noexcept {
 	/**
 	 * Для операционной системы не являющейся MS Windows
 	 */
@@ -1854,12 +2739,16 @@ void awh::Cluster::send(const uint16_t wid, const char * buffer, const size_t si
 				auto j = this->_pids.find(pid);
 				// Если идентификатор процесса найден
 				if(j != this->_pids.end()){
+					// Если мы передаём данные через разделяемую память
+					if(this->_transfer == transfer_t::SHM)
+						// Выполняем запись сообщения в кольцевой буфер
+						this->enqueue(i->second.at(j->second).get(), buffer, size, mid);
 					// Выполняем поиск объектов энкодеров для отправки сообщения
 					auto k = this->_encoders.find(this->_pid);
 					// Если протокол кластера найден
 					if(k != this->_encoders.end()){
 						// Выполняем добавление буфера данных в протокол
-						k->second->push(static_cast <uint8_t> (message_t::GENERAL), buffer, size);
+						k->second->push(static_cast <uint8_t> (mid), buffer, size);
 						// Выполняем отправку сообщения мастер-процессу
 						this->write(i->first, this->_pid, i->second.at(j->second)->mfds[1]);
 					}
@@ -1909,6 +2798,10 @@ void awh::Cluster::send(const uint16_t wid, const pid_t pid, const char * buffer
 				auto j = this->_pids.find(pid);
 				// Если идентификатор процесса найден
 				if(j != this->_pids.end()){
+					// Если мы передаём данные через разделяемую память
+					if(this->_transfer == transfer_t::SHM)
+						// Выполняем запись сообщения в кольцевой буфер
+						this->enqueue(i->second.at(j->second).get(), buffer, size);
 					// Выполняем поиск объектов энкодеров для отправки сообщения
 					auto k = this->_encoders.find(j->first);
 					// Если протокол кластера найден
@@ -1974,6 +2867,10 @@ void awh::Cluster::broadcast(const uint16_t wid, const char * buffer, const size
 				for(auto & broker : i->second){
 					// Если идентификатор процесса не нулевой
 					if(broker->pid > 0){
+						// Если мы передаём данные через разделяемую память
+						if(this->_transfer == transfer_t::SHM)
+							// Выполняем запись сообщения в кольцевой буфер
+							this->enqueue(broker.get(), buffer, size);
 						// Выполняем поиск объектов энкодеров для отправки сообщения
 						auto j = this->_encoders.find(broker->pid);
 						// Если протокол кластера найден
@@ -2037,7 +2934,9 @@ void awh::Cluster::clear() noexcept {
 				}
 			} break;
 			// Если мы передаём данные через Shared memory
-			case static_cast <uint8_t> (transfer_t::PIPE): {
+			case static_cast <uint8_t> (transfer_t::PIPE):
+			// Если мы передаём данные через разделяемую память
+			case static_cast <uint8_t> (transfer_t::SHM): {
 				// Переходим по всем брокерам
 				for(auto & item : this->_brokers)
 					// Выполняем остановку процессов
@@ -2055,6 +2954,8 @@ void awh::Cluster::clear() noexcept {
 	this->_clients.clear();
 	// Выполняем очистку списка объектов энкодеров для отправки сообщений
 	this->_encoders.clear();
+	// Выполняем очистку сведений о нагрузке дочерних процессов
+	this->_loads.clear();
 	// Выполняем освобождение памяти активных клиентов
 	std::map <decltype(this->_clients)::key_type, decltype(this->_clients)::mapped_type> ().swap(this->_clients);
 	// Выполняем освобождение выделенной памяти
@@ -2092,6 +2993,8 @@ void awh::Cluster::close() noexcept {
 					for(auto & item : this->_brokers){
 						// Переходим по всему списку брокеров
 						for(auto & broker : item.second){
+							// Выполняем закрытие канала передачи подключений
+							this->release(broker.get());
 							// Выполняем поиск объекта энкодера для отправки сообщений
 							auto j = this->_encoders.find(broker->pid);
 							// Если объект энкодера для отправки сообщений найден
@@ -2104,7 +3007,9 @@ void awh::Cluster::close() noexcept {
 					}
 				} break;
 				// Если мы передаём данные через Shared memory
-				case static_cast <uint8_t> (transfer_t::PIPE): {
+				case static_cast <uint8_t> (transfer_t::PIPE):
+				// Если мы передаём данные через разделяемую память
+				case static_cast <uint8_t> (transfer_t::SHM): {
 					// Переходим по всем брокерам
 					for(auto & item : this->_brokers){
 						// Переходим по всему списку брокеров
@@ -2118,6 +3023,8 @@ void awh::Cluster::close() noexcept {
 							this->close(item.first, broker->cfds[1]);
 							this->close(item.first, broker->mfds[0]);
 							this->close(item.first, broker->mfds[1]);
+							// Выполняем закрытие канала передачи подключений
+							this->release(broker.get());
 							// Выполняем поиск объекта энкодера для отправки сообщений
 							auto j = this->_encoders.find(broker->pid);
 							// Если объект энкодера для отправки сообщений найден
@@ -2169,6 +3076,8 @@ void awh::Cluster::close(const uint16_t wid) noexcept {
 					}
 					// Переходим по всему списку брокеров
 					for(auto & broker : i->second){
+						// Выполняем закрытие канала передачи подключений
+						this->release(broker.get());
 						// Выполняем поиск объекта энкодера для отправки сообщений
 						auto j = this->_encoders.find(broker->pid);
 						// Если объект энкодера для отправки сообщений найден
@@ -2178,7 +3087,9 @@ void awh::Cluster::close(const uint16_t wid) noexcept {
 					}
 				} break;
 				// Если мы передаём данные через Shared memory
-				case static_cast <uint8_t> (transfer_t::PIPE): {
+				case static_cast <uint8_t> (transfer_t::PIPE):
+				// Если мы передаём данные через разделяемую память
+				case static_cast <uint8_t> (transfer_t::SHM): {
 					// Переходим по всему списку брокеров
 					for(auto & broker : i->second){
 						// Выполняем остановку чтение сообщений
@@ -2190,6 +3101,8 @@ void awh::Cluster::close(const uint16_t wid) noexcept {
 						this->close(i->first, broker->cfds[1]);
 						this->close(i->first, broker->mfds[0]);
 						this->close(i->first, broker->mfds[1]);
+						// Выполняем закрытие канала передачи подключений
+						this->release(broker.get());
 						// Выполняем поиск объекта энкодера для отправки сообщений
 						auto j = this->_encoders.find(broker->pid);
 						// Если объект энкодера для отправки сообщений найден
@@ -2383,6 +3296,58 @@ void awh::Cluster::transfer(const transfer_t transfer) noexcept {
 		// Выполняем установку режима передачи данных
 		this->_transfer = transfer;
 }
+/**
+ * @brief Метод установки размера кольцевого буфера разделяемой памяти
+ *
+ * @param size размер буфера одного направления в байтах
+ */
+void awh::Cluster::ringSize(const size_t size) noexcept {
+	// Если процесс является родительским
+	if(this->_pid == static_cast <pid_t> (::getpid()))
+		// Выполняем установку размера кольцевого буфера
+		this->_ringSize = (size > 0 ? size : AWH_CLUSTER_RING_SIZE);
+}
+/**
+ * @brief Метод установки политики поведения при переполнении кольцевого буфера
+ *
+ * @param overflow политика поведения при переполнении
+ */
+void awh::Cluster::overflow(const cmp::ring_t::overflow_t overflow) noexcept {
+	// Выполняем установку политики поведения при переполнении
+	this->_overflow = overflow;
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Переходим по всем брокерам
+		for(auto & item : this->_brokers){
+			// Переходим по всему списку брокеров
+			for(auto & broker : item.second)
+				// Выполняем установку политики поведения при переполнении
+				broker->ring.overflow(overflow);
+		}
+	#endif
+}
+/**
+ * @brief Метод получения режима распределения подключений
+ *
+ * @return режим распределения подключений
+ */
+awh::Cluster::distribution_t awh::Cluster::distribution() const noexcept {
+	// Выводим режим распределения подключений
+	return this->_distribution;
+}
+/**
+ * @brief Метод установки режима распределения подключений
+ *
+ * @param distribution режим распределения подключений
+ */
+void awh::Cluster::distribution(const distribution_t distribution) noexcept {
+	// Если процесс является родительским
+	if(this->_pid == static_cast <pid_t> (::getpid()))
+		// Выполняем установку режима распределения подключений
+		this->_distribution = distribution;
+}
 /**
  * @brief Метод установки соли шифрования
  *
@@ -2505,7 +3470,9 @@ void awh::Cluster::erase(const uint16_t wid, const pid_t pid) noexcept {
 							}
 						} break;
 						// Если мы передаём данные через Shared memory
-						case static_cast <uint8_t> (transfer_t::PIPE): {
+						case static_cast <uint8_t> (transfer_t::PIPE):
+						// Если мы передаём данные через разделяемую память
+						case static_cast <uint8_t> (transfer_t::SHM): {
 							// Выполняем остановку чтение сообщений
 							broker->read.stop();
 							// Выполняем остановку записи сообщений
@@ -2685,6 +3652,8 @@ void awh::Cluster::callback(const callback_t & callback) noexcept {
 	this->_callback.set("rebase", callback);
 	// Выполняем установку функции обратного вызова при ЗАПУСКЕ/ОСТАНОВКИ процесса
 	this->_callback.set("events", callback);
+	// Выполняем установку функции обратного вызова при получении переданного подключения
+	this->_callback.set("handoff", callback);
 	// Выполняем установку функции обратного вызова при получении сообщения
 	this->_callback.set("message", callback);
 }
@@ -2696,7 +3665,8 @@ void awh::Cluster::callback(const callback_t & callback) noexcept {
  */
 awh::Cluster::Cluster(const fmk_t * fmk, const log_t * log) noexcept :
  _pid(::getpid()), _name{""}, _salt{""}, _pass{""}, _server(fmk, log), _callback(log),
- _transfer(transfer_t::PIPE), _cipher(hash_t::cipher_t::NONE), _method(hash_t::method_t::NONE),
+ _transfer(transfer_t::PIPE), _ringSize(AWH_CLUSTER_RING_SIZE), _overflow(cmp::ring_t::overflow_t::WAIT),
+ _distribution(distribution_t::SHARED), _received(0), _cipher(hash_t::cipher_t::NONE), _method(hash_t::method_t::NONE),
  _core(nullptr), _fmk(fmk), _log(log) {
 	/**
 	 * Для операционной системы не являющейся MS Windows
@@ -2727,7 +3697,8 @@ awh::Cluster::Cluster(const fmk_t * fmk, const log_t * log) noexcept :
  */
 awh::Cluster::Cluster(core_t * core, const fmk_t * fmk, const log_t * log) noexcept :
  _pid(::getpid()), _name{""}, _salt{""}, _pass{""}, _server(fmk, log), _callback(log),
- _transfer(transfer_t::PIPE), _cipher(hash_t::cipher_t::NONE), _method(hash_t::method_t::NONE),
+ _transfer(transfer_t::PIPE), _ringSize(AWH_CLUSTER_RING_SIZE), _overflow(cmp::ring_t::overflow_t::WAIT),
+ _distribution(distribution_t::SHARED), _received(0), _cipher(hash_t::cipher_t::NONE), _method(hash_t::method_t::NONE),
  _core(core), _fmk(fmk), _log(log) {
 	/**
 	 * Для операционной системы не являющейся MS Windows
@@ -299,9 +299,17 @@ void awh::cmp::Encoder::method(const hash_t::method_t method) noexcept {
 	// Выполняем установку метода компрессии
 	this->_method = method;
 	// Если метод установлен актуальный
-	if(this->_method != hash_t::method_t::NONE)
+	if(this->_method != hash_t::method_t::NONE){
 		// Выставляем уровень компрессии
 		this->_hash.level(hash_t::level_t::SPEED);
+		// Если метод компрессии не LZ4 (сообщения LZ4 передаются одним блоком, несовместимым с потоковым фреймом)
+		if(this->_method != hash_t::method_t::LZ4)
+			// Выполняем инициализацию потокового компрессора
+			this->_codec.init(this->_method, hash_t::event_t::ENCODE, hash_t::level_t::SPEED);
+		// Освобождаем контекст потокового компрессора
+		else this->_codec.clear();
+	// Освобождаем контекст потокового компрессора
+	} else this->_codec.clear();
 }
 /**
  * @brief Метод добавления новой записи в протокол
@@ -350,8 +358,14 @@ void awh::cmp::Encoder::push(const uint8_t mid, const void * buffer, const size_
 			} else {
 				// Результирующий объект буфер данных
 				vector <char> result;
+				// Если потоковый компрессор инициализирован, сжимаем сообщение без пересоздания контекста
+				if(this->_codec.method() == this->_method){
+					// Если компрессия сообщения не выполнена
+					if(!this->_codec.write(reinterpret_cast <const char *> (buffer), size, result) || !this->_codec.finish(result))
+						// Выполняем очистку буфера данных
+						result.clear();
 				// Выполняем компрессию данных
-				this->_hash.compress(reinterpret_cast <const char *> (buffer), size, this->_method, result);
+				} else this->_hash.compress(reinterpret_cast <const char *> (buffer), size, this->_method, result);
 				// Если компрессия выполнена удачно
 				if(!result.empty()){
 					// Устанавливаем флаг компрессии данных
@@ -475,7 +489,7 @@ awh::cmp::Encoder & awh::cmp::Encoder::operator = (const size_t size) noexcept {
  */
 awh::cmp::Encoder::Encoder(const log_t * log) noexcept :
  _chunkSize(CHUNK_SIZE),
- _hash(log), _buffer(log),
+ _hash(log), _codec(log), _buffer(log),
  _cipher(hash_t::cipher_t::NONE),
  _method(hash_t::method_t::NONE), _log(log) {}
 /**
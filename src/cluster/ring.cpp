@@ -0,0 +1,556 @@
+/**
+ * @file: ring.cpp
+ * @date: 2025-03-24
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <cluster/ring.hpp>
+
+/**
+ * Подписываемся на стандартное пространство имён
+ */
+using namespace std;
+
+/**
+ * @brief Функция выравнивания размера записи по границе 8 байт
+ *
+ * @param size размер для выравнивания
+ * @return     выровненный размер
+ */
+static constexpr size_t align8(const size_t size) noexcept {
+	// Выполняем выравнивание размера
+	return ((size + 0x07) & ~static_cast <size_t> (0x07));
+}
+/**
+ * @brief Метод получения канала по индексу
+ *
+ * @param index индекс канала (0 - от родителя к ребёнку, 1 - от ребёнка к родителю)
+ * @return      канал для работы
+ */
+awh::cmp::Ring::channel_t * awh::cmp::Ring::channel(const uint8_t index) const noexcept {
+	// Выводим адрес канала в разделяемой памяти
+	return (reinterpret_cast <channel_t *> (this->_memory) + index);
+}
+/**
+ * @brief Метод получения области данных канала
+ *
+ * @param index индекс канала
+ * @return      адрес области данных
+ */
+char * awh::cmp::Ring::area(const uint8_t index) const noexcept {
+	// Выводим адрес области данных расположенной за заголовками каналов
+	return (reinterpret_cast <char *> (this->_memory) + (sizeof(channel_t) * 2) + (this->_capacity * index));
+}
+/**
+ * @brief Метод записи части сообщения в буфер
+ *
+ * @param mid    идентификатор сообщения
+ * @param buffer буфер данных для записи
+ * @param size   размер буфера данных
+ * @param offset смещение уже записанных данных
+ * @param check  флаг только проверки наличия места без записи
+ * @return       результат записи сообщения целиком
+ */
+bool awh::cmp::Ring::write(const uint8_t mid, const char * buffer, const size_t size, size_t & offset, const bool check) noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Получаем индекс канала на запись
+	const uint8_t index = (this->_master ? 0 : 1);
+	// Получаем канал на запись
+	channel_t * channel = this->channel(index);
+	// Получаем область данных канала
+	char * data = this->area(index);
+	// Получаем позицию чтения установленную читателем
+	const uint64_t tail = channel->tail.load(std::memory_order_acquire);
+	// Получаем текущую позицию записи
+	uint64_t head = channel->head.load(std::memory_order_relaxed);
+	// Получаем текущее смещение записанных данных
+	size_t position = offset;
+	// Максимальный размер одного фрагмента (половина буфера, чтобы фрагмент всегда мог поместиться после заполнителя)
+	const size_t limit = ((this->_capacity / 2) - HEADER);
+	/**
+	 * Выполняем запись фрагментов пока есть место
+	 */
+	for(;;){
+		// Получаем размер оставшихся данных
+		const size_t remain = (size - position);
+		// Получаем размер текущего фрагмента
+		const size_t chunk = min(remain, limit);
+		// Получаем размер записи в буфере
+		const size_t need = (HEADER + align8(chunk));
+		// Получаем индекс позиции записи в буфере
+		const size_t idx = static_cast <size_t> (head & (this->_capacity - 1));
+		// Получаем размер свободного места до конца буфера
+		const size_t room = (this->_capacity - idx);
+		// Если запись не помещается до конца буфера
+		if(need > room){
+			// Если заполнитель не помещается в свободное место
+			if(((head - tail) + room) > this->_capacity)
+				// Выходим из цикла
+				break;
+			// Если выполняется запись данных
+			if(!check){
+				// Создаём запись заполнителя
+				record_t record = {static_cast <uint32_t> (room - HEADER), mid, static_cast <uint8_t> (flag_t::PAD), 0};
+				// Выполняем запись заполнителя
+				::memcpy(data + idx, &record, HEADER);
+			}
+			// Смещаем позицию записи в начало буфера
+			head += room;
+			// Продолжаем запись с начала буфера
+			continue;
+		}
+		// Если запись не помещается в свободное место
+		if(((head - tail) + need) > this->_capacity)
+			// Выходим из цикла
+			break;
+		// Определяем является ли фрагмент последним
+		const bool fin = (chunk == remain);
+		// Если выполняется запись данных
+		if(!check){
+			// Создаём запись фрагмента
+			record_t record = {static_cast <uint32_t> (chunk), mid, static_cast <uint8_t> (fin ? flag_t::FIN : flag_t::NONE), 0};
+			// Выполняем запись заголовка фрагмента
+			::memcpy(data + idx, &record, HEADER);
+			// Если полезная нагрузка существует
+			if(chunk > 0)
+				// Выполняем копирование полезной нагрузки
+				::memcpy(data + idx + HEADER, buffer + position, chunk);
+		}
+		// Смещаем позицию записи
+		head += need;
+		// Увеличиваем смещение записанных данных
+		position += chunk;
+		// Если фрагмент последний
+		if(fin){
+			// Запоминаем что сообщение записано целиком
+			result = true;
+			// Выходим из цикла
+			break;
+		}
+	}
+	// Если выполняется запись данных
+	if(!check){
+		// Запоминаем смещение записанных данных
+		offset = position;
+		// Публикуем новую позицию записи для читателя
+		channel->head.store(head, std::memory_order_release);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод оповещения читателя о новых данных
+ *
+ * @param head позиция записи до начала операции
+ * @return     статус необходимости пробуждения читателя
+ */
+awh::cmp::Ring::status_t awh::cmp::Ring::notify(const uint64_t head) const noexcept {
+	// Получаем канал на запись
+	channel_t * channel = this->channel(this->_master ? 0 : 1);
+	// Если позиция записи не изменилась
+	if(channel->head.load(std::memory_order_relaxed) == head)
+		// Будить читателя не требуется
+		return status_t::NONE;
+	// Упорядочиваем публикацию позиции записи и чтение флага ожидания
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	// Если читатель ожидает новых данных
+	if((channel->idle.load(std::memory_order_relaxed) == 1) && (channel->idle.exchange(0, std::memory_order_acq_rel) == 1))
+		// Требуется разбудить читателя
+		return status_t::WAKE;
+	// Будить читателя не требуется
+	return status_t::NONE;
+}
+/**
+ * @brief Метод проверки инициализации буфера
+ *
+ * @return результат проверки
+ */
+bool awh::cmp::Ring::created() const noexcept {
+	// Выводим результат проверки
+	return (this->_memory != nullptr);
+}
+/**
+ * @brief Метод создания разделяемой памяти (вызывается до создания дочернего процесса)
+ *
+ * @param capacity ёмкость одного направления в байтах
+ * @return         результат выполнения операции
+ */
+bool awh::cmp::Ring::create(const size_t capacity) noexcept {
+	// Выполняем освобождение ранее выделенной памяти
+	this->destroy();
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Устанавливаем минимальную ёмкость буфера
+		this->_capacity = MIN_CAPACITY;
+		/**
+		 * Выполняем округление ёмкости до степени двойки (не более 2 GiB, размер записи 32 бита)
+		 */
+		while((this->_capacity < capacity) && (this->_capacity < 0x80000000))
+			// Увеличиваем ёмкость буфера вдвое
+			this->_capacity <<= 1;
+		// Получаем общий размер разделяемой памяти
+		this->_length = ((sizeof(channel_t) * 2) + (this->_capacity * 2));
+		// Выполняем создание анонимной разделяемой памяти наследуемой дочерним процессом
+		void * memory = ::mmap(nullptr, this->_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+		// Если память выделить не удалось
+		if(memory == MAP_FAILED){
+			// Выводим в лог сообщение
+			this->_log->print("Cluster ring: %s", log_t::flag_t::CRITICAL, ::strerror(errno));
+			// Сбрасываем размеры буфера
+			this->_capacity = this->_length = 0;
+			// Выходим из функции
+			return false;
+		}
+		// Запоминаем адрес разделяемой памяти
+		this->_memory = memory;
+		/**
+		 * Выполняем инициализацию обоих каналов
+		 */
+		for(uint8_t i = 0; i < 2; i++){
+			// Создаём объект канала в разделяемой памяти
+			channel_t * channel = new (this->channel(i)) channel_t;
+			// Сбрасываем позицию записи
+			channel->head.store(0, std::memory_order_relaxed);
+			// Сбрасываем позицию чтения
+			channel->tail.store(0, std::memory_order_relaxed);
+			// Читатель изначально ожидает данных
+			channel->idle.store(1, std::memory_order_relaxed);
+			// Писатель изначально не заблокирован
+			channel->blocked.store(0, std::memory_order_relaxed);
+		}
+		// Выводим результат
+		return true;
+	/**
+	 * Для операционной системы MS Windows
+	 */
+	#else
+		// Выводим в лог сообщение
+		this->_log->print("Cluster ring: %s", log_t::flag_t::CRITICAL, "shared memory transport is not supported");
+		// Выводим результат
+		return false;
+	#endif
+}
+/**
+ * @brief Метод освобождения разделяемой памяти
+ *
+ */
+void awh::cmp::Ring::destroy() noexcept {
+	// Выполняем очистку буфера фрагментов
+	this->_fragments.clear();
+	// Выполняем очистку очереди отложенных сообщений
+	this->_backlog.clear();
+	// Сбрасываем объём отложенных сообщений
+	this->_waiting = 0;
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Если разделяемая память выделена
+		if(this->_memory != nullptr)
+			// Выполняем удаление отображения памяти
+			::munmap(this->_memory, this->_length);
+	#endif
+	// Сбрасываем адрес разделяемой памяти
+	this->_memory = nullptr;
+	// Сбрасываем размеры буфера
+	this->_capacity = this->_length = 0;
+}
+/**
+ * @brief Метод записи сообщения в буфер
+ *
+ * @param mid    идентификатор сообщения
+ * @param buffer буфер данных сообщения
+ * @param size   размер буфера данных сообщения
+ * @return       статус выполнения операции
+ */
+awh::cmp::Ring::status_t awh::cmp::Ring::push(const uint8_t mid, const char * buffer, const size_t size) noexcept {
+	// Если разделяемая память не создана
+	if(this->_memory == nullptr)
+		// Сообщаем что сообщение отброшено
+		return status_t::DROP;
+	// Получаем позицию записи до начала операции
+	const uint64_t head = this->channel(this->_master ? 0 : 1)->head.load(std::memory_order_relaxed);
+	// Смещение записанных данных
+	size_t offset = 0;
+	// Определяем политику поведения при переполнении
+	switch(static_cast <uint8_t> (this->_overflow)){
+		// Если сообщение необходимо отбросить
+		case static_cast <uint8_t> (overflow_t::DROP): {
+			// Если сообщение не помещается в буфер целиком
+			if(!this->write(mid, buffer, size, offset, true))
+				// Сообщаем что сообщение отброшено
+				return status_t::DROP;
+			// Выполняем запись сообщения
+			this->write(mid, buffer, size, offset);
+		} break;
+		// Если сообщение необходимо удержать
+		case static_cast <uint8_t> (overflow_t::WAIT): {
+			/**
+			 * Выполняем обработку ошибки
+			 */
+			try {
+				// Если очередь отложенных сообщений пуста и сообщение записано целиком
+				if(this->_backlog.empty() && this->write(mid, buffer, size, offset))
+					// Выходим из условия
+					break;
+				// Если сообщение ещё не записано частично, а очередь отложенных сообщений переполнена
+				if((offset == 0) && ((this->_waiting + size) > AWH_CLUSTER_RING_BACKLOG)){
+					// Выводим сообщение об ошибке
+					this->_log->print("Cluster ring backlog has reached %zu bytes, message of %zu bytes dropped", log_t::flag_t::CRITICAL, this->_waiting, size);
+					// Сообщаем что сообщение отброшено
+					return status_t::DROP;
+				}
+				// Создаём отложенное сообщение
+				pending_t pending;
+				// Устанавливаем идентификатор сообщения
+				pending.mid = mid;
+				// Устанавливаем смещение уже записанных данных
+				pending.offset = offset;
+				// Копируем данные сообщения
+				pending.data.assign(buffer, buffer + size);
+				// Добавляем сообщение в очередь
+				this->_backlog.push_back(::move(pending));
+				// Увеличиваем объём отложенных сообщений
+				this->_waiting += size;
+				// Выполняем попытку дозаписи отложенных сообщений, если читатель уже разбужен
+				if(this->flush() == status_t::WAKE)
+					// Сообщаем что требуется разбудить читателя
+					return status_t::WAKE;
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const bad_alloc &) {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(mid, size), log_t::flag_t::CRITICAL, "Memory allocation error");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+				#endif
+				// Выходим из приложения
+				::exit(EXIT_FAILURE);
+			}
+		} break;
+	}
+	// Выполняем оповещение читателя
+	return this->notify(head);
+}
+/**
+ * @brief Метод дозаписи отложенных сообщений
+ *
+ * @return статус выполнения операции
+ */
+awh::cmp::Ring::status_t awh::cmp::Ring::flush() noexcept {
+	// Если разделяемая память не создана или очередь пуста
+	if((this->_memory == nullptr) || this->_backlog.empty())
+		// Выводим результат
+		return status_t::NONE;
+	// Получаем канал на запись
+	channel_t * channel = this->channel(this->_master ? 0 : 1);
+	// Получаем позицию записи до начала операции
+	const uint64_t head = channel->head.load(std::memory_order_relaxed);
+	// Флаг выполненной повторной попытки
+	bool retry = false;
+	/**
+	 * Выполняем запись отложенных сообщений
+	 */
+	while(!this->_backlog.empty()){
+		// Получаем первое отложенное сообщение
+		pending_t & pending = this->_backlog.front();
+		// Если сообщение записано целиком
+		if(this->write(pending.mid, pending.data.data(), pending.data.size(), pending.offset)){
+			// Уменьшаем объём отложенных сообщений
+			this->_waiting -= pending.data.size();
+			// Удаляем сообщение из очереди
+			this->_backlog.pop_front();
+		// Если повторная попытка ещё не выполнялась
+		} else if(!retry) {
+			// Запоминаем что повторная попытка выполнена
+			retry = !retry;
+			// Сообщаем читателю что писатель ожидает освобождения места
+			channel->blocked.store(1, std::memory_order_relaxed);
+			// Упорядочиваем установку флага и повторное чтение позиции чтения
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+		// Выходим из цикла, читатель разбудит нас после освобождения места
+		} else break;
+	}
+	// Выполняем оповещение читателя
+	return this->notify(head);
+}
+/**
+ * @brief Метод извлечения всех доступных сообщений
+ *
+ * @param callback функция обратного вызова для каждого сообщения
+ * @return         статус необходимости пробуждения писателя
+ */
+awh::cmp::Ring::status_t awh::cmp::Ring::pop(function <void (const uint8_t, const char *, const size_t)> callback) noexcept {
+	// Если разделяемая память не создана
+	if(this->_memory == nullptr)
+		// Выводим результат
+		return status_t::NONE;
+	// Получаем индекс канала на чтение
+	const uint8_t index = (this->_master ? 1 : 0);
+	// Получаем канал на чтение
+	channel_t * channel = this->channel(index);
+	// Получаем область данных канала
+	const char * data = this->area(index);
+	// Получаем текущую позицию чтения
+	uint64_t tail = channel->tail.load(std::memory_order_relaxed);
+	/**
+	 * Выполняем чтение пока есть данные
+	 */
+	for(;;){
+		// Получаем позицию записи установленную писателем
+		uint64_t head = channel->head.load(std::memory_order_acquire);
+		// Если данных в буфере нет
+		if(head == tail){
+			// Сообщаем писателю что читатель ожидает новых данных
+			channel->idle.store(1, std::memory_order_seq_cst);
+			// Повторно проверяем позицию записи после установки флага
+			head = channel->head.load(std::memory_order_seq_cst);
+			// Если данных так и не появилось
+			if(head == tail)
+				// Выходим из цикла
+				break;
+		}
+		/**
+		 * Выполняем извлечение всех опубликованных записей
+		 */
+		while(tail != head){
+			// Получаем индекс позиции чтения в буфере
+			const size_t idx = static_cast <size_t> (tail & (this->_capacity - 1));
+			// Создаём заголовок записи
+			record_t record;
+			// Выполняем чтение заголовка записи
+			::memcpy(&record, data + idx, HEADER);
+			// Получаем адрес полезной нагрузки
+			const char * payload = (data + idx + HEADER);
+			// Получаем размер следующей позиции чтения
+			const uint64_t next = (tail + HEADER + align8(record.size));
+			// Если запись является заполнителем
+			if((record.flags & static_cast <uint8_t> (flag_t::PAD)) != 0){
+				// Освобождаем место для писателя
+				channel->tail.store(tail = next, std::memory_order_release);
+				// Переходим к следующей записи
+				continue;
+			}
+			// Если запись является последней и сообщение не фрагментировано
+			if(((record.flags & static_cast <uint8_t> (flag_t::FIN)) != 0) && this->_fragments.empty()){
+				// Передаём сообщение прямо из разделяемой памяти без копирования
+				callback(record.mid, payload, record.size);
+				// Если разделяемая память была освобождена в функции обратного вызова
+				if(this->_memory == nullptr)
+					// Выходим из функции
+					return status_t::NONE;
+				// Освобождаем место для писателя
+				channel->tail.store(tail = next, std::memory_order_release);
+				// Переходим к следующей записи
+				continue;
+			}
+			/**
+			 * Выполняем обработку ошибки
+			 */
+			try {
+				// Добавляем фрагмент в буфер сборки
+				this->_fragments.insert(this->_fragments.end(), payload, payload + record.size);
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const bad_alloc &) {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(record.mid, record.size), log_t::flag_t::CRITICAL, "Memory allocation error");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+				#endif
+				// Выходим из приложения
+				::exit(EXIT_FAILURE);
+			}
+			// Освобождаем место для писателя
+			channel->tail.store(tail = next, std::memory_order_release);
+			// Если фрагмент последний
+			if((record.flags & static_cast <uint8_t> (flag_t::FIN)) != 0){
+				// Забираем собранное сообщение
+				vector <char> message = ::move(this->_fragments);
+				// Очищаем буфер сборки
+				this->_fragments.clear();
+				// Передаём собранное сообщение
+				callback(record.mid, message.data(), message.size());
+				// Если разделяемая память была освобождена в функции обратного вызова
+				if(this->_memory == nullptr)
+					// Выходим из функции
+					return status_t::NONE;
+			}
+		}
+	}
+	// Упорядочиваем публикацию позиции чтения и чтение флага блокировки
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	// Если писатель ожидает освобождения места
+	if((channel->blocked.load(std::memory_order_relaxed) == 1) && (channel->blocked.exchange(0, std::memory_order_acq_rel) == 1))
+		// Требуется разбудить писателя
+		return status_t::WAKE;
+	// Будить писателя не требуется
+	return status_t::NONE;
+}
+/**
+ * @brief Метод получения количества отложенных сообщений
+ *
+ * @return количество отложенных сообщений
+ */
+size_t awh::cmp::Ring::pending() const noexcept {
+	// Выводим количество отложенных сообщений
+	return this->_backlog.size();
+}
+/**
+ * @brief Метод установки стороны работы с буфером
+ *
+ * @param mode флаг стороны родительского процесса
+ */
+void awh::cmp::Ring::master(const bool mode) noexcept {
+	// Устанавливаем флаг стороны родительского процесса
+	this->_master = mode;
+}
+/**
+ * @brief Метод установки политики поведения при переполнении
+ *
+ * @param overflow политика поведения при переполнении
+ */
+void awh::cmp::Ring::overflow(const overflow_t overflow) noexcept {
+	// Устанавливаем политику поведения при переполнении
+	this->_overflow = overflow;
+}
+/**
+ * @brief Деструктор
+ *
+ */
+awh::cmp::Ring::~Ring() noexcept {
+	// Выполняем освобождение разделяемой памяти
+	this->destroy();
+}
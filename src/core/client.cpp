@@ -65,6 +65,8 @@ void awh::client::Core::connect(const uint16_t sid) noexcept {
 							awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (i->second.get());
 							// Выполняем остановку работы событий
 							broker->stop();
+							// Выполняем сохранение сессии TLS для возобновления подключения
+							this->store(broker);
 							// Выполняем очистку контекста двигателя
 							broker->ectx.clear();
 							// Удаляем брокера из списка подключений
@@ -203,6 +205,8 @@ void awh::client::Core::connect(const uint16_t sid) noexcept {
 								this->_engine.encrypted(this->_callback.call <bool (const uri_t::url_t &, const uint64_t, const uint16_t)> ("ssl", url, broker->id(), sid), broker->ectx);
 							// Выполняем активацию контекста подключения
 							this->_engine.wrap(broker->ectx, &broker->addr, host);
+							// Выполняем установку сохранённой сессии TLS
+							this->resume(broker.get());
 						// Если хост сервера не получен
 						} else {
 							// Разрешаем выполнение работы
@@ -637,6 +641,43 @@ void awh::client::Core::timeout(const uint16_t sid, const scheme_t::mode_t mode)
 		}
 	}
 }
+/**
+ * @brief Метод сохранения сессии TLS подключения для последующего возобновления
+ *
+ * @param broker объект брокера подключения
+ */
+void awh::client::Core::store(const awh::scheme_t::broker_t * broker) noexcept {
+	// Если брокер передан и хост удалённого сервера известен
+	if((broker != nullptr) && !broker->ectx.host().empty()){
+		// Получаем сериализованную сессию TLS
+		vector <uint8_t> session = this->_engine.session(broker->ectx);
+		// Если сессия может быть возобновлена
+		if(!session.empty()){
+			// Выполняем блокировку потока
+			const lock_guard <std::recursive_mutex> lock(this->_mtx.session);
+			// Сохраняем сессию TLS для хоста
+			this->_sessions[broker->ectx.host()] = ::move(session);
+		}
+	}
+}
+/**
+ * @brief Метод установки сохранённой сессии TLS для возобновления подключения
+ *
+ * @param broker объект брокера подключения
+ */
+void awh::client::Core::resume(awh::scheme_t::broker_t * broker) noexcept {
+	// Если брокер передан и хост удалённого сервера известен
+	if((broker != nullptr) && !broker->ectx.host().empty()){
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx.session);
+		// Выполняем поиск сохранённой сессии для хоста
+		auto i = this->_sessions.find(broker->ectx.host());
+		// Если сессия найдена и не может быть установлена
+		if((i != this->_sessions.end()) && !this->_engine.session(broker->ectx, i->second))
+			// Удаляем устаревшую сессию
+			this->_sessions.erase(i);
+	}
+}
 /**
  * @brief Метод удаления таймера ожидания получения данных
  *
@@ -865,6 +906,8 @@ void awh::client::Core::close() noexcept {
 						awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (i->second.get());
 						// Выполняем остановку работы событий
 						broker->stop();
+						// Выполняем сохранение сессии TLS для возобновления подключения
+						this->store(broker);
 						// Выполняем очистку контекста двигателя
 						broker->ectx.clear();
 						// Удаляем брокера из списка подключений
@@ -945,6 +988,8 @@ void awh::client::Core::remove() noexcept {
 						awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (j->second.get());
 						// Выполняем остановку работы событий
 						broker->stop();
+						// Выполняем сохранение сессии TLS для возобновления подключения
+						this->store(broker);
 						// Выполняем очистку контекста двигателя
 						broker->ectx.clear();
 						// Удаляем брокера из списка подключений
@@ -1099,6 +1144,8 @@ void awh::client::Core::close(const uint64_t bid) noexcept {
 					shm-> * Выполняем переключение обратно на прокси-сервер
 					shm-> */
 					shm->switchConnect();
+				// Выполняем сохранение сессии TLS для возобновления подключения
+				this->store(broker);
 				// Выполняем очистку контекста двигателя
 				broker->ectx.clear();
 				// Выполняем удаление параметров активного брокера
@@ -1175,6 +1222,8 @@ void awh::client::Core::remove(const uint16_t sid) noexcept {
 					awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (j->second.get());
 					// Выполняем остановку работы событий
 					broker->stop();
+					// Выполняем сохранение сессии TLS для возобновления подключения
+					this->store(broker);
 					// Выполняем очистку контекста двигателя
 					broker->ectx.clear();
 					// Удаляем брокера из списка подключений
@@ -1264,6 +1313,8 @@ void awh::client::Core::switchProxy(const uint64_t bid) noexcept {
 						this->_engine.encrypted(this->_callback.call <bool (const uri_t::url_t &, const uint64_t, const uint16_t)> ("ssl", shm->url, bid, i->first), broker->ectx);
 					// Выполняем получение контекста сертификата
 					this->_engine.wrap(broker->ectx, broker->ectx, host);
+					// Выполняем установку сохранённой сессии TLS
+					this->resume(broker);
 					// Если подключение не обёрнуто
 					if(broker->addr.sock == INVALID_SOCKET){
 						// Выводим сообщение об ошибке
@@ -1419,6 +1470,19 @@ void awh::client::Core::connected(const uint64_t bid) noexcept {
  * @return       результат отправки сообщения
  */
 bool awh::client::Core::send(const char * buffer, const size_t size, const uint64_t bid) noexcept {
+	// Выполняем отправку буфера данных с копированием
+	return this->send(buffer, size, nullptr, bid);
+}
+/**
+ * @brief Метод асинхронной отправки буфера данных в сокет без копирования
+ *
+ * @param buffer буфер для записи данных
+ * @param size   размер записываемых данных
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ * @param bid    идентификатор брокера
+ * @return       результат отправки сообщения
+ */
+bool awh::client::Core::send(const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const uint64_t bid) noexcept {
 	// Результат работы функции
 	bool result = false;
 	// Если данные переданы
@@ -1432,7 +1496,7 @@ bool awh::client::Core::send(const char * buffer, const size_t size, const uint6
 			// Если установлен флаг отправки отложенных сообщений
 			case static_cast <uint8_t> (sending_t::DEFFER):
 				// Выполняем отправку сообщения асинхронным методом
-				waiting = result = node_t::send(buffer, size, bid);
+				waiting = result = node_t::send(buffer, size, owner, bid);
 			break;
 			// Если установлен флаг отправки мгновенных сообщений
 			case static_cast <uint8_t> (sending_t::INSTANT): {
@@ -1441,7 +1505,7 @@ bool awh::client::Core::send(const char * buffer, const size_t size, const uint6
 				// Если для потока очередь полезной нагрузки получена
 				if((waiting = ((i != this->_payloads.end()) && !i->second->empty())))
 					// Выполняем отправку сообщения асинхронным методом
-					result = node_t::send(buffer, size, bid);
+					result = node_t::send(buffer, size, owner, bid);
 				// Если очередь ещё не существует
 				else {
 					// Выполняем отправку данных клиенту
@@ -1449,7 +1513,7 @@ bool awh::client::Core::send(const char * buffer, const size_t size, const uint6
 					// Если данные отправлены не полностью
 					if((waiting = (bytes < size)))
 						// Выполняем отправку сообщения асинхронным методом
-						result = node_t::send(buffer + bytes, size - bytes, bid);
+						result = node_t::send(buffer + bytes, size - bytes, owner, bid);
 					// Если все данные добавлены успешно
 					else result = (bytes == size);
 				}
@@ -1515,16 +1579,24 @@ void awh::client::Core::read(const uint64_t bid) noexcept {
 							#endif
 						} break;
 					}
-					// Выполняем отключение приёма данных на этот сокет
-					broker->events(awh::scheme_t::mode_t::DISABLED, engine_t::method_t::READ);
+					// Арендуем буфер чтения потока на время чтения данных
+					lease_t lease(this->_log);
+					// Устанавливаем флаг выполнения чтения
+					broker->buffer.reading = true;
 					/**
 					 * Выполняем чтение данных с сокета
 					 */
 					do {
 						// Если подключение выполнено и чтение данных разрешено
 						if((broker->buffer.size > 0) && (shm->status.real == scheme_t::mode_t::CONNECT)){
+							// Получаем буфер для чтения: собственный буфер брокера или арендованный буфер потока
+							char * buffer = (broker->buffer.retain ? broker->buffer.data.get() : lease.get(broker->buffer.size));
+							// Если буфер для чтения не получен
+							if(buffer == nullptr)
+								// Выходим из цикла
+								break;
 							// Выполняем получение сообщения от клиента
-							const int64_t bytes = broker->ectx.read(broker->buffer.data.get(), broker->buffer.size);
+							const int64_t bytes = broker->ectx.read(buffer, broker->buffer.size);
 							// Если данные получены
 							if(bytes > 0){
 								// Если таймер ожидания получения данных установлен
@@ -1536,11 +1608,11 @@ void awh::client::Core::read(const uint64_t bid) noexcept {
 									// Если функция обратного вызова для вывода записи существует
 									if(this->_callback.is("readProxy"))
 										// Выводим функцию обратного вызова
-										this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("readProxy", broker->buffer.data.get(), static_cast <size_t> (bytes), bid, i->first);
+										this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("readProxy", buffer, static_cast <size_t> (bytes), bid, i->first);
 								// Если прокси-сервер не используется
 								} else if(this->_callback.is("read"))
 									// Выводим функцию обратного вызова
-									this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", broker->buffer.data.get(), static_cast <size_t> (bytes), bid, i->first);
+									this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", buffer, static_cast <size_t> (bytes), bid, i->first);
 							// Если данные небыли получены
 							} else if(bytes <= 0) {
 								// Если чтение не выполнена, закрываем подключение
@@ -1553,17 +1625,17 @@ void awh::client::Core::read(const uint64_t bid) noexcept {
 						// Если запись не выполнена, входим
 						} else break;
 					/**
-					 * Выполняем чтение до тех пор, пока всё не прочитаем
+					 * Выполняем чтение до тех пор, пока всё не прочитаем или чтение не будет приостановлено
 					 */
-					} while(this->has(bid));
+					} while(this->has(bid) && !broker->buffer.paused);
 					// Если подключение ещё не разорванно
 					if(this->has(bid)){
+						// Завершаем чтение и применяем отложенную переинициализацию буфера
+						this->releaseBuffer(bid);
 						// Если время ожиданий входящих сообщений установлено
 						if(broker->timeouts.wait > 0)
 							// Выполняем создание таймаута ожидания получения данных
 							this->createTimeout(bid, static_cast <uint32_t> (broker->timeouts.wait) * 1000);
-						// Выполняем активацию отслеживания получения данных с этого сокета
-						broker->events(awh::scheme_t::mode_t::ENABLED, engine_t::method_t::READ);
 					}
 				// Если подключение завершено
 				} else {
@@ -1627,7 +1699,12 @@ void awh::client::Core::write(const uint64_t bid) noexcept {
 					// Если для потока очередь полезной нагрузки получена
 					if((i != this->_payloads.end()) && !i->second->empty()){
 						// Выполняем запись в сокет
-						const size_t bytes = this->write(reinterpret_cast <const char *> (i->second->get()), i->second->size(), bid);
+						// Список записей очереди полезной нагрузки для векторной отправки
+						chain_t::record_t records[AWH_CHAIN_RECORDS];
+						// Получаем записи очереди полезной нагрузки
+						const size_t count = i->second->records(records, AWH_CHAIN_RECORDS, i->second->size());
+						// Выполняем запись в сокет всех записей одним вызовом
+						const size_t bytes = this->write(records, count, bid);
 						// Если данные записаны удачно
 						if((bytes > 0) && this->has(bid))
 							// Выполняем освобождение памяти хранения полезной нагрузки
@@ -1672,10 +1749,24 @@ void awh::client::Core::write(const uint64_t bid) noexcept {
  * @return       количество отправленных байт
  */
 size_t awh::client::Core::write(const char * buffer, const size_t size, const uint64_t bid) noexcept {
+	// Создаём запись буфера данных
+	const chain_t::record_t record(buffer, size);
+	// Выполняем запись буфера данных в сокет
+	return this->write(&record, ((buffer != nullptr) && (size > 0) ? 1 : 0), bid);
+}
+/**
+ * @brief Метод векторной записи списка буферов данных в сокет
+ *
+ * @param records список записей данных для записи
+ * @param count   количество записей в списке
+ * @param bid     идентификатор брокера
+ * @return        количество отправленных байт
+ */
+size_t awh::client::Core::write(const chain_t::record_t * records, const size_t count, const uint64_t bid) noexcept {
 	// Результат работы функции
 	size_t result = 0;
 	// Если данные переданы
-	if(this->working() && this->has(bid) && (buffer != nullptr) && (size > 0)){
+	if(this->working() && this->has(bid) && (records != nullptr) && (count > 0)){
 		// Создаём бъект активного брокера подключения
 		awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (this->broker(bid));
 		// Если сокет подключения активен
@@ -1764,8 +1855,21 @@ size_t awh::client::Core::write(const char * buffer, const size_t size, const ui
 								broker->ectx.timeout(static_cast <uint32_t> (broker->timeouts.write) * 1000, engine_t::method_t::WRITE);
 							break;
 						}
-						// Выполняем отправку сообщения клиенту
-						const int64_t bytes = broker->ectx.write(buffer, (size >= static_cast <size_t> (max) ? static_cast <size_t> (max) : size));
+						// Количество записей ограниченных размером буфера сокета
+						size_t length = 0;
+						// Размер данных записей ограниченных размером буфера сокета
+						size_t amount = 0;
+						// Список записей ограниченный размером буфера сокета
+						chain_t::record_t limited[AWH_CHAIN_RECORDS];
+						// Выполняем ограничение записей размером буфера сокета
+						for(; (length < count) && (length < AWH_CHAIN_RECORDS) && (amount < static_cast <size_t> (max)); length++){
+							// Устанавливаем запись ограниченную оставшимся местом в буфере сокета
+							limited[length] = std::make_pair(records[length].first, std::min(records[length].second, static_cast <size_t> (max) - amount));
+							// Увеличиваем размер данных записей
+							amount += limited[length].second;
+						}
+						// Выполняем отправку сообщения
+						const int64_t bytes = broker->ectx.write(limited, length);
 						// Если данные удачно отправленны
 						if(bytes > 0){
 							// Запоминаем количество записанных байт
@@ -1804,18 +1908,9 @@ size_t awh::client::Core::write(const char * buffer, const size_t size, const ui
 							}
 						}
 						// Если данные удачно отправленны
-						if(bytes > 0){
-							// Если подключение производится через, прокси-сервер
-							if(shm->isProxy()){
-								// Если функция обратного вызова для вывода записи существует
-								if(this->_callback.is("writeProxy"))
-									// Выводим функцию обратного вызова
-									this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("writeProxy", buffer, static_cast <size_t> (bytes), bid, i->first);
-							// Если функция обратного вызова на запись данных установлена
-							} else if(this->_callback.is("write"))
-								// Выводим функцию обратного вызова
-								this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", buffer, static_cast <size_t> (bytes), bid, i->first);
-						}
+						if(bytes > 0)
+							// Выводим функцию обратного вызова записи данных
+							this->written((shm->isProxy() ? "writeProxy" : "write"), limited, length, static_cast <size_t> (bytes), bid, i->first);
 					}
 				// Если подключение завершено
 				} else {
@@ -153,6 +153,25 @@ std::set <pid_t> awh::cluster::Core::pids() const noexcept {
 	// Выполняем извлечение списка доступных идентификаторов процессов
 	return this->_cluster.pids(0);
 }
+/**
+ * @brief Метод получения количества активных подключений каждого дочернего процесса
+ *
+ * @return список количества подключений по идентификаторам процессов
+ */
+std::map <pid_t, size_t> awh::cluster::Core::connections() const noexcept {
+	// Выполняем извлечение количества подключений дочерних процессов
+	return this->_cluster.connections(0);
+}
+/**
+ * @brief Метод отправки родительскому процессу сведений о нагрузке
+ *
+ * @param connections количество активных подключений
+ * @param lag         задержка цикла событий (мкс)
+ */
+void awh::cluster::Core::load(const size_t connections, const uint32_t lag) noexcept {
+	// Выполняем отправку сведений о нагрузке
+	this->_cluster.load(0, connections, lag);
+}
 /**
  * @brief Метод размещения нового воркера
  *
@@ -435,6 +454,24 @@ void awh::cluster::Core::transfer(const cluster_t::transfer_t transfer) noexcept
 	// Выполняем установку режима передачи данных
 	this->_cluster.transfer(transfer);
 }
+/**
+ * @brief Метод установки размера кольцевого буфера разделяемой памяти
+ *
+ * @param size размер буфера одного направления в байтах
+ */
+void awh::cluster::Core::ringSize(const size_t size) noexcept {
+	// Выполняем установку размера кольцевого буфера
+	this->_cluster.ringSize(size);
+}
+/**
+ * @brief Метод установки политики поведения при переполнении кольцевого буфера
+ *
+ * @param overflow политика поведения при переполнении
+ */
+void awh::cluster::Core::overflow(const cmp::ring_t::overflow_t overflow) noexcept {
+	// Выполняем установку политики поведения при переполнении
+	this->_cluster.overflow(overflow);
+}
 /**
  * @brief Метод установки пропускной способности сети
  *
@@ -31,6 +31,14 @@ using namespace placeholders;
  * Объект глобальной базы событий
  */
 static awh::base_t * EventBase = nullptr;
+/**
+ * Объект отдельной базы событий потока
+ */
+static thread_local awh::base_t * LocalBase = nullptr;
+/**
+ * Флаг работы потока с отдельной базой событий
+ */
+static thread_local bool LocalIsolation = false;
 
 /**
  * @brief Метод отправки пинка
@@ -38,11 +46,11 @@ static awh::base_t * EventBase = nullptr;
  */
 void awh::Core::Dispatch::kick() noexcept {
 	// Если база событий проинициализированна
-	if(this->_init && (EventBase != nullptr)){
+	if(this->_init && ((* this->_base) != nullptr)){
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
 		// Выполняем остановку всех событий
-		EventBase->kick();
+		(* this->_base)->kick();
 	}
 }
 /**
@@ -51,13 +59,13 @@ void awh::Core::Dispatch::kick() noexcept {
  */
 void awh::Core::Dispatch::stop() noexcept {
 	// Если чтение базы событий уже началось
-	if(this->_work && this->_init && (EventBase != nullptr)){
+	if(this->_work && this->_init && ((* this->_base) != nullptr)){
 		// Снимаем флаг работы модуля
 		this->_work = !this->_work;
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
 		// Выполняем остановку базы событий
-		EventBase->stop();
+		(* this->_base)->stop();
 	// Если модуль не инициализирован
 	} else if(!this->_init) {
 		// Если функция обратного вызова установлена
@@ -72,7 +80,7 @@ void awh::Core::Dispatch::stop() noexcept {
  */
 void awh::Core::Dispatch::start() noexcept {
 	// Если чтение базы событий ещё не началось
-	if(!this->_work && this->_init && (EventBase != nullptr)){
+	if(!this->_work && this->_init && ((* this->_base) != nullptr)){
 		// Устанавливаем флаг работы модуля
 		this->_work = !this->_work;
 		// Если функция обратного вызова установлена
@@ -80,7 +88,7 @@ void awh::Core::Dispatch::start() noexcept {
 			// Выполняем запуск функции активации базы событий
 			this->_launching(true, true);
 		// Выполняем запуск базы событий
-		EventBase->start();
+		(* this->_base)->start();
 		// Если функция обратного вызова установлена
 		if(this->_closedown != nullptr)
 			// Выполняем остановку функции активации базы событий
@@ -111,11 +119,11 @@ void awh::Core::Dispatch::rebase() noexcept {
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
 			// Если база событий уже создана
-			if(EventBase != nullptr)
+			if((* this->_base) != nullptr)
 				// Выполняем пересоздание базы событий
-				EventBase->rebase();
+				(* this->_base)->rebase();
 			// Создаем новую базу событий
-			else EventBase = new base_t(this->_fmk, this->_log);
+			else (* this->_base) = new base_t(this->_fmk, this->_log);
 			// Выполняем разблокировку чтения данных
 			this->_init = !this->_virt;
 		/**
@@ -175,11 +183,11 @@ void awh::Core::Dispatch::reinit() noexcept {
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
 			// Если база событий уже создана
-			if(EventBase != nullptr)
+			if((* this->_base) != nullptr)
 				// Удаляем объект базы событий
-				delete EventBase;
+				delete (* this->_base);
 			// Создаем новую базу событий
-			EventBase = new base_t(this->_fmk, this->_log);
+			(* this->_base) = new base_t(this->_fmk, this->_log);
 			// Выполняем разблокировку чтения данных
 			this->_init = !this->_virt;
 		/**
@@ -228,11 +236,11 @@ void awh::Core::Dispatch::reinit() noexcept {
  */
 void awh::Core::Dispatch::freeze(const bool mode) noexcept {
 	// Если база событий проинициализированна
-	if(this->_init && (EventBase != nullptr)){
+	if(this->_init && ((* this->_base) != nullptr)){
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
 		// Выполняем фриз получения данных
-		EventBase->freeze(mode);
+		(* this->_base)->freeze(mode);
 	}
 }
 /**
@@ -242,13 +250,13 @@ void awh::Core::Dispatch::freeze(const bool mode) noexcept {
  */
 void awh::Core::Dispatch::easily(const bool mode) noexcept {
 	// Если база событий инициализированна
-	if(EventBase != nullptr){
+	if((* this->_base) != nullptr){
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
 		// Устанавливаем флаг активации простого чтения базы событий
-		EventBase->easily(mode);
+		(* this->_base)->easily(mode);
 		// Выполняем остановку всех событий
-		EventBase->kick();
+		(* this->_base)->kick();
 	}
 }
 /**
@@ -258,15 +266,33 @@ void awh::Core::Dispatch::easily(const bool mode) noexcept {
  */
 void awh::Core::Dispatch::rate(const uint8_t msec) noexcept {
 	// Если база событий проинициализированна
-	if(this->_init && (EventBase != nullptr)){
+	if(this->_init && ((* this->_base) != nullptr)){
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
 		// Устанавливаем частоту обновления базы событий
-		EventBase->rate(msec);
+		(* this->_base)->rate(msec);
 		// Выполняем остановку всех событий
-		EventBase->kick();
+		(* this->_base)->kick();
 	}
 }
+/**
+ * @brief Метод получения базы событий
+ *
+ * @return база событий с которой работает модуль
+ */
+awh::base_t * awh::Core::Dispatch::base() const noexcept {
+	// Выводим базу событий
+	return (* this->_base);
+}
+/**
+ * @brief Метод проверки работы с отдельной базой событий потока
+ *
+ * @return результат проверки
+ */
+bool awh::Core::Dispatch::isolated() const noexcept {
+	// Выводим результат проверки
+	return this->_isolated;
+}
 /**
  * @brief Метод установки функции обратного вызова
  *
@@ -297,10 +323,11 @@ void awh::Core::Dispatch::on(const status_t status, function <void (const bool,
  * @param log объект для работы с логами
  */
 awh::Core::Dispatch::Dispatch(const fmk_t * fmk, const log_t * log) noexcept :
- _pid(::getpid()), _work(false), _init(false), _virt(false),
+ _pid(::getpid()), _base(LocalIsolation ? &LocalBase : &EventBase),
+ _work(false), _init(false), _virt(false), _isolated(LocalIsolation),
  _launching(nullptr), _closedown(nullptr), _fmk(fmk), _log(log) {
 	// Если база событий ещё не проинициализированна
-	if(!(this->_virt = (EventBase != nullptr)))
+	if(!(this->_virt = ((* this->_base) != nullptr)))
 		// Выполняем инициализацию базы событий
 		this->reinit();
 }
@@ -312,11 +339,11 @@ awh::Core::Dispatch::~Dispatch() noexcept {
 	// Если база событий проинициализированна
 	if(this->_init){
 		// Если база событий не является виртуальной
-		if(!this->_virt && (EventBase != nullptr)){
+		if(!this->_virt && ((* this->_base) != nullptr)){
 			// Удаляем объект базы событий
-			delete EventBase;
-			// Зануляем глобальную базу событий
-			EventBase = nullptr;
+			delete (* this->_base);
+			// Зануляем базу событий
+			(* this->_base) = nullptr;
 		}
 	}
 }
@@ -556,7 +583,25 @@ bool awh::Core::working() const noexcept {
  */
 awh::base_t * awh::Core::base() noexcept {
 	// Выполняем получение базы событий
-	return EventBase;
+	return this->_dispatch.base();
+}
+/**
+ * @brief Метод проверки работы с отдельной базой событий потока
+ *
+ * @return результат проверки
+ */
+bool awh::Core::isolated() const noexcept {
+	// Выводим результат проверки
+	return this->_dispatch.isolated();
+}
+/**
+ * @brief Метод выделения отдельной базы событий для текущего потока
+ *
+ * @param mode флаг активации
+ */
+void awh::Core::isolation(const bool mode) noexcept {
+	// Устанавливаем флаг работы потока с отдельной базой событий
+	LocalIsolation = mode;
 }
 /**
  * @brief Метод активации простого режима чтения базы событий
@@ -647,9 +692,9 @@ void awh::Core::signalInterception(const scheme_t::mode_t mode) noexcept {
  */
 void awh::Core::upstream(const SOCKET sock, const uint64_t tid) noexcept {
 	// Если база событий инициализированна
-	if(EventBase != nullptr)
+	if(this->_dispatch.base() != nullptr)
 		// Выполняем отправку сообщения
-		EventBase->upstream(sock, tid);
+		this->_dispatch.base()->upstream(sock, tid);
 }
 /**
  * @brief Метод деактивации межпотокового передатчика
@@ -658,9 +703,9 @@ void awh::Core::upstream(const SOCKET sock, const uint64_t tid) noexcept {
  */
 void awh::Core::deactivationUpstream(const SOCKET sock) noexcept {
 	// Если база событий инициализированна
-	if(EventBase != nullptr)
+	if(this->_dispatch.base() != nullptr)
 		// Выполняем деактивации межпотокового передатчика
-		EventBase->deactivationUpstream(sock);
+		this->_dispatch.base()->deactivationUpstream(sock);
 }
 /**
  * @brief Метод активации межпотокового передатчика
@@ -670,9 +715,9 @@ void awh::Core::deactivationUpstream(const SOCKET sock) noexcept {
  */
 SOCKET awh::Core::activationUpstream(function <void (const uint64_t)> callback) noexcept {
 	// Если база событий инициализированна
-	if(EventBase != nullptr)
+	if(this->_dispatch.base() != nullptr)
 		// Выполняем активации межпотокового передатчика
-		return EventBase->activationUpstream(callback);
+		return this->_dispatch.base()->activationUpstream(callback);
 	// Выводим значение по умолчанию
 	return INVALID_SOCKET;
 }
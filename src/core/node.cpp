@@ -22,6 +22,15 @@
  */
 using namespace std;
 
+/**
+ * Количество арендованных буферов чтения текущего потока
+ */
+static thread_local size_t LocalLeases = 0;
+/**
+ * Пул буферов чтения текущего потока (размер буфера и его данные)
+ */
+static thread_local vector <pair <size_t, unique_ptr <char []>>> LocalReaders;
+
 /**
  * @brief Оператор [=] перемещения SSL-параметров
  *
@@ -31,6 +40,14 @@ using namespace std;
 awh::Node::SSL & awh::Node::SSL::operator = (ssl_t && ssl) noexcept {
 	// Выполняем копирование флага валидации доменного имени
 	this->verify = ssl.verify;
+	// Выполняем копирование флага шифрования на уровне ядра
+	this->ktls = ssl.ktls;
+	// Выполняем копирование времени жизни сессии TLS
+	this->lifetime = ssl.lifetime;
+	// Выполняем копирование минимальной версии протокола TLS
+	this->minVersion = ssl.minVersion;
+	// Выполняем копирование максимальной версии протокола TLS
+	this->maxVersion = ssl.maxVersion;
 	// Выполняем перемещение ключа SSL-сертификата
 	this->key = ::move(ssl.key);
 	// Выполняем перемещение SSL-сертификата
@@ -55,6 +72,14 @@ awh::Node::SSL & awh::Node::SSL::operator = (ssl_t && ssl) noexcept {
 awh::Node::SSL & awh::Node::SSL::operator = (const ssl_t & ssl) noexcept {
 	// Выполняем копирование флага валидации доменного имени
 	this->verify = ssl.verify;
+	// Выполняем копирование флага шифрования на уровне ядра
+	this->ktls = ssl.ktls;
+	// Выполняем копирование времени жизни сессии TLS
+	this->lifetime = ssl.lifetime;
+	// Выполняем копирование минимальной версии протокола TLS
+	this->minVersion = ssl.minVersion;
+	// Выполняем копирование максимальной версии протокола TLS
+	this->maxVersion = ssl.maxVersion;
 	// Выполняем копирование ключа SSL-сертификата
 	this->key = ssl.key;
 	// Выполняем копирование SSL-сертификата
@@ -80,6 +105,10 @@ bool awh::Node::SSL::operator == (const ssl_t & ssl) noexcept {
 	// Выполняем сравнения двух объектов SSL-параметров
 	bool result = (
 		(this->verify == ssl.verify) &&
+		(this->ktls == ssl.ktls) &&
+		(this->lifetime == ssl.lifetime) &&
+		(this->minVersion == ssl.minVersion) &&
+		(this->maxVersion == ssl.maxVersion) &&
 		(this->key.compare(ssl.key) == 0) &&
 		(this->cert.compare(ssl.cert) == 0) &&
 		(this->ca.compare(ssl.ca) == 0) &&
@@ -112,6 +141,14 @@ bool awh::Node::SSL::operator == (const ssl_t & ssl) noexcept {
 awh::Node::SSL::SSL(ssl_t && ssl) noexcept {
 	// Выполняем копирование флага валидации доменного имени
 	this->verify = ssl.verify;
+	// Выполняем копирование флага шифрования на уровне ядра
+	this->ktls = ssl.ktls;
+	// Выполняем копирование времени жизни сессии TLS
+	this->lifetime = ssl.lifetime;
+	// Выполняем копирование минимальной версии протокола TLS
+	this->minVersion = ssl.minVersion;
+	// Выполняем копирование максимальной версии протокола TLS
+	this->maxVersion = ssl.maxVersion;
 	// Выполняем перемещение ключа SSL-сертификата
 	this->key = ::move(ssl.key);
 	// Выполняем перемещение SSL-сертификата
@@ -133,6 +170,14 @@ awh::Node::SSL::SSL(ssl_t && ssl) noexcept {
 awh::Node::SSL::SSL(const ssl_t & ssl) noexcept {
 	// Выполняем копирование флага валидации доменного имени
 	this->verify = ssl.verify;
+	// Выполняем копирование флага шифрования на уровне ядра
+	this->ktls = ssl.ktls;
+	// Выполняем копирование времени жизни сессии TLS
+	this->lifetime = ssl.lifetime;
+	// Выполняем копирование минимальной версии протокола TLS
+	this->minVersion = ssl.minVersion;
+	// Выполняем копирование максимальной версии протокола TLS
+	this->maxVersion = ssl.maxVersion;
 	// Выполняем копирование ключа SSL-сертификата
 	this->key = ssl.key;
 	// Выполняем копирование SSL-сертификата
@@ -150,7 +195,9 @@ awh::Node::SSL::SSL(const ssl_t & ssl) noexcept {
  * @brief Конструктор
  *
  */
-awh::Node::SSL::SSL() noexcept : verify(true), key{""}, cert{""}, ca{""}, crl{""}, capath{""} {}
+awh::Node::SSL::SSL() noexcept :
+ verify(true), ktls(false), lifetime(TLS_SESSION_LIFETIME),
+ minVersion(TLS1_2_VERSION), maxVersion(TLS1_3_VERSION), key{""}, cert{""}, ca{""}, crl{""}, capath{""} {}
 /**
  * @brief Метод удаления всех схем сети
  *
@@ -276,6 +323,86 @@ uint16_t awh::Node::sid(const uint64_t bid) const noexcept {
 	// Выводим пустой результат
 	return 0;
 }
+/**
+ * @brief Метод получения арендованного буфера
+ *
+ * @param size минимальный размер буфера
+ * @return     арендованный буфер чтения
+ */
+char * awh::Node::Lease::get(const size_t size) noexcept {
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Если буферов в пуле потока не достаточно
+		if(LocalReaders.size() <= this->_index)
+			// Добавляем пустые буферы в пул потока
+			LocalReaders.resize(this->_index + 1);
+		// Получаем буфер из пула потока
+		auto & reader = LocalReaders.at(this->_index);
+		// Если размер буфера меньше необходимого
+		if(reader.first < size){
+			// Выполняем создание буфера данных
+			reader.second = unique_ptr <char []> (new char [size]);
+			// Устанавливаем размер буфера данных
+			reader.first = size;
+		}
+		// Выводим арендованный буфер
+		return reader.second.get();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const bad_alloc &) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(size), log_t::flag_t::CRITICAL, "Memory allocation error");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+		#endif
+		// Выходим из приложения
+		::exit(EXIT_FAILURE);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(size), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим пустое значение
+	return nullptr;
+}
+/**
+ * @brief Конструктор
+ *
+ * @param log объект для работы с логами
+ */
+awh::Node::Lease::Lease(const log_t * log) noexcept : _index(LocalLeases++), _log(log) {}
+/**
+ * @brief Деструктор
+ *
+ */
+awh::Node::Lease::~Lease() noexcept {
+	// Возвращаем буфер в пул потока
+	LocalLeases--;
+}
 /**
  * @brief Метод инициализации буфера полезной нагрузки
  *
@@ -305,8 +432,10 @@ void awh::Node::initBuffer(const uint64_t bid) noexcept {
 				try {
 					// Устанавливаем размер буфера данных
 					broker->buffer.size = size;
-					// Выполняем создание буфера данных
-					broker->buffer.data = std::unique_ptr <char []> (new char [size]);
+					// Если брокеру необходим собственный буфер, иначе чтение выполняется в буфер потока
+					if(broker->buffer.retain)
+						// Выполняем создание буфера данных
+						broker->buffer.data = std::unique_ptr <char []> (new char [size]);
 				/**
 				 * Если возникает ошибка
 				 */
@@ -350,6 +479,27 @@ void awh::Node::initBuffer(const uint64_t bid) noexcept {
 		}
 	}
 }
+/**
+ * @brief Метод завершения чтения в буфер полезной нагрузки с применением отложенной переинициализации
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::Node::releaseBuffer(const uint64_t bid) noexcept {
+	// Если идентификатор брокера подключений существует
+	if((bid > 0) && this->has(bid)){
+		// Создаём бъект активного брокера подключения
+		awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (this->broker(bid));
+		// Снимаем флаг выполнения чтения
+		broker->buffer.reading = false;
+		// Если переинициализация буфера была отложена
+		if(broker->buffer.deferred){
+			// Снимаем флаг отложенной переинициализации
+			broker->buffer.deferred = false;
+			// Выполняем переинициализацию буфера полезной нагрузки
+			this->initBuffer(bid);
+		}
+	}
+}
 /**
  * @brief Метод освобождение памяти занятой для хранение полезной нагрузки брокера
  *
@@ -392,6 +542,71 @@ void awh::Node::erase(const uint64_t bid, const size_t size) noexcept {
 	if(this->_callback.is("available"))
 		// Выполняем функцию обратного вызова сообщая об освобождении памяти
 		this->_callback.call <void (const uint64_t, const size_t)> ("available", bid, (this->_brokerAvailableSize < amount) ? 0 : std::min(this->_brokerAvailableSize - amount, this->_memoryAvailableSize));
+	// Если функция обратного вызова установлена
+	if(this->_callback.is("drain"))
+		// Выполняем функцию обратного вызова сообщая о количестве байт оставшихся в очереди отправки
+		this->_callback.call <void (const uint64_t, const size_t)> ("drain", bid, amount);
+}
+/**
+ * @brief Метод вывода функции обратного вызова записи данных в сокет (один вызов на операцию записи)
+ *
+ * @param name    название функции обратного вызова
+ * @param records список записанных записей данных
+ * @param count   количество записей в списке
+ * @param bytes   количество отправленных байт
+ * @param bid     идентификатор брокера
+ * @param sid     идентификатор схемы сети
+ */
+void awh::Node::written(const char * name, const chain_t::record_t * records, const size_t count, const size_t bytes, const uint64_t bid, const uint16_t sid) noexcept {
+	// Если данные отправлены и функция обратного вызова установлена
+	if((records != nullptr) && (count > 0) && (bytes > 0) && this->_callback.is(name)){
+		// Если все отправленные данные находятся в первой записи
+		if(records[0].second >= bytes)
+			// Выводим функцию обратного вызова
+			this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> (name, reinterpret_cast <const char *> (records[0].first), bytes, bid, sid);
+		// Если данные отправлены из нескольких записей
+		else {
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				// Буфер сборки принадлежит вызову, так как функция обратного вызова может повторно выполнить отправку
+				vector <char> buffer;
+				// Выделяем память для отправленных данных
+				buffer.reserve(bytes);
+				/**
+				 * Выполняем сборку всех отправленных записей в один буфер
+				 */
+				for(size_t i = 0; (i < count) && (buffer.size() < bytes); i++){
+					// Получаем данные записи
+					const char * data = reinterpret_cast <const char *> (records[i].first);
+					// Добавляем отправленную часть записи в буфер
+					buffer.insert(buffer.end(), data, data + std::min(records[i].second, bytes - buffer.size()));
+				}
+				// Выводим функцию обратного вызова
+				this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> (name, buffer.data(), buffer.size(), bid, sid);
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const bad_alloc &) {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(name, count, bytes, bid, sid), log_t::flag_t::CRITICAL, "Memory allocation error");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+				#endif
+				// Выходим из приложения
+				::exit(EXIT_FAILURE);
+			}
+		}
+	}
 }
 /**
  * @brief Метод извлечения брокера подключения
@@ -442,6 +657,12 @@ void awh::Node::ssl(const ssl_t & ssl) noexcept {
 	const lock_guard <std::recursive_mutex> lock(this->_mtx.main);
 	// Выполняем установку флага проверки домена
 	this->_engine.verify(ssl.verify);
+	// Выполняем установку флага шифрования на уровне ядра
+	this->_engine.ktls(ssl.ktls);
+	// Выполняем установку времени жизни сессии TLS
+	this->_engine.lifetime(ssl.lifetime);
+	// Выполняем установку допустимых версий протокола TLS
+	this->_engine.version(ssl.minVersion, ssl.maxVersion);
 	// Выполняем установку алгоритмов шифрования
 	this->_engine.ciphers(ssl.ciphers);
 	// Устанавливаем адрес CRL-файла
@@ -451,6 +672,15 @@ void awh::Node::ssl(const ssl_t & ssl) noexcept {
 	// Устанавливаем файлы сертификата
 	this->_engine.certificate(ssl.cert, ssl.key);
 }
+/**
+ * @brief Метод получения статистики возобновления сессий TLS
+ *
+ * @return статистика возобновления сессий (общая для всех процессов кластера)
+ */
+awh::engine_t::resumption_t awh::Node::resumption() const noexcept {
+	// Выводим статистику возобновления сессий TLS
+	return this->_engine.resumption();
+}
 /**
  * @brief Метод установки объекта DNS-резолвера
  *
@@ -560,6 +790,25 @@ awh::engine_t::proto_t awh::Node::proto(const uint64_t bid) const noexcept {
 	// Выводим результат
 	return engine_t::proto_t::NONE;
 }
+/**
+ * @brief Метод проверки активации шифрования на уровне ядра (kTLS)
+ *
+ * @param bid идентификатор брокера
+ * @return    результат проверки (запись данных выполняется ядром)
+ */
+bool awh::Node::ktls(const uint64_t bid) const noexcept {
+	// Если данные переданы верные
+	if(bid > 0){
+		// Выполняем поиск брокера подключения
+		auto i = this->_brokers.find(bid);
+		// Если брокер подключения найден
+		if(i != this->_brokers.end())
+			// Выполняем проверку активации шифрования на уровне ядра
+			return this->_engine.ktls(i->second->ectx);
+	}
+	// Выводим результат
+	return false;
+}
 /**
  * @brief Метод установки поддерживаемого протокола подключения
  *
@@ -773,6 +1022,29 @@ bool awh::Node::nodelay(const uint64_t bid, const engine_t::mode_t mode) noexcep
 	// Сообщаем, что ничего не установлено
 	return false;
 }
+/**
+ * @brief Метод включения/отключения собственного буфера чтения брокера
+ *
+ * @param bid  идентификатор брокера
+ * @param mode режим применимой операции
+ */
+void awh::Node::retain(const uint64_t bid, const engine_t::mode_t mode) noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx.main);
+	// Если идентификатор брокера подключений существует
+	if((bid > 0) && this->has(bid)){
+		// Создаём бъект активного брокера подключения
+		awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (this->broker(bid));
+		// Устанавливаем флаг собственного буфера брокера
+		broker->buffer.retain = (mode == engine_t::mode_t::ENABLED);
+		// Если выполняется чтение, буфер переданный в функцию обратного вызова ещё используется
+		if(broker->buffer.reading)
+			// Откладываем переинициализацию буфера до завершения чтения
+			broker->buffer.deferred = true;
+		// Выполняем переинициализацию буфера полезной нагрузки
+		else this->initBuffer(bid);
+	}
+}
 /**
  * @brief Метод асинхронной отправки буфера данных в сокет
  *
@@ -782,6 +1054,19 @@ bool awh::Node::nodelay(const uint64_t bid, const engine_t::mode_t mode) noexcep
  * @return       результат отправки сообщения
  */
 bool awh::Node::send(const char * buffer, const size_t size, const uint64_t bid) noexcept {
+	// Выполняем отправку буфера данных с копированием
+	return this->send(buffer, size, nullptr, bid);
+}
+/**
+ * @brief Метод асинхронной отправки буфера данных в сокет без копирования
+ *
+ * @param buffer буфер для записи данных
+ * @param size   размер записываемых данных
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ * @param bid    идентификатор брокера
+ * @return       результат отправки сообщения
+ */
+bool awh::Node::send(const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const uint64_t bid) noexcept {
 	// Результат работы функции
 	bool result = false;
 	/**
@@ -808,14 +1093,14 @@ bool awh::Node::send(const char * buffer, const size_t size, const uint64_t bid)
 				auto i = this->_payloads.find(bid);
 				// Если для потока очередь полезной нагрузки получена
 				if(i != this->_payloads.end())
-					// Выполняем добавление полезной нагрузки
-					i->second->push(buffer, size);
+					// Выполняем добавление полезной нагрузки (по ссылке, если передан владелец буфера)
+					i->second->push(buffer, size, owner);
 				// Если для потока почередь полезной нагрузки ещё не сформированна
 				else {
 					// Создаём новую очередь полезной нагрузки
-					auto ret = this->_payloads.emplace(bid, std::make_unique <buffer_t> (this->_log));
-					// Выполняем добавление полезной нагрузки
-					ret.first->second->push(buffer, size);
+					auto ret = this->_payloads.emplace(bid, std::make_unique <chain_t> (this->_log));
+					// Выполняем добавление полезной нагрузки (по ссылке, если передан владелец буфера)
+					ret.first->second->push(buffer, size, owner);
 				}
 				// Выполняем блокировку потока
 				this->_mtx.main.lock();
@@ -0,0 +1,350 @@
+/**
+ * @file: reactor.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <core/reactor.hpp>
+
+/**
+ * Подписываемся на стандартное пространство имён
+ */
+using namespace std;
+
+/**
+ * Объект многопоточного запуска которому принадлежит текущий поток
+ */
+static thread_local const awh::Reactor * LocalReactor = nullptr;
+/**
+ * Индекс цикла базы событий текущего потока
+ */
+static thread_local int32_t LocalLoop = -1;
+
+/**
+ * @brief Метод выполнения задач цикла
+ *
+ * @param index индекс цикла базы событий
+ */
+void awh::Reactor::process(const uint16_t index) noexcept {
+	/**
+	 * Выполняем перехват ошибок
+	 */
+	try {
+		// Список задач для выполнения
+		vector <function <void (void)>> tasks;
+		// Получаем объект цикла
+		loop_t * loop = this->_loops.at(index).get();
+		// Выполняем блокировку очереди задач
+		loop->mtx.lock();
+		// Забираем все накопленные задачи
+		tasks.swap(loop->tasks);
+		// Выполняем разблокировку очереди задач
+		loop->mtx.unlock();
+		// Выполняем перебор всех задач
+		for(auto & task : tasks){
+			// Если задача установлена
+			if(task != nullptr)
+				// Выполняем задачу
+				std::apply(task, std::make_tuple());
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(index), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод работы потока цикла
+ *
+ * @param index    индекс цикла базы событий
+ * @param callback функция обратного вызова запуска сетевых ядер цикла
+ */
+void awh::Reactor::run(const uint16_t index, function <void (const uint16_t)> callback) noexcept {
+	/**
+	 * Выполняем перехват ошибок
+	 */
+	try {
+		// Получаем объект цикла
+		loop_t * loop = this->_loops.at(index).get();
+		// Запоминаем принадлежность потока
+		LocalReactor = this;
+		// Запоминаем индекс цикла потока
+		LocalLoop = static_cast <int32_t> (index);
+		// Выделяем отдельную базу событий для потока
+		core_t::isolation(true);
+		// Создаём сетевое ядро, которое владеет базой событий потока
+		loop->core = std::make_unique <core_t> (this->_fmk, this->_log);
+		// Активируем межпотоковый передатчик для получения задач
+		const SOCKET sock = loop->core->activationUpstream([this, index](const uint64_t){
+			// Выполняем задачи цикла
+			this->process(index);
+		});
+		// Выполняем блокировку очереди задач
+		loop->mtx.lock();
+		// Устанавливаем сокет межпотокового передатчика
+		loop->sock = sock;
+		// Выполняем разблокировку очереди задач
+		loop->mtx.unlock();
+		// Выполняем задачи поставленные до запуска цикла
+		this->process(index);
+		// Если функция обратного вызова установлена
+		if(callback != nullptr)
+			// Выполняем создание и запуск сетевых ядер цикла
+			std::apply(callback, std::make_tuple(index));
+		// Выполняем блокировку очереди задач
+		loop->mtx.lock();
+		// Сбрасываем сокет межпотокового передатчика
+		loop->sock = INVALID_SOCKET;
+		// Выполняем очистку оставшихся задач
+		loop->tasks.clear();
+		// Выполняем разблокировку очереди задач
+		loop->mtx.unlock();
+		// Удаляем сетевое ядро вместе с базой событий потока
+		loop->core.reset();
+		// Возвращаем потоку общую базу событий
+		core_t::isolation(false);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const bad_alloc &) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(index), log_t::flag_t::CRITICAL, "Memory allocation error");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+		#endif
+		// Выходим из приложения
+		::exit(EXIT_FAILURE);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(index), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод получения количества циклов
+ *
+ * @return количество циклов баз событий
+ */
+uint16_t awh::Reactor::size() const noexcept {
+	// Выводим количество циклов
+	return static_cast <uint16_t> (this->_loops.size());
+}
+/**
+ * @brief Метод получения индекса цикла текущего потока
+ *
+ * @return индекс цикла или -1, если поток не принадлежит циклам
+ */
+int32_t awh::Reactor::index() const noexcept {
+	// Выводим индекс цикла, если поток принадлежит текущему объекту
+	return (LocalReactor == this ? LocalLoop : -1);
+}
+/**
+ * @brief Метод передачи задачи на выполнение в поток цикла
+ *
+ * @param index индекс цикла базы событий
+ * @param task  задача для выполнения
+ * @return      результат постановки задачи
+ */
+bool awh::Reactor::post(const uint16_t index, function <void (void)> task) noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Если задача передана и цикл существует
+	if((task != nullptr) && (index < this->_loops.size())){
+		/**
+		 * Выполняем перехват ошибок
+		 */
+		try {
+			// Если задача адресована циклу текущего потока
+			if(this->index() == static_cast <int32_t> (index)){
+				// Выполняем задачу сразу, так как мы уже находимся в потоке цикла
+				std::apply(task, std::make_tuple());
+				// Задача выполнена
+				return true;
+			}
+			// Получаем объект цикла
+			loop_t * loop = this->_loops.at(index).get();
+			// Выполняем блокировку очереди задач
+			const lock_guard <std::mutex> lock(loop->mtx);
+			// Добавляем задачу в очередь цикла
+			loop->tasks.push_back(::move(task));
+			// Если межпотоковый передатчик цикла активирован
+			if((result = true) && (loop->sock != INVALID_SOCKET) && (loop->core != nullptr))
+				// Выполняем пробуждение цикла
+				loop->core->upstream(loop->sock, 0);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(index), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод передачи задачи на выполнение во все циклы
+ *
+ * @param task задача для выполнения
+ */
+void awh::Reactor::broadcast(function <void (void)> task) noexcept {
+	// Выполняем перебор всех циклов
+	for(uint16_t i = 0; i < this->size(); i++)
+		// Выполняем передачу задачи циклу
+		this->post(i, task);
+}
+/**
+ * @brief Метод остановки всех циклов
+ *
+ */
+void awh::Reactor::stop() noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем перебор всех циклов
+	for(uint16_t i = 0; i < this->size(); i++){
+		// Получаем объект цикла
+		loop_t * loop = this->_loops.at(i).get();
+		// Выполняем остановку базы событий в потоке цикла
+		this->post(i, [loop]{
+			// Если сетевое ядро цикла существует
+			if((loop->core != nullptr) && (loop->core->base() != nullptr))
+				// Выполняем остановку базы событий цикла
+				loop->core->base()->stop();
+		});
+	}
+}
+/**
+ * @brief Метод запуска циклов баз событий (блокирует поток до остановки всех циклов)
+ *
+ * @param count    количество циклов (0 - по количеству ядер процессора)
+ * @param callback функция создания и запуска сетевых ядер цикла, вызывается в потоке цикла
+ */
+void awh::Reactor::start(const uint16_t count, function <void (const uint16_t)> callback) noexcept {
+	/**
+	 * Выполняем перехват ошибок
+	 */
+	try {
+		// Выполняем блокировку потока
+		this->_mtx.lock();
+		// Если циклы уже запущены
+		if(!this->_loops.empty()){
+			// Выполняем разблокировку потока
+			this->_mtx.unlock();
+			// Выводим сообщение об ошибке
+			this->_log->print("Reactor is already running", log_t::flag_t::WARNING);
+			// Выходим из функции
+			return;
+		}
+		// Получаем количество циклов
+		const uint16_t size = (count > 0 ? count : static_cast <uint16_t> (std::max(1u, std::thread::hardware_concurrency())));
+		// Выполняем создание всех циклов
+		for(uint16_t i = 0; i < size; i++)
+			// Добавляем новый цикл
+			this->_loops.push_back(std::make_unique <loop_t> ());
+		// Выполняем запуск потоков всех циклов
+		for(uint16_t i = 0; i < size; i++)
+			// Запускаем поток цикла
+			this->_loops.at(i)->thread = std::thread(&reactor_t::run, this, i, callback);
+		// Выполняем разблокировку потока
+		this->_mtx.unlock();
+		// Выполняем перебор всех циклов
+		for(auto & loop : this->_loops){
+			// Если поток цикла ещё работает
+			if(loop->thread.joinable())
+				// Ожидаем завершения потока цикла
+				loop->thread.join();
+		}
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Выполняем очистку списка циклов
+		this->_loops.clear();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(count), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Деструктор
+ *
+ */
+awh::Reactor::~Reactor() noexcept {
+	// Выполняем остановку всех циклов
+	this->stop();
+	// Выполняем перебор всех циклов
+	for(auto & loop : this->_loops){
+		// Если поток цикла ещё работает
+		if(loop->thread.joinable())
+			// Ожидаем завершения потока цикла
+			loop->thread.join();
+	}
+}
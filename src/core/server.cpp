@@ -34,6 +34,17 @@ using namespace placeholders;
  * @param sid  идентификатор схемы сети
  */
 void awh::server::Core::accept(const SOCKET sock, const uint16_t sid) noexcept {
+	// Выполняем приём подключения со слушающего сокета
+	this->accept(sock, sid, INVALID_SOCKET);
+}
+/**
+ * @brief Метод вызова при подключении к серверу
+ *
+ * @param sock сетевой сокет подключившегося клиента
+ * @param sid  идентификатор схемы сети
+ * @param fd   файловый дескриптор уже принятого подключения
+ */
+void awh::server::Core::accept(const SOCKET sock, const uint16_t sid, const SOCKET fd) noexcept {
 	// Если идентификатор схемы сети передан
 	if((sid > 0) && (sock != INVALID_SOCKET)){
 		// Выполняем поиск идентификатора схемы сети
@@ -231,6 +242,15 @@ void awh::server::Core::accept(const SOCKET sock, const uint16_t sid) noexcept {
 					try {
 						// Если количество подключившихся клиентов, больше максимально-допустимого количества клиентов
 						if(shm->_brokers.size() >= static_cast <size_t> (shm->_total)){
+							/**
+							 * Для операционной системы не являющейся MS Windows
+							 */
+							#if !_WIN32 && !_WIN64
+								// Если подключение было принято родительским процессом
+								if(fd != INVALID_SOCKET)
+									// Закрываем переданное подключение
+									::close(fd);
+							#endif
 							// Выводим в консоль информацию
 							this->_log->print("Number of simultaneous connections, cannot exceed maximum allowed number of %d", log_t::flag_t::WARNING, shm->_total);
 							// Если функция обратного вызова установлена
@@ -271,8 +291,8 @@ void awh::server::Core::accept(const SOCKET sock, const uint16_t sid) noexcept {
 								// Устанавливаем параметры сокета
 								broker->addr.sonet(SOCK_STREAM, IPPROTO_TCP);
 						}
-						// Выполняем разрешение подключения
-						if(broker->addr.accept(shm->_addr)){
+						// Выполняем разрешение подключения или принимаем подключение переданное родительским процессом
+						if((fd != INVALID_SOCKET) ? broker->addr.adopt(fd) : broker->addr.accept(shm->_addr)){
 							// Если MAC или IP-адрес не получен, тогда выходим
 							if(broker->addr.mac.empty() || broker->addr.ip.empty()){
 								// Выполняем очистку контекста двигателя
@@ -964,6 +984,90 @@ void awh::server::Core::accept(const uint16_t sid, const uint64_t bid) noexcept
 		}
 	}
 }
+/**
+ * @brief Метод приёма подключения родительским процессом и передачи его дочернему процессу
+ *
+ * @param sock сетевой сокет сервера
+ * @param sid  идентификатор схемы сети
+ */
+void awh::server::Core::distribute(const SOCKET sock, const uint16_t sid) noexcept {
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Если идентификатор схемы сети передан
+		if((sid > 0) && (sock != INVALID_SOCKET)){
+			// Файловый дескриптор принятого подключения
+			SOCKET fd = INVALID_SOCKET;
+			/**
+			 * Выполняем приём всех ожидающих подключений
+			 */
+			while((fd = ::accept(sock, nullptr, nullptr)) != INVALID_SOCKET){
+				// Получаем идентификатор наименее загруженного дочернего процесса
+				const pid_t pid = this->_cluster.least(sid);
+				// Если подключение не удалось передать дочернему процессу
+				if((pid == 0) || !this->_cluster.handoff(sid, pid, fd)){
+					// Закрываем принятое подключение
+					::close(fd);
+					// Выводим сообщение об ошибке
+					this->_log->print("Connection could not be handed off to child process, PID=%d", log_t::flag_t::WARNING, ::getpid());
+					// Если функция обратного вызова установлена
+					if(this->_callback.is("error"))
+						// Выполняем функцию обратного вызова
+						this->_callback.call <void (const log_t::flag_t, const error_t, const string &)> ("error", log_t::flag_t::WARNING, error_t::ACCEPT, this->_fmk->format("Connection could not be handed off to child process, PID=%d", ::getpid()));
+				}
+			}
+		}
+	#endif
+}
+/**
+ * @brief Метод создания собственного слушающего сокета дочернего процесса
+ *
+ * @param sid идентификатор схемы сети
+ * @return    результат создания слушающего сокета
+ */
+bool awh::server::Core::listen(const uint16_t sid) noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Выполняем поиск идентификатора схемы сети
+	auto i = this->_schemes.find(sid);
+	// Если идентификатор схемы сети найден
+	if(i != this->_schemes.end()){
+		// Получаем объект схемы сети
+		scheme_t * shm = dynamic_cast <scheme_t *> (const_cast <awh::scheme_t *> (i->second));
+		/**
+		 * Для операционной системы не являющейся MS Windows
+		 */
+		#if !_WIN32 && !_WIN64
+			// Если унаследованный от родительского процесса слушающий сокет открыт
+			if(shm->_addr.sock != INVALID_SOCKET){
+				// Закрываем унаследованный сокет без отключения, так-как он разделяется с другими процессами
+				::close(shm->_addr.sock);
+				// Выполняем сброс слушающего сокета
+				shm->_addr.sock = INVALID_SOCKET;
+			}
+		#endif
+		// Очищаем список сетевых адресов, он будет заполнен повторно
+		shm->_addr.network.clear();
+		// Выполняем создание собственного слушающего сокета процесса
+		if((result = this->create(sid))){
+			// Если необходимо распределять подключения по ядрам процессора
+			if(this->_clusterSteering)
+				// Выполняем установку программы распределения подключений
+				this->_socket.steering(shm->_addr.sock, this->_cluster.count(sid));
+		// Если слушающий сокет не создан
+		} else {
+			// Выводим сообщение об ошибке
+			this->_log->print("Listening socket could not be created, PID=%d", log_t::flag_t::CRITICAL, ::getpid());
+			// Если функция обратного вызова установлена
+			if(this->_callback.is("error"))
+				// Выполняем функцию обратного вызова
+				this->_callback.call <void (const log_t::flag_t, const error_t, const string &)> ("error", log_t::flag_t::CRITICAL, error_t::START, this->_fmk->format("Listening socket could not be created, PID=%d", ::getpid()));
+		}
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод вызова при активации базы событий
  *
@@ -1227,6 +1331,91 @@ void awh::server::Core::clusterEventsCallback(const uint16_t sid, const pid_t pi
 								// Выполняем заполнение списка доступных воркеров
 								this->_workers.emplace(sid, worker);
 						}
+						/**
+						 * Определяем режим распределения подключений
+						 */
+						switch(static_cast <uint8_t> (this->clusterDistribution())){
+							// Если каждый процесс принимает подключения со своего слушающего сокета
+							case static_cast <uint8_t> (cluster_t::distribution_t::REUSEPORT): {
+								/**
+								 * Для операционной системы не являющейся MS Windows
+								 */
+								#if !_WIN32 && !_WIN64
+									// Если слушающий сокет родительского процесса открыт
+									if(shm->_addr.sock != INVALID_SOCKET){
+										// Закрываем слушающий сокет, иначе ядро будет направлять в него часть подключений
+										::close(shm->_addr.sock);
+										// Выполняем сброс слушающего сокета
+										shm->_addr.sock = INVALID_SOCKET;
+									}
+								#endif
+							} break;
+							// Если подключения принимаются родительским процессом
+							case static_cast <uint8_t> (cluster_t::distribution_t::MASTER): {
+								/**
+								 * Выполняем отлов ошибок
+								 */
+								try {
+									// Выполняем поиск брокера в списке активных брокеров
+									auto i = this->_brokers.find(sid);
+									// Если брокер не существует
+									if(i == this->_brokers.end()){
+										// Выполняем блокировку потока
+										this->_mtx.accept.lock();
+										// Выполняем создание брокера подключения
+										i = this->_brokers.emplace(sid, std::make_unique <awh::scheme_t::broker_t> (sid, this->_fmk, this->_log)).first;
+										// Выполняем блокировку потока
+										this->_mtx.accept.unlock();
+										// Выполняем установку функции обратного вызова на получении сообщений
+										i->second->on <void (const uint64_t)> ("read", &core_t::distribute, this, shm->_addr.sock, sid);
+									}
+									// Устанавливаем активный сокет сервера
+									i->second->addr.sock = shm->_addr.sock;
+									// Выполняем установку базы событий
+									i->second->base(this->base());
+									// Выполняем запуск работы события
+									i->second->start();
+									// Активируем получение данных с клиента
+									i->second->events(awh::scheme_t::mode_t::ENABLED, engine_t::method_t::READ);
+							/**
+							 * Если возникает ошибка
+							 */
+							} catch(const bad_alloc &) {
+								/**
+								 * Если включён режим отладки
+								 */
+								#if DEBUG_MODE
+									// Выводим сообщение об ошибке
+									this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sid, pid, static_cast <uint16_t> (event)), log_t::flag_t::CRITICAL, "Memory allocation error");
+								/**
+								* Если режим отладки не включён
+								*/
+								#else
+									// Выводим сообщение об ошибке
+									this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+								#endif
+								// Выходим из приложения
+								::exit(EXIT_FAILURE);
+							/**
+							 * Если возникает ошибка
+							 */
+							} catch(const exception & error) {
+								/**
+								 * Если включён режим отладки
+								 */
+								#if DEBUG_MODE
+									// Выводим сообщение об ошибке
+									this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sid, pid, static_cast <uint16_t> (event)), log_t::flag_t::CRITICAL, error.what());
+								/**
+								* Если режим отладки не включён
+								*/
+								#else
+									// Выводим сообщение об ошибке
+									this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+								#endif
+							}
+							} break;
+						}
 					} break;
 					// Если процесс является дочерним
 					case static_cast <uint8_t> (cluster_t::family_t::CHILDREN): {
@@ -1241,6 +1430,76 @@ void awh::server::Core::clusterEventsCallback(const uint16_t sid, const pid_t pi
 							break;
 							// Для всех остальных типов сокетов
 							default: {
+								// Получаем режим распределения подключений
+								const cluster_t::distribution_t distribution = this->clusterDistribution();
+								// Если подключения принимаются родительским процессом
+								if(distribution == cluster_t::distribution_t::MASTER){
+									/**
+									 * Выполняем отлов ошибок
+									 */
+									try {
+										// Если таймер не инициализирован
+										if(this->_timer == nullptr){
+											// Выполняем блокировку потока
+											const lock_guard <std::recursive_mutex> lock1(this->_mtx.receive);
+											// Выполняем блокировку потока
+											const lock_guard <std::recursive_mutex> lock2(this->_mtx.timeout);
+											// Выполняем инициализацию нового таймера
+											this->_timer = std::make_unique <timer_t> (this->_fmk, this->_log);
+											// Устанавливаем флаг запрещающий вывод информационных сообщений
+											this->_timer->verbose(false);
+											// Выполняем биндинг сетевого ядра таймера
+											this->bind(dynamic_cast <awh::core_t *> (this->_timer.get()));
+										}
+										// Запоминаем метку времени начала замера нагрузки
+										this->_clusterLoads[sid] = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MICROSECONDS);
+										// Выполняем создание интервала отправки сведений о нагрузке
+										const uint16_t tid = this->_timer->interval(AWH_CLUSTER_LOAD_INTERVAL);
+										// Выполняем добавление функции обратного вызова
+										this->_timer->on(tid, &core_t::clusterLoadCallback, this, sid);
+									/**
+									 * Если возникает ошибка
+									 */
+									} catch(const bad_alloc &) {
+										/**
+										 * Если включён режим отладки
+										 */
+										#if DEBUG_MODE
+											// Выводим сообщение об ошибке
+											this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sid, pid, static_cast <uint16_t> (event)), log_t::flag_t::CRITICAL, "Memory allocation error");
+										/**
+										* Если режим отладки не включён
+										*/
+										#else
+											// Выводим сообщение об ошибке
+											this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+										#endif
+										// Выходим из приложения
+										::exit(EXIT_FAILURE);
+									/**
+									 * Если возникает ошибка
+									 */
+									} catch(const exception & error) {
+										/**
+										 * Если включён режим отладки
+										 */
+										#if DEBUG_MODE
+											// Выводим сообщение об ошибке
+											this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sid, pid, static_cast <uint16_t> (event)), log_t::flag_t::CRITICAL, error.what());
+										/**
+										* Если режим отладки не включён
+										*/
+										#else
+											// Выводим сообщение об ошибке
+											this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+										#endif
+									}
+									// Выходим, так-как слушающий сокет обслуживается родительским процессом
+									break;
+								// Если каждый процесс принимает подключения со своего слушающего сокета, но сокет не создан
+								} else if((distribution == cluster_t::distribution_t::REUSEPORT) && !this->listen(sid))
+									// Выходим из условия
+									break;
 								// Выполняем поиск брокера в списке активных брокеров
 								auto i = this->_brokers.find(sid);
 								// Если активный брокер найден
@@ -1351,6 +1610,82 @@ void awh::server::Core::clusterMessageCallback(const uint16_t sid, const pid_t p
 		// Выполняем функцию обратного вызова
 		this->_callback.call <void (const cluster_t::family_t, const uint16_t, const pid_t, const char *, const size_t)> ("clusterMessage", this->clusterFamily(), sid, pid, buffer, size);
 }
+/**
+ * @brief Метод получения подключения переданного родительским процессом
+ *
+ * @param sid идентификатор схемы сети
+ * @param fd  файловый дескриптор принятого подключения
+ */
+void awh::server::Core::clusterHandoffCallback(const uint16_t sid, const SOCKET fd) noexcept {
+	// Если подключение передано
+	if(fd != INVALID_SOCKET){
+		// Если схема сети существует и подключения распределяются родительским процессом
+		if(this->has(sid) && (this->clusterDistribution() == cluster_t::distribution_t::MASTER))
+			// Выполняем приём переданного подключения
+			this->accept(fd, sid, fd);
+		/**
+		 * Для операционной системы не являющейся MS Windows
+		 */
+		#if !_WIN32 && !_WIN64
+			// Иначе закрываем подключение которое некому обработать
+			else ::close(fd);
+		#endif
+	}
+}
+/**
+ * @brief Метод отправки родительскому процессу сведений о нагрузке
+ *
+ * @param sid идентификатор схемы сети
+ */
+void awh::server::Core::clusterLoadCallback(const uint16_t sid) noexcept {
+	// Выполняем поиск идентификатора схемы сети
+	auto i = this->_schemes.find(sid);
+	// Если идентификатор схемы сети найден
+	if(i != this->_schemes.end()){
+		// Получаем объект схемы сети
+		scheme_t * shm = dynamic_cast <scheme_t *> (const_cast <awh::scheme_t *> (i->second));
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Задержка цикла событий в микросекундах
+			uint32_t lag = 0;
+			// Получаем текущую метку времени
+			const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MICROSECONDS);
+			// Получаем метку времени последнего замера
+			uint64_t & last = this->_clusterLoads[sid];
+			// Ожидаемое время срабатывания таймера
+			const uint64_t expected = (last + (static_cast <uint64_t> (AWH_CLUSTER_LOAD_INTERVAL) * 1000));
+			// Если таймер сработал позже ожидаемого, значит цикл событий был занят
+			if((last > 0) && (date > expected))
+				// Запоминаем время опоздания таймера
+				lag = static_cast <uint32_t> (std::min(date - expected, static_cast <uint64_t> (std::numeric_limits <uint32_t>::max())));
+			// Запоминаем метку времени текущего замера
+			last = date;
+			// Отправляем родительскому процессу сведения о нагрузке
+			this->_cluster.load(sid, shm->_brokers.size(), lag);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sid), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+}
 /**
  * @brief Метод инициализации DTLS-брокера
  *
@@ -2140,6 +2475,12 @@ bool awh::server::Core::create(const uint16_t sid) noexcept {
 					// Устанавливаем параметры сокета
 					shm->_addr.sonet(SOCK_STREAM, IPPROTO_TCP);
 			}
+			// Если сетевое ядро работает с отдельной базой событий потока, порт разделяется между слушающими сокетами потоков
+			shm->_addr.reuseport = this->isolated();
+			// Если каждый процесс кластера принимает подключения со своего слушающего сокета, порт разделяется между процессами
+			if(this->clusterDistribution() == cluster_t::distribution_t::REUSEPORT)
+				// Разрешаем совместное использование порта
+				shm->_addr.reuseport = true;
 			// Если unix-сокет используется
 			if(this->_settings.family == scheme_t::family_t::IPC){
 				// Если название unix-сокета ещё не инициализированно
@@ -2151,9 +2492,14 @@ bool awh::server::Core::create(const uint16_t sid) noexcept {
 			// Если unix-сокет не используется, выполняем инициализацию сокета
 			} else shm->_addr.init(shm->_host, shm->_port, (this->_settings.family == scheme_t::family_t::IPV6 ? AF_INET6 : AF_INET), engine_t::type_t::SERVER, this->_settings.ipV6only);
 			// Если сокет подключения получен
-			if(shm->_addr.sock != INVALID_SOCKET)
+			if(shm->_addr.sock != INVALID_SOCKET){
 				// Выполняем прослушивание порта
 				result = static_cast <bool> (shm->_addr.list());
+				// Если сервер запущен в защищённом режиме
+				if(result && (this->_settings.sonet == scheme_t::sonet_t::TLS))
+					// Выполняем предварительную подготовку контекста SSL, общего для всех подключений
+					this->_engine.init(&shm->_addr, this->_settings.proto);
+			}
 		}
 	}
 	// Выводим результат создания сервера
@@ -2239,6 +2585,19 @@ std::set <pid_t> awh::server::Core::workers(const uint16_t sid) const noexcept {
  * @return       результат отправки сообщения
  */
 bool awh::server::Core::send(const char * buffer, const size_t size, const uint64_t bid) noexcept {
+	// Выполняем отправку буфера данных с копированием
+	return this->send(buffer, size, nullptr, bid);
+}
+/**
+ * @brief Метод асинхронной отправки буфера данных в сокет без копирования
+ *
+ * @param buffer буфер для записи данных
+ * @param size   размер записываемых данных
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ * @param bid    идентификатор брокера
+ * @return       результат отправки сообщения
+ */
+bool awh::server::Core::send(const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const uint64_t bid) noexcept {
 	// Результат работы функции
 	bool result = false;
 	// Если данные переданы
@@ -2252,7 +2611,7 @@ bool awh::server::Core::send(const char * buffer, const size_t size, const uint6
 			// Если установлен флаг отправки отложенных сообщений
 			case static_cast <uint8_t> (sending_t::DEFFER):
 				// Выполняем отправку сообщения асинхронным методом
-				waiting = result = node_t::send(buffer, size, bid);
+				waiting = result = node_t::send(buffer, size, owner, bid);
 			break;
 			// Если установлен флаг отправки мгновенных сообщений
 			case static_cast <uint8_t> (sending_t::INSTANT): {
@@ -2261,7 +2620,7 @@ bool awh::server::Core::send(const char * buffer, const size_t size, const uint6
 				// Если для потока очередь полезной нагрузки получена
 				if((waiting = ((i != this->_payloads.end()) && !i->second->empty())))
 					// Выполняем отправку сообщения асинхронным методом
-					result = node_t::send(buffer, size, bid);
+					result = node_t::send(buffer, size, owner, bid);
 				// Если очередь ещё не существует
 				else {
 					// Выполняем отправку данных клиенту
@@ -2269,7 +2628,7 @@ bool awh::server::Core::send(const char * buffer, const size_t size, const uint6
 					// Если данные отправлены не полностью
 					if((waiting = (bytes < size)))
 						// Выполняем отправку сообщения асинхронным методом
-						result = node_t::send(buffer + bytes, size - bytes, bid);
+						result = node_t::send(buffer + bytes, size - bytes, owner, bid);
 					// Если все данные добавлены успешно
 					else result = (bytes == size);
 				}
@@ -2495,8 +2854,10 @@ void awh::server::Core::read(const uint64_t bid) noexcept {
 						#endif
 					} break;
 				}
-				// Выполняем отключение приёма данных на этот сокет
-				broker->events(awh::scheme_t::mode_t::DISABLED, engine_t::method_t::READ);
+				// Арендуем буфер чтения потока на время чтения данных
+				lease_t lease(this->_log);
+				// Устанавливаем флаг выполнения чтения
+				broker->buffer.reading = true;
 				/**
 				 * Выполняем чтение данных с сокета
 				 */
@@ -2513,8 +2874,14 @@ void awh::server::Core::read(const uint64_t bid) noexcept {
 								broker->ectx.timeout(static_cast <uint32_t> (broker->timeouts.read) * 1000, engine_t::method_t::READ);
 							break;
 						}
+						// Получаем буфер для чтения: собственный буфер брокера или арендованный буфер потока
+						char * buffer = (broker->buffer.retain ? broker->buffer.data.get() : lease.get(broker->buffer.size));
+						// Если буфер для чтения не получен
+						if(buffer == nullptr)
+							// Выходим из цикла
+							break;
 						// Выполняем получение сообщения от клиента
-						const int64_t bytes = broker->ectx.read(broker->buffer.data.get(), broker->buffer.size);
+						const int64_t bytes = broker->ectx.read(buffer, broker->buffer.size);
 						// Если данные получены
 						if(bytes > 0){
 							// Если таймер ожидания получения данных установлен
@@ -2524,7 +2891,7 @@ void awh::server::Core::read(const uint64_t bid) noexcept {
 							// Если данных достаточно и функция обратного вызова на получение данных установлена
 							if(this->_callback.is("read"))
 								// Выводим функцию обратного вызова
-								this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", broker->buffer.data.get(), static_cast <size_t> (bytes), bid, i->first);
+								this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", buffer, static_cast <size_t> (bytes), bid, i->first);
 							// Если тип сокета установлен как UDP
 							if(this->_settings.sonet == scheme_t::sonet_t::DTLS){
 								// Если подключение ещё не разорванно
@@ -2549,17 +2916,17 @@ void awh::server::Core::read(const uint64_t bid) noexcept {
 					// Если запись не выполнена, входим
 					} else break;
 				/**
-				 * Выполняем чтение до тех пор, пока всё не прочитаем
+				 * Выполняем чтение до тех пор, пока всё не прочитаем или чтение не будет приостановлено
 				 */
-				} while(this->has(bid));
+				} while(this->has(bid) && !broker->buffer.paused);
 				// Если подключение ещё не разорванно
 				if(this->has(bid)){
+					// Завершаем чтение и применяем отложенную переинициализацию буфера
+					this->releaseBuffer(bid);
 					// Если время ожиданий входящих сообщений установлено
 					if((broker->timeouts.wait > 0) && (this->_settings.sonet != scheme_t::sonet_t::DTLS))
 						// Выполняем создание таймаута ожидания получения данных
 						this->createTimeout(i->first, bid, static_cast <uint32_t> (broker->timeouts.wait) * 1000, mode_t::RECEIVE);
-					// Выполняем активацию отслеживания получения данных с этого сокета
-					broker->events(awh::scheme_t::mode_t::ENABLED, engine_t::method_t::READ);
 				}
 			// Если схема сети не существует
 			} else {
@@ -2602,7 +2969,12 @@ void awh::server::Core::write(const uint64_t bid) noexcept {
 			// Если для потока очередь полезной нагрузки получена
 			if((i != this->_payloads.end()) && !i->second->empty()){
 				// Выполняем запись в сокет
-				const size_t bytes = this->write(reinterpret_cast <const char *> (i->second->get()), i->second->size(), bid);
+				// Список записей очереди полезной нагрузки для векторной отправки
+				chain_t::record_t records[AWH_CHAIN_RECORDS];
+				// Получаем записи очереди полезной нагрузки
+				const size_t count = i->second->records(records, AWH_CHAIN_RECORDS, i->second->size());
+				// Выполняем запись в сокет всех записей одним вызовом
+				const size_t bytes = this->write(records, count, bid);
 				// Если данные записаны удачно
 				if((bytes > 0) && this->has(bid))
 					// Выполняем освобождение памяти хранения полезной нагрузки
@@ -2627,10 +2999,24 @@ void awh::server::Core::write(const uint64_t bid) noexcept {
  * @return       количество отправленных байт
  */
 size_t awh::server::Core::write(const char * buffer, const size_t size, const uint64_t bid) noexcept {
+	// Создаём запись буфера данных
+	const chain_t::record_t record(buffer, size);
+	// Выполняем запись буфера данных в сокет
+	return this->write(&record, ((buffer != nullptr) && (size > 0) ? 1 : 0), bid);
+}
+/**
+ * @brief Метод векторной записи списка буферов данных в сокет
+ *
+ * @param records список записей данных для записи
+ * @param count   количество записей в списке
+ * @param bid     идентификатор брокера
+ * @return        количество отправленных байт
+ */
+size_t awh::server::Core::write(const chain_t::record_t * records, const size_t count, const uint64_t bid) noexcept {
 	// Результат работы функции
 	size_t result = 0;
 	// Если данные переданы
-	if(this->working() && this->has(bid) && (buffer != nullptr) && (size > 0)){
+	if(this->working() && this->has(bid) && (records != nullptr) && (count > 0)){
 		// Создаём бъект активного брокера подключения
 		awh::scheme_t::broker_t * broker = const_cast <awh::scheme_t::broker_t *> (this->broker(bid));
 		// Если сокет подключения активен
@@ -2713,8 +3099,21 @@ size_t awh::server::Core::write(const char * buffer, const size_t size, const ui
 							broker->ectx.timeout(static_cast <uint32_t> (broker->timeouts.write) * 1000, engine_t::method_t::WRITE);
 						break;
 					}
-					// Выполняем отправку сообщения клиенту
-					const int64_t bytes = broker->ectx.write(buffer, (size >= static_cast <size_t> (max) ? static_cast <size_t> (max) : size));
+					// Количество записей ограниченных размером буфера сокета
+					size_t length = 0;
+					// Размер данных записей ограниченных размером буфера сокета
+					size_t amount = 0;
+					// Список записей ограниченный размером буфера сокета
+					chain_t::record_t limited[AWH_CHAIN_RECORDS];
+					// Выполняем ограничение записей размером буфера сокета
+					for(; (length < count) && (length < AWH_CHAIN_RECORDS) && (amount < static_cast <size_t> (max)); length++){
+						// Устанавливаем запись ограниченную оставшимся местом в буфере сокета
+						limited[length] = std::make_pair(records[length].first, std::min(records[length].second, static_cast <size_t> (max) - amount));
+						// Увеличиваем размер данных записей
+						amount += limited[length].second;
+					}
+					// Выполняем отправку сообщения
+					const int64_t bytes = broker->ectx.write(limited, length);
 					// Если данные удачно отправленны
 					if(bytes > 0)
 						// Запоминаем количество записанных байт
@@ -2748,10 +3147,10 @@ size_t awh::server::Core::write(const char * buffer, const size_t size, const ui
 							} break;
 						}
 					}
-					// Если данные отправлены удачно и функция обратного вызова установлена
-					if((bytes > 0) && this->_callback.is("write"))
+					// Если данные отправлены удачно
+					if(bytes > 0)
 						// Выводим функцию обратного вызова
-						this->_callback.call <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", buffer, static_cast <size_t> (bytes), bid, i->first);
+						this->written("write", limited, length, static_cast <size_t> (bytes), bid, i->first);
 				}
 			// Если схема сети не существует
 			} else {
@@ -3082,6 +3481,8 @@ void awh::server::Core::callback(const callback_t & callback) noexcept {
 	this->_callback.set("launched", callback);
 	// Выполняем установку функции обратного вызова при освобождении буфера хранения полезной нагрузки
 	this->_callback.set("available", callback);
+	// Выполняем установку функции обратного вызова при освобождении очереди отправки брокера
+	this->_callback.set("drain", callback);
 	// Выполняем установку функции обратного вызова при отключении клиента от сервера
 	this->_callback.set("disconnect", callback);
 	// Выполняем установку функции обратного вызова при заполнении буфера хранения полезной нагрузки
@@ -3309,6 +3710,80 @@ void awh::server::Core::clusterTransfer(const cluster_t::transfer_t transfer) no
 			this->_callback.call <void (const log_t::flag_t, const error_t, const string &)> ("error", log_t::flag_t::WARNING, error_t::OSBROKEN, "MS Windows OS, does not support cluster mode");
 	#endif
 }
+/**
+ * @brief Метод получения режима распределения подключений между процессами
+ *
+ * @return режим распределения подключений используемый сервером
+ */
+awh::cluster_t::distribution_t awh::server::Core::clusterDistribution() const noexcept {
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Если кластер активирован
+		if(this->_clusterMode == awh::scheme_t::mode_t::ENABLED){
+			/**
+			 * Определяем тип сокета
+			 */
+			switch(static_cast <uint8_t> (this->_settings.sonet)){
+				// Если тип сокета установлен как TCP/IP
+				case static_cast <uint8_t> (scheme_t::sonet_t::TCP):
+				// Если тип сокета установлен как TCP/IP TLS
+				case static_cast <uint8_t> (scheme_t::sonet_t::TLS): {
+					// Получаем установленный режим распределения подключений
+					const cluster_t::distribution_t distribution = this->_cluster.distribution();
+					// Если для unix-сокета выбран режим SO_REUSEPORT, используем общий слушающий сокет
+					if((distribution == cluster_t::distribution_t::REUSEPORT) && (this->_settings.family == scheme_t::family_t::IPC))
+						// Выводим режим общего слушающего сокета
+						return cluster_t::distribution_t::SHARED;
+					// Выводим установленный режим
+					return distribution;
+				}
+			}
+		}
+	#endif
+	// Выводим режим общего слушающего сокета
+	return cluster_t::distribution_t::SHARED;
+}
+/**
+ * @brief Метод установки режима распределения подключений между процессами
+ *
+ * @param distribution режим распределения подключений
+ * @param steering     флаг распределения подключений SO_REUSEPORT по ядрам процессора
+ */
+void awh::server::Core::clusterDistribution(const cluster_t::distribution_t distribution, const bool steering) noexcept {
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#if !_WIN32 && !_WIN64
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx.main);
+		// Устанавливаем флаг распределения подключений по ядрам процессора
+		this->_clusterSteering = steering;
+		// Выполняем установку режима распределения подключений
+		this->_cluster.distribution(distribution);
+	/**
+	 * Для операционной системы MS Windows
+	 */
+	#else
+		// Выводим предупредительное сообщение в лог
+		this->_log->print("MS Windows OS, does not support cluster mode", log_t::flag_t::WARNING);
+		// Если функция обратного вызова установлена
+		if(this->_callback.is("error"))
+			// Выполняем функцию обратного вызова
+			this->_callback.call <void (const log_t::flag_t, const error_t, const string &)> ("error", log_t::flag_t::WARNING, error_t::OSBROKEN, "MS Windows OS, does not support cluster mode");
+	#endif
+}
+/**
+ * @brief Метод получения количества подключений дочерних процессов
+ *
+ * @param sid идентификатор схемы сети
+ * @return    список количества подключений по идентификаторам процессов
+ */
+std::map <pid_t, size_t> awh::server::Core::clusterConnections(const uint16_t sid) const noexcept {
+	// Выводим список количества подключений дочерних процессов
+	return this->_cluster.connections(sid);
+}
 /**
  * @brief Метод установки пропускной способности сети кластера
  *
@@ -3648,7 +4123,7 @@ void awh::server::Core::waitTimeDetect(const uint64_t bid, const uint16_t read,
  */
 awh::server::Core::Core(const fmk_t * fmk, const log_t * log) noexcept :
  awh::node_t(fmk, log), _socket(fmk, log), _cluster(this, fmk, log),
- _clusterSize(-1), _clusterAutoRestart(false),
+ _clusterSize(-1), _clusterAutoRestart(false), _clusterSteering(false),
  _clusterMode(awh::scheme_t::mode_t::DISABLED), _timer(nullptr) {
 	// Устанавливаем тип запускаемого ядра
 	this->_type = engine_t::type_t::SERVER;
@@ -3662,6 +4137,8 @@ awh::server::Core::Core(const fmk_t * fmk, const log_t * log) noexcept :
 	this->_cluster.on <void (const uint16_t, const pid_t, const cluster_t::event_t)> ("events", &core_t::clusterEventsCallback, this, _1, _2, _3);
 	// Устанавливаем функцию получения сообщений процессов кластера
 	this->_cluster.on <void (const uint16_t, const pid_t, const char *, const size_t)> ("message", &core_t::clusterMessageCallback, this, _1, _2, _3, _4);
+	// Устанавливаем функцию получения подключений переданных родительским процессом
+	this->_cluster.on <void (const uint16_t, const SOCKET)> ("handoff", &core_t::clusterHandoffCallback, this, _1, _2);
 }
 /**
  * @brief Конструктор
@@ -3672,7 +4149,7 @@ awh::server::Core::Core(const fmk_t * fmk, const log_t * log) noexcept :
  */
 awh::server::Core::Core(const dns_t * dns, const fmk_t * fmk, const log_t * log) noexcept :
  awh::node_t(dns, fmk, log), _socket(fmk, log), _cluster(this, fmk, log),
- _transfer(transfer_t::SYNC), _clusterSize(-1), _clusterAutoRestart(false),
+ _transfer(transfer_t::SYNC), _clusterSize(-1), _clusterAutoRestart(false), _clusterSteering(false),
  _clusterMode(awh::scheme_t::mode_t::DISABLED), _timer(nullptr) {
 	// Устанавливаем тип запускаемого ядра
 	this->_type = engine_t::type_t::SERVER;
@@ -3686,4 +4163,6 @@ awh::server::Core::Core(const dns_t * dns, const fmk_t * fmk, const log_t * log)
 	this->_cluster.on <void (const uint16_t, const pid_t, const cluster_t::event_t)> ("events", &core_t::clusterEventsCallback, this, _1, _2, _3);
 	// Устанавливаем функцию получения сообщений процессов кластера
 	this->_cluster.on <void (const uint16_t, const pid_t, const char *, const size_t)> ("message", &core_t::clusterMessageCallback, this, _1, _2, _3, _4);
+	// Устанавливаем функцию получения подключений переданных родительским процессом
+	this->_cluster.on <void (const uint16_t, const SOCKET)> ("handoff", &core_t::clusterHandoffCallback, this, _1, _2);
 }
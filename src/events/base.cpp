@@ -487,26 +487,71 @@ void awh::Base::init(const event_mode_t mode) noexcept {
 			 * Для операционной системы Linux
 			 */
 			#elif __linux__
-				// Выполняем инициализацию EPoll
-				if((this->_efd = ::epoll_create(AWH_MAX_COUNT_FDS)) == INVALID_SOCKET){
-					/**
-					 * Если включён режим отладки
-					 */
-					#if DEBUG_MODE
-						// Выводим сообщение об ошибке
-						this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, ::strerror(errno));
-					/**
-					* Если режим отладки не включён
-					*/
-					#else
-						// Выводим сообщение об ошибке
-						this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
-					#endif
-					// Выходим принудительно из приложения
-					::exit(EXIT_FAILURE);
+				// Сбрасываем идентификатор EPoll
+				this->_efd = INVALID_SOCKET;
+				/**
+				 * Если сборка выполнена с поддержкой io_uring
+				 */
+				#if defined(AWH_IOURING)
+					// Если требуется использовать io_uring, но ядро его не поддерживает
+					if(this->_iouring && !(this->_iouring = this->_uring.init()))
+						// Выводим сообщение, что будет использован EPoll
+						this->_log->print("io_uring is not supported by the kernel, EPoll will be used", log_t::flag_t::WARNING);
+				#endif
+				// Если движок io_uring не используется
+				if(!this->_iouring){
+					// Выполняем инициализацию EPoll
+					if((this->_efd = ::epoll_create(AWH_MAX_COUNT_FDS)) == INVALID_SOCKET){
+						/**
+						 * Если включён режим отладки
+						 */
+						#if DEBUG_MODE
+							// Выводим сообщение об ошибке
+							this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, ::strerror(errno));
+						/**
+						* Если режим отладки не включён
+						*/
+						#else
+							// Выводим сообщение об ошибке
+							this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
+						#endif
+						// Выходим принудительно из приложения
+						::exit(EXIT_FAILURE);
+					}
+					// Выполняем открытие файлового дескриптора
+					::fcntl(this->_efd, F_SETFD, FD_CLOEXEC);
+				}
+				// Устанавливаем файловый дескриптор часов колеса таймеров
+				this->_clock.sock = this->_watch.fd();
+				// Устанавливаем тип участника часов
+				this->_clock.type = event_type_t::TIMER;
+				// Если часы колеса таймеров созданы
+				if(this->_clock.sock != INVALID_SOCKET){
+					// Создаём объект события часов
+					struct epoll_event event;
+					// Заполняем структуру нулями
+					::memset(&event, 0, sizeof(event));
+					// Устанавливаем флаг ожидания срабатывания часов
+					event.events = EPOLLIN;
+					// Выполняем установку указателя на участника часов
+					event.data.ptr = &this->_clock;
+					// Выполняем добавление часов в базу событий, все таймеры базы событий обслуживаются ими
+					if(this->ctl(EPOLL_CTL_ADD, this->_clock.sock, &event) != 0){
+						/**
+						 * Если включён режим отладки
+						 */
+						#if DEBUG_MODE
+							// Выводим сообщение об ошибке
+							this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, ::strerror(errno));
+						/**
+						* Если режим отладки не включён
+						*/
+						#else
+							// Выводим сообщение об ошибке
+							this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
+						#endif
+					}
 				}
-				// Выполняем открытие файлового дескриптора
-				::fcntl(this->_efd, F_SETFD, FD_CLOEXEC);
 			/**
 			 * Для операционной системы FreeBSD, NetBSD, OpenBSD или MacOS X
 			 */
@@ -553,8 +598,23 @@ void awh::Base::init(const event_mode_t mode) noexcept {
 			 * Для операционной системы Linux
 			 */
 			#elif __linux__
-				// Выполняем закрытие подключения
-				::close(this->_efd);
+				/**
+				 * Если сборка выполнена с поддержкой io_uring
+				 */
+				#if defined(AWH_IOURING)
+					// Выполняем закрытие движка io_uring
+					this->_uring.close();
+				#endif
+				// Если EPoll был создан
+				if(this->_efd != INVALID_SOCKET)
+					// Выполняем закрытие подключения
+					::close(this->_efd);
+				// Сбрасываем идентификатор EPoll
+				this->_efd = INVALID_SOCKET;
+				// Выполняем очистку списка применённых событий
+				this->_applied.clear();
+				// Выполняем очистку списка отложенных изменений
+				this->_dirty.clear();
 			/**
 			 * Для операционной системы FreeBSD, NetBSD, OpenBSD или MacOS X
 			 */
@@ -582,6 +642,158 @@ void awh::Base::stream(const SOCKET sock, const uint64_t event) noexcept {
 			std::apply(i->second->callback, std::make_tuple(event));
 	}
 }
+/**
+ * Для операционной системы Linux
+ */
+#if __linux__
+	/**
+	 * @brief Метод обработки сработавших таймеров колеса
+	 *
+	 */
+	void awh::Base::timers() noexcept {
+		// Выполняем очистку списка сработавших таймеров
+		this->_expired.clear();
+		// Извлекаем сработавшие таймеры колеса
+		this->_watch.expired(this->_expired);
+		// Выполняем перебор всех сработавших таймеров
+		for(auto & sock : this->_expired){
+			// Выполняем поиск таймера в базе событий
+			auto i = this->_peers.find(sock);
+			// Если таймер есть в базе событий
+			if((i != this->_peers.end()) && (i->second.type == event_type_t::TIMER)){
+				// Получаем идентификатор события
+				const uint64_t id = i->second.id;
+				// Если функция обратного вызова установлена
+				if(i->second.callback != nullptr){
+					// Выполняем поиск события таймера присутствует в базе событий
+					auto j = i->second.mode.find(event_type_t::TIMER);
+					// Если событие найдено и оно активированно
+					if((j != i->second.mode.end()) && (j->second == event_mode_t::ENABLED))
+						// Выполняем функцию обратного вызова
+						std::apply(i->second.callback, std::make_tuple(sock, event_type_t::TIMER));
+				}
+				// Выполняем поиск таймера в базе событий повторно, так как функция обратного вызова могла его удалить
+				i = this->_peers.find(sock);
+				// Если таймер есть в базе событий и он персистентный
+				if((i != this->_peers.end()) && (id == i->second.id) && i->second.persist){
+					// Выполняем поиск события таймера присутствует в базе событий
+					auto j = i->second.mode.find(event_type_t::TIMER);
+					// Если событие найдено и оно активированно
+					if((j != i->second.mode.end()) && (j->second == event_mode_t::ENABLED))
+						// Выполняем активацию таймера на указанное время
+						this->_watch.wait(i->second.sock, i->second.delay);
+				}
+			}
+		}
+	}
+	/**
+	 * @brief Метод изменения отслеживаемых событий активным движком (epoll_ctl или io_uring)
+	 *
+	 * Изменения EPOLL_CTL_MOD из потока базы событий применяются один раз перед следующим ожиданием
+	 *
+	 * @param op    операция EPOLL_CTL_ADD, EPOLL_CTL_MOD или EPOLL_CTL_DEL
+	 * @param sock  файловый дескриптор
+	 * @param event параметры события
+	 * @return      0 при успешном выполнении или -1 при ошибке
+	 */
+	int32_t awh::Base::ctl(const int32_t op, const SOCKET sock, struct epoll_event * event) noexcept {
+		/**
+		 * Если сборка выполнена с поддержкой io_uring
+		 */
+		#if defined(AWH_IOURING)
+			// Если используется движок io_uring
+			if(this->_iouring)
+				// Изменение будет отправлено в ядро вместе со следующим ожиданием событий
+				return this->_uring.ctl(op, sock, event);
+		#endif
+		// Выполняем блокировку потока, списки изменений разделяются с дочерними потоками
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Если изменение выполняется в потоке базы событий
+		if((op == EPOLL_CTL_MOD) && (event != nullptr) && !this->isChildThread()){
+			// Откладываем изменение до следующего ожидания событий, повторные изменения схлопываются
+			this->_dirty[sock] = (* event);
+			// Выходим из функции
+			return 0;
+		}
+		// Изменение применяется немедленно, поэтому устаревшее отложенное изменение не должно его перезаписать
+		this->_dirty.erase(sock);
+		// Увеличиваем количество системных вызовов
+		this->_syscalls++;
+		// Выполняем изменение параметров события в EPoll
+		const int32_t result = ::epoll_ctl(this->_efd, op, sock, event);
+		// Если изменение применено
+		if(result == 0){
+			// Если событие удалено
+			if(op == EPOLL_CTL_DEL)
+				// Удаляем применённые отслеживаемые события
+				this->_applied.erase(sock);
+			// Если событие добавлено или изменено
+			else if(event != nullptr)
+				// Запоминаем применённые отслеживаемые события
+				this->_applied[sock] = event->events;
+		}
+		// Выводим результат
+		return result;
+	}
+	/**
+	 * @brief Метод ожидания событий активным движком (epoll_wait или io_uring)
+	 *
+	 * @param timeout время ожидания в миллисекундах
+	 * @return        количество полученных событий или -1 при ошибке
+	 */
+	int32_t awh::Base::wait(const int32_t timeout) noexcept {
+		/**
+		 * Если сборка выполнена с поддержкой io_uring
+		 */
+		#if defined(AWH_IOURING)
+			// Если используется движок io_uring
+			if(this->_iouring)
+				// Выполняем ожидание событий в io_uring
+				return this->_uring.wait(this->_events.data(), static_cast <int32_t> (this->_events.size()), timeout);
+		#endif
+		// Выполняем блокировку потока на время применения отложенных изменений
+		std::unique_lock <std::recursive_mutex> lock(this->_mtx);
+		// Выполняем перебор всех отложенных изменений событий
+		for(auto & item : this->_dirty){
+			// Выполняем поиск применённых отслеживаемых событий
+			auto i = this->_applied.find(item.first);
+			// Если за итерацию отслеживаемые события вернулись к применённым, системный вызов не требуется
+			if((i != this->_applied.end()) && (i->second == item.second.events))
+				// Пропускаем изменение
+				continue;
+			// Увеличиваем количество системных вызовов
+			this->_syscalls++;
+			// Выполняем изменение параметров события в EPoll
+			if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, item.first, &item.second) == 0)
+				// Запоминаем применённые отслеживаемые события
+				this->_applied[item.first] = item.second.events;
+			// Если изменение не применено
+			else {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(item.first), log_t::flag_t::CRITICAL, ::strerror(errno));
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
+				#endif
+			}
+		}
+		// Выполняем очистку списка отложенных изменений
+		this->_dirty.clear();
+		// Увеличиваем количество системных вызовов
+		this->_syscalls++;
+		// Снимаем блокировку потока, ожидание событий не должно задерживать дочерние потоки
+		lock.unlock();
+		// Выполняем ожидание событий в EPoll
+		return ::epoll_wait(this->_efd, this->_events.data(), static_cast <int32_t> (this->_events.size()), timeout);
+	}
+#endif
 /**
  * @brief Метод удаления файлового дескриптора из базы событий
  *
@@ -694,8 +906,8 @@ bool awh::Base::del(const SOCKET sock) noexcept {
 			for(auto i = this->_events.begin(); i != this->_events.end(); ++i){
 				// Если сокет найден
 				if((i->data.ptr != nullptr) && (reinterpret_cast <peer_t *> (i->data.ptr)->sock == sock)){
-					// Выполняем изменение параметров события
-					result = erased = (::epoll_ctl(this->_efd, EPOLL_CTL_DEL, sock, &(* i)) == 0);
+					// Выполняем изменение параметров события (таймеры в EPoll не регистрируются)
+					result = erased = ((reinterpret_cast <peer_t *> (i->data.ptr)->type == event_type_t::TIMER) || (this->ctl(EPOLL_CTL_DEL, sock, &(* i)) == 0));
 					// Если событие принадлежит к таймеру
 					if(reinterpret_cast <peer_t *> (i->data.ptr)->type == event_type_t::TIMER)
 						// Выполняем удаление таймера
@@ -712,8 +924,8 @@ bool awh::Base::del(const SOCKET sock) noexcept {
 				if((i->data.ptr != nullptr) && (reinterpret_cast <peer_t *> (i->data.ptr)->sock == sock)){
 					// Если событие ещё не удалено из базы событий
 					if(!erased){
-						// Выполняем изменение параметров события
-						result = (::epoll_ctl(this->_efd, EPOLL_CTL_DEL, sock, &(* i)) == 0);
+						// Выполняем изменение параметров события (таймеры в EPoll не регистрируются)
+						result = ((reinterpret_cast <peer_t *> (i->data.ptr)->type == event_type_t::TIMER) || (this->ctl(EPOLL_CTL_DEL, sock, &(* i)) == 0));
 						// Если событие принадлежит к таймеру
 						if(reinterpret_cast <peer_t *> (i->data.ptr)->type == event_type_t::TIMER)
 							// Выполняем удаление таймера
@@ -728,7 +940,7 @@ bool awh::Base::del(const SOCKET sock) noexcept {
 			// Если удаление не выполненно
 			if(!result)
 				// Выполняем изменение параметров события
-				result = (::epoll_ctl(this->_efd, EPOLL_CTL_DEL, sock, nullptr) == 0);
+				result = (this->ctl(EPOLL_CTL_DEL, sock, nullptr) == 0);
 			// Выполняем разблокировку чтения базы событий
 			this->_locker = false;
 		/**
@@ -920,8 +1132,8 @@ bool awh::Base::del(const uint64_t id, const SOCKET sock) noexcept {
 					// Если сокет найден
 					if((reinterpret_cast <peer_t *> (j->data.ptr) == &i->second) &&
 					   (reinterpret_cast <peer_t *> (j->data.ptr)->id == id)){
-						// Выполняем изменение параметров события
-						result = erased = (::epoll_ctl(this->_efd, EPOLL_CTL_DEL, i->second.sock, &(* j)) == 0);
+						// Выполняем изменение параметров события (таймеры в EPoll не регистрируются)
+						result = erased = ((i->second.type == event_type_t::TIMER) || (this->ctl(EPOLL_CTL_DEL, i->second.sock, &(* j)) == 0));
 						// Выполняем удаление события из списка отслеживания
 						this->_events.erase(j);
 						// Выходим из цикла
@@ -935,8 +1147,8 @@ bool awh::Base::del(const uint64_t id, const SOCKET sock) noexcept {
 					   (reinterpret_cast <peer_t *> (j->data.ptr)->id == id)){
 						// Если событие ещё не удалено из базы событий
 						if(!erased)
-							// Выполняем изменение параметров события
-							result = (::epoll_ctl(this->_efd, EPOLL_CTL_DEL, i->second.sock, &(* j)) == 0);
+							// Выполняем изменение параметров события (таймеры в EPoll не регистрируются)
+							result = ((i->second.type == event_type_t::TIMER) || (this->ctl(EPOLL_CTL_DEL, i->second.sock, &(* j)) == 0));
 						// Выполняем удаление события из списка изменений
 						this->_change.erase(j);
 						// Выходим из цикла
@@ -1558,12 +1770,12 @@ bool awh::Base::del(const uint64_t id, const SOCKET sock, const event_type_t typ
 								i->second.mode.erase(j);
 								// Если список режимов событий пустой
 								if(i->second.mode.empty()){
-									// Выполняем изменение параметров события
-									result = (::epoll_ctl(this->_efd, EPOLL_CTL_DEL, i->second.sock, &(* k)) == 0);
+									// Выполняем изменение параметров события (таймеры в EPoll не регистрируются)
+									result = ((i->second.type == event_type_t::TIMER) || (this->ctl(EPOLL_CTL_DEL, i->second.sock, &(* k)) == 0));
 									// Выполняем удаление события из списка изменений
 									this->_change.erase(k);
-								// Выполняем изменение параметров события
-								} else result = (::epoll_ctl(this->_efd, EPOLL_CTL_MOD, i->second.sock, &(* k)) == 0);
+								// Выполняем изменение параметров события (таймеры в EPoll не регистрируются)
+								} else result = ((i->second.type == event_type_t::TIMER) || (this->ctl(EPOLL_CTL_MOD, i->second.sock, &(* k)) == 0));
 								// Если событие принадлежит к таймеру
 								if(i->second.type == event_type_t::TIMER)
 									// Выполняем удаление таймера
@@ -2053,8 +2265,12 @@ bool awh::Base::add(const uint64_t id, SOCKET & sock, callback_t callback, const
 							this->_change.back().data.ptr = item;
 							// Устанавливаем флаг ожидания отключения сокета
 							this->_change.back().events = EPOLLERR;
+							// Если событие принадлежит к таймеру, он обслуживается колесом таймеров без регистрации в EPoll
+							if(item->type == event_type_t::TIMER)
+								// Таймер добавлен успешно
+								result = true;
 							// Выполняем изменение параметров события
-							if(!(result = (::epoll_ctl(this->_efd, EPOLL_CTL_ADD, sock, &this->_change.back()) == 0))){
+							else if(!(result = (this->ctl(EPOLL_CTL_ADD, sock, &this->_change.back()) == 0))){
 								/**
 								 * Если включён режим отладки
 								 */
@@ -2593,47 +2809,17 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 										switch(static_cast <uint8_t> (mode)){
 											// Если нужно активировать событие таймера
 											case static_cast <uint8_t> (event_mode_t::ENABLED): {
-												// Устанавливаем флаг ожидания готовности файлового дескриптора на чтение
+												// Устанавливаем флаг ожидания срабатывания таймера
 												k->events |= (EPOLLIN | EPOLLET);
-												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
-													/**
-													 * Если включён режим отладки
-													 */
-													#if DEBUG_MODE
-														// Выводим сообщение об ошибке
-														this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(id, sock, static_cast <uint16_t> (type), static_cast <uint16_t> (mode)), log_t::flag_t::CRITICAL, ::strerror(errno));
-													/**
-													 * Если режим отладки не включён
-													 */
-													#else
-														// Выводим сообщение об ошибке
-														this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
-													#endif
-												// Выполняем активацию таймера на указанное время
-												} else this->_watch.wait(sock, i->second.delay);
+												// Выполняем активацию таймера в колесе таймеров на указанное время
+												this->_watch.wait(sock, i->second.delay);
 											} break;
 											// Если нужно деактивировать событие таймера
 											case static_cast <uint8_t> (event_mode_t::DISABLED): {
-												// Снимаем флаг ожидания готовности файлового дескриптора на чтение
+												// Снимаем флаг ожидания срабатывания таймера
 												k->events ^= (EPOLLIN | EPOLLET);
-												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
-													/**
-													 * Если включён режим отладки
-													 */
-													#if DEBUG_MODE
-														// Выводим сообщение об ошибке
-														this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(id, sock, static_cast <uint16_t> (type), static_cast <uint16_t> (mode)), log_t::flag_t::CRITICAL, ::strerror(errno));
-													/**
-													 * Если режим отладки не включён
-													 */
-													#else
-														// Выводим сообщение об ошибке
-														this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
-													#endif
-												// Выполняем деактивацию таймера
-												} else this->_watch.away(sock);
+												// Выполняем отмену ожидания таймера в колесе таймеров
+												this->_watch.cancel(sock);
 											} break;
 										}
 									} break;
@@ -2650,7 +2836,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Устанавливаем флаг ожидания готовности файлового дескриптора на чтение
 												k->events |= (EPOLLIN | EPOLLET);
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2671,7 +2857,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Снимаем флаг ожидания готовности файлового дескриптора на чтение
 												k->events ^= (EPOLLIN | EPOLLET);
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2700,7 +2886,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Выполняем установку флагов отслеживания закрытия подключения
 												k->events |= (EPOLLRDHUP | EPOLLHUP);
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2721,7 +2907,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Выполняем удаление флагов отслеживания закрытия подключения
 												k->events ^= (EPOLLRDHUP | EPOLLHUP);
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2750,7 +2936,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Устанавливаем флаг ожидания готовности файлового дескриптора на чтение
 												k->events |= EPOLLIN;
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2771,7 +2957,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Снимаем флаг ожидания готовности файлового дескриптора на чтение
 												k->events ^= EPOLLIN;
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2800,7 +2986,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Устанавливаем флаг отслеживания записи данных в сокет
 												k->events |= EPOLLOUT;
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -2821,7 +3007,7 @@ bool awh::Base::mode(const uint64_t id, const SOCKET sock, const event_type_t ty
 												// Снимаем флаг ожидания готовности файлового дескриптора на запись
 												k->events ^= EPOLLOUT;
 												// Выполняем изменение параметров события
-												if(::epoll_ctl(this->_efd, EPOLL_CTL_MOD, sock, &(* k)) != 0){
+												if(this->ctl(EPOLL_CTL_MOD, sock, &(* k)) != 0){
 													/**
 													 * Если включён режим отладки
 													 */
@@ -3053,12 +3239,12 @@ void awh::Base::clear() noexcept {
 		#elif __linux__
 			// Выполняем поиск файлового дескриптора из списка изменений
 			for(auto i = this->_change.begin(); i != this->_change.end();){
-				// Выполняем изменение параметров события
-				::epoll_ctl(this->_efd, EPOLL_CTL_DEL, reinterpret_cast <peer_t *> (i->data.ptr)->sock, &(* i));
 				// Если событие принадлежит к таймеру
 				if(reinterpret_cast <peer_t *> (i->data.ptr)->type == event_type_t::TIMER)
 					// Выполняем удаление таймера
 					this->_watch.away(reinterpret_cast <peer_t *> (i->data.ptr)->sock);
+				// Выполняем изменение параметров события
+				else this->ctl(EPOLL_CTL_DEL, reinterpret_cast <peer_t *> (i->data.ptr)->sock, &(* i));
 				// Выполняем удаление события из списка изменений
 				i = this->_change.erase(i);
 			}
@@ -3778,7 +3964,7 @@ void awh::Base::start() noexcept {
 						// Если в списке достаточно событий для опроса
 						if(!this->_change.empty()){
 							// Выполняем запуск ожидания входящих событий сокетов
-							poll = ::epoll_wait(this->_efd, this->_events.data(), AWH_MAX_COUNT_FDS, (!this->_easily ? static_cast <int32_t> (this->_rate) : 0));
+							poll = this->wait(!this->_easily ? static_cast <int32_t> (this->_rate) : 0);
 							// Если мы получили ошибку
 							if(poll == INVALID_SOCKET){
 								/**
@@ -3836,35 +4022,13 @@ void awh::Base::start() noexcept {
 												switch(static_cast <uint8_t> (item->type)){
 													// Если событие принадлежит к таймеру
 													case static_cast <uint8_t> (event_type_t::TIMER): {
-														// Выполняем чтение входящего события
-														const uint64_t event = this->_watch.event(sock);
-														// Если чтение выполнено удачно
-														if(event > 0){
-															// Если функция обратного вызова установлена
-															if(item->callback != nullptr){
-																// Выполняем поиск события таймера присутствует в базе событий
-																auto j = item->mode.find(event_type_t::TIMER);
-																// Если событие найдено и оно активированно
-																if((j != item->mode.end()) && (j->second == event_mode_t::ENABLED))
-																	// Выполняем функцию обратного вызова
-																	std::apply(item->callback, std::make_tuple(item->sock, event_type_t::TIMER));
-															}
-															// Выполняем поиск файлового дескриптора в базе событий
-															auto j = this->_peers.find(sock);
-															// Если сокет есть в базе событий
-															if((j != this->_peers.end()) && (id == j->second.id)){
-																// Если таймер установлен как персистентный
-																if(j->second.persist){
-																	// Выполняем поиск события таймера присутствует в базе событий
-																	auto k = j->second.mode.find(event_type_t::TIMER);
-																	// Если событие найдено и оно активированно
-																	if((k != j->second.mode.end()) && (k->second == event_mode_t::ENABLED))
-																		// Выполняем активацию таймера на указанное время
-																		this->_watch.wait(j->second.sock, j->second.delay);
-																}
-															}
-														// Удаляем сокет из базы событий
-														} else this->del(item->id, item->sock);
+														// Если сработали часы колеса таймеров
+														if(item == &this->_clock){
+															// Выполняем чтение количества срабатываний часов
+															this->_watch.event(sock);
+															// Выполняем обработку сработавших таймеров
+															this->timers();
+														}
 													} break;
 													// Если событие принадлежит к потоку
 													case static_cast <uint8_t> (event_type_t::STREAM): {
@@ -4338,6 +4502,122 @@ void awh::Base::rate(const uint32_t msec) noexcept {
 	// Выполняем сброс времени ожидания
 	else this->_rate = -1;
 }
+/**
+ * @brief Метод установки разрешения таймеров базы событий
+ *
+ * @param usec разрешение таймеров в микросекундах
+ */
+void awh::Base::resolution(const uint32_t usec) noexcept {
+	/**
+	 * Для операционной системы Linux
+	 */
+	#if __linux__
+		// Выполняем установку разрешения колеса таймеров
+		this->_watch.resolution(usec);
+	/**
+	 * Для всех остальных операционных систем
+	 */
+	#else
+		// Точность таймеров определяется потоком часов
+		(void) usec;
+	#endif
+}
+/**
+ * @brief Метод выбора движка io_uring вместо EPoll (только для Linux)
+ *
+ * @param mode флаг использования io_uring
+ * @return     результат переключения движка
+ */
+bool awh::Base::uring(const bool mode) noexcept {
+	/**
+	 * Для операционной системы Linux собранной с поддержкой io_uring
+	 */
+	#if __linux__ && defined(AWH_IOURING)
+		// Если метод запущен в дочернем потоке
+		if(this->isChildThread()){
+			// Выводим сообщение об ошибке
+			this->_log->print("Method \"%s\" cannot be called in a child thread", log_t::flag_t::WARNING, __FUNCTION__);
+			// Выходим из функции
+			return false;
+		}
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Если движок уже выбран
+		if(this->_iouring == mode)
+			// Выходим из функции
+			return true;
+		// Выполняем блокировку чтения базы событий
+		this->_locker = true;
+		// Выполняем закрытие текущего движка
+		this->init(event_mode_t::DISABLED);
+		// Устанавливаем флаг использования io_uring
+		this->_iouring = mode;
+		// Выполняем инициализацию нового движка (при отсутствии поддержки io_uring будет выбран EPoll)
+		this->init(event_mode_t::ENABLED);
+		// Выполняем перебор всех зарегистрированных событий
+		for(auto & event : this->_change){
+			// Получаем объект участника
+			peer_t * item = reinterpret_cast <peer_t *> (event.data.ptr);
+			// Если участник не является таймером (таймеры обслуживаются колесом таймеров)
+			if((item != nullptr) && (item->type != event_type_t::TIMER)){
+				// Выполняем регистрацию события в новом движке
+				if(this->ctl(EPOLL_CTL_ADD, item->sock, &event) != 0)
+					// Выводим сообщение что событие не вышло активировать
+					this->_log->print("Failed activate event for SOCKET=%d", log_t::flag_t::WARNING, item->sock);
+			}
+		}
+		// Выполняем разблокировку чтения базы событий
+		this->_locker = false;
+		// Выводим результат
+		return (this->_iouring == mode);
+	/**
+	 * Для операционной системы Linux собранной без поддержки io_uring
+	 */
+	#elif __linux__
+		// Если требуется активировать io_uring
+		if(mode)
+			// Выводим сообщение об ошибке
+			this->_log->print("Library is built without io_uring support", log_t::flag_t::WARNING);
+		// Выводим результат
+		return !mode;
+	/**
+	 * Для всех остальных операционных систем
+	 */
+	#else
+		// Если требуется активировать io_uring
+		if(mode)
+			// Выводим сообщение об ошибке
+			this->_log->print("io_uring is only available on Linux", log_t::flag_t::WARNING);
+		// Выводим результат
+		return !mode;
+	#endif
+}
+/**
+ * @brief Метод получения количества системных вызовов движка событий
+ *
+ * @return количество системных вызовов (только для Linux)
+ */
+uint64_t awh::Base::syscalls() const noexcept {
+	/**
+	 * Для операционной системы Linux собранной с поддержкой io_uring
+	 */
+	#if __linux__ && defined(AWH_IOURING)
+		// Выводим количество системных вызовов EPoll и io_uring
+		return (this->_syscalls + this->_uring.syscalls());
+	/**
+	 * Для операционной системы Linux
+	 */
+	#elif __linux__
+		// Выводим количество системных вызовов EPoll
+		return this->_syscalls;
+	/**
+	 * Для всех остальных операционных систем
+	 */
+	#else
+		// Подсчёт системных вызовов не поддерживается
+		return 0;
+	#endif
+}
 /**
  * @brief Метод отправки сообщения между потоками
  *
@@ -4528,6 +4808,17 @@ awh::Base::Base(const fmk_t * fmk, const log_t * log) noexcept :
  _wid(0), _rate(-1),
  _works(false), _easily(false),
  _locker(false), _launched(false),
+/**
+ * Для операционной системы Linux собранной с поддержкой io_uring
+ */
+#if __linux__ && defined(AWH_IOURING)
+ _efd(INVALID_SOCKET), _iouring(true), _syscalls(0), _uring(log),
+/**
+ * Для операционной системы Linux
+ */
+#elif __linux__
+ _efd(INVALID_SOCKET), _iouring(false), _syscalls(0),
+#endif
  _fds(log), _watch(fmk, log), _fmk(fmk), _log(log) {
 	// Получаем идентификатор потока
 	this->_wid = this->wid();
@@ -0,0 +1,677 @@
+/**
+ * @file: uring.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <events/uring.hpp>
+
+/**
+ * Для операционной системы Linux собранной с поддержкой io_uring
+ */
+#if __linux__ && defined(AWH_IOURING)
+
+/**
+ * Подписываемся на стандартное пространство имён
+ */
+using namespace std;
+
+/**
+ * Идентификатор служебных запросов, события которых не требуют обработки
+ */
+#define AWH_URING_IGNORE UINT64_MAX
+
+/**
+ * @brief Функция подготовки маски событий опроса
+ *
+ * @param events маска событий в формате EPoll
+ * @return       маска событий для запроса IORING_OP_POLL_ADD
+ */
+static uint32_t pollMask(const uint32_t events) noexcept {
+	// Снимаем флаги режимов, опрос всегда однократный и перевзводится движком
+	uint32_t result = (events & ~(EPOLLET | EPOLLONESHOT | EPOLLEXCLUSIVE));
+	/**
+	 * Для архитектур с обратным порядком байт
+	 */
+	#if __BYTE_ORDER == __BIG_ENDIAN
+		// Ядро ожидает маску с переставленными полусловами
+		result = ((result << 16) | (result >> 16));
+	#endif
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения свободного запроса очереди отправки
+ *
+ * @return свободный запрос очереди отправки
+ */
+struct io_uring_sqe * awh::URing::sqe() noexcept {
+	// Получаем хвост очереди отправки
+	const uint32_t tail = (* this->_sqTail);
+	// Получаем голову очереди отправки
+	uint32_t head = __atomic_load_n(this->_sqHead, __ATOMIC_ACQUIRE);
+	// Если очередь отправки заполнена
+	if((tail - head) >= this->_sqEntries){
+		// Отправляем накопленные запросы в ядро
+		this->enter(0, 0);
+		// Получаем голову очереди отправки повторно
+		head = __atomic_load_n(this->_sqHead, __ATOMIC_ACQUIRE);
+		// Если очередь так и не освободилась
+		if((tail - head) >= this->_sqEntries)
+			// Выходим из функции
+			return nullptr;
+	}
+	// Получаем свободный запрос очереди отправки
+	struct io_uring_sqe * result = &this->_sqes[tail & (* this->_sqMask)];
+	// Заполняем запрос нулями
+	::memset(result, 0, sizeof(struct io_uring_sqe));
+	// Публикуем запрос в очереди отправки (ядро прочитает его только при вызове io_uring_enter)
+	__atomic_store_n(this->_sqTail, tail + 1, __ATOMIC_RELEASE);
+	// Запоминаем количество неотправленных запросов
+	this->_pending = ((tail + 1) - head);
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод взведения опроса файлового дескриптора
+ *
+ * @param sock     файловый дескриптор для опроса
+ * @param interest интерес к файловому дескриптору
+ * @return         результат работы функции
+ */
+bool awh::URing::arm(const SOCKET sock, interest_t & interest) noexcept {
+	// Получаем свободный запрос очереди отправки
+	struct io_uring_sqe * sqe = this->sqe();
+	// Если запрос получен
+	if(sqe != nullptr){
+		// Устанавливаем новое поколение опроса
+		interest.gen = ++this->_gen;
+		// Устанавливаем операцию опроса файлового дескриптора
+		sqe->opcode = IORING_OP_POLL_ADD;
+		// Устанавливаем файловый дескриптор
+		sqe->fd = sock;
+		// Устанавливаем отслеживаемые события
+		sqe->poll32_events = pollMask(interest.events);
+		// Устанавливаем идентификатор опроса из поколения и файлового дескриптора
+		sqe->user_data = ((static_cast <uint64_t> (interest.gen) << 32) | static_cast <uint32_t> (sock));
+		// Запоминаем индекс запроса в очереди отправки
+		interest.index = static_cast <uint32_t> (sqe - this->_sqes);
+		// Помечаем опрос взведённым и ещё не отправленным
+		interest.armed = interest.queued = true;
+		// Добавляем сокет в список неотправленных запросов
+		this->_queued.push_back(sock);
+		// Выводим результат
+		return true;
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод снятия опроса файлового дескриптора
+ *
+ * @param sock     файловый дескриптор опроса
+ * @param interest интерес к файловому дескриптору
+ * @return         результат работы функции
+ */
+bool awh::URing::disarm(const SOCKET sock, interest_t & interest) noexcept {
+	// Если опрос не взведён
+	if(!interest.armed)
+		// Выходим из функции
+		return true;
+	// Если запрос ещё не отправлен в ядро
+	if(interest.queued){
+		// Получаем неотправленный запрос
+		struct io_uring_sqe * sqe = &this->_sqes[interest.index];
+		// Заполняем запрос нулями
+		::memset(sqe, 0, sizeof(struct io_uring_sqe));
+		// Превращаем запрос в пустую операцию
+		sqe->opcode = IORING_OP_NOP;
+		// Помечаем запрос как служебный
+		sqe->user_data = AWH_URING_IGNORE;
+	// Если запрос уже находится в ядре
+	} else {
+		// Получаем свободный запрос очереди отправки
+		struct io_uring_sqe * sqe = this->sqe();
+		// Если запрос не получен
+		if(sqe == nullptr)
+			// Выходим из функции
+			return false;
+		// Устанавливаем операцию снятия опроса
+		sqe->opcode = IORING_OP_POLL_REMOVE;
+		// Устанавливаем идентификатор снимаемого опроса
+		sqe->addr = ((static_cast <uint64_t> (interest.gen) << 32) | static_cast <uint32_t> (sock));
+		// Помечаем запрос как служебный
+		sqe->user_data = AWH_URING_IGNORE;
+	}
+	// Сбрасываем поколение опроса, чтобы запоздавшие события были проигнорированы
+	interest.gen = 0;
+	// Снимаем флаги опроса
+	interest.armed = interest.queued = false;
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод извлечения событий из очереди завершения
+ *
+ * @param events список для получения событий
+ * @param max    максимальное количество событий
+ * @return       количество полученных событий
+ */
+int32_t awh::URing::reap(struct epoll_event * events, const int32_t max) noexcept {
+	// Результат работы функции
+	int32_t result = 0;
+	// Получаем голову очереди завершения
+	uint32_t head = (* this->_cqHead);
+	// Получаем хвост очереди завершения
+	const uint32_t tail = __atomic_load_n(this->_cqTail, __ATOMIC_ACQUIRE);
+	// Выполняем перебор всех завершённых запросов
+	while((head != tail) && (result < max)){
+		// Получаем завершённый запрос
+		const struct io_uring_cqe * cqe = &this->_cqes[head & (* this->_cqMask)];
+		// Смещаем голову очереди завершения
+		head++;
+		// Если запрос служебный
+		if(cqe->user_data == AWH_URING_IGNORE)
+			// Пропускаем запрос
+			continue;
+		// Выполняем поиск интереса к файловому дескриптору
+		auto i = this->_interests.find(static_cast <SOCKET> (cqe->user_data & 0xFFFFFFFF));
+		// Если интерес не найден или опрос относится к прошлому поколению
+		if((i == this->_interests.end()) || (i->second.gen != static_cast <uint32_t> (cqe->user_data >> 32)))
+			// Пропускаем запрос
+			continue;
+		// Опрос сработал и больше не взведён
+		i->second.armed = i->second.queued = false;
+		// Если опрос был отменён ядром
+		if(cqe->res == -ECANCELED)
+			// Выполняем перевзведение опроса
+			this->arm(i->first, i->second);
+		// Если опрос завершился ошибкой
+		else if(cqe->res < 0) {
+			// Устанавливаем событие ошибки
+			events[result].events = EPOLLERR;
+			// Устанавливаем пользовательские данные события
+			events[result++].data = i->second.data;
+		// Если опрос завершился успешно
+		} else {
+			// Устанавливаем сработавшие события
+			events[result].events = (static_cast <uint32_t> (cqe->res) & (i->second.events | EPOLLERR | EPOLLHUP));
+			// Устанавливаем пользовательские данные события
+			events[result++].data = i->second.data;
+			// Перевзводим опрос, запрос уйдёт в ядро вместе со следующим ожиданием (эмуляция level-triggered)
+			this->arm(i->first, i->second);
+		}
+	}
+	// Освобождаем прочитанные события очереди завершения
+	__atomic_store_n(this->_cqHead, head, __ATOMIC_RELEASE);
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод отправки накопленных запросов и ожидания событий
+ *
+ * @param wait    минимальное количество ожидаемых событий
+ * @param timeout время ожидания в миллисекундах
+ * @return        результат работы функции
+ */
+int32_t awh::URing::enter(const uint32_t wait, const int32_t timeout) noexcept {
+	// Флаги вызова io_uring_enter
+	uint32_t flags = 0;
+	// Время ожидания событий
+	struct __kernel_timespec ts;
+	// Расширенные параметры ожидания событий
+	struct io_uring_getevents_arg arg;
+	// Заполняем структуры нулями
+	::memset(&ts, 0, sizeof(ts));
+	::memset(&arg, 0, sizeof(arg));
+	// Если необходимо дождаться событий
+	if(wait > 0){
+		// Устанавливаем флаги ожидания событий
+		flags = (IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG);
+		// Если время ожидания ограничено
+		if(timeout >= 0){
+			// Устанавливаем количество секунд ожидания
+			ts.tv_sec = (timeout / 1000);
+			// Устанавливаем количество наносекунд ожидания
+			ts.tv_nsec = ((timeout % 1000) * 1000000);
+			// Устанавливаем время ожидания
+			arg.ts = reinterpret_cast <uint64_t> (&ts);
+		}
+	}
+	// Количество запросов отправляемых в ядро
+	uint32_t pending = 0;
+	{
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Увеличиваем количество системных вызовов
+		this->_syscalls++;
+		// Запоминаем количество отправляемых запросов
+		pending = this->_pending;
+		// Выполняем перебор всех сокетов с неотправленными запросами
+		for(auto & sock : this->_queued){
+			// Выполняем поиск интереса к файловому дескриптору
+			auto i = this->_interests.find(sock);
+			// Если интерес найден
+			if(i != this->_interests.end())
+				// Запрос уходит в ядро и больше не может быть изменён на месте
+				i->second.queued = false;
+		}
+		// Выполняем очистку списка неотправленных запросов
+		this->_queued.clear();
+	}
+	// Выполняем отправку запросов и ожидание событий одним системным вызовом (ожидание выполняется без блокировки)
+	const int32_t result = static_cast <int32_t> (::syscall(
+		__NR_io_uring_enter, this->_fd, pending, wait, flags,
+		(wait > 0 ? &arg : nullptr), (wait > 0 ? sizeof(arg) : 0)
+	));
+	{
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Получаем количество оставшихся неотправленных запросов
+		this->_pending = ((* this->_sqTail) - __atomic_load_n(this->_sqHead, __ATOMIC_ACQUIRE));
+	}
+	// Если возникла ошибка
+	if(result < 0){
+		/**
+		 * Определяем тип ошибки
+		 */
+		switch(errno){
+			// Если время ожидания вышло
+			case ETIME:
+			// Если ожидание прервано сигналом
+			case EINTR:
+			// Если очередь завершения переполнена
+			case EBUSY:
+			// Если ядру временно не хватает ресурсов
+			case EAGAIN:
+				// Ошибка не является критической
+				return 0;
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод отправки накопленных запросов во время ожидания событий потоком событий
+ *
+ * @return результат работы функции
+ */
+int32_t awh::URing::submit() noexcept {
+	// Если поток событий ожидает в ядре, запросы другого потока не должны ждать его пробуждения
+	if(this->_waiting && (this->_pending > 0))
+		// Отправляем запросы в ядро без ожидания событий (при ошибке запросы уйдут со следующим ожиданием)
+		this->enter(0, 0);
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод проверки активности движка
+ *
+ * @return результат проверки
+ */
+bool awh::URing::active() const noexcept {
+	// Выводим результат проверки
+	return (this->_fd != INVALID_SOCKET);
+}
+/**
+ * @brief Метод получения количества выполненных системных вызовов
+ *
+ * @return количество системных вызовов
+ */
+uint64_t awh::URing::syscalls() const noexcept {
+	// Выводим количество системных вызовов
+	return this->_syscalls;
+}
+/**
+ * @brief Метод закрытия движка
+ *
+ */
+void awh::URing::close() noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Если массив запросов очереди отправки создан
+	if(this->_sqes != nullptr)
+		// Удаляем массив запросов очереди отправки
+		::munmap(this->_sqes, this->_sqesSize);
+	// Если кольцо очереди завершения создано отдельно
+	if((this->_cq != nullptr) && (this->_cq != this->_sq))
+		// Удаляем кольцо очереди завершения
+		::munmap(this->_cq, this->_cqSize);
+	// Если кольцо очереди отправки создано
+	if(this->_sq != nullptr)
+		// Удаляем кольцо очереди отправки
+		::munmap(this->_sq, this->_sqSize);
+	// Если файловый дескриптор io_uring открыт
+	if(this->_fd != INVALID_SOCKET)
+		// Выполняем закрытие файлового дескриптора
+		::close(this->_fd);
+	// Сбрасываем файловый дескриптор io_uring
+	this->_fd = INVALID_SOCKET;
+	// Сбрасываем кольца очередей
+	this->_sq = this->_cq = nullptr;
+	// Сбрасываем массивы запросов и событий
+	this->_sqes = nullptr;
+	this->_cqes = nullptr;
+	// Сбрасываем количество неотправленных запросов
+	this->_pending = 0;
+	// Выполняем очистку списка неотправленных запросов
+	this->_queued.clear();
+	// Выполняем очистку списка интересов
+	this->_interests.clear();
+}
+/**
+ * @brief Метод инициализации движка
+ *
+ * @param entries размер очереди отправки
+ * @return        результат инициализации (false если ядро не поддерживает io_uring)
+ */
+bool awh::URing::init(const uint32_t entries) noexcept {
+	// Выполняем закрытие ранее открытого движка
+	this->close();
+	// Параметры создаваемого io_uring
+	struct io_uring_params params;
+	// Заполняем структуру нулями
+	::memset(&params, 0, sizeof(params));
+	// Выполняем создание io_uring
+	const int32_t fd = static_cast <int32_t> (::syscall(__NR_io_uring_setup, entries, &params));
+	// Если ядро не поддерживает io_uring или его использование запрещено
+	if(fd < 0)
+		// Выходим из функции
+		return false;
+	// Запоминаем файловый дескриптор io_uring
+	this->_fd = fd;
+	// Если ядро не поддерживает ожидание событий с таймаутом (ядра старше 5.11)
+	if(!(params.features & IORING_FEAT_EXT_ARG)){
+		// Выполняем закрытие движка
+		this->close();
+		// Выходим из функции
+		return false;
+	}
+	// Получаем размер кольца очереди отправки
+	this->_sqSize = (params.sq_off.array + params.sq_entries * sizeof(uint32_t));
+	// Получаем размер кольца очереди завершения
+	this->_cqSize = (params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+	// Получаем размер массива запросов
+	this->_sqesSize = (params.sq_entries * sizeof(struct io_uring_sqe));
+	// Если оба кольца отображаются одним блоком памяти
+	if(params.features & IORING_FEAT_SINGLE_MMAP)
+		// Устанавливаем общий размер колец
+		this->_sqSize = this->_cqSize = std::max(this->_sqSize, this->_cqSize);
+	// Выполняем отображение кольца очереди отправки
+	void * sq = ::mmap(nullptr, this->_sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	// Если отображение не выполнено
+	if(sq == MAP_FAILED){
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(entries), log_t::flag_t::CRITICAL, ::strerror(errno));
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
+		#endif
+		// Выполняем закрытие движка
+		this->close();
+		// Выходим из функции
+		return false;
+	}
+	// Запоминаем кольцо очереди отправки
+	this->_sq = sq;
+	// Если оба кольца отображаются одним блоком памяти
+	if(params.features & IORING_FEAT_SINGLE_MMAP)
+		// Используем кольцо очереди отправки
+		this->_cq = this->_sq;
+	// Если кольца отображаются раздельно
+	else {
+		// Выполняем отображение кольца очереди завершения
+		void * cq = ::mmap(nullptr, this->_cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+		// Если отображение не выполнено
+		if(cq == MAP_FAILED){
+			// Выполняем закрытие движка
+			this->close();
+			// Выходим из функции
+			return false;
+		}
+		// Запоминаем кольцо очереди завершения
+		this->_cq = cq;
+	}
+	// Выполняем отображение массива запросов
+	void * sqes = ::mmap(nullptr, this->_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	// Если отображение не выполнено
+	if(sqes == MAP_FAILED){
+		// Выполняем закрытие движка
+		this->close();
+		// Выходим из функции
+		return false;
+	}
+	// Запоминаем массив запросов
+	this->_sqes = reinterpret_cast <struct io_uring_sqe *> (sqes);
+	// Получаем указатели кольца очереди отправки
+	this->_sqHead = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_sq) + params.sq_off.head);
+	this->_sqTail = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_sq) + params.sq_off.tail);
+	this->_sqMask = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_sq) + params.sq_off.ring_mask);
+	// Получаем указатели кольца очереди завершения
+	this->_cqHead = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_cq) + params.cq_off.head);
+	this->_cqTail = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_cq) + params.cq_off.tail);
+	this->_cqMask = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_cq) + params.cq_off.ring_mask);
+	// Получаем массив событий очереди завершения
+	this->_cqes = reinterpret_cast <struct io_uring_cqe *> (reinterpret_cast <char *> (this->_cq) + params.cq_off.cqes);
+	// Запоминаем количество записей очереди отправки
+	this->_sqEntries = params.sq_entries;
+	// Получаем массив индексов очереди отправки
+	uint32_t * array = reinterpret_cast <uint32_t *> (reinterpret_cast <char *> (this->_sq) + params.sq_off.array);
+	// Индексы очереди отправки всегда совпадают с позициями запросов
+	for(uint32_t i = 0; i < params.sq_entries; i++)
+		// Устанавливаем индекс запроса
+		array[i] = i;
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод изменения интереса к файловому дескриптору (аналог epoll_ctl)
+ *
+ * @param op    операция EPOLL_CTL_ADD, EPOLL_CTL_MOD или EPOLL_CTL_DEL
+ * @param sock  файловый дескриптор
+ * @param event параметры события
+ * @return      0 при успешном выполнении или -1 при ошибке
+ */
+int32_t awh::URing::ctl(const int32_t op, const SOCKET sock, struct epoll_event * event) noexcept {
+	// Если движок не инициализирован
+	if(this->_fd == INVALID_SOCKET){
+		// Устанавливаем код ошибки
+		errno = EBADF;
+		// Выходим из функции
+		return -1;
+	}
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	/**
+	 * Выполняем перехват ошибок
+	 */
+	try {
+		/**
+		 * Определяем тип операции
+		 */
+		switch(op){
+			// Если необходимо добавить файловый дескриптор
+			case EPOLL_CTL_ADD: {
+				// Если параметры события не переданы
+				if(event == nullptr)
+					// Устанавливаем код ошибки
+					errno = EINVAL;
+				// Если параметры события переданы
+				else {
+					// Выполняем добавление интереса к файловому дескриптору
+					auto ret = this->_interests.emplace(sock, interest_t());
+					// Если файловый дескриптор уже отслеживается
+					if(!ret.second)
+						// Устанавливаем код ошибки
+						errno = EEXIST;
+					// Если интерес добавлен
+					else {
+						// Устанавливаем отслеживаемые события
+						ret.first->second.events = event->events;
+						// Устанавливаем пользовательские данные события
+						ret.first->second.data = event->data;
+						// Выполняем взведение опроса
+						if(this->arm(sock, ret.first->second))
+							// Отправляем запрос и выходим из функции
+							return this->submit();
+						// Удаляем интерес к файловому дескриптору
+						this->_interests.erase(ret.first);
+						// Устанавливаем код ошибки
+						errno = EBUSY;
+					}
+				}
+			} break;
+			// Если необходимо изменить отслеживаемые события
+			case EPOLL_CTL_MOD: {
+				// Выполняем поиск интереса к файловому дескриптору
+				auto i = this->_interests.find(sock);
+				// Если файловый дескриптор не отслеживается
+				if(i == this->_interests.end())
+					// Устанавливаем код ошибки
+					errno = ENOENT;
+				// Если параметры события не переданы
+				else if(event == nullptr)
+					// Устанавливаем код ошибки
+					errno = EINVAL;
+				// Если интерес найден
+				else {
+					// Устанавливаем пользовательские данные события
+					i->second.data = event->data;
+					// Если отслеживаемые события не изменились и опрос взведён, системный вызов не требуется
+					if((i->second.events == event->events) && i->second.armed)
+						// Выходим из функции
+						return 0;
+					// Устанавливаем отслеживаемые события
+					i->second.events = event->events;
+					// Если запрос опроса ещё не отправлен в ядро
+					if(i->second.queued){
+						// Правим отслеживаемые события прямо в неотправленном запросе
+						this->_sqes[i->second.index].poll32_events = pollMask(i->second.events);
+						// Отправляем запрос и выходим из функции
+						return this->submit();
+					}
+					// Выполняем снятие старого опроса и взведение нового
+					if(this->disarm(sock, i->second) && this->arm(sock, i->second))
+						// Отправляем запрос и выходим из функции
+						return this->submit();
+					// Устанавливаем код ошибки
+					errno = EBUSY;
+				}
+			} break;
+			// Если необходимо удалить файловый дескриптор
+			case EPOLL_CTL_DEL: {
+				// Выполняем поиск интереса к файловому дескриптору
+				auto i = this->_interests.find(sock);
+				// Если файловый дескриптор не отслеживается
+				if(i == this->_interests.end())
+					// Устанавливаем код ошибки
+					errno = ENOENT;
+				// Если интерес найден
+				else {
+					// Выполняем снятие опроса
+					const bool result = this->disarm(sock, i->second);
+					// Удаляем интерес к файловому дескриптору
+					this->_interests.erase(i);
+					// Если опрос снят
+					if(result)
+						// Отправляем запрос и выходим из функции
+						return this->submit();
+					// Устанавливаем код ошибки
+					errno = EBUSY;
+				}
+			} break;
+			// Если операция неизвестна
+			default: errno = EINVAL;
+		}
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(op, sock), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+		// Устанавливаем код ошибки
+		errno = ENOMEM;
+	}
+	// Выводим результат
+	return -1;
+}
+/**
+ * @brief Метод ожидания событий (аналог epoll_wait)
+ *
+ * @param events  список для получения событий
+ * @param max     максимальное количество событий
+ * @param timeout время ожидания в миллисекундах
+ * @return        количество полученных событий или -1 при ошибке
+ */
+int32_t awh::URing::wait(struct epoll_event * events, const int32_t max, const int32_t timeout) noexcept {
+	// Если движок не инициализирован
+	if(this->_fd == INVALID_SOCKET){
+		// Устанавливаем код ошибки
+		errno = EBADF;
+		// Выходим из функции
+		return -1;
+	}
+	{
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Забираем события уже находящиеся в очереди завершения без системного вызова
+		const int32_t result = this->reap(events, max);
+		// Если события получены или ожидание событий не требуется
+		if((result > 0) || ((timeout == 0) && (this->_pending == 0)))
+			// Выводим результат
+			return result;
+		// Устанавливаем флаг ожидания событий в ядре
+		this->_waiting = (timeout != 0);
+	}
+	// Выполняем отправку запросов и ожидание событий одним системным вызовом
+	const int32_t result = this->enter((timeout != 0 ? 1 : 0), timeout);
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Снимаем флаг ожидания событий в ядре
+	this->_waiting = false;
+	// Если возникла ошибка
+	if(result < 0)
+		// Выходим из функции
+		return -1;
+	// Забираем полученные события
+	return this->reap(events, max);
+}
+/**
+ * @brief Деструктор
+ *
+ */
+awh::URing::~URing() noexcept {
+	// Выполняем закрытие движка
+	this->close();
+}
+
+#endif // __linux__ && AWH_IOURING
@@ -28,90 +28,271 @@ using namespace std;
 using namespace placeholders;
 
 /**
- * @brief Метод обработки событий триггера
- *
+ * Для операционной системы Linux
  */
-void awh::Watch::trigger() noexcept {
+#if __linux__
 	/**
-	 * Выполняем перехват ошибок
+	 * @brief Метод получения монотонного времени в наносекундах
+	 *
+	 * @return текущее монотонное время
 	 */
-	try {
-		// Выполняем блокировку потока
-		this->_mtx.lock();
-		// Получаем текущее значение даты
-		const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::NANOSECONDS);
-		// Выполняем перебор всего списка таймеров
-		for(auto i = this->_timers.begin(); i != this->_timers.end();){
-			// Если время вышло
-			if(date >= i->first.first){
-				// Выполняем поиск файловый дескриптор
-				auto j = this->_notifiers.find(i->second);
-				// Если файловый дескриптор найден в списке
-				if(j != this->_notifiers.end())
-					// Выполняем отправку сообщения
-					j->second->notify((date - i->first.second) / 1000000);
-				// Выполняем удаление значение таймера
-				i = this->_timers.erase(i);
-			// Продолжаем перебор дальше
-			} else ++i;
+	uint64_t awh::Watch::now() const noexcept {
+		// Объект текущего времени
+		struct timespec date = {0, 0};
+		// Получаем монотонное время, по которому работают часы колеса
+		::clock_gettime(CLOCK_MONOTONIC, &date);
+		// Выводим время в наносекундах
+		return ((static_cast <uint64_t> (date.tv_sec) * 1000000000ULL) + static_cast <uint64_t> (date.tv_nsec));
+	}
+	/**
+	 * @brief Метод привязки таймера к слоту колеса
+	 *
+	 * @param index индекс таймера
+	 */
+	void awh::Watch::link(const uint32_t index) noexcept {
+		// Получаем объект таймера
+		unit_t & unit = this->_units[index];
+		// Получаем номер слота колеса
+		const size_t slot = static_cast <size_t> (unit.target % AWH_WATCH_SLOTS);
+		// Таймер становится первым в слоте
+		unit.prev = UINT32_MAX;
+		// Следующим становится бывший первый таймер слота
+		unit.next = this->_slots[slot];
+		// Если слот уже содержит таймеры
+		if(unit.next != UINT32_MAX)
+			// Устанавливаем обратную ссылку
+			this->_units[unit.next].prev = index;
+		// Устанавливаем таймер первым в слоте
+		this->_slots[slot] = index;
+		// Помечаем слот как занятый
+		this->_bits[slot / 64] |= (1ULL << (slot % 64));
+		// Помечаем таймер как взведённый
+		unit.armed = true;
+		// Увеличиваем количество взведённых таймеров
+		this->_count++;
+	}
+	/**
+	 * @brief Метод отвязки таймера от слота колеса
+	 *
+	 * @param index индекс таймера
+	 */
+	void awh::Watch::unlink(const uint32_t index) noexcept {
+		// Получаем объект таймера
+		unit_t & unit = this->_units[index];
+		// Если таймер взведён
+		if(unit.armed){
+			// Получаем номер слота колеса
+			const size_t slot = static_cast <size_t> (unit.target % AWH_WATCH_SLOTS);
+			// Если предыдущий таймер существует
+			if(unit.prev != UINT32_MAX)
+				// Связываем предыдущий таймер со следующим
+				this->_units[unit.prev].next = unit.next;
+			// Иначе таймер был первым в слоте
+			else this->_slots[slot] = unit.next;
+			// Если следующий таймер существует
+			if(unit.next != UINT32_MAX)
+				// Связываем следующий таймер с предыдущим
+				this->_units[unit.next].prev = unit.prev;
+			// Если слот опустел
+			if(this->_slots[slot] == UINT32_MAX)
+				// Помечаем слот как свободный
+				this->_bits[slot / 64] &= ~(1ULL << (slot % 64));
+			// Сбрасываем ссылки таймера
+			unit.prev = unit.next = UINT32_MAX;
+			// Снимаем флаг взведённого таймера
+			unit.armed = false;
+			// Уменьшаем количество взведённых таймеров
+			this->_count--;
 		}
-		// Выполняем разблокировку потока
-		this->_mtx.unlock();
-		// Если список таймеров не пустой
-		if(!this->_timers.empty()){
-			// Получаем наименьшее значение даты в списке
-			const uint64_t smallest = this->_timers.begin()->first.first;
-			// Если время задержки выше нуля
-			if((smallest > date ? (smallest - date) : 0) > 0){
-				// Выполняем смену времени таймера
-				this->_screen = static_cast <uint64_t> (smallest - date);
-				// Выходим из функции
-				return;
+	}
+	/**
+	 * @brief Метод извлечения сработавших таймеров слота
+	 *
+	 * @param slot   номер слота колеса
+	 * @param timers список сработавших таймеров
+	 */
+	void awh::Watch::sweep(const size_t slot, vector <SOCKET> & timers) noexcept {
+		// Выполняем перебор всех таймеров слота
+		for(uint32_t index = this->_slots[slot]; index != UINT32_MAX;){
+			// Запоминаем следующий таймер слота
+			const uint32_t next = this->_units[index].next;
+			// Если время таймера вышло
+			if(this->_units[index].target <= this->_tick){
+				// Выполняем отвязку таймера от колеса
+				this->unlink(index);
+				// Добавляем таймер в список сработавших
+				timers.push_back(static_cast <SOCKET> (AWH_WATCH_TIMER_ID + index));
 			}
+			// Переходим к следующему таймеру
+			index = next;
 		}
-		// Устанавливаем таймаут по умолчанию
-		this->_screen.timeout();
+	}
 	/**
-	 * Если возникает ошибка
+	 * @brief Метод взведения часов на ближайший занятый слот колеса
+	 *
 	 */
-	} catch(const exception & error) {
+	void awh::Watch::schedule() noexcept {
+		// Количество шагов до ближайшего занятого слота
+		uint64_t steps = 0;
+		// Если взведённые таймеры существуют
+		if(this->_count > 0){
+			// Выполняем перебор слотов колеса начиная со следующего тика
+			for(uint64_t i = 1; i <= AWH_WATCH_SLOTS;){
+				// Получаем номер проверяемого слота
+				const size_t slot = static_cast <size_t> ((this->_tick + i) % AWH_WATCH_SLOTS);
+				// Получаем оставшиеся биты слова карты начиная с проверяемого слота
+				const uint64_t bits = (this->_bits[slot / 64] >> (slot % 64));
+				// Если в слове карты есть занятые слоты
+				if(bits != 0){
+					// Получаем количество шагов до занятого слота
+					steps = (i + static_cast <uint64_t> (__builtin_ctzll(bits)));
+					// Выходим из цикла
+					break;
+				}
+				// Переходим к следующему слову карты
+				i += (64 - (slot % 64));
+			}
+			// Если занятый слот находится за пределами полного оборота колеса
+			if(steps > AWH_WATCH_SLOTS)
+				// Ограничиваем количество шагов одним оборотом
+				steps = AWH_WATCH_SLOTS;
+		}
+		// Если тик срабатывания часов изменился
+		if((steps > 0 ? (this->_tick + steps) : 0) != this->_deadline){
+			// Объект параметров часов
+			struct itimerspec spec;
+			// Заполняем структуру нулями
+			::memset(&spec, 0, sizeof(spec));
+			// Запоминаем тик срабатывания часов
+			this->_deadline = (steps > 0 ? (this->_tick + steps) : 0);
+			// Если часы необходимо взвести
+			if(steps > 0){
+				// Получаем время срабатывания часов
+				const uint64_t date = (this->_last + (steps * this->_resolution));
+				// Устанавливаем время срабатывания в секундах
+				spec.it_value.tv_sec = static_cast <time_t> (date / 1000000000ULL);
+				// Устанавливаем время срабатывания в наносекундах
+				spec.it_value.tv_nsec = static_cast <long> (date % 1000000000ULL);
+			}
+			// Выполняем установку часов
+			if(::timerfd_settime(this->_fd, TFD_TIMER_ABSTIME, &spec, nullptr) == INVALID_SOCKET){
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, ::strerror(errno));
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
+				#endif
+			}
+		}
+	}
+	/**
+	 * @brief Метод получения файлового дескриптора часов колеса таймеров
+	 *
+	 * @return файловый дескриптор часов
+	 */
+	SOCKET awh::Watch::fd() const noexcept {
+		// Выводим файловый дескриптор часов
+		return this->_fd;
+	}
+	/**
+	 * @brief Метод извлечения сработавших таймеров
+	 *
+	 * @param timers список сработавших таймеров
+	 */
+	void awh::Watch::expired(vector <SOCKET> & timers) noexcept {
 		/**
-		 * Если включён режим отладки
+		 * Выполняем перехват ошибок
 		 */
-		#if DEBUG_MODE
-			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		try {
+			// Выполняем блокировку потока
+			const lock_guard <std::mutex> lock(this->_mtx);
+			// Получаем текущее значение времени
+			const uint64_t date = this->now();
+			// Получаем количество прошедших тиков колеса
+			const uint64_t ticks = (date > this->_last ? ((date - this->_last) / this->_resolution) : 0);
+			// Если тики прошли
+			if(ticks > 0){
+				// Запоминаем начальный тик
+				const uint64_t tick = this->_tick;
+				// Выполняем смещение колеса на прошедшее время
+				this->_tick += ticks;
+				// Запоминаем время текущего тика
+				this->_last += (ticks * this->_resolution);
+				// Если взведённые таймеры существуют
+				if(this->_count > 0){
+					// Выполняем перебор пройденных слотов колеса, но не более одного оборота
+					for(uint64_t i = 1; i <= std::min(ticks, static_cast <uint64_t> (AWH_WATCH_SLOTS)); i++){
+						// Получаем номер пройденного слота
+						const size_t slot = static_cast <size_t> ((tick + i) % AWH_WATCH_SLOTS);
+						// Если слот занят
+						if(this->_slots[slot] != UINT32_MAX)
+							// Извлекаем сработавшие таймеры слота
+							this->sweep(slot, timers);
+					}
+				}
+			}
+			// Выполняем взведение часов на ближайший занятый слот
+			this->schedule();
 		/**
-		* Если режим отладки не включён
-		*/
-		#else
-			// Выводим сообщение об ошибке
-			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
-		#endif
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	/**
+	 * @brief Метод установки разрешения колеса таймеров
+	 *
+	 * @param usec разрешение колеса в микросекундах
+	 */
+	void awh::Watch::resolution(const uint32_t usec) noexcept {
+		// Выполняем блокировку потока
+		const lock_guard <std::mutex> lock(this->_mtx);
+		// Если взведённые таймеры существуют
+		if(this->_count > 0)
+			// Выводим сообщение, что разрешение нельзя сменить
+			this->_log->print("Resolution of the timer wheel cannot be changed while timers are armed", log_t::flag_t::WARNING);
+		// Устанавливаем разрешение колеса таймеров
+		else this->_resolution = (static_cast <uint64_t> (usec > 0 ? usec : AWH_WATCH_RESOLUTION) * 1000ULL);
 	}
-}
 /**
- * @brief Метод обработки процесса добавления таймеров
- *
- * @param unit параметры участника
+ * Для всех остальных операционных систем
  */
-void awh::Watch::process(const unit_t unit) noexcept {
+#else
 	/**
-	 * Выполняем перехват ошибок
+	 * @brief Метод обработки событий триггера
+	 *
 	 */
-	try {
-		// Выполняем блокировку потока
-		this->_mtx.lock();
-		// Получаем текущее значение даты
-		const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::NANOSECONDS);
-		// Выполняем перебор всего списка таймеров
-		for(auto i = this->_timers.begin(); i != this->_timers.end();){
-			// Если мы нашли наш таймер
-			if(unit.sock == i->second)
-				// Выполняем удаление значение таймера
-				i = this->_timers.erase(i);
-			// Если это другие таймеры
-			else {
+	void awh::Watch::trigger() noexcept {
+		/**
+		 * Выполняем перехват ошибок
+		 */
+		try {
+			// Выполняем блокировку потока
+			this->_mtx.lock();
+			// Получаем текущее значение даты
+			const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::NANOSECONDS);
+			// Выполняем перебор всего списка таймеров
+			for(auto i = this->_timers.begin(); i != this->_timers.end();){
 				// Если время вышло
 				if(date >= i->first.first){
 					// Выполняем поиск файловый дескриптор
@@ -125,56 +306,159 @@ void awh::Watch::process(const unit_t unit) noexcept {
 				// Продолжаем перебор дальше
 				} else ++i;
 			}
+			// Выполняем разблокировку потока
+			this->_mtx.unlock();
+			// Если список таймеров не пустой
+			if(!this->_timers.empty()){
+				// Получаем наименьшее значение даты в списке
+				const uint64_t smallest = this->_timers.begin()->first.first;
+				// Если время задержки выше нуля
+				if((smallest > date ? (smallest - date) : 0) > 0){
+					// Выполняем смену времени таймера
+					this->_screen = static_cast <uint64_t> (smallest - date);
+					// Выходим из функции
+					return;
+				}
+			}
+			// Устанавливаем таймаут по умолчанию
+			this->_screen.timeout();
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
 		}
-		// Выполняем добавления нового таймера
-		this->_timers.emplace(std::make_pair(unit.delay + date, date), unit.sock);
-		// Получаем наименьшее значение даты в списке
-		const uint64_t smallest = this->_timers.begin()->first.first;
-		// Выполняем разблокировку потока
-		this->_mtx.unlock();
-		// Если время задержки выше нуля
-		if((smallest > date ? (smallest - date) : 0) > 0){
-			// Выполняем смену времени таймера
-			this->_screen = static_cast <uint64_t> (smallest - date);
-			// Выходим из функции
-			return;
-		}
-		// Устанавливаем таймаут по умолчанию
-		this->_screen.timeout();
+	}
 	/**
-	 * Если возникает ошибка
+	 * @brief Метод обработки процесса добавления таймеров
+	 *
+	 * @param unit параметры участника
 	 */
-	} catch(const exception & error) {
+	void awh::Watch::process(const unit_t unit) noexcept {
 		/**
-		 * Если включён режим отладки
+		 * Выполняем перехват ошибок
 		 */
-		#if DEBUG_MODE
-			// Выводим сообщение об ошибке
-			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(unit.sock, unit.delay), log_t::flag_t::CRITICAL, error.what());
+		try {
+			// Выполняем блокировку потока
+			this->_mtx.lock();
+			// Получаем текущее значение даты
+			const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::NANOSECONDS);
+			// Выполняем перебор всего списка таймеров
+			for(auto i = this->_timers.begin(); i != this->_timers.end();){
+				// Если мы нашли наш таймер
+				if(unit.sock == i->second)
+					// Выполняем удаление значение таймера
+					i = this->_timers.erase(i);
+				// Если это другие таймеры
+				else {
+					// Если время вышло
+					if(date >= i->first.first){
+						// Выполняем поиск файловый дескриптор
+						auto j = this->_notifiers.find(i->second);
+						// Если файловый дескриптор найден в списке
+						if(j != this->_notifiers.end())
+							// Выполняем отправку сообщения
+							j->second->notify((date - i->first.second) / 1000000);
+						// Выполняем удаление значение таймера
+						i = this->_timers.erase(i);
+					// Продолжаем перебор дальше
+					} else ++i;
+				}
+			}
+			// Выполняем добавления нового таймера
+			this->_timers.emplace(std::make_pair(unit.delay + date, date), unit.sock);
+			// Получаем наименьшее значение даты в списке
+			const uint64_t smallest = this->_timers.begin()->first.first;
+			// Выполняем разблокировку потока
+			this->_mtx.unlock();
+			// Если время задержки выше нуля
+			if((smallest > date ? (smallest - date) : 0) > 0){
+				// Выполняем смену времени таймера
+				this->_screen = static_cast <uint64_t> (smallest - date);
+				// Выходим из функции
+				return;
+			}
+			// Устанавливаем таймаут по умолчанию
+			this->_screen.timeout();
 		/**
-		* Если режим отладки не включён
-		*/
-		#else
-			// Выводим сообщение об ошибке
-			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
-		#endif
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(unit.sock, unit.delay), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
 	}
-}
+#endif
 /**
  * @brief Метод остановки работы таймера
  *
  */
 void awh::Watch::stop() noexcept {
-	// Выполняем остановку работы экрана
-	this->_screen.stop();
+	/**
+	 * Для операционной системы Linux
+	 */
+	#if __linux__
+		// Выполняем блокировку потока
+		const lock_guard <std::mutex> lock(this->_mtx);
+		// Выполняем перебор всех занятых таймеров
+		for(uint32_t i = 0; i < static_cast <uint32_t> (this->_units.size()); i++)
+			// Выполняем отвязку таймера от колеса
+			this->unlink(i);
+		// Выполняем снятие часов
+		this->schedule();
+	/**
+	 * Для всех остальных операционных систем
+	 */
+	#else
+		// Выполняем остановку работы экрана
+		this->_screen.stop();
+	#endif
 }
 /**
  * @brief Метод запуска работы таймера
  *
  */
 void awh::Watch::start() noexcept {
-	// Выполняем запуск работы экрана
-	this->_screen.start();
+	/**
+	 * Для операционной системы Linux
+	 */
+	#if __linux__
+		// Выполняем блокировку потока
+		const lock_guard <std::mutex> lock(this->_mtx);
+		// Если взведённых таймеров нет
+		if(this->_count == 0)
+			// Выполняем синхронизацию времени текущего тика
+			this->_last = this->now();
+	/**
+	 * Для всех остальных операционных систем
+	 */
+	#else
+		// Выполняем запуск работы экрана
+		this->_screen.start();
+	#endif
 }
 /**
  * @brief Метод создания нового таймера
@@ -188,23 +472,53 @@ SOCKET awh::Watch::create() noexcept {
 	 * Выполняем перехват ошибок
 	 */
 	try {
-		// Выполняем инициализацию нового уведомителя
-		std::unique_ptr <notifier_t> notifier = std::make_unique <notifier_t> (this->_fmk, this->_log);
-		// Выполняем инициализацию
-		result = notifier->init();
-		// Если уведомитель инициализирован правильно
-		if(result != INVALID_SOCKET){
+		/**
+		 * Для операционной системы Linux
+		 */
+		#if __linux__
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
-			// Выполняем поиск уже существующего уведомителя
-			auto i = this->_notifiers.find(result);
-			// Если такой уведомитель уже существует
-			if(i != this->_notifiers.end())
-				// Выполняем замену уведомителя
-				i->second = ::move(notifier);
-			// Выполняем перенос нашего уведомителя в список уведомителей
-			else this->_notifiers.emplace(result, ::move(notifier));
-		}
+			// Индекс нового таймера
+			uint32_t index = 0;
+			// Если освобождённые таймеры существуют
+			if(!this->_free.empty()){
+				// Получаем индекс освобождённого таймера
+				index = this->_free.back();
+				// Удаляем таймер из списка освобождённых
+				this->_free.pop_back();
+			// Если освобождённых таймеров нет
+			} else {
+				// Получаем индекс нового таймера
+				index = static_cast <uint32_t> (this->_units.size());
+				// Добавляем новый таймер в колесо
+				this->_units.emplace_back();
+			}
+			// Помечаем таймер как занятый
+			this->_units[index].used = true;
+			// Формируем идентификатор таймера
+			result = static_cast <SOCKET> (AWH_WATCH_TIMER_ID + index);
+		/**
+		 * Для всех остальных операционных систем
+		 */
+		#else
+			// Выполняем инициализацию нового уведомителя
+			std::unique_ptr <notifier_t> notifier = std::make_unique <notifier_t> (this->_fmk, this->_log);
+			// Выполняем инициализацию
+			result = notifier->init();
+			// Если уведомитель инициализирован правильно
+			if(result != INVALID_SOCKET){
+				// Выполняем блокировку потока
+				const lock_guard <std::mutex> lock(this->_mtx);
+				// Выполняем поиск уже существующего уведомителя
+				auto i = this->_notifiers.find(result);
+				// Если такой уведомитель уже существует
+				if(i != this->_notifiers.end())
+					// Выполняем замену уведомителя
+					i->second = ::move(notifier);
+				// Выполняем перенос нашего уведомителя в список уведомителей
+				else this->_notifiers.emplace(result, ::move(notifier));
+			}
+		#endif
 	/**
 	 * Если возникает ошибка
 	 */
@@ -233,14 +547,31 @@ SOCKET awh::Watch::create() noexcept {
  * @return     идентификатор события
  */
 uint64_t awh::Watch::event(const SOCKET sock) noexcept {
-	// Выполняем поиск нужного нам уведомителя
-	auto i = this->_notifiers.find(sock);
-	// Если уведомитель найден
-	if(i != this->_notifiers.end())
-		// Выполняем вывод полученного уведомления
-		return i->second->event();
-	// Выводим результат
-	return 0;
+	/**
+	 * Для операционной системы Linux
+	 */
+	#if __linux__
+		// Количество срабатываний часов
+		uint64_t result = 0;
+		// Если передан файловый дескриптор часов
+		if((sock == this->_fd) && (::read(this->_fd, &result, sizeof(result)) != static_cast <ssize_t> (sizeof(result))))
+			// Сбрасываем количество срабатываний
+			result = 0;
+		// Выводим результат
+		return result;
+	/**
+	 * Для всех остальных операционных систем
+	 */
+	#else
+		// Выполняем поиск нужного нам уведомителя
+		auto i = this->_notifiers.find(sock);
+		// Если уведомитель найден
+		if(i != this->_notifiers.end())
+			// Выполняем вывод полученного уведомления
+			return i->second->event();
+		// Выводим результат
+		return 0;
+	#endif
 }
 /**
  * @brief Метод убрать таймер из отслеживания
@@ -252,8 +583,34 @@ void awh::Watch::away(const SOCKET sock) noexcept {
 	 * Выполняем перехват ошибок
 	 */
 	try {
-		// Если список таймеров не пустой
-		if(!this->_timers.empty()){
+		/**
+		 * Для операционной системы Linux
+		 */
+		#if __linux__
+			// Выполняем блокировку потока до проверки размера колеса, колесо может расти в другом потоке
+			const lock_guard <std::mutex> lock(this->_mtx);
+			// Если идентификатор принадлежит колесу таймеров
+			if((static_cast <uint64_t> (sock) >= AWH_WATCH_TIMER_ID) && ((static_cast <uint64_t> (sock) - AWH_WATCH_TIMER_ID) < this->_units.size())){
+				// Получаем индекс таймера
+				const uint32_t index = static_cast <uint32_t> (static_cast <uint64_t> (sock) - AWH_WATCH_TIMER_ID);
+				// Если таймер занят
+				if(this->_units[index].used){
+					// Выполняем отвязку таймера от колеса
+					this->unlink(index);
+					// Снимаем флаг занятого таймера
+					this->_units[index].used = false;
+					// Добавляем таймер в список освобождённых
+					this->_free.push_back(index);
+					// Если взведённых таймеров не осталось
+					if(this->_count == 0)
+						// Выполняем снятие часов
+						this->schedule();
+				}
+			}
+		/**
+		 * Для всех остальных операционных систем
+		 */
+		#else
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
 			// Выполняем удаление уведомителя
@@ -268,7 +625,68 @@ void awh::Watch::away(const SOCKET sock) noexcept {
 					break;
 				}
 			}
-		}
+		#endif
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sock), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+}
+/**
+ * @brief Метод отмены ожидания таймера без его удаления
+ *
+ * @param sock файловый дескриптор таймера
+ */
+void awh::Watch::cancel(const SOCKET sock) noexcept {
+	/**
+	 * Выполняем перехват ошибок
+	 */
+	try {
+		/**
+		 * Для операционной системы Linux
+		 */
+		#if __linux__
+			// Выполняем блокировку потока до проверки размера колеса, колесо может расти в другом потоке
+			const lock_guard <std::mutex> lock(this->_mtx);
+			// Если идентификатор принадлежит колесу таймеров
+			if((static_cast <uint64_t> (sock) >= AWH_WATCH_TIMER_ID) && ((static_cast <uint64_t> (sock) - AWH_WATCH_TIMER_ID) < this->_units.size())){
+				// Выполняем отвязку таймера от колеса
+				this->unlink(static_cast <uint32_t> (static_cast <uint64_t> (sock) - AWH_WATCH_TIMER_ID));
+				// Если взведённых таймеров не осталось
+				if(this->_count == 0)
+					// Выполняем снятие часов
+					this->schedule();
+			}
+		/**
+		 * Для всех остальных операционных систем
+		 */
+		#else
+			// Выполняем блокировку потока
+			const lock_guard <std::mutex> lock(this->_mtx);
+			// Выполняем перебор всего списка таймеров
+			for(auto i = this->_timers.begin(); i != this->_timers.end(); ++i){
+				// Если мы нашли наш таймер
+				if(sock == i->second){
+					// Выполняем удаление значение таймера
+					this->_timers.erase(i);
+					// Выходим из цикла
+					break;
+				}
+			}
+		#endif
 	/**
 	 * Если возникает ошибка
 	 */
@@ -299,19 +717,56 @@ void awh::Watch::wait(const SOCKET sock, const uint32_t delay) noexcept {
 	 * Выполняем перехват ошибок
 	 */
 	try {
-		// Выполняем поиск уведомитель
-		auto i = this->_notifiers.find(sock);
-		// Если уведомитель найден
-		if(i != this->_notifiers.end()){
-			// Создаём объект даты для передачи
-			unit_t unit;
-			// Устанавливаем идентификатор файлового дескриптора
-			unit.sock = sock;
-			// Устанавливаем задержку времени в наносекундах
-			unit.delay = (static_cast <uint64_t> (delay) * 1000000);
-			// Выполняем отправку события экрану
-			this->_screen = unit;
-		}
+		/**
+		 * Для операционной системы Linux
+		 */
+		#if __linux__
+			// Выполняем блокировку потока до проверки размера колеса, колесо может расти в другом потоке
+			const lock_guard <std::mutex> lock(this->_mtx);
+			// Если идентификатор принадлежит колесу таймеров
+			if((static_cast <uint64_t> (sock) >= AWH_WATCH_TIMER_ID) && ((static_cast <uint64_t> (sock) - AWH_WATCH_TIMER_ID) < this->_units.size())){
+				// Получаем индекс таймера
+				const uint32_t index = static_cast <uint32_t> (static_cast <uint64_t> (sock) - AWH_WATCH_TIMER_ID);
+				// Если таймер занят
+				if(this->_units[index].used){
+					// Выполняем отвязку таймера от колеса, если он уже взведён
+					this->unlink(index);
+					// Получаем текущее значение времени
+					const uint64_t date = this->now();
+					// Если взведённых таймеров нет, колесо простаивало
+					if(this->_count == 0)
+						// Выполняем синхронизацию времени текущего тика
+						this->_last = date;
+					// Получаем время срабатывания относительно текущего тика
+					const uint64_t offset = ((date > this->_last ? (date - this->_last) : 0) + (static_cast <uint64_t> (delay) * 1000000ULL));
+					// Устанавливаем тик срабатывания таймера (не ранее следующего тика)
+					this->_units[index].target = (this->_tick + std::max(static_cast <uint64_t> (1), (offset + this->_resolution - 1) / this->_resolution));
+					// Выполняем привязку таймера к слоту колеса
+					this->link(index);
+					// Если часы не взведены или таймер сработает раньше
+					if((this->_deadline == 0) || (this->_units[index].target < this->_deadline))
+						// Выполняем взведение часов на ближайший занятый слот
+						this->schedule();
+				}
+			}
+		/**
+		 * Для всех остальных операционных систем
+		 */
+		#else
+			// Выполняем поиск уведомитель
+			auto i = this->_notifiers.find(sock);
+			// Если уведомитель найден
+			if(i != this->_notifiers.end()){
+				// Создаём объект даты для передачи
+				unit_t unit;
+				// Устанавливаем идентификатор файлового дескриптора
+				unit.sock = sock;
+				// Устанавливаем задержку времени в наносекундах
+				unit.delay = (static_cast <uint64_t> (delay) * 1000000);
+				// Выполняем отправку события экрану
+				this->_screen = unit;
+			}
+		#endif
 	/**
 	 * Если возникает ошибка
 	 */
@@ -332,23 +787,71 @@ void awh::Watch::wait(const SOCKET sock, const uint32_t delay) noexcept {
 	}
 }
 /**
- * @brief Конструктор
- *
- * @param fmk объект фреймворка
- * @param log объект для работы с логами
+ * Для операционной системы Linux
  */
-awh::Watch::Watch(const fmk_t * fmk, const log_t * log) noexcept :
- _screen(screen_t <unit_t>::health_t::DEAD), _fmk(fmk), _log(log) {
-	// Выполняем добавление функции обратного вызова триггера
-	this->_screen = static_cast <function <void (void)>> (std::bind(&watch_t::trigger, this));
-	// Выполняем добавление функции обратного вызова процесса обработки
-	this->_screen = static_cast <function <void (const unit_t)>> (std::bind(&watch_t::process, this, _1));
-}
+#if __linux__
+	/**
+	 * @brief Конструктор
+	 *
+	 * @param fmk объект фреймворка
+	 * @param log объект для работы с логами
+	 */
+	awh::Watch::Watch(const fmk_t * fmk, const log_t * log) noexcept :
+	 _fd(INVALID_SOCKET), _count(0), _tick(0), _last(0), _deadline(0),
+	 _resolution(static_cast <uint64_t> (AWH_WATCH_RESOLUTION) * 1000ULL),
+	 _slots(AWH_WATCH_SLOTS, UINT32_MAX), _bits(AWH_WATCH_SLOTS / 64, 0), _fmk(fmk), _log(log) {
+		// Выполняем создание часов колеса таймеров
+		if((this->_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) == INVALID_SOCKET){
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, ::strerror(errno));
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, ::strerror(errno));
+			#endif
+		}
+		// Запоминаем время текущего тика
+		this->_last = this->now();
+	}
+	/**
+	 * @brief Деструктор
+	 *
+	 */
+	awh::Watch::~Watch() noexcept {
+		// Если часы колеса таймеров созданы
+		if(this->_fd != INVALID_SOCKET)
+			// Выполняем закрытие часов
+			::close(this->_fd);
+	}
 /**
- * @brief Деструктор
- *
+ * Для всех остальных операционных систем
  */
-awh::Watch::~Watch() noexcept {
-	// Выполняем остановку работы экрана
-	this->_screen.stop();
-}
+#else
+	/**
+	 * @brief Конструктор
+	 *
+	 * @param fmk объект фреймворка
+	 * @param log объект для работы с логами
+	 */
+	awh::Watch::Watch(const fmk_t * fmk, const log_t * log) noexcept :
+	 _screen(screen_t <unit_t>::health_t::DEAD), _fmk(fmk), _log(log) {
+		// Выполняем добавление функции обратного вызова триггера
+		this->_screen = static_cast <function <void (void)>> (std::bind(&watch_t::trigger, this));
+		// Выполняем добавление функции обратного вызова процесса обработки
+		this->_screen = static_cast <function <void (const unit_t)>> (std::bind(&watch_t::process, this, _1));
+	}
+	/**
+	 * @brief Деструктор
+	 *
+	 */
+	awh::Watch::~Watch() noexcept {
+		// Выполняем остановку работы экрана
+		this->_screen.stop();
+	}
+#endif
@@ -16,7 +16,6 @@
  * Подключаем модуль работы с временем
  */
 #include <ctime>
-#include <iomanip>
 
 /**
  * Подключаем заголовочный файл
@@ -33,6 +32,15 @@ using namespace std;
  */
 using namespace placeholders;
 
+/**
+ * Секунда, для которой сформирована текущая дата потока
+ */
+static thread_local time_t LocalSecond = 0;
+/**
+ * Текущая дата потока в формате IMF-fixdate
+ */
+static thread_local string LocalDate = "";
+
 /**
  * Для операционной системы MS Windows
  */
@@ -2615,42 +2623,86 @@ void awh::Http::response(const web_t::res_t & res) noexcept {
 	this->_web.response(res);
 }
 /**
- * @brief Метод получения текущей даты для HTTP-запроса
+ * @brief Метод формирования даты в формате IMF-fixdate (RFC 9110)
  *
- * @param date дата в формате UnixTimestamp
- * @return     штамп времени в текстовом виде
+ * @param date   дата в формате UnixTimestamp (в секундах)
+ * @param result строка для записи сформированной даты
  */
-string awh::Http::date(const uint64_t date) const noexcept {
-	// Результат работы функции
-	string result = "";
+void awh::Http::fixdate(const time_t date, string & result) const noexcept {
+	// Названия дней недели
+	static const char * days = "SunMonTueWedThuFriSat";
+	// Названия месяцев
+	static const char * months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+	// Получаем количество дней прошедших с начала эпохи
+	int64_t count = (static_cast <int64_t> (date) / 86400);
+	// Получаем количество секунд прошедших с начала дня
+	int64_t seconds = (static_cast <int64_t> (date) % 86400);
+	// Если дата находится до начала эпохи
+	if(seconds < 0){
+		// Уменьшаем количество дней
+		count--;
+		// Корректируем количество секунд
+		seconds += 86400;
+	}
+	// Получаем день недели (1 января 1970 года был четвергом)
+	const int64_t week = (((count % 7) + 11) % 7);
+	// Выполняем смещение дней относительно 1 марта 0000 года
+	const int64_t shift = (count + 719468);
+	// Получаем номер 400-летней эры
+	const int64_t era = ((shift >= 0 ? shift : shift - 146096) / 146097);
+	// Получаем день эры
+	const int64_t doe = (shift - era * 146097);
+	// Получаем год эры
+	const int64_t yoe = ((doe - doe / 1460 + doe / 36524 - doe / 146096) / 365);
+	// Получаем день года начинающегося с марта
+	const int64_t doy = (doe - (365 * yoe + yoe / 4 - yoe / 100));
+	// Получаем месяц начинающийся с марта
+	const int64_t mp = ((5 * doy + 2) / 153);
+	// Получаем день месяца
+	const int64_t day = (doy - (153 * mp + 2) / 5 + 1);
+	// Получаем месяц года
+	const int64_t month = (mp < 10 ? mp + 3 : mp - 9);
+	// Получаем год
+	const int64_t year = (yoe + era * 400 + (month <= 2 ? 1 : 0));
+	// Получаем час, минуты и секунды
+	const int64_t hour = (seconds / 3600), minute = ((seconds % 3600) / 60), second = (seconds % 60);
 	/**
 	 * Выполняем отлов ошибок
 	 */
 	try {
-		// Создаем структуру времени
-		std::tm tm = {};
-		// Создаём объект потока
-		stringstream ss;
-		// Преобразуем дату в нужный нам формат
-		time_t value = static_cast <time_t> (date);
-		// Если штамп времени передан в числовом виде
-		if(value == 0)
-			// Формируем время по умолчанию
-			value = ::time(nullptr);
-		// Получаем текущее значение размерности даты
-		const uint8_t current = static_cast <uint8_t> (::floor(::log10(static_cast <long double> (value))));
-		// Получаем размерность актуальной размерности даты
-		const uint8_t actual = static_cast <uint8_t> (::floor(::log10(static_cast <long double> (::time(nullptr)))));
-		// Если текущий размер выше актуального
-		if(current > actual)
-			// Переводим указанные единицы в секунды
-			value /= static_cast <time_t> (::pow(static_cast <long double> (10), static_cast <long double> (current - actual)));
-		// Формируем локальное время
-		gmtime_r(&value, &tm);
-		// Выполняем извлечение даты
-		ss << ::put_time(&tm, "%a, %d %b %Y %H:%M:%S GMT");
-		// Выводим полученное значение даты
-		return ss.str();
+		// Выделяем память для даты вида "Sun, 06 Nov 1994 08:49:37 GMT"
+		result.resize(29);
+		// Получаем указатель на данные строки
+		char * buffer = result.data();
+		// Устанавливаем название дня недели
+		::memcpy(buffer, days + week * 3, 3);
+		// Устанавливаем разделители
+		buffer[3] = ','; buffer[4] = ' ';
+		// Устанавливаем день месяца
+		buffer[5] = static_cast <char> ('0' + day / 10); buffer[6] = static_cast <char> ('0' + day % 10);
+		// Устанавливаем разделитель
+		buffer[7] = ' ';
+		// Устанавливаем название месяца
+		::memcpy(buffer + 8, months + (month - 1) * 3, 3);
+		// Устанавливаем разделитель
+		buffer[11] = ' ';
+		// Устанавливаем год
+		buffer[12] = static_cast <char> ('0' + (year / 1000) % 10); buffer[13] = static_cast <char> ('0' + (year / 100) % 10);
+		buffer[14] = static_cast <char> ('0' + (year / 10) % 10);   buffer[15] = static_cast <char> ('0' + year % 10);
+		// Устанавливаем разделитель
+		buffer[16] = ' ';
+		// Устанавливаем часы
+		buffer[17] = static_cast <char> ('0' + hour / 10); buffer[18] = static_cast <char> ('0' + hour % 10);
+		// Устанавливаем разделитель
+		buffer[19] = ':';
+		// Устанавливаем минуты
+		buffer[20] = static_cast <char> ('0' + minute / 10); buffer[21] = static_cast <char> ('0' + minute % 10);
+		// Устанавливаем разделитель
+		buffer[22] = ':';
+		// Устанавливаем секунды
+		buffer[23] = static_cast <char> ('0' + second / 10); buffer[24] = static_cast <char> ('0' + second % 10);
+		// Устанавливаем часовой пояс
+		::memcpy(buffer + 25, " GMT", 4);
 	/**
 	 * Если возникает ошибка
 	 */
@@ -2669,6 +2721,50 @@ string awh::Http::date(const uint64_t date) const noexcept {
 			this->_log->print("%s", log_t::flag_t::WARNING, error.what());
 		#endif
 	}
+}
+/**
+ * @brief Метод получения текущей даты для HTTP-запроса
+ *
+ * Текущая дата формируется не чаще одного раза в секунду и кэшируется для каждого потока
+ *
+ * @param date дата в формате UnixTimestamp
+ * @return     штамп времени в текстовом виде
+ */
+string awh::Http::date(const uint64_t date) const noexcept {
+	// Результат работы функции
+	string result = "";
+	// Получаем текущее время
+	const time_t now = ::time(nullptr);
+	// Если дата не передана, используем текущую дату потока
+	if(date == 0){
+		// Если текущая дата потока устарела
+		if((now != LocalSecond) || LocalDate.empty()){
+			// Запоминаем секунду для которой сформирована дата
+			LocalSecond = now;
+			// Выполняем формирование текущей даты
+			this->fixdate(now, LocalDate);
+		}
+		// Выводим текущую дату потока
+		return LocalDate;
+	}
+	// Преобразуем дату в нужный нам формат
+	uint64_t value = date;
+	// Количество разрядов указанной и текущей даты
+	uint8_t current = 0, actual = 0;
+	// Выполняем подсчёт разрядов указанной даты
+	for(uint64_t i = value; i >= 10; i /= 10)
+		// Увеличиваем количество разрядов
+		current++;
+	// Выполняем подсчёт разрядов текущей даты
+	for(uint64_t i = static_cast <uint64_t> (now); i >= 10; i /= 10)
+		// Увеличиваем количество разрядов
+		actual++;
+	// Если дата передана в миллисекундах, микросекундах или наносекундах, переводим её в секунды
+	for(; current > actual; current--)
+		// Уменьшаем разрядность даты
+		value /= 10;
+	// Выполняем формирование даты
+	this->fixdate(static_cast <time_t> (value), result);
 	// Выводим результат
 	return result;
 }
@@ -4465,38 +4561,39 @@ vector <std::pair <string, string>> awh::Http::process2(const process_t flag, co
 								if(header.first.front() != ':'){
 									// Если заголовок не находится в чёрном списке и не является системным
 									bool allow = (!this->is(suite_t::BLACK, header.first) && (systemHeaders.count(header.first) < 1));
-									// Выполняем перебор всех обязательных заголовков
-									for(uint8_t i = 0; i < 14; i++){
-										// Если заголовок уже найден пропускаем его
-										if(available[i])
-											// Продолжаем поиск дальше
-											continue;
-										/**
-										 * Выполняем првоерку заголовка
-										 */
-										switch(i){
-											case 0:  available[i] = this->_fmk->compare(header.first, "te");                  break;
-											case 1:  available[i] = this->_fmk->compare(header.first, "host");                break;
-											case 2:  available[i] = this->_fmk->compare(header.first, "accept");              break;
-											case 3:  available[i] = this->_fmk->compare(header.first, "origin");              break;
-											case 4:  available[i] = this->_fmk->compare(header.first, "user-agent");          break;
-											case 5:  available[i] = this->_fmk->compare(header.first, "connection");          break;
-											case 6:  available[i] = this->_fmk->compare(header.first, "proxy-connection");    break;
-											case 7:  available[i] = this->_fmk->compare(header.first, "content-length");      break;
-											case 8:  available[i] = this->_fmk->compare(header.first, "accept-language");     break;
-											case 9:  available[i] = this->_fmk->compare(header.first, "accept-encoding");     break;
-											case 10: available[i] = this->_fmk->compare(header.first, "content-encoding");    break;
-											case 11: available[i] = this->_fmk->compare(header.first, "transfer-encoding");   break;
-											case 12: available[i] = this->_fmk->compare(header.first, "x-awh-encryption");    break;
-											case 13: available[i] = this->_fmk->compare(header.first, "authorization");       break;
-											case 14: available[i] = this->_fmk->compare(header.first, "proxy-authorization"); break;
-										}
+									// Получаем идентификатор заголовка
+									const web_t::header_t interned = this->_web.intern(header.first);
+									// Индекс обязательного заголовка
+									int8_t index = -1;
+									/**
+									 * Определяем индекс обязательного заголовка
+									 */
+									switch(static_cast <uint8_t> (interned)){
+										case static_cast <uint8_t> (web_t::header_t::TE):                index = 0;  break;
+										case static_cast <uint8_t> (web_t::header_t::HOST):              index = 1;  break;
+										case static_cast <uint8_t> (web_t::header_t::ACCEPT):            index = 2;  break;
+										case static_cast <uint8_t> (web_t::header_t::ORIGIN):            index = 3;  break;
+										case static_cast <uint8_t> (web_t::header_t::USER_AGENT):        index = 4;  break;
+										case static_cast <uint8_t> (web_t::header_t::CONNECTION):        index = 5;  break;
+										case static_cast <uint8_t> (web_t::header_t::PROXY_CONNECTION):  index = 6;  break;
+										case static_cast <uint8_t> (web_t::header_t::CONTENT_LENGTH):    index = 7;  break;
+										case static_cast <uint8_t> (web_t::header_t::ACCEPT_LANGUAGE):   index = 8;  break;
+										case static_cast <uint8_t> (web_t::header_t::ACCEPT_ENCODING):   index = 9;  break;
+										case static_cast <uint8_t> (web_t::header_t::CONTENT_ENCODING):  index = 10; break;
+										case static_cast <uint8_t> (web_t::header_t::TRANSFER_ENCODING): index = 11; break;
+										case static_cast <uint8_t> (web_t::header_t::X_AWH_ENCRYPTION):  index = 12; break;
+										case static_cast <uint8_t> (web_t::header_t::AUTHORIZATION):     index = 13; break;
+									}
+									// Если обязательный заголовок найден впервые
+									if((index > -1) && !available[index]){
+										// Запоминаем, что заголовок найден
+										available[index] = true;
 										// Если заголовок разрешён для вывода
 										if(allow){
 											/**
 											 * Выполняем првоерку заголовка
 											 */
-											switch(i){
+											switch(index){
 												case 0:
 												case 1:
 												case 5:
@@ -4504,7 +4601,7 @@ vector <std::pair <string, string>> awh::Http::process2(const process_t flag, co
 												case 7:
 												case 10:
 												case 11:
-												case 12: allow = !available[i]; break;
+												case 12: allow = false; break;
 											}
 											// Если заголовок запрещён к выводу
 											if(!allow)
@@ -4514,8 +4611,8 @@ vector <std::pair <string, string>> awh::Http::process2(const process_t flag, co
 									}
 									// Если заголовок не является запрещённым, добавляем заголовок в запрос
 									if(allow)
-										// Формируем строку запроса
-										result.push_back(std::make_pair(this->_fmk->transform(header.first, fmk_t::transform_t::LOWER), header.second));
+										// Формируем строку запроса, для известного заголовка используем его название без приведения регистра
+										result.push_back(std::make_pair((interned != web_t::header_t::NONE ? this->_web.name(interned) : this->_fmk->transform(header.first, fmk_t::transform_t::LOWER)), header.second));
 								}
 							}
 							// Устанавливаем Accept если не передан
@@ -4969,48 +5066,50 @@ vector <std::pair <string, string>> awh::Http::process2(const process_t flag, co
 							for(auto & header : this->_web.headers()){
 								// Если заголовок не находится в чёрном списке и не является системным
 								bool allow = (!this->is(suite_t::BLACK, header.first) && (systemHeaders.count(header.first) < 1));
-								// Выполняем перебор всех обязательных заголовков
-								for(uint8_t i = 0; i < 12; i++){
-									// Если заголовок уже найден пропускаем его
-									if(available[i])
-										// Продолжаем поиск дальше
-										continue;
-									/**
-									 * Выполняем првоерку заголовка
-									 */
-									switch(i){
-										case 0:  available[i] = this->_fmk->compare(header.first, "date");               break;
-										case 1:  available[i] = this->_fmk->compare(header.first, "server");             break;
-										case 2:  available[i] = this->_fmk->compare(header.first, "connection");         break;
-										case 3:  available[i] = this->_fmk->compare(header.first, "proxy-connection");   break;
-										case 4:  available[i] = this->_fmk->compare(header.first, "x-powered-by");       break;
-										case 5:  available[i] = this->_fmk->compare(header.first, "content-type");       break;
-										case 6:  available[i] = this->_fmk->compare(header.first, "content-length");     break;
-										case 7:  available[i] = this->_fmk->compare(header.first, "content-encoding");   break;
-										case 8:  available[i] = this->_fmk->compare(header.first, "transfer-encoding");  break;
-										case 9:  available[i] = this->_fmk->compare(header.first, "x-awh-encryption");   break;
-										case 10: available[i] = this->_fmk->compare(header.first, "www-authenticate");   break;
-										case 11: available[i] = this->_fmk->compare(header.first, "proxy-authenticate"); break;
-									}
+								// Получаем идентификатор заголовка
+								const web_t::header_t interned = this->_web.intern(header.first);
+								// Индекс обязательного заголовка
+								int8_t index = -1;
+								/**
+								 * Определяем индекс обязательного заголовка
+								 */
+								switch(static_cast <uint8_t> (interned)){
+									case static_cast <uint8_t> (web_t::header_t::DATE):               index = 0;  break;
+									case static_cast <uint8_t> (web_t::header_t::SERVER):             index = 1;  break;
+									case static_cast <uint8_t> (web_t::header_t::CONNECTION):         index = 2;  break;
+									case static_cast <uint8_t> (web_t::header_t::PROXY_CONNECTION):   index = 3;  break;
+									case static_cast <uint8_t> (web_t::header_t::X_POWERED_BY):       index = 4;  break;
+									case static_cast <uint8_t> (web_t::header_t::CONTENT_TYPE):       index = 5;  break;
+									case static_cast <uint8_t> (web_t::header_t::CONTENT_LENGTH):     index = 6;  break;
+									case static_cast <uint8_t> (web_t::header_t::CONTENT_ENCODING):   index = 7;  break;
+									case static_cast <uint8_t> (web_t::header_t::TRANSFER_ENCODING):  index = 8;  break;
+									case static_cast <uint8_t> (web_t::header_t::X_AWH_ENCRYPTION):   index = 9;  break;
+									case static_cast <uint8_t> (web_t::header_t::WWW_AUTHENTICATE):   index = 10; break;
+									case static_cast <uint8_t> (web_t::header_t::PROXY_AUTHENTICATE): index = 11; break;
+								}
+								// Если обязательный заголовок найден впервые
+								if((index > -1) && !available[index]){
+									// Запоминаем, что заголовок найден
+									available[index] = true;
 									// Если заголовок разрешён для вывода
 									if(allow){
 										/**
 										 * Выполняем првоерку заголовка
 										 */
-										switch(i){
+										switch(index){
 											case 2:
 											case 3:
 											case 6:
 											case 7:
 											case 8:
-											case 9: allow = !available[i]; break;
+											case 9: allow = false; break;
 										}
 										// Если ответ является информационным
-										if((((res.code >= 100) && (res.code < 200)) || (res.code == 204)) && available[i]){
+										if(((res.code >= 100) && (res.code < 200)) || (res.code == 204)){
 											/**
 											 * Запрещяем указанным заголовкам формирование
 											 */
-											switch(i){
+											switch(index){
 												case 0:
 												case 5:
 												case 6:
@@ -5029,8 +5128,8 @@ vector <std::pair <string, string>> awh::Http::process2(const process_t flag, co
 								}
 								// Если заголовок не является запрещённым, добавляем заголовок в ответ
 								if(allow)
-									// Формируем строку ответа
-									result.push_back(std::make_pair(this->_fmk->transform(header.first, fmk_t::transform_t::LOWER), header.second));
+									// Формируем строку ответа, для известного заголовка используем его название без приведения регистра
+									result.push_back(std::make_pair((interned != web_t::header_t::NONE ? this->_web.name(interned) : this->_fmk->transform(header.first, fmk_t::transform_t::LOWER)), header.second));
 							}
 							// Если заголовок не запрещён
 							if(!available[1] && !this->is(suite_t::BLACK, "server"))
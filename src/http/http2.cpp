@@ -316,10 +316,14 @@ int32_t awh::Http2::frameRecv([[maybe_unused]] nghttp2_session * session, const
 				type = frame_t::DATA;
 			break;
 			// Если мы получили фрейм пингов
-			case static_cast <uint8_t> (NGHTTP2_PING):
+			case static_cast <uint8_t> (NGHTTP2_PING): {
 				// Выполняем установку фрейма
 				type = frame_t::PING;
-			break;
+				// Если получен ответ на пинг замера задержки
+				if(self->_probe.wait && (frame->hd.flags & NGHTTP2_FLAG_ACK))
+					// Выполняем подстройку размеров окон
+					self->tune(frame->ping.opaque_data);
+			} break;
 			// Если мы получили фрейм требования отключиться от сервера
 			case static_cast <uint8_t> (NGHTTP2_GOAWAY):
 				// Выполняем установку фрейма
@@ -389,49 +393,30 @@ int32_t awh::Http2::frameRecv([[maybe_unused]] nghttp2_session * session, const
 				// Выполняем установку фрейма
 				type = frame_t::WINDOW_UPDATE;
 				// Если список полезной нагрузки заполнен
-				if(!self->_payloads.empty()){
-					// Если получен идентификатор нулевого потока
-					if(sid == 0){
-						// Выполняем перебор всего списка записей
-						for(auto & record : self->_records){
-							/**
-							 * Выполняем перебор всего списка записей для которых есть неотправленные данные
-							 */
-							while(!record.second.empty()){
-								// Если на принимаемой стороне достаточно памяти для получения данных
-								if(self->available(record.first) >= record.second.front().first)
-									// Выполняем отправку данных полезной нагрузки для указанного потока
-									self->submit(record.first, record.second.front().second);
-								// Если данных не достаточно, выходим
-								else break;
-							}
-						}
-					// Если получен идентификатор потока
-					} else {
-						// Выполняем поиск записей для потока
-						auto i = self->_records.find(sid);
-						// Если список неотправленных записей для потока существуют
-						if((i != self->_records.end()) && !i->second.empty()){
-							/**
-							 * Выполняем перебор всего списка записей которые ещё не отправленны
-							 */
-							while(!i->second.empty()){
-								// Если на принимаемой стороне достаточно памяти для получения данных
-								if(self->available(i->first) >= i->second.front().first)
-									// Выполняем отправку записи для указанного потока
-									self->submit(i->first, i->second.front().second);
-								// Если данных не достаточно, выходим
-								else break;
-							}
-						}
-					}
-				}
+				if(!self->_payloads.empty())
+					// Выполняем отправку записей, для которых освободилось окно, в порядке приоритетов потоков
+					self->dispatch();
 			} break;
 			// Если мы получили фрейм обновления приоритетов
-			case static_cast <uint8_t> (NGHTTP2_PRIORITY_UPDATE):
+			case static_cast <uint8_t> (NGHTTP2_PRIORITY_UPDATE): {
 				// Выполняем установку фрейма
 				type = frame_t::PRIORITY_UPDATE;
-			break;
+				// Если сервис идентифицирован как сервер
+				if(self->_mode == mode_t::SERVER){
+					// Извлекаем данные обновления приоритета
+					nghttp2_ext_priority_update * update = reinterpret_cast <nghttp2_ext_priority_update *> (frame->ext.payload);
+					// Выполняем поиск приоритета потока
+					auto i = self->_priorities.find(update->stream_id);
+					// Если приоритет потока ещё не установлен
+					if(i == self->_priorities.end())
+						// Выполняем установку приоритета потока
+						self->_priorities.emplace(update->stream_id, self->parse(reinterpret_cast <const char *> (update->field_value), update->field_value_len));
+					// Если приоритет потока не зафиксирован сервером
+					else if(!i->second.fixed)
+						// Выполняем обновление приоритета потока
+						i->second = self->parse(reinterpret_cast <const char *> (update->field_value), update->field_value_len);
+				}
+			} break;
 		}
 		// Выполняем функцию обратного вызова
 		return self->_callback.call <int32_t (const int32_t, const direct_t, const frame_t, const std::set <flag_t> &)> ("frame", sid, direct_t::RECV, type, flags);
@@ -721,6 +706,12 @@ int32_t awh::Http2::close(nghttp2_session * session, const int32_t sid, const ui
 				self->_callback.call <void (const log_t::flag_t, const http::error_t, const string &)> ("error", log_t::flag_t::WARNING, http::error_t::HTTP2_HTTP_1_1_REQUIRED, self->_fmk->format("Stream %d closed with error=%s", sid, "HTTP_1_1_REQUIRED"));
 		} break;
 	}
+	// Выполняем удаление приоритета закрытого потока
+	self->_priorities.erase(sid);
+	// Выполняем удаление неотправленных записей закрытого потока
+	self->_records.erase(sid);
+	// Выполняем удаление буфера полезной нагрузки закрытого потока
+	self->_payloads.erase(sid);
 	// Если функция обратного вызова установлена
 	if(self->_callback.is("close"))
 		// Выполняем функцию обратного вызова
@@ -788,6 +779,10 @@ int32_t awh::Http2::chunk([[maybe_unused]] nghttp2_session * session, [[maybe_un
 				return rv;
 			// Выполняем обновление размеров окна
 			}// else self->windowUpdate(sid, size); // Система делает это сама когда потребуется
+			// Если активирована автоматическая подстройка размеров окон
+			if(self->_flow.limit > 0)
+				// Выполняем учёт полученных данных
+				self->probe(size);
 		}
 	}
 	// Выводим значение по умолчанию
@@ -809,6 +804,18 @@ int32_t awh::Http2::chunk([[maybe_unused]] nghttp2_session * session, [[maybe_un
 int32_t awh::Http2::header([[maybe_unused]] nghttp2_session * session, const nghttp2_frame * frame, nghttp2_rcbuf * name, nghttp2_rcbuf * value, [[maybe_unused]] const uint8_t flags, void * ctx) noexcept {
 	// Получаем объект родительского объекта
 	http2_t * self = reinterpret_cast <http2_t *> (ctx);
+	// Если сервер получил заголовок запроса клиента
+	if((self->_mode == mode_t::SERVER) && (frame->hd.type == NGHTTP2_HEADERS) && (frame->headers.cat == NGHTTP2_HCAT_REQUEST)){
+		// Получаем буфер названия заголовка
+		auto nameBuffer = nghttp2_rcbuf_get_buf(name);
+		// Если получен заголовок приоритета запроса
+		if((nameBuffer.len == 8) && (::memcmp(nameBuffer.base, "priority", nameBuffer.len) == 0)){
+			// Получаем буфер значения заголовка
+			auto valueBuffer = nghttp2_rcbuf_get_buf(value);
+			// Выполняем установку приоритета потока, если он не был установлен ранее
+			self->_priorities.emplace(frame->hd.stream_id, self->parse(reinterpret_cast <const char *> (valueBuffer.base), valueBuffer.len));
+		}
+	}
 	// Если функция обратного вызова установлена
 	if(self->_callback.is("header")){
 		// Получаем буфер названия заголовка
@@ -916,22 +923,19 @@ ssize_t awh::Http2::send([[maybe_unused]] nghttp2_session * session, const int32
 		if((j != self->_payloads.end()) && !j->second->empty() && (j->second->size() >= i->second.front().first)){
 			// Определяем размер данных который мы можем отправить
 			result = static_cast <ssize_t> (i->second.front().first > size ? size : i->second.front().first);
-			// Выполняем копирование нужного нам количества данных
-			::memcpy(buffer, j->second->get(), result);
-			// Выполняем удаление из буфера отправленные данные
-			j->second->erase(result);
+			/**
+			 * Данные не копируются в буфер NgHttp2, фрейм будет сформирован
+			 * из буфера полезной нагрузки в функции отправки фрейма данных
+			 */
+			(* flags) |= NGHTTP2_DATA_FLAG_NO_COPY;
 			// Уменьшаем размер отправленных данных записи
 			i->second.front().first -= result;
 			// Если все данные записи отправленны
-			if(i->second.front().first == 0){
+			if(i->second.front().first == 0)
 				// Выполняем удаление записи
 				i->second.pop();
-				// Если буфер пустой
-				if(j->second->empty())
-					// Очищаем буфер
-					j->second->clear();
 			// Если установленно требование завершить работу потока
-			} else if(i->second.front().second == flag_t::END_STREAM)
+			else if(i->second.front().second == flag_t::END_STREAM)
 				// Отменяем завершение работы подключения
 				(* flags) |= NGHTTP2_DATA_FLAG_NO_END_STREAM;
 		// Если произошла рассинхронизация буфера и потоков
@@ -950,6 +954,69 @@ ssize_t awh::Http2::send([[maybe_unused]] nghttp2_session * session, const int32
 	// Выводим сообщение об ошибке
 	} else return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
 }
+/**
+ * @brief Функция отправки фрейма данных без копирования полезной нагрузки в буфер NgHttp2
+ *
+ * @param session объект сессии
+ * @param frame   объект фрейма данных
+ * @param head    заголовок фрейма
+ * @param size    размер полезной нагрузки фрейма
+ * @param source  объект промежуточных данных локального подключения
+ * @param ctx     передаваемый промежуточный контекст
+ * @return        статус полученного события
+ */
+int32_t awh::Http2::send([[maybe_unused]] nghttp2_session * session, nghttp2_frame * frame, const uint8_t * head, const size_t size, [[maybe_unused]] nghttp2_data_source * source, void * ctx) noexcept {
+	// Получаем объект родительского объекта
+	http2_t * self = reinterpret_cast <http2_t *> (ctx);
+	// Выполняем поиск буфера данных для потока
+	auto i = self->_payloads.find(frame->hd.stream_id);
+	// Если в буфере достаточно данных для формирования фрейма
+	if((i != self->_payloads.end()) && (i->second->size() >= size)){
+		// Если функция обратного вызова установлена
+		if(self->_callback.is("send")){
+			// Выполняем отправку заголовка фрейма
+			self->_callback.call <void (const uint8_t *, const size_t)> ("send", head, FRAME_HEADER_SIZE);
+			// Если фрейм передаётся с выравниванием
+			if(frame->data.padlen > 0){
+				// Получаем размер выравнивания
+				const uint8_t padding = static_cast <uint8_t> (frame->data.padlen - 1);
+				// Выполняем отправку размера выравнивания
+				self->_callback.call <void (const uint8_t *, const size_t)> ("send", &padding, sizeof(padding));
+			}
+			/**
+			 * Выполняем передачу полезной нагрузки фрейма по сегментам буфера
+			 */
+			for(size_t bytes = size; (bytes > 0) && !i->second->empty();){
+				// Определяем размер передаваемого сегмента
+				const size_t length = std::min(bytes, i->second->front());
+				// Получаем владельца данных сегмента
+				const auto owner = i->second->owner();
+				// Если данные переданы с владельцем, передаём их в очередь отправки по ссылке
+				if((owner != nullptr) && self->_callback.is("write"))
+					// Выполняем отправку сегмента без копирования
+					self->_callback.call <void (const uint8_t *, const size_t, const std::shared_ptr <const void> &)> ("write", reinterpret_cast <const uint8_t *> (i->second->get()), length, owner);
+				// Выполняем отправку сегмента с копированием
+				else self->_callback.call <void (const uint8_t *, const size_t)> ("send", reinterpret_cast <const uint8_t *> (i->second->get()), length);
+				// Выполняем удаление из буфера отправленные данные
+				i->second->erase(length);
+				// Уменьшаем количество оставшихся данных
+				bytes -= length;
+			}
+			// Если фрейм передаётся с выравниванием
+			if(frame->data.padlen > 1){
+				// Буфер выравнивания фрейма
+				static const uint8_t padding[256] = {0};
+				// Выполняем отправку выравнивания
+				self->_callback.call <void (const uint8_t *, const size_t)> ("send", padding, frame->data.padlen - 1);
+			}
+		// Выполняем удаление из буфера отправленные данные
+		} else i->second->erase(size);
+		// Выводим результат
+		return 0;
+	}
+	// Выводим сообщение об ошибке
+	return NGHTTP2_ERR_CALLBACK_FAILURE;
+}
 /**
  * @brief Метод проверки сколько байт доступно для отправки
  *
@@ -977,6 +1044,100 @@ size_t awh::Http2::available(const int32_t sid) const noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод извлечения приоритета из значения заголовка Priority
+ *
+ * @param buffer буфер значения заголовка
+ * @param size   размер значения заголовка
+ * @return       полученный приоритет потока
+ */
+awh::Http2::priority_t awh::Http2::parse(const char * buffer, const size_t size) const noexcept {
+	// Результат работы функции
+	priority_t result;
+	// Если значение заголовка передано
+	if((buffer != nullptr) && (size > 0)){
+		// Позиция начала и конца члена словаря
+		size_t begin = 0, end = 0;
+		/**
+		 * Выполняем перебор всех членов словаря, разделённых запятой
+		 */
+		while(begin < size){
+			// Выполняем поиск конца члена словаря
+			for(end = begin; (end < size) && (buffer[end] != ','); end++);
+			// Пропускаем пробельные символы в начале члена словаря
+			while((begin < end) && ((buffer[begin] == ' ') || (buffer[begin] == '\t')))
+				// Выполняем смещение начала члена словаря
+				begin++;
+			// Если получен параметр срочности ответа
+			if(((end - begin) >= 3) && (buffer[begin] == 'u') && (buffer[begin + 1] == '=')){
+				// Получаем значение срочности ответа
+				const char value = buffer[begin + 2];
+				// Если значение срочности ответа корректное
+				if((value >= '0') && (value <= '7') && (((begin + 3) == end) || (buffer[begin + 3] == ';') || (buffer[begin + 3] == ' ')))
+					// Выполняем установку срочности ответа
+					result.urgency = static_cast <uint8_t> (value - '0');
+			// Если получен параметр инкрементальной обработки ответа
+			} else if(((end - begin) >= 1) && (buffer[begin] == 'i')) {
+				// Если значение параметра не указано, он считается установленным
+				if(((begin + 1) == end) || (buffer[begin + 1] == ';') || (buffer[begin + 1] == ' '))
+					// Выполняем установку флага инкрементальной обработки ответа
+					result.incremental = true;
+				// Если значение параметра указано как логическое
+				else if(((end - begin) >= 4) && (buffer[begin + 1] == '=') && (buffer[begin + 2] == '?'))
+					// Выполняем установку флага инкрементальной обработки ответа
+					result.incremental = (buffer[begin + 3] == '1');
+			}
+			// Выполняем переход к следующему члену словаря
+			begin = (end + 1);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод выбора потока, данные которого следует отправить следующими
+ *
+ * @param skip список потоков исключённых из выбора
+ * @return     идентификатор выбранного потока
+ */
+int32_t awh::Http2::next(const std::set <int32_t> & skip) const noexcept {
+	// Результат работы функции
+	int32_t result = 0;
+	// Приоритет выбранного потока
+	priority_t selected;
+	/**
+	 * Выполняем перебор всех потоков имеющих неотправленные записи
+	 */
+	for(auto & record : this->_records){
+		// Если записей нет, поток исключён или на принимаемой стороне недостаточно памяти для получения данных
+		if(record.second.empty() || (skip.find(record.first) != skip.end()) || (this->available(record.first) < record.second.front().first))
+			// Пропускаем поток
+			continue;
+		// Получаем приоритет текущего потока
+		const priority_t current = this->priority(record.first);
+		// Если поток ещё не выбран или срочность текущего потока выше
+		if((result == 0) || (current.urgency < selected.urgency)){
+			// Выполняем выбор текущего потока
+			result = record.first;
+			// Запоминаем приоритет выбранного потока
+			selected = current;
+		// Если срочность потоков совпадает
+		} else if(current.urgency == selected.urgency) {
+			/**
+			 * Неинкрементальные потоки обслуживаются первыми и целиком в порядке идентификаторов,
+			 * а инкрементальные потоки обслуживаются поочерёдно начиная со следующего за последним обслуженным
+			 */
+			if(selected.incremental && (!current.incremental || ((result <= this->_turn) && (record.first > this->_turn)))){
+				// Выполняем выбор текущего потока
+				result = record.first;
+				// Запоминаем приоритет выбранного потока
+				selected = current;
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод применения изменений
  *
@@ -1134,6 +1295,108 @@ bool awh::Http2::windowUpdate(const int32_t sid, const int32_t size) noexcept {
 	// Выводим результат
 	return false;
 }
+/**
+ * @brief Метод учёта полученных данных и отправки пинга замера задержки
+ *
+ * @param size размер полученных данных
+ */
+void awh::Http2::probe(const size_t size) noexcept {
+	// Если ответ на предыдущий пинг ещё не получен
+	if(this->_probe.wait)
+		// Увеличиваем количество полученных байт за время замера
+		this->_probe.bytes += size;
+	// Если сессия инициализированна
+	else if(this->_session != nullptr) {
+		// Буфер данных пинга
+		uint8_t data[8];
+		// Запоминаем время отправки пинга
+		this->_probe.stamp = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MICROSECONDS);
+		// Копируем время отправки пинга в данные пинга
+		::memcpy(data, &this->_probe.stamp, sizeof(data));
+		// Выполняем отправку пинга удалённому узлу
+		const int32_t rv = nghttp2_submit_ping(this->_session, NGHTTP2_FLAG_NONE, data);
+		// Если отправить пинг не вышло
+		if(nghttp2_is_fatal(rv))
+			// Выводим сообщение об полученной ошибке
+			this->_log->print("%s", log_t::flag_t::WARNING, nghttp2_strerror(rv));
+		// Если пинг отправлен удачно
+		else {
+			// Сбрасываем количество полученных байт за время замера
+			this->_probe.bytes = 0;
+			// Устанавливаем флаг ожидания ответа на пинг
+			this->_probe.wait = true;
+		}
+	}
+}
+/**
+ * @brief Метод подстройки размеров окон по результатам замера задержки
+ *
+ * @param data данные полученного ответа на пинг
+ */
+void awh::Http2::tune(const uint8_t * data) noexcept {
+	// Время отправки пинга
+	uint64_t stamp = 0;
+	// Извлекаем время отправки пинга из данных ответа
+	::memcpy(&stamp, data, sizeof(stamp));
+	// Если ответ получен на отправленный нами пинг и сессия инициализированна
+	if((stamp == this->_probe.stamp) && (this->_session != nullptr)){
+		// Снимаем флаг ожидания ответа на пинг
+		this->_probe.wait = false;
+		// Получаем текущее время
+		const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MICROSECONDS);
+		// Получаем время приёма-передачи
+		const uint64_t rtt = std::max(date, stamp + 1) - stamp;
+		// Выполняем сглаживание времени приёма-передачи
+		this->_flow.rtt = static_cast <uint32_t> (std::min((this->_flow.rtt > 0 ? ((static_cast <uint64_t> (this->_flow.rtt) * 7 + rtt) / 8) : rtt), static_cast <uint64_t> (UINT32_MAX)));
+		// Получаем количество байт полученных за время приёма-передачи
+		const uint64_t bytes = std::min(this->_probe.bytes, static_cast <uint64_t> (UINT32_MAX));
+		// Если объём полученных данных вырос, принимаем его сразу, иначе плавно снижаем оценку
+		this->_flow.bdp = static_cast <uint32_t> (bytes >= this->_flow.bdp ? bytes : ((static_cast <uint64_t> (this->_flow.bdp) * 3 + bytes) / 4));
+		// Новый размер окна подключения
+		uint64_t window = this->_flow.window;
+		/**
+		 * Если за время приёма-передачи было получено больше двух третей окна,
+		 * скорость передачи ограничена окном и его следует увеличить
+		 */
+		if((bytes * 3) >= (static_cast <uint64_t> (this->_flow.window) * 2))
+			// Увеличиваем размер окна подключения
+			window = std::max(window * 2, static_cast <uint64_t> (this->_flow.bdp) * 2);
+		// Ограничиваем размер окна подключения максимальным значением
+		window = std::min(window, static_cast <uint64_t> (this->_flow.limit));
+		// Если функция обратного вызова получения доступной памяти установлена
+		if(this->_callback.is("memory"))
+			// Ограничиваем размер окна подключения объёмом доступной памяти
+			window = std::min(window, static_cast <uint64_t> (this->_callback.call <size_t (void)> ("memory")));
+		// Размер окна не может быть меньше начального
+		window = std::max(window, static_cast <uint64_t> (this->_probe.window));
+		// Если размер окна подключения изменился
+		if(window != static_cast <uint64_t> (this->_flow.window)){
+			// Выполняем установку нового размера окна подключения
+			const int32_t rv = nghttp2_session_set_local_window_size(this->_session, NGHTTP2_FLAG_NONE, 0, static_cast <int32_t> (window));
+			// Если установить размер окна подключения не вышло
+			if(nghttp2_is_fatal(rv))
+				// Выводим сообщение об полученной ошибке
+				this->_log->print("%s", log_t::flag_t::WARNING, nghttp2_strerror(rv));
+			// Запоминаем новый размер окна подключения
+			else this->_flow.window = static_cast <uint32_t> (window);
+		}
+		// Размер окна потоков следует за окном подключения, но не меньше начального
+		const uint32_t stream = std::max(this->_flow.window, this->_probe.stream);
+		// Если размер окна потоков изменился
+		if(stream != this->_flow.stream){
+			// Параметры настроек с новым начальным размером окна потоков
+			const nghttp2_settings_entry iv = {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, stream};
+			// Выполняем отправку нового размера окна потоков, он применяется ко всем открытым потокам
+			const int32_t rv = nghttp2_submit_settings(this->_session, NGHTTP2_FLAG_NONE, &iv, 1);
+			// Если отправить настройки не вышло
+			if(nghttp2_is_fatal(rv))
+				// Выводим сообщение об полученной ошибке
+				this->_log->print("%s", log_t::flag_t::WARNING, nghttp2_strerror(rv));
+			// Запоминаем новый размер окна потоков
+			else this->_flow.stream = stream;
+		}
+	}
+}
 /**
  * @brief Метод выполнения пинга
  *
@@ -1179,6 +1442,31 @@ bool awh::Http2::ping() noexcept {
 	// Выводим результат
 	return true;
 }
+/**
+ * @brief Метод получения состояния управления потоком сессии
+ *
+ * @return состояние управления потоком
+ */
+awh::Http2::flow_t awh::Http2::flow() const noexcept {
+	// Выводим состояние управления потоком
+	return this->_flow;
+}
+/**
+ * @brief Метод получения количества байт ожидающих отправки в потоке
+ *
+ * @param sid идентификатор потока
+ * @return    количество байт полезной нагрузки в очереди потока
+ */
+size_t awh::Http2::pending(const int32_t sid) const noexcept {
+	// Выполняем поиск очереди полезной нагрузки потока
+	auto i = this->_payloads.find(sid);
+	// Если очередь полезной нагрузки найдена
+	if(i != this->_payloads.end())
+		// Выводим количество байт в очереди потока
+		return i->second->size();
+	// Выводим результат
+	return 0;
+}
 /**
  * @brief Метод запрещения получения данных с клиента
  *
@@ -1627,6 +1915,20 @@ bool awh::Http2::sendTrailers(const int32_t id, const vector <std::pair <string,
  * @return       результат отправки данных фрейма
  */
 bool awh::Http2::sendData(const int32_t id, const uint8_t * buffer, const size_t size, const flag_t flag) noexcept {
+	// Выполняем отправку данных с копированием в буфер полезной нагрузки
+	return this->sendData(id, buffer, size, nullptr, flag);
+}
+/**
+ * @brief Метод отправки бинарных данных без копирования
+ *
+ * @param id     идентификатор потока
+ * @param buffer буфер бинарных данных передаваемых
+ * @param size   размер передаваемых данных в байтах
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ * @param flag   флаг передаваемого потока по сети
+ * @return       результат отправки данных фрейма
+ */
+bool awh::Http2::sendData(const int32_t id, const uint8_t * buffer, const size_t size, const std::shared_ptr <const void> & owner, const flag_t flag) noexcept {
 	// Выполняем установку активного события
 	this->_event = event_t::SEND_DATA;
 	// Если данные полезной нагрузки для отправки в сеть переданы
@@ -1643,13 +1945,13 @@ bool awh::Http2::sendData(const int32_t id, const uint8_t * buffer, const size_t
 					// Если буфер полезной нагрузки существует
 					if(i != this->_payloads.end())
 						// Выполняем добавление в буфер данных полезной нагрузки
-						i->second->push(buffer, size);
+						i->second->push(buffer, size, owner);
 					// Если буфер полезной нагрузки не существует
 					else {
 						// Выполняем создание буфера полезной нагрузки
-						auto ret = this->_payloads.emplace(id, std::make_unique <buffer_t> (this->_log));
+						auto ret = this->_payloads.emplace(id, std::make_unique <chain_t> (this->_log));
 						// Выполняем добавление в буфер данных полезной нагрузки
-						ret.first->second->push(buffer, size);
+						ret.first->second->push(buffer, size, owner);
 					}
 				}{
 					// Выполняем получение списка записей для потока
@@ -1670,24 +1972,8 @@ bool awh::Http2::sendData(const int32_t id, const uint8_t * buffer, const size_t
 				if((nghttp2_session_want_read(this->_session) == 0) && (nghttp2_session_want_write(this->_session) == 0))
 					// Выполняем завершение работы
 					goto End;
-				{
-					// Выполняем поиск записей для потока
-					auto i = this->_records.find(id);
-					// Если список неотправленных записей для потока существуют
-					if((i != this->_records.end()) && !i->second.empty()){
-						/**
-						 * Выполняем перебор всего списка записей которые ещё не отправленны
-						 */
-						while(!i->second.empty()){
-							// Если на принимаемой стороне достаточно памяти для получения данных
-							if(this->available(i->first) >= i->second.front().first)
-								// Выполняем отправку записи для указанного потока
-								this->submit(i->first, i->second.front().second);
-							// Если данных не достаточно, выходим
-							else break;
-						}
-					}
-				}
+				// Выполняем отправку подготовленных записей в порядке приоритетов потоков
+				this->dispatch();
 				// Выполняем вызов метода выполненного события
 				this->completed(event_t::SEND_DATA);
 				// Выводим результат
@@ -1746,6 +2032,152 @@ bool awh::Http2::sendData(const int32_t id, const uint8_t * buffer, const size_t
 	// Выводим результат
 	return false;
 }
+/**
+ * @brief Метод отправки подготовленных записей в порядке приоритетов потоков
+ *
+ * @return результат отправки данных
+ */
+bool awh::Http2::dispatch() noexcept {
+	// Результат работы функции
+	bool result = true;
+	// Если сессия инициализированна
+	if(this->_session != nullptr){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Идентификатор выбранного потока
+			int32_t sid = 0;
+			// Список потоков, записи которых отправить не вышло
+			std::set <int32_t> skip;
+			/**
+			 * Выполняем отправку записей пока есть потоки готовые к отправке
+			 */
+			while((sid = this->next(skip)) > 0){
+				// Если очередь отправки заполнена, отправка будет продолжена после её освобождения
+				if(this->_callback.is("pending") && (this->_callback.call <size_t (void)> ("pending") >= static_cast <size_t> (SEND_WATERMARK)))
+					// Выходим из цикла
+					break;
+				// Выполняем поиск записей для потока
+				auto i = this->_records.find(sid);
+				// Запоминаем количество записей потока
+				const size_t count = i->second.size();
+				// Запоминаем размер отправляемой записи
+				const size_t size = i->second.front().first;
+				// Если поток обрабатывается инкрементально
+				if(this->priority(sid).incremental)
+					// Запоминаем последний обслуженный инкрементальный поток
+					this->_turn = sid;
+				// Выполняем отправку записи для указанного потока
+				if(!(result = this->submit(sid, i->second.front().second)))
+					// Выходим из цикла
+					break;
+				// Выполняем поиск записей для потока повторно, так как поток мог быть закрыт
+				i = this->_records.find(sid);
+				// Если запись отправить не вышло
+				if((i != this->_records.end()) && (i->second.size() == count) && (i->second.front().first == size))
+					// Исключаем поток из выбора, чтобы не блокировать отправку остальных потоков
+					skip.emplace(sid);
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения приоритета потока
+ *
+ * @param sid идентификатор потока
+ * @return    приоритет потока
+ */
+awh::Http2::priority_t awh::Http2::priority(const int32_t sid) const noexcept {
+	// Выполняем поиск приоритета потока
+	auto i = this->_priorities.find(sid);
+	// Если приоритет потока найден
+	if(i != this->_priorities.end())
+		// Выводим приоритет потока
+		return i->second;
+	// Выводим приоритет по умолчанию
+	return priority_t();
+}
+/**
+ * @brief Метод установки приоритета потока
+ *
+ * @param sid         идентификатор потока
+ * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+ * @param incremental флаг инкрементальной обработки ответа
+ */
+void awh::Http2::priority(const int32_t sid, const uint8_t urgency, const bool incremental) noexcept {
+	// Если идентификатор потока передан
+	if(sid > 0){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Выполняем поиск приоритета потока
+			auto i = this->_priorities.find(sid);
+			// Если приоритет потока не найден
+			if(i == this->_priorities.end())
+				// Выполняем создание приоритета потока
+				i = this->_priorities.emplace(sid, priority_t()).first;
+			// Запрещаем клиенту изменять приоритет потока
+			i->second.fixed = true;
+			// Устанавливаем флаг инкрементальной обработки ответа
+			i->second.incremental = incremental;
+			// Устанавливаем срочность ответа
+			i->second.urgency = std::min(urgency, static_cast <uint8_t> (NGHTTP2_EXTPRI_URGENCY_LOW));
+			// Если сессия сервера инициализированна
+			if((this->_session != nullptr) && (this->_mode == mode_t::SERVER)){
+				// Создаём объект приоритета NgHttp2
+				nghttp2_extpri extpri;
+				// Устанавливаем срочность ответа
+				extpri.urgency = i->second.urgency;
+				// Устанавливаем флаг инкрементальной обработки ответа
+				extpri.inc = (incremental ? 1 : 0);
+				// Сообщаем NgHttp2 новый приоритет потока и запрещаем его изменение клиентом
+				nghttp2_session_change_extpri_stream_priority(this->_session, sid, &extpri, 1);
+			}
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(sid, urgency, incremental), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+}
 /**
  * @brief Метод отправки push-уведомлений
  *
@@ -2061,6 +2493,16 @@ void awh::Http2::free() noexcept {
 	if(!this->_records.empty())
 		// Выполняем удаление всего списка записей
 		this->_records.clear();
+	// Если список приоритетов потоков существует
+	if(!this->_priorities.empty())
+		// Выполняем удаление всего списка приоритетов
+		this->_priorities.clear();
+	// Выполняем сброс последнего обслуженного инкрементального потока
+	this->_turn = 0;
+	// Выполняем сброс состояния управления потоком
+	this->_flow = flow_t();
+	// Выполняем сброс параметров замера задержки
+	this->_probe = probe_t();
 }
 /**
  * @brief Метод закрытия подключения
@@ -2181,6 +2623,8 @@ bool awh::Http2::init(const mode_t mode, const std::map <settings_t, uint32_t> &
 		nghttp2_session_callbacks_new(&callback);
 		// Выполняем установку функции обратного вызова при подготовки данных для отправки
 		nghttp2_session_callbacks_set_send_callback2(callback, &http2_t::send);
+		// Выполняем установку функции обратного вызова отправки фреймов данных без копирования
+		nghttp2_session_callbacks_set_send_data_callback(callback, &http2_t::send);
 		// Выполняем установку функции обратного вызова при перехвате ошибок протокола
 		nghttp2_session_callbacks_set_error_callback2(callback, &http2_t::error);
 		// Выполняем установку функции обратного вызова при получении заголовка
@@ -2300,6 +2744,8 @@ bool awh::Http2::init(const mode_t mode, const std::map <settings_t, uint32_t> &
 				 * Это гарантирует, что поток данных по соединению не будет перемещаться слишком быстро, и ограничит объем данных, которые нам необходимо буферизовать.
 				 */
 				nghttp2_option_set_no_auto_window_update(option, 1);
+				// Разрешаем получение фреймов обновления приоритетов потоков RFC 9218
+				nghttp2_option_set_builtin_recv_extension_type(option, NGHTTP2_PRIORITY_UPDATE);
 				// Выполняем переход по всему списку настроек
 				for(auto & item : settings){
 					/**
@@ -2376,6 +2822,22 @@ bool awh::Http2::init(const mode_t mode, const std::map <settings_t, uint32_t> &
 				}
 			}
 		}
+		// Запоминаем начальный размер окна подключения
+		this->_probe.window = std::max(static_cast <uint32_t> (nghttp2_session_get_local_window_size(this->_session)), static_cast <uint32_t> (NGHTTP2_INITIAL_CONNECTION_WINDOW_SIZE));
+		// Выполняем поиск начального размера окна потоков
+		auto j = settings.find(settings_t::WINDOW_SIZE);
+		// Запоминаем начальный размер окна потоков
+		this->_probe.stream = ((j != settings.end()) ? j->second : static_cast <uint32_t> (NGHTTP2_INITIAL_WINDOW_SIZE));
+		// Устанавливаем текущий размер окна подключения
+		this->_flow.window = this->_probe.window;
+		// Устанавливаем текущий размер окна потоков
+		this->_flow.stream = this->_probe.stream;
+		// Выполняем поиск максимального размера окна при автоматической подстройке
+		j = settings.find(settings_t::WINDOW_LIMIT);
+		// Если автоматическая подстройка размеров окон активирована
+		if((j != settings.end()) && (j->second > 0))
+			// Устанавливаем максимальный размер окна
+			this->_flow.limit = std::min(j->second, static_cast <uint32_t> (NGHTTP2_MAX_WINDOW_SIZE));
 		// Если список параметров настроек не пустой
 		if(!iv.empty()){
 			// Клиентская 24-байтовая магическая строка будет отправлена библиотекой nghttp2
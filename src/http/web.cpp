@@ -17,11 +17,99 @@
  */
 #include <http/web.hpp>
 
+/**
+ * Если сборка выполняется для архитектуры x86
+ */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	/**
+	 * Если используется набор инструкций AVX2
+	 */
+	#if defined(__AVX2__)
+		/**
+		 * Подключаем модуль инструкций AVX2
+		 */
+		#include <immintrin.h>
+		// Активируем векторный поиск блоками по 32 байта
+		#define AWH_WEB_SEEK_AVX2 1
+	/**
+	 * Если используется набор инструкций SSE2
+	 */
+	#elif defined(__SSE2__)
+		/**
+		 * Подключаем модуль инструкций SSE2
+		 */
+		#include <emmintrin.h>
+		// Активируем векторный поиск блоками по 16 байт
+		#define AWH_WEB_SEEK_SSE2 1
+	#endif
+#endif
+
 /**
  * Подписываемся на стандартное пространство имён
  */
 using namespace std;
 
+/**
+ * Названия известных заголовков в порядке их идентификаторов
+ */
+static const string HeaderNames[] = {
+	"",
+	"te",
+	"age",
+	"via",
+	"dnt",
+	"date",
+	"host",
+	"etag",
+	"link",
+	"vary",
+	"from",
+	"range",
+	"allow",
+	"accept",
+	"cookie",
+	"origin",
+	"server",
+	"pragma",
+	"expect",
+	"expires",
+	"referer",
+	"trailer",
+	"upgrade",
+	"location",
+	"keep-alive",
+	"user-agent",
+	"set-cookie",
+	"connection",
+	"retry-after",
+	"content-type",
+	"x-powered-by",
+	"cache-control",
+	"last-modified",
+	"authorization",
+	"accept-ranges",
+	"if-none-match",
+	"content-range",
+	"content-length",
+	"accept-charset",
+	"http2-settings",
+	"accept-encoding",
+	"accept-language",
+	"content-encoding",
+	"proxy-connection",
+	"www-authenticate",
+	"x-awh-encryption",
+	"if-modified-since",
+	"transfer-encoding",
+	"sec-websocket-key",
+	"proxy-authenticate",
+	"sec-websocket-accept",
+	"proxy-authorization",
+	"sec-websocket-version",
+	"sec-websocket-protocol",
+	"sec-websocket-extensions"
+};
+
 /**
  * @brief Оператор [=] перемещения параметров запроса клиента
  *
@@ -396,6 +484,8 @@ size_t awh::Web::readPayload(const char * buffer, const size_t size) noexcept {
 										this->_fmk->transform(key, fmk_t::transform_t::LOWER),
 										this->_fmk->transform(val, fmk_t::transform_t::TRIM)
 									);
+									// Помечаем известный заголовок как присутствующий
+									this->known(key);
 									// Если функция обратного вызова на вывод полученного заголовка с сервера установлена
 									if(this->_callback.is("header"))
 										// Выполняем функцию обратного вызова
@@ -940,14 +1030,34 @@ size_t awh::Web::readHeaders(const char * buffer, const size_t size) noexcept {
 							 * Выполняем отлов ошибок
 							 */
 							try {
-								// Получаем ключ заголовка
-								string key(buffer, this->_pos[0]);
+								// Получаем длину ключа заголовка
+								const size_t length = static_cast <size_t> (this->_pos[0]);
 								// Получаем значение заголовка
-								string val(buffer + (this->_pos[0] + 1), size - (this->_pos[0] + 1));
+								const char * value = (buffer + (this->_pos[0] + 1));
+								// Получаем размер значения заголовка
+								const size_t bytes = (size - (this->_pos[0] + 1));
 								// Добавляем заголовок в список заголовков
-								if(!key.empty() && !val.empty()){
+								if((length > 0) && (bytes > 0)){
+									// Начало и конец значения заголовка без пробелов
+									const char * first = value, * last = (value + bytes);
+									// Выполняем удаление пробелов в начале значения
+									while((first < last) && ::isspace(static_cast <uint8_t> (* first)))
+										// Выполняем смещение начала значения
+										++first;
+									// Выполняем удаление пробелов в конце значения
+									while((last > first) && ::isspace(static_cast <uint8_t> (* (last - 1))))
+										// Выполняем смещение конца значения
+										--last;
+									// Получаем ключ заголовка в нижнем регистре
+									string key(length, '\0');
+									// Выполняем перебор всех символов ключа
+									for(size_t i = 0; i < length; i++)
+										// Приводим каждую букву ключа к нижнему регистру
+										key[i] = static_cast <char> (::tolower(static_cast <uint8_t> (buffer[i])));
+									// Получаем значение заголовка без пробелов
+									string val(first, last);
 									// Если название заголовка соответствует HOST
-									if(this->_fmk->compare(key, "host")){
+									if(key.compare("host") == 0){
 										// Создаём объект работы с IP-адресами
 										net_t net(this->_log);
 										// Выполняем установку порта по умолчанию
@@ -955,7 +1065,7 @@ size_t awh::Web::readHeaders(const char * buffer, const size_t size) noexcept {
 										// Выполняем установку схемы запроса
 										this->_request.url.schema = "http";
 										// Выполняем установку хоста
-										this->_request.url.host = this->_fmk->transform(val, fmk_t::transform_t::TRIM);
+										this->_request.url.host = val;
 										// Выполняем поиск разделителя
 										const size_t pos = this->_request.url.host.rfind(':');
 										// Если разделитель найден
@@ -999,25 +1109,24 @@ size_t awh::Web::readHeaders(const char * buffer, const size_t size) noexcept {
 											break;
 										}
 									// Если название заголовка соответствует переключению протокола
-									} else if(this->_fmk->compare(key, "upgrade"))
+									} else if(key.compare("upgrade") == 0)
 										// Выполняем установку название протокола для переключению
-										this->_upgrade = val;
+										this->_upgrade.assign(value, bytes);
 									// Если название заголовка соответствует трейлеру
-									else if(this->_fmk->compare(key, "trailer")) {
+									else if(key.compare("trailer") == 0) {
 										// Выполняем сбор трейлеров
-										this->_trailers.emplace(this->_fmk->transform(this->_fmk->transform(val, fmk_t::transform_t::TRIM), fmk_t::transform_t::LOWER));
+										this->_trailers.emplace(this->_fmk->transform(val, fmk_t::transform_t::LOWER));
 										// Выводим результат
 										return;
 									}
-									// Добавляем заголовок в список
-									this->_headers.emplace(
-										this->_fmk->transform(key, fmk_t::transform_t::LOWER),
-										this->_fmk->transform(val, fmk_t::transform_t::TRIM)
-									);
+									// Добавляем заголовок в список без повторного копирования
+									const auto i = this->_headers.emplace(::move(key), ::move(val));
+									// Помечаем известный заголовок как присутствующий
+									this->known(i->first);
 									// Если функция обратного вызова на вывод полученного заголовка с сервера установлена
 									if(this->_callback.is("header"))
 										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const uint64_t, const string &, const string &)> ("header", this->_id, key, val);
+										this->_callback.call <void (const uint64_t, const string &, const string &)> ("header", this->_id, i->first, i->second);
 								}
 							/**
 							 * Если возникает ошибка
@@ -1046,9 +1155,68 @@ size_t awh::Web::readHeaders(const char * buffer, const size_t size) noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод поиска символа в буфере данных
+ *
+ * Поиск выполняется блоками по 32 байта (AVX2) или по 16 байт (SSE2),
+ * при отсутствии векторных инструкций используется системный memchr
+ *
+ * @param buffer буфер данных для поиска
+ * @param size   размер буфера данных для поиска
+ * @param letter искомый символ
+ * @return       указатель на найденный символ или nullptr
+ */
+const char * awh::Web::seek(const char * buffer, const size_t size, const char letter) const noexcept {
+	// Если данные не переданы
+	if((buffer == nullptr) || (size == 0))
+		// Выводим пустое значение
+		return nullptr;
+	// Смещение в буфере данных
+	size_t offset = 0;
+	/**
+	 * Если используется набор инструкций AVX2
+	 */
+	#if defined(AWH_WEB_SEEK_AVX2)
+		// Заполняем вектор искомым символом
+		const __m256i pattern = _mm256_set1_epi8(letter);
+		// Выполняем перебор буфера блоками по 32 байта
+		for(; (offset + 32) <= size; offset += 32){
+			// Получаем маску совпадений символов блока
+			const uint32_t mask = static_cast <uint32_t> (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast <const __m256i *> (buffer + offset)), pattern)));
+			// Если символ в блоке найден
+			if(mask != 0)
+				// Выводим позицию первого найденного символа
+				return (buffer + (offset + static_cast <size_t> (__builtin_ctz(mask))));
+		}
+	/**
+	 * Если используется набор инструкций SSE2
+	 */
+	#elif defined(AWH_WEB_SEEK_SSE2)
+		// Заполняем вектор искомым символом
+		const __m128i pattern = _mm_set1_epi8(letter);
+		// Выполняем перебор буфера блоками по 16 байт
+		for(; (offset + 16) <= size; offset += 16){
+			// Получаем маску совпадений символов блока
+			const uint32_t mask = static_cast <uint32_t> (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast <const __m128i *> (buffer + offset)), pattern)));
+			// Если символ в блоке найден
+			if(mask != 0)
+				// Выводим позицию первого найденного символа
+				return (buffer + (offset + static_cast <size_t> (__builtin_ctz(mask))));
+		}
+	#endif
+	// Если в буфере остались непроверенные данные
+	if(offset < size)
+		// Выполняем поиск символа в оставшихся данных
+		return reinterpret_cast <const char *> (::memchr(buffer + offset, letter, size - offset));
+	// Выводим пустое значение
+	return nullptr;
+}
 /**
  * @brief Метод препарирования HTTP заголовков
  *
+ * Буфер разбирается построчно: переносы строк и разделители ищутся векторным поиском,
+ * функция обратного вызова вызывается один раз на каждую полученную строку
+ *
  * @param buffer   буфер данных для парсинга
  * @param size     размер буфера данных для парсинга
  * @param callback функция обратного вызова
@@ -1058,67 +1226,77 @@ void awh::Web::prepare(const char * buffer, const size_t size, function <void (c
 	if((buffer != nullptr) && (size > 0) && (callback != nullptr)){
 		// Флаг завершения работы сборки
 		bool stop = false;
-		// Значение текущей и предыдущей буквы
-		char letter = 0, old = 0;
-		// Смещение в буфере и длина полученной строки
-		size_t offset = 0, length = 0, count = 0;
+		// Указатель на найденный символ
+		const char * letter = nullptr;
+		// Смещение в буфере, длина полученной строки и количество найденных сепараторов
+		size_t offset = 0, length = 0, count = 0, end = 0;
 		// Если позиция ещё не сброшена
 		if((this->_pos[0] > -1) && (this->_pos[1] > -1))
 			// Выполняем сброс массива сепараторов
 			::memset(this->_pos, -1, sizeof(this->_pos));
-		// Переходим по всему буферу
-		for(size_t i = 0; i < size; i++){
-			// Получаем значение текущей буквы
-			letter = buffer[i];
+		// Переходим по всем строкам буфера
+		while(offset < size){
+			// Если строка начинается с возврата каретки, значит получена пустая строка завершения
+			if((offset > 0) && (buffer[offset] == '\r'))
+				// Устанавливаем флаг конца
+				stop = true;
+			// Выполняем поиск переноса строки
+			letter = this->seek(buffer + offset, size - offset, '\n');
+			// Если перенос строки находится в самом начале буфера, он не завершает строку
+			if(letter == buffer){
+				// Если за переносом строки следует возврат каретки
+				if((size > 1) && (buffer[1] == '\r'))
+					// Устанавливаем флаг конца
+					stop = true;
+				// Выполняем поиск следующего переноса строки
+				letter = this->seek(buffer + 1, size - 1, '\n');
+			}
+			// Получаем позицию конца строки
+			end = (letter != nullptr ? static_cast <size_t> (letter - buffer) : size);
+			// Если сепаратор установлен и ещё не все сепараторы найдены
+			if((this->_separator != '\0') && (count < 2)){
+				// Выполняем поиск сепараторов в полученной строке
+				for(const char * i = (buffer + offset), * j = (buffer + end); (count < 2) && (i < j); ++i){
+					// Если сепаратор в строке не найден
+					if((i = this->seek(i, static_cast <size_t> (j - i), this->_separator)) == nullptr)
+						// Выходим из цикла
+						break;
+					// Устанавливаем позицию найденного разделителя
+					this->_pos[count] = static_cast <int64_t> (i - (buffer + offset));
+					// Увеличиваем количество найденных разделителей
+					count++;
+				}
+			}
+			// Если перенос строки не найден, ожидаем получения остальных данных
+			if(letter == nullptr)
+				// Выходим из цикла
+				break;
 			// Если текущий символ перенос строки и это конец, выходим
-			if(stop && (letter == '\n')){
+			if(stop){
 				// Выполняем функцию обратного вызова
-				callback(nullptr, 0, i + 1, stop);
+				callback(nullptr, 0, end + 1, stop);
 				// Выходим из цикла
 				break;
 			}
-			// Если предыдущий символ был переносом строки а текущий возврат каретки
-			if((old == '\n') && (letter == '\r'))
+			// Если предыдущая буква была возвратом каретки, уменьшаем длину строки
+			length = ((buffer[end - 1] == '\r' ? end - 1 : end) - offset);
+			// Если данные не получены но мы дошли до конца
+			if((length == 0) && (buffer[end - 1] == '\r')){
 				// Устанавливаем флаг конца
-				stop = true;
-			// Если сепаратор найден, добавляем его в массив
-			if((this->_separator != '\0') && (letter == this->_separator) && (count < 2)){
-				// Устанавливаем позицию найденного разделителя
-				this->_pos[count] = (i - offset);
-				// Увеличиваем количество найденных разделителей
-				count++;
-			}
-			// Если текущая буква является переносом строк
-			// if((i > 0) && ((letter == '\n') || (i == (size - 1)))){
-			if((i > 0) && (letter == '\n')){
-				// Если предыдущая буква была возвратом каретки, уменьшаем длину строки
-				length = ((old == '\r' ? i - 1 : i) - offset);
-				/*
-				// Если символ является последним и он не является переносом строки
-				if((i == (size - 1)) && (letter != '\n'))
-					// Увеличиваем общий размер обработанных байт
-					length++;
-				*/
-				// Если данные не получены но мы дошли до конца
-				if((length == 0) && (old == '\r') && (letter == '\n')){
-					// Устанавливаем флаг конца
-					stop = ((this->_state == state_t::HEADERS) || (this->_state == state_t::BODY));
-					// Выполняем функцию обратного вызова
-					callback(nullptr, 0, i + 1, stop);
-				// Если длина слова получена, выводим полученную строку
-				} else callback(buffer + offset, length, i + 1, stop);
-				// Если массив сепараторов получен
-				if(this->_separator != '\0'){
-					// Выполняем сброс количество найденных сепараторов
-					count = 0;
-					// Выполняем сброс массива сепараторов
-					::memset(this->_pos, -1, sizeof(this->_pos));
-				}
-				// Выполняем смещение
-				offset = (i + 1);
+				stop = ((this->_state == state_t::HEADERS) || (this->_state == state_t::BODY));
+				// Выполняем функцию обратного вызова
+				callback(nullptr, 0, end + 1, stop);
+			// Если длина слова получена, выводим полученную строку
+			} else callback(buffer + offset, length, end + 1, stop);
+			// Если массив сепараторов получен
+			if(this->_separator != '\0'){
+				// Выполняем сброс количество найденных сепараторов
+				count = 0;
+				// Выполняем сброс массива сепараторов
+				::memset(this->_pos, -1, sizeof(this->_pos));
 			}
-			// Запоминаем предыдущую букву
-			old = letter;
+			// Выполняем смещение
+			offset = (end + 1);
 		}
 	}
 }
@@ -1311,6 +1489,8 @@ void awh::Web::dump(const vector <char> & data) noexcept {
 		offset += sizeof(count);
 		// Выполняем сброс заголовков
 		this->_headers.clear();
+		// Выполняем сброс маски известных заголовков
+		this->_known = 0;
 		// Если количество заголовков больше чем ничего
 		if(count > 0){
 			// Выполняем последовательную загрузку всех заголовков
@@ -1340,9 +1520,12 @@ void awh::Web::dump(const vector <char> & data) noexcept {
 						// Выполняем смещение в буфере
 						offset += length;
 						// Если и ключ и значение заголовка получены
-						if(!key.empty() && !value.empty())
+						if(!key.empty() && !value.empty()){
+							// Помечаем известный заголовок как присутствующий
+							this->known(key);
 							// Добавляем заголовок в список заголовков
 							this->_headers.emplace(::move(key), ::move(value));
+						}
 					}
 				}
 			}
@@ -1401,6 +1584,8 @@ void awh::Web::clear() noexcept {
 	this->_chunk.clear();
 	// Выполняем сброс полученных HTTP заголовков
 	this->_headers.clear();
+	// Выполняем сброс маски известных заголовков
+	this->_known = 0;
 	// Выполняем сброс списка трейлеров
 	this->_trailers.clear();
 	// Выполняем удаление памяти тела
@@ -1498,6 +1683,12 @@ bool awh::Web::isHeader(const string & key) const noexcept {
 	bool result = false;
 	// Если ключ передан
 	if(!key.empty()){
+		// Получаем идентификатор заголовка
+		const header_t interned = this->intern(key);
+		// Если заголовок является известным
+		if(interned != header_t::NONE)
+			// Выводим результат проверки маски известных заголовков
+			return ((this->_known & (1ULL << static_cast <uint8_t> (interned))) != 0);
 		// Выполняем перебор всех заголовков
 		for(auto & header : this->_headers){
 			// Выполняем проверку существования заголовка
@@ -1517,12 +1708,247 @@ bool awh::Web::isHeader(const string & key) const noexcept {
  */
 bool awh::Web::isStandard(const string & key) const noexcept {
 	// Если ключ передан
-	if(!key.empty())
+	if(!key.empty()){
+		// Получаем идентификатор заголовка
+		const header_t interned = this->intern(key);
+		// Если заголовок является известным
+		if(interned != header_t::NONE)
+			// Выполняем проверку заголовка без приведения к нижнему регистру
+			return (this->_standardHeaders.count(this->name(interned)) > 0);
 		// Выполняем проверку заголовка
 		return (this->_standardHeaders.count(this->_fmk->transform(key, fmk_t::transform_t::LOWER)) > 0);
+	}
 	// Выводим результат
 	return false;
 }
+/**
+ * @brief Метод получения идентификатора известного заголовка
+ *
+ * @param key ключ заголовка
+ * @return    идентификатор заголовка
+ */
+awh::Web::header_t awh::Web::intern(const string & key) const noexcept {
+	// Выводим идентификатор заголовка
+	return this->intern(key.data(), key.size());
+}
+/**
+ * @brief Метод получения идентификатора известного заголовка
+ *
+ * Идентификатор определяется без копирования и приведения ключа к нижнему регистру:
+ * кандидат выбирается по длине названия и одному символу, затем сверяется полностью
+ *
+ * @param key  ключ заголовка
+ * @param size размер ключа заголовка
+ * @return     идентификатор заголовка
+ */
+awh::Web::header_t awh::Web::intern(const char * key, const size_t size) const noexcept {
+	// Результат работы функции
+	header_t result = header_t::NONE;
+	// Если ключ заголовка передан
+	if((key != nullptr) && (size > 0)){
+		/**
+		 * Определяем кандидата по длине названия заголовка
+		 */
+		switch(size){
+			// Если длина названия заголовка равна 2
+			case 2: result = header_t::TE; break;
+			// Если длина названия заголовка равна 3
+			case 3: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'a': result = header_t::AGE; break;
+					case 'd': result = header_t::DNT; break;
+					case 'v': result = header_t::VIA; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 4
+			case 4: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'd': result = header_t::DATE; break;
+					case 'e': result = header_t::ETAG; break;
+					case 'f': result = header_t::FROM; break;
+					case 'h': result = header_t::HOST; break;
+					case 'l': result = header_t::LINK; break;
+					case 'v': result = header_t::VARY; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 5
+			case 5: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'a': result = header_t::ALLOW; break;
+					case 'r': result = header_t::RANGE; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 6
+			case 6: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'a': result = header_t::ACCEPT; break;
+					case 'c': result = header_t::COOKIE; break;
+					case 'e': result = header_t::EXPECT; break;
+					case 'o': result = header_t::ORIGIN; break;
+					case 'p': result = header_t::PRAGMA; break;
+					case 's': result = header_t::SERVER; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 7
+			case 7: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'e': result = header_t::EXPIRES; break;
+					case 'r': result = header_t::REFERER; break;
+					case 't': result = header_t::TRAILER; break;
+					case 'u': result = header_t::UPGRADE; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 8
+			case 8: result = header_t::LOCATION; break;
+			// Если длина названия заголовка равна 10
+			case 10: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'c': result = header_t::CONNECTION; break;
+					case 'k': result = header_t::KEEP_ALIVE; break;
+					case 's': result = header_t::SET_COOKIE; break;
+					case 'u': result = header_t::USER_AGENT; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 11
+			case 11: result = header_t::RETRY_AFTER; break;
+			// Если длина названия заголовка равна 12
+			case 12: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'c': result = header_t::CONTENT_TYPE; break;
+					case 'x': result = header_t::X_POWERED_BY; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 13
+			case 13: {
+				/**
+				 * Определяем заголовок по символу в позиции 6
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[6]))){
+					case '-': result = header_t::ACCEPT_RANGES; break;
+					case 'c': result = header_t::CACHE_CONTROL; break;
+					case 'e': result = header_t::IF_NONE_MATCH; break;
+					case 'i': result = header_t::AUTHORIZATION; break;
+					case 'o': result = header_t::LAST_MODIFIED; break;
+					case 't': result = header_t::CONTENT_RANGE; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 14
+			case 14: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'a': result = header_t::ACCEPT_CHARSET; break;
+					case 'c': result = header_t::CONTENT_LENGTH; break;
+					case 'h': result = header_t::HTTP2_SETTINGS; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 15
+			case 15: {
+				/**
+				 * Определяем заголовок по символу в позиции 7
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[7]))){
+					case 'e': result = header_t::ACCEPT_ENCODING; break;
+					case 'l': result = header_t::ACCEPT_LANGUAGE; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 16
+			case 16: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'c': result = header_t::CONTENT_ENCODING; break;
+					case 'p': result = header_t::PROXY_CONNECTION; break;
+					case 'w': result = header_t::WWW_AUTHENTICATE; break;
+					case 'x': result = header_t::X_AWH_ENCRYPTION; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 17
+			case 17: {
+				/**
+				 * Определяем заголовок по символу в позиции 0
+				 */
+				switch(::tolower(static_cast <uint8_t> (key[0]))){
+					case 'i': result = header_t::IF_MODIFIED_SINCE; break;
+					case 's': result = header_t::SEC_WEBSOCKET_KEY; break;
+					case 't': result = header_t::TRANSFER_ENCODING; break;
+				}
+			} break;
+			// Если длина названия заголовка равна 18
+			case 18: result = header_t::PROXY_AUTHENTICATE; break;
+			// Если длина названия заголовка равна 19
+			case 19: result = header_t::PROXY_AUTHORIZATION; break;
+			// Если длина названия заголовка равна 20
+			case 20: result = header_t::SEC_WEBSOCKET_ACCEPT; break;
+			// Если длина названия заголовка равна 21
+			case 21: result = header_t::SEC_WEBSOCKET_VERSION; break;
+			// Если длина названия заголовка равна 22
+			case 22: result = header_t::SEC_WEBSOCKET_PROTOCOL; break;
+			// Если длина названия заголовка равна 24
+			case 24: result = header_t::SEC_WEBSOCKET_EXTENSIONS; break;
+		}
+		// Если кандидат найден
+		if(result != header_t::NONE){
+			// Получаем название кандидата
+			const string & name = HeaderNames[static_cast <uint8_t> (result)];
+			// Выполняем перебор всех символов ключа
+			for(size_t i = 0; i < size; i++){
+				// Если символ ключа не совпадает с названием кандидата
+				if(::tolower(static_cast <uint8_t> (key[i])) != name[i])
+					// Выводим пустой идентификатор
+					return header_t::NONE;
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения названия известного заголовка
+ *
+ * @param header идентификатор заголовка
+ * @return       название заголовка в нижнем регистре
+ */
+const string & awh::Web::name(const header_t header) const noexcept {
+	// Выводим название заголовка
+	return HeaderNames[static_cast <uint8_t> (header)];
+}
+/**
+ * @brief Метод пометки известного заголовка как присутствующего
+ *
+ * @param key ключ заголовка
+ */
+void awh::Web::known(const string & key) noexcept {
+	// Получаем идентификатор заголовка
+	const header_t interned = this->intern(key);
+	// Если заголовок является известным
+	if(interned != header_t::NONE)
+		// Помечаем заголовок как присутствующий
+		this->_known |= (1ULL << static_cast <uint8_t> (interned));
+}
 /**
  * @brief Метод очистки данных тела
  *
@@ -1538,6 +1964,8 @@ void awh::Web::clearBody() noexcept {
 void awh::Web::clearHeaders() noexcept {
 	// Выполняем очистку заголовков
 	this->_headers.clear();
+	// Выполняем сброс маски известных заголовков
+	this->_known = 0;
 }
 /**
  * @brief Метод получения данных тела запроса
@@ -1598,8 +2026,10 @@ void awh::Web::upgrade(const string & upgrade) noexcept {
 std::set <awh::Web::proto_t> awh::Web::proto(const string & key) const noexcept {
 	// Если ключ передан
 	if(!key.empty()){
+		// Получаем идентификатор заголовка
+		const header_t interned = this->intern(key);
 		// Выполняем поиск заголовка
-		auto i = this->_standardHeaders.find(this->_fmk->transform(key, fmk_t::transform_t::LOWER));
+		auto i = (interned != header_t::NONE ? this->_standardHeaders.find(this->name(interned)) : this->_standardHeaders.find(this->_fmk->transform(key, fmk_t::transform_t::LOWER)));
 		// Если заголовок найден выводим результат
 		if(i != this->_standardHeaders.end())
 			// Выводим результат
@@ -1616,6 +2046,17 @@ std::set <awh::Web::proto_t> awh::Web::proto(const string & key) const noexcept
 void awh::Web::delHeader(const string & key) noexcept {
 	// Если ключ заголовка передан
 	if(!key.empty()){
+		// Получаем идентификатор заголовка
+		const header_t interned = this->intern(key);
+		// Если заголовок является известным
+		if(interned != header_t::NONE){
+			// Если заголовок отсутствует в списке
+			if((this->_known & (1ULL << static_cast <uint8_t> (interned))) == 0)
+				// Выходим из функции
+				return;
+			// Снимаем пометку присутствия заголовка
+			this->_known &= ~(1ULL << static_cast <uint8_t> (interned));
+		}
 		// Выполняем перебор всех заголовков
 		for(auto i = this->_headers.begin(); i != this->_headers.end();){
 			// Выполняем проверку существования заголовка
@@ -1636,6 +2077,21 @@ void awh::Web::delHeader(const string & key) noexcept {
 string awh::Web::header(const string & key) const noexcept {
 	// Если ключ заголовка передан
 	if(!key.empty()){
+		// Получаем идентификатор заголовка
+		const header_t interned = this->intern(key);
+		// Если заголовок является известным
+		if(interned != header_t::NONE){
+			// Если заголовок отсутствует в списке
+			if((this->_known & (1ULL << static_cast <uint8_t> (interned))) == 0)
+				// Выводим пустое значение
+				return "";
+			// Выполняем поиск заголовка по названию в нижнем регистре
+			auto i = this->_headers.find(this->name(interned));
+			// Если заголовок найден
+			if(i != this->_headers.end())
+				// Выводим найденный заголовок
+				return i->second;
+		}
 		// Выполняем перебор всех заголовков
 		for(auto & header : this->_headers){
 			// Выполняем проверку существования заголовка
@@ -1655,9 +2111,12 @@ string awh::Web::header(const string & key) const noexcept {
  */
 void awh::Web::header(const string & key, const string & val) noexcept {
 	// Если даныне заголовка переданы
-	if(!key.empty() && !val.empty())
+	if(!key.empty() && !val.empty()){
 		// Выполняем добавление передаваемого заголовка
 		this->_headers.emplace(key, val);
+		// Помечаем известный заголовок как присутствующий
+		this->known(key);
+	}
 }
 /**
  * @brief Метод получения списка заголовков
@@ -1676,6 +2135,12 @@ const std::unordered_multimap <string, string> & awh::Web::headers() const noexc
 void awh::Web::headers(const std::unordered_multimap <string, string> & headers) noexcept {
 	// Выполняем установку заголовков
 	this->_headers = headers;
+	// Выполняем сброс маски известных заголовков
+	this->_known = 0;
+	// Выполняем перебор всех установленных заголовков
+	for(auto & header : this->_headers)
+		// Помечаем известный заголовок как присутствующий
+		this->known(header.first);
 }
 /**
  * @brief Метод получения идентификатора объекта
@@ -1753,7 +2218,7 @@ void awh::Web::callback(const callback_t & callback) noexcept {
  */
 awh::Web::Web(const fmk_t * fmk, const log_t * log) noexcept :
  _separator('\0'), _pos{-1, -1}, _bodySize(-1), _uri(fmk, log), _callback(log),
- _hid(hid_t::NONE), _state(state_t::QUERY), _upgrade{""}, _fmk(fmk), _log(log) {
+ _hid(hid_t::NONE), _state(state_t::QUERY), _upgrade{""}, _known(0), _fmk(fmk), _log(log) {
 	// Выполняем заполнение списка стандартных заголовков
 	this->_standardHeaders.insert({
 		{"via", {proto_t::PROXY}},
@@ -76,6 +76,8 @@ bool awh::Engine::Address::close() noexcept {
 		#endif
 		// Выполняем сброс сетевого сокета
 		this->sock = INVALID_SOCKET;
+		// Сбрасываем закэшированные параметры сокета
+		this->_cached = INVALID_SOCKET;
 	}
 	// Выводим результат
 	return result;
@@ -533,6 +535,47 @@ bool awh::Engine::Address::accept(const SOCKET sock, const int32_t family) noexc
 		// Если сокет установлен UDP
 		case SOCK_DGRAM: this->sock = sock; break;
 	}
+	// Выполняем настройку принятого подключения
+	this->prepare();
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод согласования подключения принятого другим процессом
+ *
+ * @param sock сетевой сокет принятого подключения
+ * @return     результат выполнения операции
+ */
+bool awh::Engine::Address::adopt(const SOCKET sock) noexcept {
+	// Устанавливаем статус отключения
+	this->status = status_t::DISCONNECTED;
+	// Если сокет подключения не передан
+	if(sock == INVALID_SOCKET)
+		// Выходим из функции
+		return false;
+	// Устанавливаем сокет принятого подключения
+	this->sock = sock;
+	// Заполняем структуру клиента нулями
+	::memset(&this->_peer.client, 0, sizeof(this->_peer.client));
+	// Запоминаем размер структуры
+	this->_peer.size = sizeof(this->_peer.client);
+	// Если параметры подключения клиента не получены
+	if(::getpeername(this->sock, reinterpret_cast <struct sockaddr *> (&this->_peer.client), &this->_peer.size) != 0){
+		// Выполняем закрытие подключения
+		this->close();
+		// Выходим из функции
+		return false;
+	}
+	// Выполняем настройку принятого подключения
+	this->prepare();
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод настройки параметров принятого подключения
+ *
+ */
+void awh::Engine::Address::prepare() noexcept {
 	/**
 	 * Определяем тип подключения
 	 */
@@ -608,8 +651,6 @@ bool awh::Engine::Address::accept(const SOCKET sock, const int32_t family) noexc
 	this->client();
 	// Устанавливаем статус подключения
 	this->status = status_t::ACCEPTED;
-	// Выводим результат
-	return true;
 }
 /**
  * @brief Метод установки параметров сокета
@@ -1011,6 +1052,10 @@ void awh::Engine::Address::init(const string & ip, const uint32_t port, const in
 				this->_socket.blocking(this->sock, socket_t::mode_t::DISABLED);
 			// Устанавливаем разрешение на повторное использование сокета
 			this->_socket.reuseable(this->sock);
+			// Если сервер разделяет порт с другими слушающими сокетами
+			if((type == type_t::SERVER) && this->reuseport)
+				// Разрешаем ядру распределять подключения между сокетами порта
+				this->_socket.reusePort(this->sock);
 			/**
 			 * Определяем тип запускаемого приложения
 			 */
@@ -1311,6 +1356,15 @@ void awh::Engine::Context::crl(const X509_CRL * crl) noexcept {
 	// Выполняем установку объекта CRL-файла сертификата
 	this->_crl = crl;
 }
+/**
+ * @brief Метод получения хоста удалённого сервера
+ *
+ * @return хост удалённого сервера
+ */
+const string & awh::Engine::Context::host() const noexcept {
+	// Выводим хост удалённого сервера
+	return this->_host;
+}
 /**
  * @brief Метод чтения данных из сокета
  *
@@ -1934,6 +1988,90 @@ int64_t awh::Engine::Context::write(const char * buffer, const size_t size) noex
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод векторной записи данных в сокет
+ *
+ * @param records список записей данных для записи
+ * @param count   количество записей в списке
+ * @return        количество записанных байт
+ */
+int64_t awh::Engine::Context::write(const chain_t::record_t * records, const size_t count) noexcept {
+	// Если записи не переданы
+	if((records == nullptr) || (count == 0))
+		// Выходим из функции
+		return 0;
+	// Если запись всего одна, выполняем обычную запись
+	else if(count == 1)
+		// Выполняем запись данных в сокет
+		return this->write(reinterpret_cast <const char *> (records[0].first), records[0].second);
+	// Если адрес присвоен и сокет активен
+	if((this->_addr != nullptr) && (this->_type != type_t::NONE) && (this->_addr->sock != INVALID_SOCKET)){
+		// Если защищённый режим работы разрешён
+		if(this->_encrypted && (this->_ssl != nullptr)){
+			// Если первая запись не меньше записи TLS, отправляем её без копирования
+			if(records[0].second >= AWH_CHAIN_SEGMENT)
+				// Выполняем запись первой записи
+				return this->write(reinterpret_cast <const char *> (records[0].first), records[0].second);
+			// Буфер объединения мелких записей в одну запись TLS
+			char buffer[AWH_CHAIN_SEGMENT];
+			// Размер объединённых данных
+			size_t size = 0;
+			// Выполняем объединение записей, пока они помещаются в одну запись TLS
+			for(size_t i = 0; (i < count) && (size < sizeof(buffer)); i++){
+				// Получаем количество копируемых байт
+				const size_t bytes = std::min(records[i].second, sizeof(buffer) - size);
+				// Выполняем копирование данных записи
+				::memcpy(buffer + size, records[i].first, bytes);
+				// Увеличиваем размер объединённых данных
+				size += bytes;
+			}
+			// Выполняем запись объединённых данных одним вызовом SSL_write
+			return this->write(buffer, size);
+		}
+		/**
+		 * Для операционной системы не являющейся MS Windows
+		 */
+		#if !_WIN32 && !_WIN64
+			// Если сокет установлен как TCP/IP
+			if(this->_addr->_type == SOCK_STREAM){
+				// Список векторов для отправки
+				struct iovec iov[AWH_CHAIN_RECORDS];
+				// Получаем количество отправляемых векторов
+				const size_t size = std::min(count, static_cast <size_t> (AWH_CHAIN_RECORDS));
+				// Выполняем заполнение списка векторов
+				for(size_t i = 0; i < size; i++){
+					// Устанавливаем указатель на данные
+					iov[i].iov_base = const_cast <void *> (records[i].first);
+					// Устанавливаем размер данных
+					iov[i].iov_len = records[i].second;
+				}
+				// Создаём объект сообщения
+				struct msghdr message;
+				// Заполняем структуру сообщения нулями
+				::memset(&message, 0, sizeof(message));
+				// Устанавливаем список векторов
+				message.msg_iov = iov;
+				// Устанавливаем количество векторов
+				message.msg_iovlen = size;
+				// Выполняем отправку всех векторов одним системным вызовом
+				const int64_t result = ::sendmsg(this->_addr->sock, &message, 0);
+				// Если данные отправлены удачно
+				if(result > 0)
+					// Выводим количество отправленных байт
+					return result;
+				// Если сокет не готов к записи
+				else if((result < 0) && ((AWH_ERROR() == EWOULDBLOCK) || (AWH_ERROR() == EINTR)))
+					// Выполняем пропуск попытки
+					return -1;
+			}
+		#endif
+	}
+	/**
+	 * Для датаграмм, MS Windows и обработки ошибок векторной записи
+	 * выполняем обычную запись первой записи
+	 */
+	return this->write(reinterpret_cast <const char *> (records[0].first), records[0].second);
+}
 /**
  * @brief Метод проверки на то, является ли сокет заблокированным
  *
@@ -2144,18 +2282,47 @@ bool awh::Engine::Context::timeout(const uint32_t msec, const method_t method) n
 	if(this->_addr != nullptr){
 		// Если защищённый режим работы разрешён
 		if(this->_addr->sock != INVALID_SOCKET){
+			// Если закэшированные параметры принадлежат другому сокету
+			if(this->_addr->_cached != this->_addr->sock){
+				// Запоминаем сокет которому принадлежат параметры
+				this->_addr->_cached = this->_addr->sock;
+				// Сбрасываем закэшированные таймауты
+				this->_addr->_rtimeout = this->_addr->_wtimeout = UINT32_MAX;
+				// Сбрасываем закэшированный размер буфера
+				this->_addr->_wbuffer = 0;
+			}
 			/**
 			 * Определяем тип метода
 			 */
 			switch(static_cast <uint8_t> (method)){
 				// Если установлен метод чтения
-				case static_cast <uint8_t> (method_t::READ):
+				case static_cast <uint8_t> (method_t::READ): {
+					// Если таймаут уже установлен, системный вызов не требуется
+					if(this->_addr->_rtimeout == msec)
+						// Сообщаем, что операция выполнена
+						return true;
 					// Выполняем установку таймера на чтение данных из сокета
-					return this->_addr->_socket.timeout(this->_addr->sock, msec, socket_t::mode_t::READ);
+					if(this->_addr->_socket.timeout(this->_addr->sock, msec, socket_t::mode_t::READ)){
+						// Запоминаем установленный таймаут
+						this->_addr->_rtimeout = msec;
+						// Сообщаем, что операция выполнена
+						return true;
+					}
+				} break;
 				// Если установлен метод записи
-				case static_cast <uint8_t> (method_t::WRITE):
+				case static_cast <uint8_t> (method_t::WRITE): {
+					// Если таймаут уже установлен, системный вызов не требуется
+					if(this->_addr->_wtimeout == msec)
+						// Сообщаем, что операция выполнена
+						return true;
 					// Выполняем установку таймера на запись данных в сокет
-					return this->_addr->_socket.timeout(this->_addr->sock, msec, socket_t::mode_t::WRITE);
+					if(this->_addr->_socket.timeout(this->_addr->sock, msec, socket_t::mode_t::WRITE)){
+						// Запоминаем установленный таймаут
+						this->_addr->_wtimeout = msec;
+						// Сообщаем, что операция выполнена
+						return true;
+					}
+				} break;
 			}
 		}
 	}
@@ -2185,16 +2352,30 @@ int32_t awh::Engine::Context::buffer(const method_t method) const noexcept {
 					result = this->_addr->_socket.bufferSize(this->_addr->sock, socket_t::mode_t::READ);
 				break;
 				// Если метод записи
-				case static_cast <uint8_t> (method_t::WRITE):
-					// Получаем размер буфера для записи
-					result = this->_addr->_socket.bufferSize(this->_addr->sock, socket_t::mode_t::WRITE);
+				case static_cast <uint8_t> (method_t::WRITE): {
+					// Если размер буфера уже получен для текущего сокета
+					if((this->_addr->_cached == this->_addr->sock) && (this->_addr->_wbuffer > 0))
+						// Используем закэшированный размер буфера
+						result = this->_addr->_wbuffer;
+					// Если размер буфера ещё не получен
+					else {
+						// Если закэшированные параметры принадлежат другому сокету
+						if(this->_addr->_cached != this->_addr->sock){
+							// Запоминаем сокет которому принадлежат параметры
+							this->_addr->_cached = this->_addr->sock;
+							// Сбрасываем закэшированные таймауты
+							this->_addr->_rtimeout = this->_addr->_wtimeout = UINT32_MAX;
+						}
+						// Получаем размер буфера для записи
+						result = this->_addr->_wbuffer = this->_addr->_socket.bufferSize(this->_addr->sock, socket_t::mode_t::WRITE);
+					}
 					/*
 					// Если защищённый режим работы разрешён
 					if(this->_encrypted && (this->_ssl != nullptr))
 						// Выполняем определение минимального размера буфера который возможно отправить
 						result = min(result, BIO_get_write_guarantee(this->_bio));
 					*/
-				break;
+				} break;
 			}
 		}
 	}
@@ -2220,6 +2401,8 @@ bool awh::Engine::Context::buffer(const int32_t read, const int32_t write) noexc
 				// Устанавливаем размер буфера данных на запись в BIO SSL
 				::BIO_set_write_buffer_size(this->_bio, static_cast <long> (write));
 			}
+			// Сбрасываем закэшированный размер буфера на запись
+			this->_addr->_wbuffer = 0;
 			// Выполняем установку буферов сокета на чтение и запись
 			return (
 				this->_addr->_socket.bufferSize(this->_addr->sock, read, socket_t::mode_t::READ) &&
@@ -2586,8 +2769,24 @@ int32_t awh::Engine::verifyCert(const int32_t ok, X509_STORE_CTX * x509) noexcep
  * @return     результат проверки
  */
 int32_t awh::Engine::verifyHost(X509_STORE_CTX * x509, void * ctx) noexcept {
+	// Получаем объект проверки домена
+	const verify_t * verify = reinterpret_cast <const verify_t *> (ctx);
+	// Если объект проверки домена не передан
+	if((verify == nullptr) && (x509 != nullptr)){
+		// Получаем объект SSL из хранилища сертификатов
+		SSL * ssl = reinterpret_cast <SSL *> (::X509_STORE_CTX_get_ex_data(x509, ::SSL_get_ex_data_X509_STORE_CTX_idx()));
+		// Если объект SSL получен
+		if(ssl != nullptr){
+			// Получаем объект контекста подключения
+			const ctx_t * context = reinterpret_cast <const ctx_t *> (SSL_get_app_data(ssl));
+			// Если объект контекста подключения получен
+			if(context != nullptr)
+				// Получаем объект проверки домена текущего подключения
+				verify = context->_verify.get();
+		}
+	}
 	// Если объекты переданы верно
-	if((x509 != nullptr) && (ctx != nullptr)){
+	if((x509 != nullptr) && (verify != nullptr)){
 		// Буфер данных сертификатов из хранилища
 		char buffer[256];
 		// Заполняем структуру нулями
@@ -2600,8 +2799,6 @@ int32_t awh::Engine::verifyHost(X509_STORE_CTX * x509, void * ctx) noexcept {
 		X509 * cert = ::X509_STORE_CTX_get_current_cert(x509);
 		// Результат проверки домена
 		engine_t::validate_t validate = engine_t::validate_t::Error;
-		// Получаем объект подключения
-		const verify_t * verify = reinterpret_cast <const verify_t *> (ctx);
 		// Если проверка сертификата прошла удачно
 		if(ok){
 			// Выполняем проверку на соответствие хоста с данными хостов у сертификата
@@ -2653,13 +2850,15 @@ int32_t awh::Engine::verifyHost(X509_STORE_CTX * x509, void * ctx) noexcept {
 	 * @param ctx  передаваемый контекст
 	 * @return     результат переключения протокола
 	 */
-	int32_t awh::Engine::nextProto([[maybe_unused]] SSL * ssl, const uint8_t ** data, uint32_t * len, void * ctx) noexcept {
+	int32_t awh::Engine::nextProto(SSL * ssl, const uint8_t ** data, uint32_t * len, [[maybe_unused]] void * ctx) noexcept {
+		// Получаем объект контекста подключения
+		const ctx_t * context = (ssl != nullptr ? reinterpret_cast <const ctx_t *> (SSL_get_app_data(ssl)) : nullptr);
 		// Если объекты переданы верно
-		if((ssl != nullptr) && (ctx != nullptr)){
+		if(context != nullptr){
 			// Выполняем установку буфера данных
-			(* data) = reinterpret_cast <ctx_t *> (ctx)->protocols.data();
+			(* data) = context->protocols.data();
 			// Выполняем установку размер буфера данных протокола
-			(* len) = static_cast <uint32_t> (reinterpret_cast <ctx_t *> (ctx)->protocols.size());
+			(* len) = static_cast <uint32_t> (context->protocols.size());
 			// Выводим результат
 			return SSL_TLSEXT_ERR_OK;
 		}
@@ -2677,11 +2876,11 @@ int32_t awh::Engine::verifyHost(X509_STORE_CTX * x509, void * ctx) noexcept {
 	 * @param ctx     передаваемый контекст
 	 * @return        результат выбора протокола
 	 */
-	int32_t awh::Engine::selectNextProtoClient([[maybe_unused]] SSL * ssl, uint8_t ** out, uint8_t * outSize, const uint8_t * in, uint32_t inSize, void * ctx) noexcept {
+	int32_t awh::Engine::selectNextProtoClient(SSL * ssl, uint8_t ** out, uint8_t * outSize, const uint8_t * in, uint32_t inSize, [[maybe_unused]] void * ctx) noexcept {
+		// Получаем объект контекста модуля
+		ctx_t * context = (ssl != nullptr ? reinterpret_cast <ctx_t *> (SSL_get_app_data(ssl)) : nullptr);
 		// Если объекты переданы верно
-		if((ssl != nullptr) && (ctx != nullptr)){
-			// Получаем объект контекста модуля
-			ctx_t * context = reinterpret_cast <ctx_t *> (ctx);
+		if(context != nullptr){
 			// Если протокол переключить получилось на HTTP/2
 			if(context->selectProto(out, outSize, in, inSize, "\x2h2", 2))
 				// Выводим результат
@@ -2713,11 +2912,11 @@ int32_t awh::Engine::verifyHost(X509_STORE_CTX * x509, void * ctx) noexcept {
 	 * @param ctx     передаваемый контекст
 	 * @return        результат выбора протокола
 	 */
-	int32_t awh::Engine::selectNextProtoServer([[maybe_unused]] SSL * ssl, const uint8_t ** out, uint8_t * outSize, const uint8_t * in, uint32_t inSize, void * ctx) noexcept {
+	int32_t awh::Engine::selectNextProtoServer(SSL * ssl, const uint8_t ** out, uint8_t * outSize, const uint8_t * in, uint32_t inSize, [[maybe_unused]] void * ctx) noexcept {
+		// Получаем объект контекста модуля
+		ctx_t * context = (ssl != nullptr ? reinterpret_cast <ctx_t *> (SSL_get_app_data(ssl)) : nullptr);
 		// Если объекты переданы верно
-		if((ssl != nullptr) && (ctx != nullptr)){
-			// Получаем объект контекста модуля
-			ctx_t * context = reinterpret_cast <ctx_t *> (ctx);
+		if(context != nullptr){
 			// Если протокол переключить получилось на HTTP/2
 			if(context->selectProto(const_cast <uint8_t **> (out), outSize, in, inSize, "\x2h2", 2))
 				// Выводим результат
@@ -2946,6 +3145,373 @@ int32_t awh::Engine::verifyStatelessCookie(SSL * ssl, const uint8_t * cookie, si
 	// Выполняем проверку печенок
 	return verifyCookie(ssl, cookie, static_cast <uint32_t> (size));
 }
+/**
+ * @brief Конструктор
+ *
+ */
+awh::Engine::Session::Session() noexcept : expires(0), id(0), size(0), sid{0}, data{0} {
+	/**
+	 * Если операционной системой является Linux или FreeBSD
+	 */
+	#if __linux__ || __FreeBSD__
+		// Атрибуты мютекса ячейки
+		pthread_mutexattr_t attr;
+		// Выполняем инициализацию атрибутов мютекса
+		::pthread_mutexattr_init(&attr);
+		// Разрешаем использование мютекса несколькими процессами
+		::pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+		// Разрешаем восстановление мютекса после завершения процесса-владельца
+		::pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+		// Выполняем инициализацию мютекса ячейки
+		::pthread_mutex_init(&this->mtx, &attr);
+		// Выполняем удаление атрибутов мютекса
+		::pthread_mutexattr_destroy(&attr);
+	/**
+	 * Для остальных операционных систем
+	 */
+	#else
+		// Сбрасываем флаг блокировки ячейки
+		this->lock.clear();
+	#endif
+}
+/**
+ * @brief Функция блокировки ячейки общего кэша сессий
+ *
+ * @param cell ячейка кэша сессий
+ * @return     результат блокировки ячейки
+ */
+bool awh::Engine::lock(session_t & cell) noexcept {
+	/**
+	 * Если операционной системой является Linux или FreeBSD
+	 */
+	#if __linux__ || __FreeBSD__
+		/**
+		 * Определяем результат блокировки мютекса
+		 */
+		switch(::pthread_mutex_lock(&cell.mtx)){
+			// Если ячейка заблокирована
+			case 0: return true;
+			// Если процесс владевший ячейкой завершился не разблокировав её
+			case EOWNERDEAD: {
+				// Сбрасываем размер идентификатора, данные ячейки могли остаться недописанными
+				cell.id = 0;
+				// Сбрасываем размер сессии
+				cell.size = 0;
+				// Сбрасываем время жизни сессии
+				cell.expires = 0;
+				// Помечаем мютекс как восстановленный
+				::pthread_mutex_consistent(&cell.mtx);
+			} return true;
+		}
+	/**
+	 * Для остальных операционных систем
+	 */
+	#else
+		/**
+		 * Выполняем ограниченное количество попыток захвата ячейки
+		 */
+		for(uint16_t i = 0; i < AWH_TLS_SESSION_SPINS; i++){
+			// Если ячейка заблокирована
+			if(!cell.lock.test_and_set(std::memory_order_acquire))
+				// Выходим из функции
+				return true;
+			// Уступаем процессорное время владельцу ячейки
+			std::this_thread::yield();
+		}
+	#endif
+	// Ячейка занята, кэш сессий не используется и выполняется полное рукопожатие
+	return false;
+}
+/**
+ * @brief Функция разблокировки ячейки общего кэша сессий
+ *
+ * @param cell ячейка кэша сессий
+ */
+void awh::Engine::unlock(session_t & cell) noexcept {
+	/**
+	 * Если операционной системой является Linux или FreeBSD
+	 */
+	#if __linux__ || __FreeBSD__
+		// Выполняем разблокировку мютекса ячейки
+		::pthread_mutex_unlock(&cell.mtx);
+	/**
+	 * Для остальных операционных систем
+	 */
+	#else
+		// Выполняем разблокировку ячейки
+		cell.lock.clear(std::memory_order_release);
+	#endif
+}
+/**
+ * @brief Функция обратного вызова сохранения новой сессии в общий кэш
+ *
+ * @param ssl     объект SSL
+ * @param session объект сессии SSL
+ * @return        результат сохранения сессии
+ */
+int32_t awh::Engine::newSession(SSL * ssl, SSL_SESSION * session) noexcept {
+	// Если объекты переданы верно
+	if((ssl != nullptr) && (session != nullptr)){
+		// Получаем объект двигателя
+		const Engine * engine = reinterpret_cast <const Engine *> (SSL_CTX_get_app_data(::SSL_get_SSL_CTX(ssl)));
+		// Если общее хранилище сессий создано
+		if((engine != nullptr) && (engine->_storage != nullptr)){
+			// Размер идентификатора сессии
+			uint32_t length = 0;
+			// Получаем идентификатор сессии
+			const uint8_t * id = ::SSL_SESSION_get_id(session, &length);
+			// Получаем размер сериализованной сессии
+			const int32_t size = ::i2d_SSL_SESSION(session, nullptr);
+			// Если сессия помещается в ячейку кэша
+			if((length > 0) && (length <= SSL_MAX_SSL_SESSION_ID_LENGTH) && (size > 0) && (size <= AWH_TLS_SESSION_SIZE)){
+				// Получаем ячейку кэша сессий
+				session_t & cell = engine->_storage->sessions[engine->index(id, length)];
+				// Если ячейка заблокирована
+				if(lock(cell)){
+					// Получаем буфер данных ячейки
+					uint8_t * data = cell.data;
+					// Выполняем сериализацию сессии
+					cell.size = static_cast <uint32_t> (::i2d_SSL_SESSION(session, &data));
+					// Устанавливаем размер идентификатора сессии
+					cell.id = length;
+					// Устанавливаем идентификатор сессии
+					::memcpy(cell.sid, id, length);
+					// Устанавливаем время жизни сессии
+					cell.expires = (::time(nullptr) + static_cast <time_t> (::SSL_SESSION_get_timeout(session)));
+					// Выполняем разблокировку ячейки
+					unlock(cell);
+				}
+			}
+		}
+	}
+	// Сообщаем, что ссылку на сессию мы не удерживаем
+	return 0;
+}
+/**
+ * @brief Функция обратного вызова извлечения сессии из общего кэша
+ *
+ * @param ssl  объект SSL
+ * @param id   идентификатор сессии
+ * @param size размер идентификатора сессии
+ * @param copy флаг увеличения счётчика ссылок сессии
+ * @return     объект сессии SSL
+ */
+SSL_SESSION * awh::Engine::getSession(SSL * ssl, const uint8_t * id, int32_t size, int32_t * copy) noexcept {
+	// Результат работы функции
+	SSL_SESSION * result = nullptr;
+	// Если объекты переданы верно
+	if((ssl != nullptr) && (id != nullptr) && (size > 0) && (size <= SSL_MAX_SSL_SESSION_ID_LENGTH)){
+		// Получаем объект двигателя
+		const Engine * engine = reinterpret_cast <const Engine *> (SSL_CTX_get_app_data(::SSL_get_SSL_CTX(ssl)));
+		// Если общее хранилище сессий создано
+		if((engine != nullptr) && (engine->_storage != nullptr)){
+			// Размер извлечённой сессии
+			uint32_t length = 0;
+			// Буфер извлечённой сессии
+			uint8_t buffer[AWH_TLS_SESSION_SIZE];
+			// Получаем ячейку кэша сессий
+			session_t & cell = engine->_storage->sessions[engine->index(id, static_cast <uint32_t> (size))];
+			// Если ячейка заблокирована
+			if(lock(cell)){
+				// Если идентификатор сессии совпадает и сессия ещё жива
+				if((cell.id == static_cast <uint32_t> (size)) && (::memcmp(cell.sid, id, size) == 0) && (cell.expires > ::time(nullptr))){
+					// Запоминаем размер сессии
+					length = cell.size;
+					// Копируем данные сессии
+					::memcpy(buffer, cell.data, length);
+				}
+				// Выполняем разблокировку ячейки
+				unlock(cell);
+			}
+			// Если сессия найдена
+			if(length > 0){
+				// Получаем буфер данных сессии
+				const uint8_t * data = buffer;
+				// Выполняем десериализацию сессии
+				result = ::d2i_SSL_SESSION(nullptr, &data, static_cast <long> (length));
+			}
+		}
+	}
+	// Если флаг копирования передан
+	if(copy != nullptr)
+		// Сообщаем, что счётчик ссылок увеличивать не нужно
+		(* copy) = 0;
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Функция обратного вызова удаления сессии из общего кэша
+ *
+ * @param ctx     объект контекста SSL
+ * @param session объект сессии SSL
+ */
+void awh::Engine::removeSession(SSL_CTX * ctx, SSL_SESSION * session) noexcept {
+	// Если объекты переданы верно
+	if((ctx != nullptr) && (session != nullptr)){
+		// Получаем объект двигателя
+		const Engine * engine = reinterpret_cast <const Engine *> (SSL_CTX_get_app_data(ctx));
+		// Если общее хранилище сессий создано
+		if((engine != nullptr) && (engine->_storage != nullptr)){
+			// Размер идентификатора сессии
+			uint32_t length = 0;
+			// Получаем идентификатор сессии
+			const uint8_t * id = ::SSL_SESSION_get_id(session, &length);
+			// Если идентификатор сессии получен
+			if((length > 0) && (length <= SSL_MAX_SSL_SESSION_ID_LENGTH)){
+				// Получаем ячейку кэша сессий
+				session_t & cell = engine->_storage->sessions[engine->index(id, length)];
+				// Если ячейка заблокирована
+				if(lock(cell)){
+					// Если идентификатор сессии совпадает
+					if((cell.id == length) && (::memcmp(cell.sid, id, length) == 0)){
+						// Сбрасываем размер идентификатора
+						cell.id = 0;
+						// Сбрасываем размер сессии
+						cell.size = 0;
+						// Сбрасываем время жизни сессии
+						cell.expires = 0;
+					}
+					// Выполняем разблокировку ячейки
+					unlock(cell);
+				}
+			}
+		}
+	}
+}
+/**
+ * @brief Функция обратного вызова получения состояния подключения
+ *
+ * @param ssl   объект SSL
+ * @param where место вызова функции
+ * @param ret   код возврата
+ */
+void awh::Engine::handshake(const SSL * ssl, int32_t where, [[maybe_unused]] int32_t ret) noexcept {
+	// Если рукопожатие выполнено
+	if((ssl != nullptr) && (where & SSL_CB_HANDSHAKE_DONE)){
+		// Получаем объект двигателя
+		const Engine * engine = reinterpret_cast <const Engine *> (SSL_CTX_get_app_data(::SSL_get_SSL_CTX(ssl)));
+		// Если объект двигателя получен
+		if(engine != nullptr){
+			// Получаем счётчик рукопожатий общего хранилища сессий, либо собственный, если хранилище не создано
+			std::atomic <uint64_t> & counter = (
+				engine->_storage != nullptr ?
+				(::SSL_session_reused(ssl) ? engine->_storage->hits : engine->_storage->misses) :
+				(::SSL_session_reused(ssl) ? engine->_hits : engine->_misses)
+			);
+			// Увеличиваем количество рукопожатий
+			counter.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+/**
+ * Если версия OpenSSL соответствует или выше версии 3.0.0
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	/**
+	 * @brief Функция обратного вызова шифрования сессионных билетов
+	 *
+	 * @param ssl  объект SSL
+	 * @param name название ключа билета
+	 * @param iv   вектор инициализации
+	 * @param ctx  контекст шифрования билета
+	 * @param hctx контекст подписи билета
+	 * @param enc  флаг шифрования билета
+	 * @return     результат работы функции
+	 */
+	int32_t awh::Engine::ticket(SSL * ssl, uint8_t * name, uint8_t * iv, EVP_CIPHER_CTX * ctx, EVP_MAC_CTX * hctx, int32_t enc) noexcept {
+/**
+ * Если версия OpenSSL ниже версии 3.0.0
+ */
+#else
+	/**
+	 * @brief Функция обратного вызова шифрования сессионных билетов
+	 *
+	 * @param ssl  объект SSL
+	 * @param name название ключа билета
+	 * @param iv   вектор инициализации
+	 * @param ctx  контекст шифрования билета
+	 * @param hctx контекст подписи билета
+	 * @param enc  флаг шифрования билета
+	 * @return     результат работы функции
+	 */
+	int32_t awh::Engine::ticket(SSL * ssl, uint8_t * name, uint8_t * iv, EVP_CIPHER_CTX * ctx, HMAC_CTX * hctx, int32_t enc) noexcept {
+#endif
+	// Результат работы функции
+	int32_t result = -1;
+	// Если объекты переданы верно
+	if(ssl != nullptr){
+		// Получаем объект двигателя
+		const Engine * engine = reinterpret_cast <const Engine *> (SSL_CTX_get_app_data(::SSL_get_SSL_CTX(ssl)));
+		// Если общее хранилище сессий создано
+		if((engine != nullptr) && (engine->_storage != nullptr)){
+			// Название ключа билета
+			uint8_t key[16];
+			// Ключ шифрования и ключ подписи билета
+			uint8_t aes[32], hmac[32];
+			// Получаем номер текущей эпохи ротации ключей
+			const uint64_t epoch = (static_cast <uint64_t> (::time(nullptr)) / engine->_lifetime);
+			// Если выполняется шифрование билета
+			if(enc == 1){
+				// Выполняем генерацию ключей текущей эпохи и вектора инициализации
+				if(!engine->ticketKey(epoch, key, aes, hmac) || (::RAND_bytes(iv, EVP_MAX_IV_LENGTH) < 1))
+					// Выходим из функции
+					return -1;
+				// Устанавливаем название ключа билета
+				::memcpy(name, key, sizeof(key));
+				// Выполняем инициализацию шифрования билета
+				result = (::EVP_EncryptInit_ex(ctx, ::EVP_aes_256_cbc(), nullptr, aes, iv) > 0 ? 1 : -1);
+			// Если выполняется расшифровка билета
+			} else {
+				// Билет не найден, требуется полное рукопожатие
+				result = 0;
+				// Выполняем поиск ключа текущей и предыдущей эпохи
+				for(uint8_t i = 0; i < 2; i++){
+					// Если ключ эпохи соответствует названию ключа билета
+					if(engine->ticketKey(epoch - i, key, aes, hmac) && (::memcmp(name, key, sizeof(key)) == 0)){
+						// Билет актуален, для билета предыдущей эпохи требуется выпуск нового
+						result = (i == 0 ? 1 : 2);
+						// Выходим из цикла
+						break;
+					}
+				}
+				// Если ключ билета найден
+				if(result > 0)
+					// Выполняем инициализацию расшифровки билета
+					result = (::EVP_DecryptInit_ex(ctx, ::EVP_aes_256_cbc(), nullptr, aes, iv) > 0 ? result : -1);
+			}
+			// Если контекст шифрования инициализирован
+			if(result > 0){
+				/**
+				 * Если версия OpenSSL соответствует или выше версии 3.0.0
+				 */
+				#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+					// Параметры подписи билета
+					OSSL_PARAM params[3];
+					// Устанавливаем ключ подписи билета
+					params[0] = ::OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, hmac, sizeof(hmac));
+					// Устанавливаем алгоритм подписи билета
+					params[1] = ::OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast <char *> ("SHA256"), 0);
+					// Завершаем список параметров
+					params[2] = ::OSSL_PARAM_construct_end();
+					// Выполняем инициализацию подписи билета
+					if(::EVP_MAC_CTX_set_params(hctx, params) < 1)
+						// Сообщаем, что произошла ошибка
+						result = -1;
+				/**
+				 * Если версия OpenSSL ниже версии 3.0.0
+				 */
+				#else
+					// Выполняем инициализацию подписи билета
+					if(::HMAC_Init_ex(hctx, hmac, sizeof(hmac), ::EVP_sha256(), nullptr) < 1)
+						// Сообщаем, что произошла ошибка
+						result = -1;
+				#endif
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод проверки доменного имени по данным из сертификата
  *
@@ -3304,6 +3870,176 @@ bool awh::Engine::storeCRL(SSL_CTX * ctx) const noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод получения общего хранилища сессий TLS (создаётся при первом обращении)
+ *
+ * Хранилище занимает несколько мегабайт, поэтому выделяется только для сервера с кэшированием сессий.
+ * Сервер подготавливает контекст SSL при запуске, до создания дочерних процессов кластера,
+ * поэтому разделяемая память остаётся общей для всех процессов
+ *
+ * @return общее хранилище сессий TLS
+ */
+awh::Engine::storage_t * awh::Engine::storage() const noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(const_cast <engine_t *> (this)->_mtx);
+	// Если общее хранилище сессий ещё не создано
+	if(this->_storage == nullptr){
+		// Создаваемое хранилище сессий
+		storage_t * storage = nullptr;
+		/**
+		 * Для операционной системы не являющейся MS Windows
+		 */
+		#if !_WIN32 && !_WIN64
+			// Выделяем разделяемую память, доступную всем дочерним процессам кластера
+			void * memory = ::mmap(nullptr, sizeof(storage_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			// Если память выделена
+			if(memory != MAP_FAILED)
+				// Создаём общее хранилище сессий
+				storage = new (memory) storage_t();
+			// Выводим в лог сообщение
+			else this->_log->print("Shared TLS session cache is not allocated: %s", log_t::flag_t::WARNING, ::strerror(errno));
+		/**
+		 * Для операционной системы MS Windows
+		 */
+		#else
+			// Создаём общее хранилище сессий
+			storage = new (nothrow) storage_t();
+		#endif
+		// Если общее хранилище сессий создано
+		if(storage != nullptr){
+			// Устанавливаем идентификатор процесса создавшего хранилище
+			storage->pid = ::getpid();
+			// Переносим статистику рукопожатий, выполненных до создания хранилища
+			storage->hits.store(this->_hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			storage->misses.store(this->_misses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			// Выполняем генерацию секретного ключа сессионных билетов
+			if(::RAND_bytes(storage->secret, sizeof(storage->secret)) < 1)
+				// Выводим в лог сообщение
+				this->_log->print("Session ticket secret is not generated", log_t::flag_t::WARNING);
+			// Запоминаем созданное хранилище сессий
+			const_cast <engine_t *> (this)->_storage = storage;
+		}
+	}
+	// Выводим результат
+	return this->_storage;
+}
+/**
+ * @brief Метод инициализации общего кэша сессий и сессионных билетов
+ *
+ * @param ctx  объект контекста SSL
+ * @param type тип активного приложения
+ */
+void awh::Engine::sessions(SSL_CTX * ctx, const type_t type) const noexcept {
+	// Если контекст передан
+	if(ctx != nullptr){
+		// Устанавливаем объект двигателя для функций обратного вызова
+		SSL_CTX_set_app_data(ctx, const_cast <Engine *> (this));
+		// Устанавливаем время жизни сессии
+		::SSL_CTX_set_timeout(ctx, static_cast <long> (this->_lifetime));
+		// Устанавливаем функцию подсчёта возобновлённых сессий
+		::SSL_CTX_set_info_callback(ctx, &handshake);
+		/**
+		 * Определяем тип активного приложения
+		 */
+		switch(static_cast <uint8_t> (type)){
+			// Если приложение является клиентом
+			case static_cast <uint8_t> (type_t::CLIENT):
+				// Запускаем кэширование сессий клиента, сессии хранятся на стороне сетевого ядра
+				::SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+			break;
+			// Если приложение является сервером
+			case static_cast <uint8_t> (type_t::SERVER): {
+				// Если общее хранилище сессий создано
+				if(this->storage() != nullptr){
+					// Запускаем кэширование во внешнем хранилище
+					::SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+					// Устанавливаем функцию сохранения сессии
+					::SSL_CTX_sess_set_new_cb(ctx, &newSession);
+					// Устанавливаем функцию извлечения сессии
+					::SSL_CTX_sess_set_get_cb(ctx, &getSession);
+					// Устанавливаем функцию удаления сессии
+					::SSL_CTX_sess_set_remove_cb(ctx, &removeSession);
+					/**
+					 * Если версия OpenSSL соответствует или выше версии 3.0.0
+					 */
+					#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+						// Устанавливаем функцию шифрования сессионных билетов с ротацией ключей
+						::SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, &ticket);
+					/**
+					 * Если версия OpenSSL ниже версии 3.0.0
+					 */
+					#else
+						// Устанавливаем функцию шифрования сессионных билетов с ротацией ключей
+						SSL_CTX_set_tlsext_ticket_key_cb(ctx, &ticket);
+					#endif
+				// Запускаем кэширование во внутреннем хранилище
+				} else ::SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+			} break;
+		}
+	}
+}
+/**
+ * @brief Метод получения индекса ячейки кэша сессий
+ *
+ * @param id   идентификатор сессии
+ * @param size размер идентификатора сессии
+ * @return     индекс ячейки кэша сессий
+ */
+size_t awh::Engine::index(const uint8_t * id, const uint32_t size) const noexcept {
+	// Результат работы функции (FNV-1a)
+	uint64_t result = 0xCBF29CE484222325;
+	// Выполняем перебор всего идентификатора сессии
+	for(uint32_t i = 0; i < size; i++){
+		// Добавляем байт идентификатора
+		result ^= static_cast <uint64_t> (id[i]);
+		// Выполняем перемешивание
+		result *= 0x100000001B3;
+	}
+	// Выводим результат
+	return static_cast <size_t> (result % AWH_TLS_SESSIONS);
+}
+/**
+ * @brief Метод генерации ключей сессионного билета для указанной эпохи
+ *
+ * @param epoch номер эпохи ротации ключей
+ * @param name  название ключа билета (16 байт)
+ * @param aes   ключ шифрования билета (32 байта)
+ * @param hmac  ключ подписи билета (32 байта)
+ * @return      результат генерации ключей
+ */
+bool awh::Engine::ticketKey(const uint64_t epoch, uint8_t * name, uint8_t * aes, uint8_t * hmac) const noexcept {
+	// Если общее хранилище сессий создано
+	if(this->_storage != nullptr){
+		// Размер полученного хэша
+		uint32_t size = 0;
+		// Буфер исходных данных для генерации ключей
+		uint8_t buffer[sizeof(this->_storage->secret) + sizeof(epoch)];
+		// Буферы полученных хэшей
+		uint8_t digest[EVP_MAX_MD_SIZE], hash[EVP_MAX_MD_SIZE];
+		// Копируем секретный ключ общий для всех процессов кластера
+		::memcpy(buffer, this->_storage->secret, sizeof(this->_storage->secret));
+		// Копируем номер эпохи ротации ключей
+		::memcpy(buffer + sizeof(this->_storage->secret), &epoch, sizeof(epoch));
+		// Выполняем генерацию ключей шифрования и подписи
+		if(::EVP_Digest(buffer, sizeof(buffer), digest, &size, ::EVP_sha512(), nullptr) < 1)
+			// Выходим из функции
+			return false;
+		// Выполняем генерацию названия ключа билета
+		if(::EVP_Digest(digest, size, hash, &size, ::EVP_sha256(), nullptr) < 1)
+			// Выходим из функции
+			return false;
+		// Устанавливаем название ключа билета
+		::memcpy(name, hash, 16);
+		// Устанавливаем ключ шифрования билета
+		::memcpy(aes, digest, 32);
+		// Устанавливаем ключ подписи билета
+		::memcpy(hmac, digest + 32, 32);
+		// Выводим результат
+		return true;
+	}
+	// Выводим результат
+	return false;
+}
 /**
  * @brief Метод ожидания рукопожатия
  *
@@ -3352,25 +4088,61 @@ void awh::Engine::encrypted(const bool mode, ctx_t & ctx) noexcept {
 	ctx._encrypted = mode;
 }
 /**
- * @brief Метод извлечения активного протокола
+ * @brief Метод проверки активации шифрования на уровне ядра (kTLS)
  *
- * @param target контекст назначения
- * @return       метод активного протокола
+ * @param target контекст подключения
+ * @param method метод передачи данных для проверки (READ / WRITE)
+ * @return       результат проверки
  */
-awh::Engine::proto_t awh::Engine::proto(ctx_t & target) const noexcept {
+bool awh::Engine::ktls(const ctx_t & target, const method_t method) const noexcept {
 	// Результат работы функции
-	proto_t result = proto_t::HTTP1_1;
-	// Если контекст SSL инициализирован
-	if(target._ssl != nullptr){
-		// Результат работы функции
-		result = target._proto;
-		// Если подключение выполнено
-		if(target._type == type_t::SERVER ? ::SSL_accept(target._ssl) : ::SSL_connect(target._ssl)){
+	bool result = false;
+	/**
+	 * Если OpenSSL собран с поддержкой шифрования на уровне ядра (kTLS)
+	 */
+	#if defined(SSL_OP_ENABLE_KTLS) && defined(BIO_get_ktls_send)
+		// Если контекст SSL инициализирован
+		if(target._ssl != nullptr){
 			/**
-			 * Определяет желаемый активный протокол
+			 * Определяем метод передачи данных
 			 */
-			switch(static_cast <uint8_t> (target._proto)){
-				// Если протокол соответствует SPDY/1
+			switch(static_cast <uint8_t> (method)){
+				// Если метод передачи данных - чтение
+				case static_cast <uint8_t> (method_t::READ):
+					// Выполняем проверку активации kTLS на чтение
+					result = static_cast <bool> (BIO_get_ktls_recv(::SSL_get_rbio(target._ssl)));
+				break;
+				// Если метод передачи данных - запись
+				case static_cast <uint8_t> (method_t::WRITE):
+					// Выполняем проверку активации kTLS на запись
+					result = static_cast <bool> (BIO_get_ktls_send(::SSL_get_wbio(target._ssl)));
+				break;
+			}
+		}
+	#endif
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод извлечения активного протокола
+ *
+ * @param target контекст назначения
+ * @return       метод активного протокола
+ */
+awh::Engine::proto_t awh::Engine::proto(ctx_t & target) const noexcept {
+	// Результат работы функции
+	proto_t result = proto_t::HTTP1_1;
+	// Если контекст SSL инициализирован
+	if(target._ssl != nullptr){
+		// Результат работы функции
+		result = target._proto;
+		// Если подключение выполнено
+		if(target._type == type_t::SERVER ? ::SSL_accept(target._ssl) : ::SSL_connect(target._ssl)){
+			/**
+			 * Определяет желаемый активный протокол
+			 */
+			switch(static_cast <uint8_t> (target._proto)){
+				// Если протокол соответствует SPDY/1
 				case static_cast <uint8_t> (proto_t::SPDY1):
 				// Если протокол соответствует HTTP/2
 				case static_cast <uint8_t> (proto_t::HTTP2):
@@ -3533,10 +4305,27 @@ void awh::Engine::httpUpgrade(ctx_t & target) const noexcept {
 			} break;
 		}
 	}
+	/**
+	 * Если версия OpenSSL соответствует или выше версии 1.0.2
+	 */
+	#if OPENSSL_VERSION_NUMBER >= 0x10002000L
+		// Если приложение является клиентом и объект SSL уже создан
+		if((target._type == type_t::CLIENT) && (target._ssl != nullptr))
+			// Выполняем установку доступных протоколов передачи данных для текущего подключения
+			::SSL_set_alpn_protos(target._ssl, target.protocols.data(), static_cast <uint32_t> (target.protocols.size()));
+	#endif // OPENSSL_VERSION_NUMBER >= 0x10002000L
+}
+/**
+ * @brief Метод установки функций обратного вызова выбора протокола
+ *
+ * @param ctx  объект контекста SSL
+ * @param type тип активного приложения
+ */
+void awh::Engine::alpn(SSL_CTX * ctx, const type_t type) const noexcept {
 	/**
 	 * Определяем тип приложения
 	 */
-	switch(static_cast <uint8_t> (target._type)){
+	switch(static_cast <uint8_t> (type)){
 		// Если приложение является клиентом
 		case static_cast <uint8_t> (type_t::CLIENT): {
 			/**
@@ -3544,16 +4333,9 @@ void awh::Engine::httpUpgrade(ctx_t & target) const noexcept {
 			 *
 			 */
 			#ifndef OPENSSL_NO_NEXTPROTONEG
-				// Устанавливаем функцию обратного вызова для переключения протокола на HTTP
-				::SSL_CTX_set_next_proto_select_cb(target._ctx, &engine_t::selectNextProtoClient, &target);
+				// Устанавливаем функцию обратного вызова для переключения протокола на HTTP (контекст извлекается из объекта SSL)
+				::SSL_CTX_set_next_proto_select_cb(ctx, &engine_t::selectNextProtoClient, nullptr);
 			#endif // !OPENSSL_NO_NEXTPROTONEG
-			/**
-			 * Если версия OpenSSL соответствует или выше версии 1.0.2
-			 */
-			#if OPENSSL_VERSION_NUMBER >= 0x10002000L
-				// Выполняем установку доступных протоколов передачи данных
-				::SSL_CTX_set_alpn_protos(target._ctx, target.protocols.data(), static_cast <uint32_t> (target.protocols.size()));
-			#endif // OPENSSL_VERSION_NUMBER >= 0x10002000L
 		} break;
 		// Если приложение является сервером
 		case static_cast <uint8_t> (type_t::SERVER): {
@@ -3562,15 +4344,15 @@ void awh::Engine::httpUpgrade(ctx_t & target) const noexcept {
 			 *
 			 */
 			#ifndef OPENSSL_NO_NEXTPROTONEG
-				// Выполняем установку функцию обратного вызова при выборе следующего протокола
-				::SSL_CTX_set_next_protos_advertised_cb(target._ctx, &engine_t::nextProto, &target);
+				// Выполняем установку функцию обратного вызова при выборе следующего протокола (контекст извлекается из объекта SSL)
+				::SSL_CTX_set_next_protos_advertised_cb(ctx, &engine_t::nextProto, nullptr);
 			#endif // !OPENSSL_NO_NEXTPROTONEG
 			/**
 			 * Если версия OpenSSL соответствует или выше версии 1.0.2
 			 */
 			#if OPENSSL_VERSION_NUMBER >= 0x10002000L
-				// Устанавливаем функцию обратного вызова для переключения протокола на HTTP/2
-				::SSL_CTX_set_alpn_select_cb(target._ctx, &engine_t::selectNextProtoServer, &target);
+				// Устанавливаем функцию обратного вызова для переключения протокола на HTTP/2 (контекст извлекается из объекта SSL)
+				::SSL_CTX_set_alpn_select_cb(ctx, &engine_t::selectNextProtoServer, nullptr);
 			#endif // OPENSSL_VERSION_NUMBER >= 0x10002000L
 		} break;
 	}
@@ -3613,6 +4395,796 @@ void awh::Engine::wrap(ctx_t & target, ctx_t & source) noexcept {
 		// Выполняем обёртывание уже активного SSL контекста
 		this->wrap(target, source._addr);
 }
+/**
+ * @brief Метод создания контекста SSL сервера принимающего подключения
+ *
+ * @param protocol протокол сокета (IPPROTO_TCP / IPPROTO_UDP / IPPROTO_SCTP)
+ * @param proto    желаемый протокол подключения
+ * @return         объект контекста SSL
+ */
+SSL_CTX * awh::Engine::server(const int32_t protocol, const proto_t proto) noexcept {
+	// Объект контекста SSL
+	SSL_CTX * ctx = nullptr;
+	/**
+	 * Для операционной системы Linux или FreeBSD
+	 */
+	#if __linux__ || __FreeBSD__
+		/**
+		 * Определяем тип протокола подключения
+		 */
+		switch(protocol){
+			// Если протокол подключения UDP
+			case IPPROTO_UDP:
+			// Если протокол подключения SCTP
+			case IPPROTO_SCTP:
+				// Получаем контекст OpenSSL
+				ctx = ::SSL_CTX_new(::DTLS_server_method());
+			break;
+			// Если протокол подключения TCP
+			case IPPROTO_TCP:
+				// Получаем контекст OpenSSL
+				ctx = ::SSL_CTX_new(::TLS_server_method());
+			break;
+		}
+	/**
+	 * Для операционной системы Linux
+	 */
+	#else
+		// Получаем контекст OpenSSL
+		ctx = ::SSL_CTX_new(::TLS_server_method());
+	#endif
+	// Если контекст не создан
+	if(ctx == nullptr){
+		// Выводим в лог сообщение
+		this->_log->print("Context SSL is not initialization: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+		// Выходим
+		return nullptr;
+	}
+	// Устанавливаем опции запроса
+	::SSL_CTX_set_options(ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION | SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
+	// Если используется потоковый протокол TLS
+	if(protocol == IPPROTO_TCP){
+		// Устанавливаем минимально-возможную версию TLS
+		::SSL_CTX_set_min_proto_version(ctx, this->_minVersion);
+		// Устанавливаем максимально-возможную версию TLS
+		::SSL_CTX_set_max_proto_version(ctx, this->_maxVersion);
+	}
+	/**
+	 * Если OpenSSL собран с поддержкой шифрования на уровне ядра (kTLS)
+	 */
+	#ifdef SSL_OP_ENABLE_KTLS
+		// Если разрешено шифрование на уровне ядра и используется потоковый протокол
+		if(this->_ktls && (protocol == IPPROTO_TCP))
+			// Разрешаем передачу шифрования записей TLS ядру операционной системы (при отсутствии поддержки шифр обрабатывается в пространстве пользователя)
+			::SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+	#endif
+	// Если нужно установить основные алгоритмы шифрования
+	if(!this->_cipher.empty()){
+		// Устанавливаем все основные алгоритмы шифрования
+		if(::SSL_CTX_set_cipher_list(ctx, this->_cipher.c_str()) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Set SSL ciphers: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+		// Заставляем серверные алгоритмы шифрования использовать в приоритете
+		::SSL_CTX_set_options(ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION | SSL_OP_CIPHER_SERVER_PREFERENCE | SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
+	}
+	// Получаем общее хранилище сессий, создаваемое при подготовке первого контекста сервера
+	const storage_t * storage = this->storage();
+	// Получаем идентификатор процесса (общий для всех процессов кластера, чтобы сессии возобновлялись в любом из них)
+	const pid_t pid = (storage != nullptr ? storage->pid : ::getpid());
+	/**
+	 * Если версия OpenSSL соответствует или выше версии 3.0.0
+	 */
+	#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		// Выполняем установку кривых P-256, P-384 и P-521
+		if(::SSL_CTX_set1_curves_list(ctx, "P-521:P-384:P-256") != 1){
+			// Выводим в лог сообщение
+			this->_log->print("Set SSL curves list failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	/**
+	 * Если версия OpenSSL ниже версии 3.0.0
+	 */
+	#else
+		{
+			// Выполняем создание объекта кривой P-256, доступны также (P-384 и P-521) или NID_secp256k1
+			EC_KEY * ecdh = ::EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+			// Если кривые не получилось установить
+			if(ecdh == nullptr){
+				// Выводим в лог сообщение
+				this->_log->print("Set new SSL curv name failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+				// Выполняем очистку созданного контекста
+				::SSL_CTX_free(ctx);
+				// Выходим
+				return nullptr;
+			}
+			// Выполняем установку кривых P-256
+			::SSL_CTX_set_tmp_ecdh(ctx, ecdh);
+			// Выполняем очистку объекта кривой
+			::EC_KEY_free(ecdh);
+		}
+	#endif
+	/**
+	 * Если протоколом является HTTP, выполняем переключение на него
+	 */
+	switch(static_cast <uint8_t> (proto)){
+		// Если протокол соответствует SPDY/1
+		case static_cast <uint8_t> (proto_t::SPDY1):
+		// Если протокол соответствует HTTP/2
+		case static_cast <uint8_t> (proto_t::HTTP2):
+		// Если протокол соответствует HTTP/3
+		case static_cast <uint8_t> (proto_t::HTTP3):
+			// Выполняем установку функций выбора протокола подключения
+			this->alpn(ctx, type_t::SERVER);
+		break;
+	}
+	// Выполняем установку идентификатора сессии
+	if(::SSL_CTX_set_session_id_context(ctx, reinterpret_cast <const uint8_t *> (&pid), sizeof(pid)) < 1){
+		// Выводим в лог сообщение
+		this->_log->print("Failed to set session ID", log_t::flag_t::CRITICAL);
+		// Выполняем очистку созданного контекста
+		::SSL_CTX_free(ctx);
+		// Выходим
+		return nullptr;
+	}
+	// Устанавливаем поддерживаемые кривые
+	if(SSL_CTX_set_ecdh_auto(ctx, 1) < 1){
+		// Выводим в лог сообщение
+		this->_log->print("Set SSL ECDH: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+		// Выполняем очистку созданного контекста
+		::SSL_CTX_free(ctx);
+		// Выходим
+		return nullptr;
+	}
+	// Устанавливаем флаг quiet shutdown
+	// ::SSL_CTX_set_quiet_shutdown(ctx, 1);
+	// Устанавливаем флаг очистки буферов на чтение и запись когда они не требуются
+	::SSL_CTX_set_mode(ctx, SSL_MODE_RELEASE_BUFFERS);
+	// Выполняем инициализацию общего кэша сессий и сессионных билетов
+	this->sessions(ctx, type_t::SERVER);
+	// Если цепочка сертификатов установлена
+	if(!this->_cert.pem.empty()){
+		// Если цепочка сертификатов не установлена
+		if(::SSL_CTX_use_certificate_chain_file(ctx, this->_cert.pem.c_str()) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	}
+	// Если приватный ключ установлен
+	if(!this->_cert.key.empty()){
+		// Если приватный ключ не может быть установлен
+		if(::SSL_CTX_use_PrivateKey_file(ctx, this->_cert.key.c_str(), SSL_FILETYPE_PEM) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Private key cannot be set", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+		// Если приватный ключ недействителен
+		if(::SSL_CTX_check_private_key(ctx) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Private key is not valid", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	}
+	// Если сертификат центра сертификации недействителен
+	if(::SSL_CTX_set_default_verify_file(ctx) < 1){
+		// Выводим в лог сообщение
+		this->_log->print("CAfile is invalid", log_t::flag_t::CRITICAL);
+		// Выполняем очистку созданного контекста
+		::SSL_CTX_free(ctx);
+		// Выходим
+		return nullptr;
+	}
+	// Если нужно произвести проверку
+	if(this->_verify){
+		// Устанавливаем глубину проверки
+		::SSL_CTX_set_verify_depth(ctx, 2);
+		// Выполняем проверку сертификата клиента
+		::SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, &verifyCert);
+	// Запрещаем выполнять првоерку сертификата пользователя
+	} else ::SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, nullptr);
+	// Выводим результат
+	return ctx;
+}
+/**
+ * @brief Метод создания контекста SSL клиента подключающегося к хосту
+ *
+ * @param protocol протокол сокета (IPPROTO_TCP / IPPROTO_UDP / IPPROTO_SCTP)
+ * @param proto    желаемый протокол подключения
+ * @return         объект контекста SSL
+ */
+SSL_CTX * awh::Engine::client(const int32_t protocol, const proto_t proto) noexcept {
+	// Объект контекста SSL
+	SSL_CTX * ctx = nullptr;
+	/**
+	 * Для операционной системы Linux или FreeBSD
+	 */
+	#if __linux__ || __FreeBSD__
+		/**
+		 * Определяем тип протокола подключения
+		 */
+		switch(protocol){
+			// Если протокол подключения UDP
+			case IPPROTO_UDP:
+			// Если протокол подключения SCTP
+			case IPPROTO_SCTP:
+				// Получаем контекст OpenSSL
+				ctx = ::SSL_CTX_new(::DTLS_client_method());
+			break;
+			// Если протокол подключения TCP
+			case IPPROTO_TCP:
+				// Получаем контекст OpenSSL
+				ctx = ::SSL_CTX_new(::TLS_client_method());
+			break;
+		}
+	/**
+	 * Для операционной системы Linux
+	 */
+	#else
+		// Получаем контекст OpenSSL
+		ctx = ::SSL_CTX_new(::TLS_client_method());
+	#endif
+	// Если контекст не создан
+	if(ctx == nullptr){
+		// Выводим в лог сообщение
+		this->_log->print("Context SSL is not initialization: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+		// Выходим
+		return nullptr;
+	}
+	// Устанавливаем опции запроса
+	::SSL_CTX_set_options(ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION);
+	// Если используется потоковый протокол TLS
+	if(protocol == IPPROTO_TCP){
+		// Устанавливаем минимально-возможную версию TLS
+		::SSL_CTX_set_min_proto_version(ctx, this->_minVersion);
+		// Устанавливаем максимально-возможную версию TLS
+		::SSL_CTX_set_max_proto_version(ctx, this->_maxVersion);
+	}
+	/**
+	 * Если OpenSSL собран с поддержкой шифрования на уровне ядра (kTLS)
+	 */
+	#ifdef SSL_OP_ENABLE_KTLS
+		// Если разрешено шифрование на уровне ядра и используется потоковый протокол
+		if(this->_ktls && (protocol == IPPROTO_TCP))
+			// Разрешаем передачу шифрования записей TLS ядру операционной системы (при отсутствии поддержки шифр обрабатывается в пространстве пользователя)
+			::SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+	#endif
+	/**
+	 * Если версия OpenSSL соответствует или выше версии 3.0.0
+	 */
+	#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		// Выполняем установку кривых P-256, P-384 и P-521
+		if(::SSL_CTX_set1_curves_list(ctx, "P-521:P-384:P-256") != 1){
+			// Выводим в лог сообщение
+			this->_log->print("Set SSL curves list failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	/**
+	 * Если версия OpenSSL ниже версии 3.0.0
+	 */
+	#else
+		{
+			// Выполняем создание объекта кривой P-256, доступны также (P-384 и P-521) или NID_secp256k1
+			EC_KEY * ecdh = ::EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+			// Если кривые не получилось установить
+			if(ecdh == nullptr){
+				// Выводим в лог сообщение
+				this->_log->print("Set new SSL curv name failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+				// Выполняем очистку созданного контекста
+				::SSL_CTX_free(ctx);
+				// Выходим
+				return nullptr;
+			}
+			// Выполняем установку кривых P-256
+			::SSL_CTX_set_tmp_ecdh(ctx, ecdh);
+			// Выполняем очистку объекта кривой
+			::EC_KEY_free(ecdh);
+		}
+	#endif
+	/**
+	 * Если протоколом является HTTP, выполняем переключение на него
+	 */
+	switch(static_cast <uint8_t> (proto)){
+		// Если протокол соответствует SPDY/1
+		case static_cast <uint8_t> (proto_t::SPDY1):
+		// Если протокол соответствует HTTP/1
+		case static_cast <uint8_t> (proto_t::HTTP1):
+		// Если протокол соответствует HTTP/2
+		case static_cast <uint8_t> (proto_t::HTTP2):
+		// Если протокол соответствует HTTP/3
+		case static_cast <uint8_t> (proto_t::HTTP3):
+		// Если протокол соответствует HTTP/1.1
+		case static_cast <uint8_t> (proto_t::HTTP1_1):
+			// Выполняем установку функций выбора протокола подключения
+			this->alpn(ctx, type_t::CLIENT);
+		break;
+	}
+	// Выполняем инициализацию CA-файла сертификата
+	if(!this->storeCA(ctx)){
+		// Выполняем очистку созданного контекста
+		::SSL_CTX_free(ctx);
+		// Выходим
+		return nullptr;
+	}
+	// Выполняем инициализацию CRL-файла сертификата
+	this->storeCRL(ctx);
+	// Если нужно установить основные алгоритмы шифрования
+	if(!this->_cipher.empty()){
+		// Устанавливаем все основные алгоритмы шифрования
+		if(::SSL_CTX_set_cipher_list(ctx, this->_cipher.c_str()) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Set SSL ciphers: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	}
+	// Устанавливаем флаг очистки буферов на чтение и запись когда они не требуются
+	::SSL_CTX_set_mode(ctx, SSL_MODE_RELEASE_BUFFERS);
+	// Если цепочка сертификатов установлена
+	if(!this->_cert.pem.empty()){
+		// Если цепочка сертификатов не установлена
+		if(::SSL_CTX_use_certificate_file(ctx, this->_cert.pem.c_str(), SSL_FILETYPE_PEM) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	}
+	// Если приватный ключ установлен
+	if(!this->_cert.key.empty()){
+		// Если приватный ключ не может быть установлен
+		if(::SSL_CTX_use_PrivateKey_file(ctx, this->_cert.key.c_str(), SSL_FILETYPE_PEM) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Private key cannot be set", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+		// Если приватный ключ недействителен
+		if(::SSL_CTX_check_private_key(ctx) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Private key is not valid", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	}
+	// Если нужно произвести проверку
+	if(this->_verify){
+		// Выполняем проверку сертификата
+		::SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, nullptr);
+		// Выполняем проверку всех дочерних сертификатов (параметры проверки извлекаются из объекта SSL)
+		::SSL_CTX_set_cert_verify_callback(ctx, &verifyHost, nullptr);
+		// Устанавливаем глубину проверки
+		::SSL_CTX_set_verify_depth(ctx, 4);
+	// Запрещаем выполнять првоерку сертификата пользователя
+	} else ::SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, nullptr);
+	// Устанавливаем, что мы должны читать как можно больше входных байтов
+	::SSL_CTX_set_read_ahead(ctx, 1);
+	// Выполняем инициализацию кэширования сессий клиента
+	this->sessions(ctx, type_t::CLIENT);
+	// Выводим результат
+	return ctx;
+}
+/**
+ * @brief Метод создания контекста SSL клиента/сервера для произвольного типа сокета
+ *
+ * @param type  тип активного приложения
+ * @param sonet тип сокета (SOCK_STREAM / SOCK_DGRAM)
+ * @param proto желаемый протокол подключения
+ * @return      объект контекста SSL
+ */
+SSL_CTX * awh::Engine::generic(const type_t type, const int32_t sonet, const proto_t proto) noexcept {
+	// Объект контекста SSL
+	SSL_CTX * ctx = nullptr;
+	/**
+	 * Определяем тип сокета
+	 */
+	switch(sonet){
+		// Если тип сокета - диграммы
+		case SOCK_DGRAM: {
+			/**
+			 * Определяем тип активного приложения
+			 */
+			switch(static_cast <uint8_t> (type)){
+				// Если приложение является клиентом
+				case static_cast <uint8_t> (type_t::CLIENT):
+					// Получаем контекст OpenSSL
+					ctx = ::SSL_CTX_new(::DTLS_client_method());
+				break;
+				// Если приложение является сервером
+				case static_cast <uint8_t> (type_t::SERVER):
+					// Получаем контекст OpenSSL
+					ctx = ::SSL_CTX_new(::DTLS_server_method());
+				break;
+			}
+		} break;
+		// Если тип сокета - потоки
+		case SOCK_STREAM: {
+			/**
+			 * Определяем тип активного приложения
+			 */
+			switch(static_cast <uint8_t> (type)){
+				// Если приложение является клиентом
+				case static_cast <uint8_t> (type_t::CLIENT):
+					// Получаем контекст OpenSSL
+					ctx = ::SSL_CTX_new(::TLS_client_method());
+				break;
+				// Если приложение является сервером
+				case static_cast <uint8_t> (type_t::SERVER):
+					// Получаем контекст OpenSSL
+					ctx = ::SSL_CTX_new(::TLS_server_method());
+				break;
+			}
+		} break;
+	}
+	// Если контекст не создан
+	if(ctx == nullptr){
+		// Выводим в лог сообщение
+		this->_log->print("Context SSL is not initialization: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+		// Выходим
+		return nullptr;
+	}
+	// Устанавливаем опции запроса
+	::SSL_CTX_set_options(ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION);
+	// Если используется потоковый протокол TLS
+	if(sonet == SOCK_STREAM){
+		// Устанавливаем минимально-возможную версию TLS
+		::SSL_CTX_set_min_proto_version(ctx, this->_minVersion);
+		// Устанавливаем максимально-возможную версию TLS
+		::SSL_CTX_set_max_proto_version(ctx, this->_maxVersion);
+	}
+	/**
+	 * Если OpenSSL собран с поддержкой шифрования на уровне ядра (kTLS)
+	 */
+	#ifdef SSL_OP_ENABLE_KTLS
+		// Если разрешено шифрование на уровне ядра и используется потоковый протокол
+		if(this->_ktls && (sonet == SOCK_STREAM))
+			// Разрешаем передачу шифрования записей TLS ядру операционной системы (при отсутствии поддержки шифр обрабатывается в пространстве пользователя)
+			::SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+	#endif
+	// Если нужно установить основные алгоритмы шифрования
+	if(!this->_cipher.empty()){
+		// Устанавливаем все основные алгоритмы шифрования
+		if(::SSL_CTX_set_cipher_list(ctx, this->_cipher.c_str()) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Set SSL ciphers: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+		// Если приложение является сервером
+		if(type == type_t::SERVER)
+			// Заставляем серверные алгоритмы шифрования использовать в приоритете
+			::SSL_CTX_set_options(ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION | SSL_OP_CIPHER_SERVER_PREFERENCE | SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
+	}
+	/**
+	 * Если версия OpenSSL соответствует или выше версии 3.0.0
+	 */
+	#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		// Выполняем установку кривых P-256, P-384 и P-521
+		if(::SSL_CTX_set1_curves_list(ctx, "P-521:P-384:P-256") != 1){
+			// Выводим в лог сообщение
+			this->_log->print("Set SSL curves list failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	/**
+	 * Если версия OpenSSL ниже версии 3.0.0
+	 */
+	#else
+		{
+			// Выполняем создание объекта кривой P-256, доступны также (P-384 и P-521) или NID_secp256k1
+			EC_KEY * ecdh = ::EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+			// Если кривые не получилось установить
+			if(ecdh == nullptr){
+				// Выводим в лог сообщение
+				this->_log->print("Set new SSL curv name failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+				// Выполняем очистку созданного контекста
+				::SSL_CTX_free(ctx);
+				// Выходим
+				return nullptr;
+			}
+			// Выполняем установку кривых P-256
+			::SSL_CTX_set_tmp_ecdh(ctx, ecdh);
+			// Выполняем очистку объекта кривой
+			::EC_KEY_free(ecdh);
+		}
+	#endif
+	// Если приложение является сервером
+	if(type == type_t::SERVER){
+		// Получаем идентификатор процесса
+		const pid_t pid = ::getpid();
+		/**
+		 * Если протоколом является HTTP, выполняем переключение на него
+		 */
+		switch(static_cast <uint8_t> (proto)){
+			// Если протокол соответствует SPDY/1
+			case static_cast <uint8_t> (proto_t::SPDY1):
+			// Если протокол соответствует HTTP/2
+			case static_cast <uint8_t> (proto_t::HTTP2):
+			// Если протокол соответствует HTTP/3
+			case static_cast <uint8_t> (proto_t::HTTP3):
+				// Выполняем установку функций выбора протокола подключения
+				this->alpn(ctx, type);
+			break;
+		}
+		// Выполняем установку идентификатора сессии
+		if(::SSL_CTX_set_session_id_context(ctx, reinterpret_cast <const uint8_t *> (&pid), sizeof(pid)) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Failed to set session ID", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	// Если приложение является клиентом
+	} else {
+		/**
+		 * Если протоколом является HTTP, выполняем переключение на него
+		 */
+		switch(static_cast <uint8_t> (proto)){
+			// Если протокол соответствует SPDY/1
+			case static_cast <uint8_t> (proto_t::SPDY1):
+			// Если протокол соответствует HTTP/1
+			case static_cast <uint8_t> (proto_t::HTTP1):
+			// Если протокол соответствует HTTP/2
+			case static_cast <uint8_t> (proto_t::HTTP2):
+			// Если протокол соответствует HTTP/3
+			case static_cast <uint8_t> (proto_t::HTTP3):
+			// Если протокол соответствует HTTP/1.1
+			case static_cast <uint8_t> (proto_t::HTTP1_1):
+				// Выполняем установку функций выбора протокола подключения
+				this->alpn(ctx, type);
+			break;
+		}
+	}
+	// Устанавливаем поддерживаемые кривые
+	if(SSL_CTX_set_ecdh_auto(ctx, 1) < 1){
+		// Выводим в лог сообщение
+		this->_log->print("Set SSL ECDH: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+		// Выполняем очистку созданного контекста
+		::SSL_CTX_free(ctx);
+		// Выходим
+		return nullptr;
+	}
+	// Если приложение является клиентом
+	if(type == type_t::CLIENT){
+		// Выполняем инициализацию CA-файла сертификата
+		if(!this->storeCA(ctx)){
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+		// Выполняем инициализацию CRL-файла сертификата
+		this->storeCRL(ctx);
+	}
+	// Устанавливаем флаг очистки буферов на чтение и запись когда они не требуются
+	::SSL_CTX_set_mode(ctx, SSL_MODE_RELEASE_BUFFERS);
+	// Если приложение является сервером
+	if(type == type_t::SERVER)
+		// Выполняем отключение SSL кеша
+		::SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+	// Если цепочка сертификатов установлена
+	if(!this->_cert.pem.empty()){
+		/**
+		 * Определяем тип активного приложения
+		 */
+		switch(static_cast <uint8_t> (type)){
+			// Если приложение является клиентом
+			case static_cast <uint8_t> (type_t::CLIENT):
+				// Если цепочка сертификатов не установлена
+				if(::SSL_CTX_use_certificate_file(ctx, this->_cert.pem.c_str(), SSL_FILETYPE_PEM) < 1){
+					// Выводим в лог сообщение
+					this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
+					// Выполняем очистку созданного контекста
+					::SSL_CTX_free(ctx);
+					// Выходим
+					return nullptr;
+				}
+			break;
+			// Если приложение является сервером
+			case static_cast <uint8_t> (type_t::SERVER):
+				// Если цепочка сертификатов не установлена
+				if(::SSL_CTX_use_certificate_chain_file(ctx, this->_cert.pem.c_str()) < 1){
+					// Выводим в лог сообщение
+					this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
+					// Выполняем очистку созданного контекста
+					::SSL_CTX_free(ctx);
+					// Выходим
+					return nullptr;
+				}
+			break;
+		}
+	}
+	// Если приватный ключ установлен
+	if(!this->_cert.key.empty()){
+		// Если приватный ключ не может быть установлен
+		if(::SSL_CTX_use_PrivateKey_file(ctx, this->_cert.key.c_str(), SSL_FILETYPE_PEM) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Private key cannot be set", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+		// Если приватный ключ недействителен
+		if(::SSL_CTX_check_private_key(ctx) < 1){
+			// Выводим в лог сообщение
+			this->_log->print("Private key is not valid", log_t::flag_t::CRITICAL);
+			// Выполняем очистку созданного контекста
+			::SSL_CTX_free(ctx);
+			// Выходим
+			return nullptr;
+		}
+	}
+	// Если нужно произвести проверку
+	if(this->_verify){
+		// Устанавливаем глубину проверки
+		::SSL_CTX_set_verify_depth(ctx, 2);
+		// Выполняем проверку сертификата клиента
+		::SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, &verifyCert);
+	// Запрещаем выполнять првоерку сертификата пользователя
+	} else ::SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, nullptr);
+	// Устанавливаем, что мы должны читать как можно больше входных байтов
+	::SSL_CTX_set_read_ahead(ctx, 1);
+	// Если приложение является сервером
+	if(type == type_t::SERVER){
+		/**
+		 * Определяем тип сокета
+		 */
+		switch(sonet){
+			// Если тип сокета - диграммы
+			case SOCK_DGRAM: {
+				// Выполняем проверку файлов печенок
+				::SSL_CTX_set_cookie_verify_cb(ctx, &verifyCookie);
+				// Выполняем генерацию файлов печенок
+				::SSL_CTX_set_cookie_generate_cb(ctx, &generateCookie);
+			} break;
+			// Если тип сокета - потоки
+			case SOCK_STREAM: {
+				// Выполняем проверку файлов печенок
+				::SSL_CTX_set_stateless_cookie_verify_cb(ctx, &verifyStatelessCookie);
+				// Выполняем генерацию файлов печенок
+				::SSL_CTX_set_stateless_cookie_generate_cb(ctx, &generateStatelessCookie);
+			} break;
+		}
+	}
+	// Выводим результат
+	return ctx;
+}
+/**
+ * @brief Метод извлечения подготовленного контекста SSL
+ *
+ * @param prepare  тип подготавливаемого контекста
+ * @param type     тип активного приложения
+ * @param sonet    тип сокета (SOCK_STREAM / SOCK_DGRAM)
+ * @param protocol протокол сокета (IPPROTO_TCP / IPPROTO_UDP / IPPROTO_SCTP)
+ * @param proto    желаемый протокол подключения
+ * @return         объект контекста SSL с увеличенным счётчиком ссылок
+ */
+SSL_CTX * awh::Engine::prepare(const prepare_t prepare, const type_t type, const int32_t sonet, const int32_t protocol, const proto_t proto) noexcept {
+	// Результат работы функции
+	SSL_CTX * result = nullptr;
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	/**
+	 * Формируем ключ контекста, сертификаты, CA-файлы, режим проверки и алгоритмы шифрования
+	 * общие для всего двигателя, при их изменении список подготовленных контекстов сбрасывается
+	 */
+	const string & key = this->_fmk->format(
+		"%u:%u:%d:%d:%u",
+		static_cast <uint8_t> (prepare),
+		static_cast <uint8_t> (type),
+		sonet, protocol,
+		static_cast <uint8_t> (proto)
+	);
+	// Выполняем поиск уже подготовленного контекста
+	auto i = this->_contexts.find(key);
+	// Если контекст уже подготовлен
+	if(i != this->_contexts.end())
+		// Получаем подготовленный контекст
+		result = i->second;
+	// Если контекст ещё не подготовлен
+	else {
+		/**
+		 * Определяем тип подготавливаемого контекста
+		 */
+		switch(static_cast <uint8_t> (prepare)){
+			// Если контекст подготавливается для сервера
+			case static_cast <uint8_t> (prepare_t::SERVER):
+				// Выполняем создание контекста сервера
+				result = this->server(protocol, proto);
+			break;
+			// Если контекст подготавливается для клиента
+			case static_cast <uint8_t> (prepare_t::CLIENT):
+				// Выполняем создание контекста клиента
+				result = this->client(protocol, proto);
+			break;
+			// Если контекст подготавливается для произвольного типа сокета
+			case static_cast <uint8_t> (prepare_t::GENERIC):
+				// Выполняем создание контекста клиента/сервера
+				result = this->generic(type, sonet, proto);
+			break;
+		}
+		// Если контекст создан удачно
+		if(result != nullptr)
+			// Добавляем контекст в список подготовленных
+			this->_contexts.emplace(key, result);
+	}
+	// Если контекст получен
+	if(result != nullptr)
+		// Увеличиваем счётчик ссылок, контекст освобождается при очистке контекста двигателя
+		::SSL_CTX_up_ref(result);
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод очистки списка подготовленных контекстов SSL
+ *
+ */
+void awh::Engine::flush() noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем перебор всех подготовленных контекстов
+	for(auto & item : this->_contexts)
+		// Уменьшаем счётчик ссылок, активные подключения продолжают использовать свою копию
+		::SSL_CTX_free(item.second);
+	// Выполняем очистку списка подготовленных контекстов
+	this->_contexts.clear();
+}
+/**
+ * @brief Метод предварительной подготовки контекста SSL сервера
+ *
+ * @param address объект подключения сервера
+ * @param proto   желаемый протокол подключения
+ * @return        результат подготовки контекста
+ */
+bool awh::Engine::init(const addr_t * address, const proto_t proto) noexcept {
+	// Если данные переданы и сертификаты установлены
+	if((address != nullptr) && (address->_type == SOCK_STREAM) && !this->_cert.key.empty() && !this->_cert.pem.empty()){
+		// Выполняем подготовку контекста сервера
+		SSL_CTX * ctx = this->prepare(prepare_t::SERVER, type_t::SERVER, address->_type, address->_protocol, proto);
+		// Если контекст подготовлен
+		if(ctx != nullptr){
+			// Освобождаем полученную ссылку, контекст остаётся в списке подготовленных
+			::SSL_CTX_free(ctx);
+			// Сообщаем, что контекст подготовлен
+			return true;
+		}
+	}
+	// Сообщаем, что контекст не подготовлен
+	return false;
+}
 /**
  * @brief Метод обертывания сетевого сокета для сервера
  *
@@ -3644,94 +5216,25 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address) noexcept {
 			return;
 		// Если объект фреймворка существует
 		if((target._addr->sock != INVALID_SOCKET) && !this->_cert.key.empty() && !this->_cert.pem.empty()){
-			/**
-			 * Для операционной системы Linux или FreeBSD
-			 */
-			#if __linux__ || __FreeBSD__
-				/**
-				 * Определяем тип протокола подключения
-				 */
-				switch(target._addr->_protocol){
-					// Если протокол подключения UDP
-					case IPPROTO_UDP:
-					// Если протокол подключения SCTP
-					case IPPROTO_SCTP:
-						// Получаем контекст OpenSSL
-						target._ctx = ::SSL_CTX_new(::DTLSv1_2_server_method());
-					break;
-					// Если протокол подключения TCP
-					case IPPROTO_TCP:
-						// Получаем контекст OpenSSL
-						target._ctx = ::SSL_CTX_new(::TLSv1_2_server_method());
-					break;
-				}
-			/**
-			 * Для операционной системы Linux
-			 */
-			#else
-				// Получаем контекст OpenSSL
-				target._ctx = ::SSL_CTX_new(::TLSv1_2_server_method());
-			#endif
+			// Получаем подготовленный контекст OpenSSL
+			target._ctx = this->prepare(prepare_t::SERVER, type_t::SERVER, target._addr->_type, target._addr->_protocol, target._proto);
 			// Если контекст не создан
-			if(target._ctx == nullptr){
+			if(target._ctx == nullptr)
+				// Выходим
+				return;
+			// Создаем SSL объект
+			target._ssl = ::SSL_new(target._ctx);
+			// Если объект не создан
+			if(!(target._encrypted = (target._ssl != nullptr))){
+				// Очищаем созданный контекст
+				target.clear();
 				// Выводим в лог сообщение
-				this->_log->print("Context SSL is not initialization: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
+				this->_log->print("Could not create SSL/TLS session object: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
 				// Выходим
 				return;
 			}
-			// Устанавливаем опции запроса
-			::SSL_CTX_set_options(target._ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION | SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
-			// Устанавливаем минимально-возможную версию TLS
-			::SSL_CTX_set_min_proto_version(target._ctx, 0);
-			// Устанавливаем максимально-возможную версию TLS
-			::SSL_CTX_set_max_proto_version(target._ctx, TLS1_3_VERSION);
-			// Если нужно установить основные алгоритмы шифрования
-			if(!this->_cipher.empty()){
-				// Устанавливаем все основные алгоритмы шифрования
-				if(::SSL_CTX_set_cipher_list(target._ctx, this->_cipher.c_str()) < 1){
-					// Очищаем созданный контекст
-					target.clear();
-					// Выводим в лог сообщение
-					this->_log->print("Set SSL ciphers: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-					// Выходим
-					return;
-				}
-				// Заставляем серверные алгоритмы шифрования использовать в приоритете
-				::SSL_CTX_set_options(target._ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION | SSL_OP_CIPHER_SERVER_PREFERENCE | SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
-			}
-			// Получаем идентификатор процесса
-			const pid_t pid = ::getpid();
-			/**
-			 * Если версия OpenSSL соответствует или выше версии 3.0.0
-			 */
-			#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-				// Выполняем установку кривых P-256, P-384 и P-521
-				if(::SSL_CTX_set1_curves_list(target._ctx, "P-521:P-384:P-256") != 1){
-					// Выводим в лог сообщение
-					this->_log->print("Set SSL curves list failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-					// Выходим
-					return;
-				}
-			/**
-			 * Если версия OpenSSL ниже версии 3.0.0
-			 */
-			#else
-				{
-					// Выполняем создание объекта кривой P-256, доступны также (P-384 и P-521) или NID_secp256k1
-					EC_KEY * ecdh = ::EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
-					// Если кривые не получилось установить
-					if(ecdh == nullptr){
-						// Выводим в лог сообщение
-						this->_log->print("Set new SSL curv name failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-						// Выходим
-						return;
-					}
-					// Выполняем установку кривых P-256
-					::SSL_CTX_set_tmp_ecdh(target._ctx, ecdh);
-					// Выполняем очистку объекта кривой
-					::EC_KEY_free(ecdh);
-				}
-			#endif
+			// Выполняем установку контекста двигателя для функций обратного вызова
+			SSL_set_app_data(target._ssl, &target);
 			/**
 			 * Если протоколом является HTTP, выполняем переключение на него
 			 */
@@ -3746,91 +5249,6 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address) noexcept {
 					this->httpUpgrade(target);
 				break;
 			}
-			// Выполняем установку идентификатора сессии
-			if(::SSL_CTX_set_session_id_context(target._ctx, reinterpret_cast <const uint8_t *> (&pid), sizeof(pid)) < 1){
-				// Очищаем созданный контекст
-				target.clear();
-				// Выводим в лог сообщение
-				this->_log->print("Failed to set session ID", log_t::flag_t::CRITICAL);
-				// Выходим
-				return;
-			}
-			// Устанавливаем поддерживаемые кривые
-			if(SSL_CTX_set_ecdh_auto(target._ctx, 1) < 1){
-				// Очищаем созданный контекст
-				target.clear();
-				// Выводим в лог сообщение
-				this->_log->print("Set SSL ECDH: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-				// Выходим
-				return;
-			}
-			// Устанавливаем флаг quiet shutdown
-			// ::SSL_CTX_set_quiet_shutdown(target._ctx, 1);
-			// Устанавливаем флаг очистки буферов на чтение и запись когда они не требуются
-			::SSL_CTX_set_mode(target._ctx, SSL_MODE_RELEASE_BUFFERS);
-			// Запускаем кэширование
-			::SSL_CTX_set_session_cache_mode(target._ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
-			// Если цепочка сертификатов установлена
-			if(!this->_cert.pem.empty()){
-				// Если цепочка сертификатов не установлена
-				if(::SSL_CTX_use_certificate_chain_file(target._ctx, this->_cert.pem.c_str()) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-			}
-			// Если приватный ключ установлен
-			if(!this->_cert.key.empty()){
-				// Если приватный ключ не может быть установлен
-				if(::SSL_CTX_use_PrivateKey_file(target._ctx, this->_cert.key.c_str(), SSL_FILETYPE_PEM) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Private key cannot be set", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-				// Если приватный ключ недействителен
-				if(::SSL_CTX_check_private_key(target._ctx) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Private key is not valid", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-			}
-			// Если сертификат центра сертификации недействителен
-			if(::SSL_CTX_set_default_verify_file(target._ctx) < 1){
-				// Выводим в лог сообщение
-				this->_log->print("CAfile is invalid", log_t::flag_t::CRITICAL);
-				// Очищаем созданный контекст
-				target.clear();
-				// Выходим
-				return;
-			}
-			// Если нужно произвести проверку
-			if(this->_verify){
-				// Устанавливаем глубину проверки
-				::SSL_CTX_set_verify_depth(target._ctx, 2);
-				// Выполняем проверку сертификата клиента
-				::SSL_CTX_set_verify(target._ctx, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, &verifyCert);
-			// Запрещаем выполнять првоерку сертификата пользователя
-			} else ::SSL_CTX_set_verify(target._ctx, SSL_VERIFY_NONE, nullptr);
-			// Создаем SSL объект
-			target._ssl = ::SSL_new(target._ctx);
-			// Если объект не создан
-			if(!(target._encrypted = (target._ssl != nullptr))){
-				// Очищаем созданный контекст
-				target.clear();
-				// Выводим в лог сообщение
-				this->_log->print("Could not create SSL/TLS session object: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-				// Выходим
-				return;
-			}
 			// Проверяем рукопожатие
 			if(::SSL_do_handshake(target._ssl) < 1){
 				// Выполняем проверку рукопожатия
@@ -3896,295 +5314,43 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address) noexcept {
 			// Если BIO SSL не создано
 			} else {
 				// Очищаем созданный контекст
-				target.clear();
-				// Выводим сообщение об ошибке
-				this->_log->print("BIO new socket is failed", log_t::flag_t::CRITICAL);
-			}
-		}
-	}
-}
-/**
- * @brief Метод обертывания сетевого сокета для клиента/сервера
- *
- * @param target  контекст назначения
- * @param address объект подключения
- * @param type    тип активного приложения
- * @return        объект SSL контекста
- */
-void awh::Engine::wrap(ctx_t & target, addr_t * address, const type_t type) noexcept {
-	// Если данные переданы
-	if(address != nullptr){
-		// Устанавливаем тип приложения
-		target._type = type;
-		// Устанавливаем сетевой сокет
-		target._addr = address;
-		// Если объект фреймворка существует
-		if(target._addr->sock != INVALID_SOCKET){
-			/**
-			 * Определяем тип сокета
-			 */
-			switch(target._addr->_type){
-				// Если тип сокета - диграммы
-				case SOCK_DGRAM: {
-					/**
-					 * Определяем тип активного приложения
-					 */
-					switch(static_cast <uint8_t> (type)){
-						// Если приложение является клиентом
-						case static_cast <uint8_t> (type_t::CLIENT):
-							// Получаем контекст OpenSSL
-							target._ctx = ::SSL_CTX_new(DTLSv1_2_client_method());
-						break;
-						// Если приложение является сервером
-						case static_cast <uint8_t> (type_t::SERVER):
-							// Получаем контекст OpenSSL
-							target._ctx = ::SSL_CTX_new(DTLSv1_2_server_method());
-						break;
-					}
-				} break;
-				// Если тип сокета - потоки
-				case SOCK_STREAM: {
-					/**
-					 * Определяем тип активного приложения
-					 */
-					switch(static_cast <uint8_t> (type)){
-						// Если приложение является клиентом
-						case static_cast <uint8_t> (type_t::CLIENT):
-							// Получаем контекст OpenSSL
-							target._ctx = ::SSL_CTX_new(TLSv1_2_client_method());
-						break;
-						// Если приложение является сервером
-						case static_cast <uint8_t> (type_t::SERVER):
-							// Получаем контекст OpenSSL
-							target._ctx = ::SSL_CTX_new(TLSv1_2_server_method());
-						break;
-					}
-				} break;
-			}
-			// Если контекст не создан
-			if(target._ctx == nullptr){
-				// Выводим в лог сообщение
-				this->_log->print("Context SSL is not initialization: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-				// Выходим
-				return;
-			}
-			// Устанавливаем опции запроса
-			::SSL_CTX_set_options(target._ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION);
-			// Устанавливаем минимально-возможную версию TLS
-			::SSL_CTX_set_min_proto_version(target._ctx, 0);
-			// Устанавливаем максимально-возможную версию TLS
-			::SSL_CTX_set_max_proto_version(target._ctx, TLS1_3_VERSION);
-			// Если нужно установить основные алгоритмы шифрования
-			if(!this->_cipher.empty()){
-				// Устанавливаем все основные алгоритмы шифрования
-				if(::SSL_CTX_set_cipher_list(target._ctx, this->_cipher.c_str()) < 1){
-					// Очищаем созданный контекст
-					target.clear();
-					// Выводим в лог сообщение
-					this->_log->print("Set SSL ciphers: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-					// Выходим
-					return;
-				}
-				// Если приложение является сервером
-				if(type == type_t::SERVER)
-					// Заставляем серверные алгоритмы шифрования использовать в приоритете
-					::SSL_CTX_set_options(target._ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION | SSL_OP_CIPHER_SERVER_PREFERENCE | SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
-			}
-			/**
-			 * Если версия OpenSSL соответствует или выше версии 3.0.0
-			 */
-			#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-				// Выполняем установку кривых P-256, P-384 и P-521
-				if(::SSL_CTX_set1_curves_list(target._ctx, "P-521:P-384:P-256") != 1){
-					// Выводим в лог сообщение
-					this->_log->print("Set SSL curves list failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-					// Выходим
-					return;
-				}
-			/**
-			 * Если версия OpenSSL ниже версии 3.0.0
-			 */
-			#else
-				{
-					// Выполняем создание объекта кривой P-256, доступны также (P-384 и P-521) или NID_secp256k1
-					EC_KEY * ecdh = ::EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
-					// Если кривые не получилось установить
-					if(ecdh == nullptr){
-						// Выводим в лог сообщение
-						this->_log->print("Set new SSL curv name failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-						// Выходим
-						return;
-					}
-					// Выполняем установку кривых P-256
-					::SSL_CTX_set_tmp_ecdh(target._ctx, ecdh);
-					// Выполняем очистку объекта кривой
-					::EC_KEY_free(ecdh);
-				}
-			#endif
-			// Если приложение является сервером
-			if(type == type_t::SERVER){
-				// Получаем идентификатор процесса
-				const pid_t pid = ::getpid();
-				/**
-				 * Если протоколом является HTTP, выполняем переключение на него
-				 */
-				switch(static_cast <uint8_t> (target._proto)){
-					// Если протокол соответствует SPDY/1
-					case static_cast <uint8_t> (proto_t::SPDY1):
-					// Если протокол соответствует HTTP/2
-					case static_cast <uint8_t> (proto_t::HTTP2):
-					// Если протокол соответствует HTTP/3
-					case static_cast <uint8_t> (proto_t::HTTP3):
-						// Выполняем переключение протокола подключения
-						this->httpUpgrade(target);
-					break;
-				}
-				// Выполняем установку идентификатора сессии
-				if(::SSL_CTX_set_session_id_context(target._ctx, reinterpret_cast <const uint8_t *> (&pid), sizeof(pid)) < 1){
-					// Очищаем созданный контекст
-					target.clear();
-					// Выводим в лог сообщение
-					this->_log->print("Failed to set session ID", log_t::flag_t::CRITICAL);
-					// Выходим
-					return;
-				}
-			// Если приложение является клиентом
-			} else {
-				/**
-				 * Если протоколом является HTTP, выполняем переключение на него
-				 */
-				switch(static_cast <uint8_t> (target._proto)){
-					// Если протокол соответствует SPDY/1
-					case static_cast <uint8_t> (proto_t::SPDY1):
-					// Если протокол соответствует HTTP/1
-					case static_cast <uint8_t> (proto_t::HTTP1):
-					// Если протокол соответствует HTTP/2
-					case static_cast <uint8_t> (proto_t::HTTP2):
-					// Если протокол соответствует HTTP/3
-					case static_cast <uint8_t> (proto_t::HTTP3):
-					// Если протокол соответствует HTTP/1.1
-					case static_cast <uint8_t> (proto_t::HTTP1_1):
-						// Выполняем переключение протокола подключения
-						this->httpUpgrade(target);
-					break;
-				}
+				target.clear();
+				// Выводим сообщение об ошибке
+				this->_log->print("BIO new socket is failed", log_t::flag_t::CRITICAL);
 			}
-			// Устанавливаем поддерживаемые кривые
-			if(SSL_CTX_set_ecdh_auto(target._ctx, 1) < 1){
+		}
+	}
+}
+/**
+ * @brief Метод обертывания сетевого сокета для клиента/сервера
+ *
+ * @param target  контекст назначения
+ * @param address объект подключения
+ * @param type    тип активного приложения
+ * @return        объект SSL контекста
+ */
+void awh::Engine::wrap(ctx_t & target, addr_t * address, const type_t type) noexcept {
+	// Если данные переданы
+	if(address != nullptr){
+		// Устанавливаем тип приложения
+		target._type = type;
+		// Устанавливаем сетевой сокет
+		target._addr = address;
+		// Если объект фреймворка существует
+		if(target._addr->sock != INVALID_SOCKET){
+			// Получаем подготовленный контекст OpenSSL
+			target._ctx = this->prepare(prepare_t::GENERIC, type, target._addr->_type, target._addr->_protocol, target._proto);
+			// Если контекст не создан
+			if(target._ctx == nullptr){
 				// Очищаем созданный контекст
 				target.clear();
-				// Выводим в лог сообщение
-				this->_log->print("Set SSL ECDH: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
 				// Выходим
 				return;
 			}
-			// Если приложение является клиентом
-			if(type == type_t::CLIENT){
-				// Выполняем инициализацию CA-файла сертификата
-				if(!this->storeCA(target._ctx)){
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-				// Выполняем инициализацию CRL-файла сертификата
-				this->storeCRL(target._ctx);
-				// Если объект CRL-файла сертификата получен
-				if(this->_crl != nullptr)
-					// Выполняем установку объект CRL-файла сертификата
-					target.crl(this->_crl);
-			}
-			// Устанавливаем флаг очистки буферов на чтение и запись когда они не требуются
-			::SSL_CTX_set_mode(target._ctx, SSL_MODE_RELEASE_BUFFERS);
-			// Если приложение является сервером
-			if(type == type_t::SERVER)
-				// Выполняем отключение SSL кеша
-				::SSL_CTX_set_session_cache_mode(target._ctx, SSL_SESS_CACHE_OFF);
-			// Если цепочка сертификатов установлена
-			if(!this->_cert.pem.empty()){
-				/**
-				 * Определяем тип активного приложения
-				 */
-				switch(static_cast <uint8_t> (type)){
-					// Если приложение является клиентом
-					case static_cast <uint8_t> (type_t::CLIENT):
-						// Если цепочка сертификатов не установлена
-						if(::SSL_CTX_use_certificate_file(target._ctx, this->_cert.pem.c_str(), SSL_FILETYPE_PEM) < 1){
-							// Выводим в лог сообщение
-							this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
-							// Очищаем созданный контекст
-							target.clear();
-							// Выходим
-							return;
-						}
-					break;
-					// Если приложение является сервером
-					case static_cast <uint8_t> (type_t::SERVER):
-						// Если цепочка сертификатов не установлена
-						if(::SSL_CTX_use_certificate_chain_file(target._ctx, this->_cert.pem.c_str()) < 1){
-							// Выводим в лог сообщение
-							this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
-							// Очищаем созданный контекст
-							target.clear();
-							// Выходим
-							return;
-						}
-					break;
-				}
-			}
-			// Если приватный ключ установлен
-			if(!this->_cert.key.empty()){
-				// Если приватный ключ не может быть установлен
-				if(::SSL_CTX_use_PrivateKey_file(target._ctx, this->_cert.key.c_str(), SSL_FILETYPE_PEM) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Private key cannot be set", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-				// Если приватный ключ недействителен
-				if(::SSL_CTX_check_private_key(target._ctx) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Private key is not valid", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-			}
-			// Если нужно произвести проверку
-			if(this->_verify){
-				// Устанавливаем глубину проверки
-				::SSL_CTX_set_verify_depth(target._ctx, 2);
-				// Выполняем проверку сертификата клиента
-				::SSL_CTX_set_verify(target._ctx, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, &verifyCert);
-			// Запрещаем выполнять првоерку сертификата пользователя
-			} else ::SSL_CTX_set_verify(target._ctx, SSL_VERIFY_NONE, nullptr);
-			// Устанавливаем, что мы должны читать как можно больше входных байтов
-			::SSL_CTX_set_read_ahead(target._ctx, 1);
-			// Если приложение является сервером
-			if(type == type_t::SERVER){
-				/**
-				 * Определяем тип сокета
-				 */
-				switch(target._addr->_type){
-					// Если тип сокета - диграммы
-					case SOCK_DGRAM: {
-						// Выполняем проверку файлов печенок
-						::SSL_CTX_set_cookie_verify_cb(target._ctx, &verifyCookie);
-						// Выполняем генерацию файлов печенок
-						::SSL_CTX_set_cookie_generate_cb(target._ctx, &generateCookie);
-					} break;
-					// Если тип сокета - потоки
-					case SOCK_STREAM: {
-						// Выполняем проверку файлов печенок
-						::SSL_CTX_set_stateless_cookie_verify_cb(target._ctx, &verifyStatelessCookie);
-						// Выполняем генерацию файлов печенок
-						::SSL_CTX_set_stateless_cookie_generate_cb(target._ctx, &generateStatelessCookie);
-					} break;
-				}
-			}
+			// Если приложение является клиентом и объект CRL-файла сертификата получен
+			if((type == type_t::CLIENT) && (this->_crl != nullptr))
+				// Выполняем установку объект CRL-файла сертификата
+				target.crl(this->_crl);
 			// Создаем SSL объект
 			target._ssl = ::SSL_new(target._ctx);
 			// Если объект не создан
@@ -4196,6 +5362,31 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address, const type_t type) noex
 				// Выходим
 				return;
 			}
+			// Выполняем установку контекста двигателя для функций обратного вызова
+			SSL_set_app_data(target._ssl, &target);
+			/**
+			 * Если протоколом является HTTP, выполняем переключение на него
+			 */
+			switch(static_cast <uint8_t> (target._proto)){
+				// Если протокол соответствует SPDY/1
+				case static_cast <uint8_t> (proto_t::SPDY1):
+				// Если протокол соответствует HTTP/2
+				case static_cast <uint8_t> (proto_t::HTTP2):
+				// Если протокол соответствует HTTP/3
+				case static_cast <uint8_t> (proto_t::HTTP3):
+					// Выполняем переключение протокола подключения
+					this->httpUpgrade(target);
+				break;
+				// Если протокол соответствует HTTP/1
+				case static_cast <uint8_t> (proto_t::HTTP1):
+				// Если протокол соответствует HTTP/1.1
+				case static_cast <uint8_t> (proto_t::HTTP1_1): {
+					// Если приложение является клиентом
+					if(type == type_t::CLIENT)
+						// Выполняем переключение протокола подключения
+						this->httpUpgrade(target);
+				} break;
+			}
 			// Устанавливаем флаг активации TLS
 			target._addr->_encrypted = target._encrypted;
 			/**
@@ -4283,168 +5474,27 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address, const string & host) no
 		target._addr = address;
 		// Устанавливаем тип приложения
 		target._type = type_t::CLIENT;
+		// Устанавливаем хост удалённого сервера
+		target._host = host;
 		// Если объект фреймворка существует
 		if((target._addr->sock != INVALID_SOCKET) && this->encrypted(target)){
-			/**
-			 * Для операционной системы Linux или FreeBSD
-			 */
-			#if __linux__ || __FreeBSD__
-				/**
-				 * Определяем тип протокола подключения
-				 */
-				switch(target._addr->_protocol){
-					// Если протокол подключения UDP
-					case IPPROTO_UDP:
-					// Если протокол подключения SCTP
-					case IPPROTO_SCTP:
-						// Получаем контекст OpenSSL
-						target._ctx = ::SSL_CTX_new(::DTLSv1_2_client_method());
-					break;
-					// Если протокол подключения TCP
-					case IPPROTO_TCP:
-						// Получаем контекст OpenSSL
-						target._ctx = ::SSL_CTX_new(::TLSv1_2_client_method());
-					break;
-				}
-			/**
-			 * Для операционной системы Linux
-			 */
-			#else
-				// Получаем контекст OpenSSL
-				target._ctx = ::SSL_CTX_new(::TLSv1_2_client_method());
-			#endif
+			// Получаем подготовленный контекст OpenSSL
+			target._ctx = this->prepare(prepare_t::CLIENT, type_t::CLIENT, target._addr->_type, target._addr->_protocol, target._proto);
 			// Если контекст не создан
 			if(target._ctx == nullptr){
-				// Выводим в лог сообщение
-				this->_log->print("Context SSL is not initialization: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-				// Выходим
-				return;
-			}
-			// Устанавливаем опции запроса
-			::SSL_CTX_set_options(target._ctx, SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 | SSL_OP_NO_COMPRESSION);
-			/**
-			 * Если версия OpenSSL соответствует или выше версии 3.0.0
-			 */
-			#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-				// Выполняем установку кривых P-256, P-384 и P-521
-				if(::SSL_CTX_set1_curves_list(target._ctx, "P-521:P-384:P-256") != 1){
-					// Выводим в лог сообщение
-					this->_log->print("Set SSL curves list failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-					// Выходим
-					return;
-				}
-			/**
-			 * Если версия OpenSSL ниже версии 3.0.0
-			 */
-			#else
-				{
-					// Выполняем создание объекта кривой P-256, доступны также (P-384 и P-521) или NID_secp256k1
-					EC_KEY * ecdh = ::EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
-					// Если кривые не получилось установить
-					if(ecdh == nullptr){
-						// Выводим в лог сообщение
-						this->_log->print("Set new SSL curv name failed: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-						// Выходим
-						return;
-					}
-					// Выполняем установку кривых P-256
-					::SSL_CTX_set_tmp_ecdh(target._ctx, ecdh);
-					// Выполняем очистку объекта кривой
-					::EC_KEY_free(ecdh);
-				}
-			#endif
-			/**
-			 * Если протоколом является HTTP, выполняем переключение на него
-			 */
-			switch(static_cast <uint8_t> (target._proto)){
-				// Если протокол соответствует SPDY/1
-				case static_cast <uint8_t> (proto_t::SPDY1):
-				// Если протокол соответствует HTTP/1
-				case static_cast <uint8_t> (proto_t::HTTP1):
-				// Если протокол соответствует HTTP/2
-				case static_cast <uint8_t> (proto_t::HTTP2):
-				// Если протокол соответствует HTTP/3
-				case static_cast <uint8_t> (proto_t::HTTP3):
-				// Если протокол соответствует HTTP/1.1
-				case static_cast <uint8_t> (proto_t::HTTP1_1):
-					// Выполняем переключение протокола подключения
-					this->httpUpgrade(target);
-				break;
-			}
-			// Выполняем инициализацию CA-файла сертификата
-			if(!this->storeCA(target._ctx)){
 				// Очищаем созданный контекст
 				target.clear();
 				// Выходим
 				return;
 			}
-			// Выполняем инициализацию CRL-файла сертификата
-			this->storeCRL(target._ctx);
 			// Если объект CRL-файла сертификата получен
 			if(this->_crl != nullptr)
 				// Выполняем установку объект CRL-файла сертификата
 				target.crl(this->_crl);
-			// Если нужно установить основные алгоритмы шифрования
-			if(!this->_cipher.empty()){
-				// Устанавливаем все основные алгоритмы шифрования
-				if(::SSL_CTX_set_cipher_list(target._ctx, this->_cipher.c_str()) < 1){
-					// Очищаем созданный контекст
-					target.clear();
-					// Выводим в лог сообщение
-					this->_log->print("Set SSL ciphers: %s", log_t::flag_t::CRITICAL, ::ERR_error_string(::ERR_get_error(), nullptr));
-					// Выходим
-					return;
-				}
-			}
-			// Устанавливаем флаг очистки буферов на чтение и запись когда они не требуются
-			::SSL_CTX_set_mode(target._ctx, SSL_MODE_RELEASE_BUFFERS);
-			// Если цепочка сертификатов установлена
-			if(!this->_cert.pem.empty()){
-				// Если цепочка сертификатов не установлена
-				if(::SSL_CTX_use_certificate_file(target._ctx, this->_cert.pem.c_str(), SSL_FILETYPE_PEM) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Certificate cannot be set", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-			}
-			// Если приватный ключ установлен
-			if(!this->_cert.key.empty()){
-				// Если приватный ключ не может быть установлен
-				if(::SSL_CTX_use_PrivateKey_file(target._ctx, this->_cert.key.c_str(), SSL_FILETYPE_PEM) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Private key cannot be set", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-				// Если приватный ключ недействителен
-				if(::SSL_CTX_check_private_key(target._ctx) < 1){
-					// Выводим в лог сообщение
-					this->_log->print("Private key is not valid", log_t::flag_t::CRITICAL);
-					// Очищаем созданный контекст
-					target.clear();
-					// Выходим
-					return;
-				}
-			}
 			// Если нужно произвести проверку
-			if(this->_verify){
+			if(this->_verify)
 				// Создаём объект проверки домена
 				target._verify = std::make_unique <verify_t> (host, this);
-				// Выполняем проверку сертификата
-				::SSL_CTX_set_verify(target._ctx, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, nullptr);
-				// Выполняем проверку всех дочерних сертификатов
-				::SSL_CTX_set_cert_verify_callback(target._ctx, &verifyHost, target._verify.get());
-				// Устанавливаем глубину проверки
-				::SSL_CTX_set_verify_depth(target._ctx, 4);
-			// Запрещаем выполнять првоерку сертификата пользователя
-			} else ::SSL_CTX_set_verify(target._ctx, SSL_VERIFY_NONE, nullptr);
-			// Устанавливаем, что мы должны читать как можно больше входных байтов
-			::SSL_CTX_set_read_ahead(target._ctx, 1);
 			// Создаем SSL объект
 			target._ssl = ::SSL_new(target._ctx);
 			// Если объект не создан
@@ -4456,6 +5506,26 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address, const string & host) no
 				// Выходим
 				return;
 			}
+			// Выполняем установку контекста двигателя для функций обратного вызова
+			SSL_set_app_data(target._ssl, &target);
+			/**
+			 * Если протоколом является HTTP, выполняем переключение на него
+			 */
+			switch(static_cast <uint8_t> (target._proto)){
+				// Если протокол соответствует SPDY/1
+				case static_cast <uint8_t> (proto_t::SPDY1):
+				// Если протокол соответствует HTTP/1
+				case static_cast <uint8_t> (proto_t::HTTP1):
+				// Если протокол соответствует HTTP/2
+				case static_cast <uint8_t> (proto_t::HTTP2):
+				// Если протокол соответствует HTTP/3
+				case static_cast <uint8_t> (proto_t::HTTP3):
+				// Если протокол соответствует HTTP/1.1
+				case static_cast <uint8_t> (proto_t::HTTP1_1):
+					// Выполняем переключение протокола подключения
+					this->httpUpgrade(target);
+				break;
+			}
 			/**
 			 * Если нужно установить TLS расширение
 			 */
@@ -4544,14 +5614,106 @@ void awh::Engine::wrap(ctx_t & target, addr_t * address, const string & host) no
 		}
 	}
 }
+/**
+ * @brief Метод получения сериализованной сессии TLS для последующего возобновления
+ *
+ * @param target контекст подключения
+ * @return       сериализованная сессия TLS
+ */
+vector <uint8_t> awh::Engine::session(const ctx_t & target) const noexcept {
+	// Результат работы функции
+	vector <uint8_t> result;
+	// Если объект SSL создан
+	if(target._ssl != nullptr){
+		// Получаем текущую сессию подключения
+		SSL_SESSION * session = ::SSL_get1_session(target._ssl);
+		// Если сессия получена
+		if(session != nullptr){
+			// Если сессия может быть возобновлена
+			if(::SSL_SESSION_is_resumable(session)){
+				// Получаем размер сериализованной сессии
+				const int32_t size = ::i2d_SSL_SESSION(session, nullptr);
+				// Если размер сессии получен
+				if(size > 0){
+					// Выделяем память для сессии
+					result.resize(static_cast <size_t> (size));
+					// Получаем буфер данных сессии
+					uint8_t * data = result.data();
+					// Выполняем сериализацию сессии
+					::i2d_SSL_SESSION(session, &data);
+				}
+			}
+			// Освобождаем полученную сессию
+			::SSL_SESSION_free(session);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод установки сохранённой сессии TLS для возобновления подключения
+ *
+ * @param target  контекст подключения
+ * @param session сериализованная сессия TLS
+ * @return        результат установки сессии
+ */
+bool awh::Engine::session(ctx_t & target, const vector <uint8_t> & session) const noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Если объект SSL создан и сессия передана
+	if((target._ssl != nullptr) && !session.empty()){
+		// Получаем буфер данных сессии
+		const uint8_t * data = session.data();
+		// Выполняем десериализацию сессии
+		SSL_SESSION * item = ::d2i_SSL_SESSION(nullptr, &data, static_cast <long> (session.size()));
+		// Если сессия получена
+		if(item != nullptr){
+			// Выполняем установку сессии для возобновления
+			result = (::SSL_set_session(target._ssl, item) > 0);
+			// Освобождаем полученную сессию
+			::SSL_SESSION_free(item);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения статистики возобновления сессий TLS
+ *
+ * @return статистика возобновления сессий
+ */
+awh::Engine::resumption_t awh::Engine::resumption() const noexcept {
+	// Результат работы функции
+	resumption_t result;
+	// Если общее хранилище сессий создано
+	if(this->_storage != nullptr){
+		// Получаем количество возобновлённых сессий
+		result.hits = this->_storage->hits.load(std::memory_order_relaxed);
+		// Получаем количество полных рукопожатий
+		result.misses = this->_storage->misses.load(std::memory_order_relaxed);
+	}
+	// Если общее хранилище сессий не создано
+	else {
+		// Получаем количество возобновлённых сессий
+		result.hits = this->_hits.load(std::memory_order_relaxed);
+		// Получаем количество полных рукопожатий
+		result.misses = this->_misses.load(std::memory_order_relaxed);
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод разрешающий или запрещающий, выполнять проверку соответствия, сертификата домену
  *
  * @param mode флаг состояния разрешения проверки
  */
 void awh::Engine::verify(const bool mode) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
 	// Устанавливаем флаг проверки
 	this->_verify = mode;
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
 }
 /**
  * @brief Метод установки алгоритмов шифрования
@@ -4559,6 +5721,8 @@ void awh::Engine::verify(const bool mode) noexcept {
  * @param ciphers список алгоритмов шифрования для установки
  */
 void awh::Engine::ciphers(const vector <string> & ciphers) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
 	// Если список алгоритмов шифрования передан
 	if(!ciphers.empty()){
 		// Очищаем установленный список алгоритмов шифрования
@@ -4573,6 +5737,8 @@ void awh::Engine::ciphers(const vector <string> & ciphers) noexcept {
 			this->_cipher.append(cip);
 		}
 	}
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
 }
 /**
  * @brief Метод установки CRL-файла отозванных сертификатов центром сертификации
@@ -4580,10 +5746,14 @@ void awh::Engine::ciphers(const vector <string> & ciphers) noexcept {
  * @param crl адрес CRL-файла отозванных сертификатов центром сертификации
  */
 void awh::Engine::crl(const string & crl) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
 	// Если адрес CRL-файла передан
 	if(!crl.empty())
 		// Устанавливаем адрес сертификата (CRL-файла)
 		this->_cert.crl = this->_fs.realPath(crl, false);
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
 }
 /**
  * @brief Метод установки сертификата центра сертификации (CA-файла)
@@ -4592,6 +5762,8 @@ void awh::Engine::crl(const string & crl) noexcept {
  * @param path адрес каталога где находится сертификат (CA-файл)
  */
 void awh::Engine::ca(const string & ca, const string & path) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
 	// Если адрес CA-файла передан
 	if(!ca.empty())
 		// Устанавливаем адрес сертификата центра сертификации (CA-файла)
@@ -4604,6 +5776,8 @@ void awh::Engine::ca(const string & ca, const string & path) noexcept {
 		this->_cert.path = this->_fs.realPath(path, false);
 	// Если путь хранения CA-файлов не передан, выполняем очистку ранее установленного
 	else this->_cert.path.clear();
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
 }
 /**
  * @brief Метод установки файлов сертификата
@@ -4612,6 +5786,8 @@ void awh::Engine::ca(const string & ca, const string & path) noexcept {
  * @param key приватный ключ сертификата (если требуется)
  */
 void awh::Engine::certificate(const string & pem, const string & key) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
 	// Если ключ сертификата передан
 	if(!key.empty())
 		// Устанавливаем приватный ключ сертификата
@@ -4624,6 +5800,53 @@ void awh::Engine::certificate(const string & pem, const string & key) noexcept {
 		this->_cert.pem = this->_fs.realPath(pem, false);
 	// Если сертификат не передан, очищаем установленный адрес сертификата
 	else this->_cert.pem.clear();
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
+}
+/**
+ * @brief Метод установки времени жизни сессии TLS
+ *
+ * @param sec время жизни сессии и период ротации ключей билетов в секундах
+ */
+void awh::Engine::lifetime(const uint32_t sec) noexcept {
+	// Если время жизни сессии передано
+	if(sec > 0){
+		// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Устанавливаем время жизни сессии
+		this->_lifetime = sec;
+		// Сбрасываем подготовленные контексты SSL, параметры изменились
+		this->flush();
+	}
+}
+/**
+ * @brief Метод установки допустимых версий протокола TLS
+ *
+ * @param min минимальная версия протокола (TLS1_2_VERSION / TLS1_3_VERSION)
+ * @param max максимальная версия протокола (TLS1_2_VERSION / TLS1_3_VERSION)
+ */
+void awh::Engine::version(const int32_t min, const int32_t max) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Устанавливаем минимальную версию протокола
+	this->_minVersion = min;
+	// Устанавливаем максимальную версию протокола
+	this->_maxVersion = max;
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
+}
+/**
+ * @brief Метод разрешения шифрования на уровне ядра (kTLS)
+ *
+ * @param mode флаг разрешения шифрования на уровне ядра
+ */
+void awh::Engine::ktls(const bool mode) noexcept {
+	// Выполняем блокировку потока, контексты SSL собираются из этих параметров
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Устанавливаем флаг шифрования на уровне ядра
+	this->_ktls = mode;
+	// Сбрасываем подготовленные контексты SSL, параметры изменились
+	this->flush();
 }
 /**
  * @brief Конструктор
@@ -4633,7 +5856,9 @@ void awh::Engine::certificate(const string & pem, const string & key) noexcept {
  * @param uri объект работы с URI
  */
 awh::Engine::Engine(const fmk_t * fmk, const log_t * log, const uri_t * uri) noexcept :
- _verify(true), _fs(fmk, log), _cipher{""}, _crl(nullptr), _fmk(fmk), _uri(uri), _log(log) {
+ _verify(true), _ktls(false), _lifetime(TLS_SESSION_LIFETIME),
+ _minVersion(TLS1_2_VERSION), _maxVersion(TLS1_3_VERSION),
+ _storage(nullptr), _hits{0}, _misses{0}, _fs(fmk, log), _cipher{""}, _crl(nullptr), _fmk(fmk), _uri(uri), _log(log) {
 	/**
 	 * Для операционной системы не являющейся MS Windows
 	 */
@@ -4727,6 +5952,28 @@ awh::Engine::Engine(const fmk_t * fmk, const log_t * log, const uri_t * uri) noe
  *
  */
 awh::Engine::~Engine() noexcept {
+	// Выполняем освобождение подготовленных контекстов SSL
+	this->flush();
+	// Если общее хранилище сессий создано
+	if(this->_storage != nullptr){
+		/**
+		 * Для операционной системы не являющейся MS Windows
+		 */
+		#if !_WIN32 && !_WIN64
+			// Выполняем удаление общего хранилища сессий
+			this->_storage->~storage_t();
+			// Освобождаем разделяемую память
+			::munmap(this->_storage, sizeof(storage_t));
+		/**
+		 * Для операционной системы MS Windows
+		 */
+		#else
+			// Выполняем удаление общего хранилища сессий
+			delete this->_storage;
+		#endif
+		// Зануляем общее хранилище сессий
+		this->_storage = nullptr;
+	}
 	// Если CRL-файл сертификата уже создан
 	if(this->_crl != nullptr)
 		// Выполняем освобождение памяти
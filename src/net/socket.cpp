@@ -218,6 +218,99 @@ bool awh::Socket::reuseable(const SOCKET sock) const noexcept {
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод разрешающий нескольким сокетам слушать один и тот же порт
+ *
+ * @param sock сетевой сокет
+ * @return     результат работы функции
+ */
+bool awh::Socket::reusePort(const SOCKET sock) const noexcept {
+	// Результат работы функции
+	bool result = false;
+	/**
+	 * Для операционной системы Linux
+	 */
+	#if __linux__
+		// Устанавливаем параметр
+		const int32_t on = 1;
+		// Разрешаем ядру распределять подключения между сокетами одного порта
+		if(!(result = !static_cast <bool> (::setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast <const char *> (&on), sizeof(on))))){
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим в лог информацию
+				this->_log->print("Cannot set SO_REUSEPORT option on SOCKET=%d [%s]", log_t::flag_t::WARNING, sock, this->message().c_str());
+			#endif
+		}
+	/**
+	 * Для операционной системы не являющейся MS Windows
+	 */
+	#elif !_WIN32 && !_WIN64
+		// Параметр SO_REUSEPORT уже установлен при разрешении повторного использования сокета
+		result = this->reuseable(sock);
+	/**
+	 * Для операционной системы MS Windows
+	 */
+	#else
+		// Выводим в лог информацию
+		this->_log->print("Option SO_REUSEPORT is not supported on SOCKET=%d", log_t::flag_t::WARNING, sock);
+	#endif
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод установки программы распределения подключений группы SO_REUSEPORT по ядрам процессора
+ *
+ * @param sock  сетевой сокет
+ * @param count количество сокетов в группе
+ * @return      результат работы функции
+ */
+bool awh::Socket::steering(const SOCKET sock, [[maybe_unused]] const uint16_t count) const noexcept {
+	// Результат работы функции
+	bool result = false;
+	/**
+	 * Для операционной системы Linux с поддержкой программ распределения SO_REUSEPORT
+	 */
+	#if __linux__ && defined(SO_ATTACH_REUSEPORT_CBPF)
+		// Если количество сокетов в группе передано
+		if(count > 0){
+			// Программа выбора сокета группы по номеру ядра процессора получившего подключение
+			struct sock_filter code[] = {
+				// Загружаем номер ядра процессора
+				{BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast <uint32_t> (SKF_AD_OFF + SKF_AD_CPU)},
+				// Получаем остаток от деления на количество сокетов в группе
+				{BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast <uint32_t> (count)},
+				// Возвращаем индекс сокета в группе
+				{BPF_RET | BPF_A, 0, 0, 0}
+			};
+			// Создаём объект программы
+			struct sock_fprog program;
+			// Устанавливаем количество инструкций программы
+			program.len = static_cast <uint16_t> (sizeof(code) / sizeof(code[0]));
+			// Устанавливаем инструкции программы
+			program.filter = code;
+			// Устанавливаем программу распределения подключений для всей группы сокетов порта
+			if(!(result = !static_cast <bool> (::setsockopt(sock, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program))))){
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим в лог информацию
+					this->_log->print("Cannot set SO_ATTACH_REUSEPORT_CBPF option on SOCKET=%d [%s]", log_t::flag_t::WARNING, sock, this->message().c_str());
+				#endif
+			}
+		}
+	/**
+	 * Для остальных операционных систем
+	 */
+	#else
+		// Выводим в лог информацию
+		this->_log->print("Option SO_ATTACH_REUSEPORT_CBPF is not supported on SOCKET=%d", log_t::flag_t::WARNING, sock);
+	#endif
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод разрешения закрывать сокет, после запуска
  *
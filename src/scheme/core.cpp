@@ -224,6 +224,8 @@ void awh::Scheme::Broker::events(const mode_t mode, const engine_t::method_t met
 				switch(static_cast <uint8_t> (mode)){
 					// Если установлен сигнал активации сокета
 					case static_cast <uint8_t> (mode_t::ENABLED): {
+						// Снимаем флаг приостановки чтения данных из сокета
+						this->buffer.paused = false;
 						// Выполняем активацию работы события
 						this->_event.mode(base_t::event_type_t::READ, base_t::event_mode_t::ENABLED);
 						// Выполняем активацию события закрытий подключения
@@ -233,6 +235,8 @@ void awh::Scheme::Broker::events(const mode_t mode, const engine_t::method_t met
 					} break;
 					// Если установлен сигнал деактивации сокета
 					case static_cast <uint8_t> (mode_t::DISABLED):
+						// Устанавливаем флаг приостановки чтения данных из сокета
+						this->buffer.paused = true;
 						// Выполняем деактивацию работы события
 						this->_event.mode(base_t::event_type_t::READ, base_t::event_mode_t::DISABLED);
 					break;
@@ -192,6 +192,39 @@ void awh::server::AWH::send(const int32_t sid, const uint64_t bid, const uint32_
 	// Выполняем отправку сообщения клиенту
 	this->_http.send(sid, bid, code, mess, entity, headers);
 }
+/**
+ * @brief Метод отправки ответа, тело которого читается по мере отправки
+ *
+ * @param sid     идентификатор потока HTTP
+ * @param bid     идентификатор брокера
+ * @param code    код сообщения для брокера
+ * @param mess    отправляемое сообщение об ошибке
+ * @param reader  функция чтения очередного фрагмента тела (возвращает количество байт, 0 - конец тела)
+ * @param headers HTTP заголовки сообщения
+ * @return        результат отправки заголовков ответа
+ */
+bool awh::server::AWH::stream(const int32_t sid, const uint64_t bid, const uint32_t code, const string & mess, const scheme::web_t::reader_t & reader, const std::unordered_multimap <string, string> & headers) noexcept {
+	// Выполняем отправку ответа клиенту
+	return this->_http.stream(sid, bid, code, mess, reader, headers);
+}
+/**
+ * @brief Метод приостановки чтения данных клиента
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::AWH::pause(const uint64_t bid) noexcept {
+	// Выполняем приостановку чтения данных клиента
+	this->_http.pause(bid);
+}
+/**
+ * @brief Метод возобновления чтения данных клиента
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::AWH::resume(const uint64_t bid) noexcept {
+	// Выполняем возобновление чтения данных клиента
+	this->_http.resume(bid);
+}
 /**
  * @brief Метод HTTP/2 отправки клиенту сообщения корректного завершения
  *
@@ -214,6 +247,19 @@ bool awh::server::AWH::reject2(const int32_t sid, const uint64_t bid, const awh:
 	// Выполняем сброс подключения
 	return this->_http.reject2(sid, bid, error);
 }
+/**
+ * @brief Метод HTTP/2 установки приоритета потока (RFC 9218)
+ *
+ * @param sid         идентификатор потока
+ * @param bid         идентификатор брокера
+ * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+ * @param incremental флаг инкрементальной обработки ответа
+ * @return            результат установки приоритета
+ */
+bool awh::server::AWH::priority2(const int32_t sid, const uint64_t bid, const uint8_t urgency, const bool incremental) noexcept {
+	// Выполняем установку приоритета потока
+	return this->_http.priority2(sid, bid, urgency, incremental);
+}
 /**
  * @brief Метод HTTP/2 отправки сообщения закрытия всех потоков
  *
@@ -523,6 +569,16 @@ void awh::server::AWH::settings(const std::map <awh::http2_t::settings_t, uint32
 	// Выполняем установку списка настроек протокола HTTP/2
 	this->_http.settings(settings);
 }
+/**
+ * @brief Метод HTTP/2 получения состояния управления потоком сессии
+ *
+ * @param bid идентификатор брокера
+ * @return    размеры окон, время приёма-передачи и оценка BDP
+ */
+awh::http2_t::flow_t awh::server::AWH::flow2(const uint64_t bid) const noexcept {
+	// Выводим состояние управления потоком
+	return this->_http.flow(bid);
+}
 /**
  * @brief Метод установки название сервера
  *
@@ -559,6 +615,15 @@ void awh::server::AWH::maxRequests(const uint32_t max) noexcept {
 	// Выполняем установку максимального количества запросов
 	this->_http.maxRequests(max);
 }
+/**
+ * @brief Метод установки максимальной глубины конвейера запросов
+ *
+ * @param depth максимальное количество запросов ожидающих ответа
+ */
+void awh::server::AWH::pipelineDepth(const uint16_t depth) noexcept {
+	// Выполняем установку максимальной глубины конвейера запросов
+	this->_http.pipelineDepth(depth);
+}
 /**
  * @brief Метод установки долгоживущего подключения
  *
@@ -178,295 +178,578 @@ void awh::server::Http1::readEvents(const char * buffer, const size_t size, cons
 					if(!options->mode && (options->mode = this->_callback.is("stream")))
 						// Выполняем функцию обратного вызова
 						this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::OPEN);
-					/**
-					 * Выполняем обработку полученных данных
-					 */
-					while(!options->close){
-						// Выполняем парсинг полученных данных
-						const size_t bytes = options->http.parse(reinterpret_cast <const char *> (options->buffer.get()), options->buffer.size());
-						// Если все данные получены
-						if((bytes > 0) && options->http.is(http_t::state_t::END)){
-							// Получаем флаг постоянного подключения
-							const bool alive = options->http.is(http_t::state_t::ALIVE);
-							// Если включён режим отладки
-							#if DEBUG_MODE
-								{
-									// Получаем данные запроса
-									const auto & request = options->http.process(http_t::process_t::REQUEST, options->http.request());
-									// Если параметры запроса получены
-									if(!request.empty()){
-										// Выводим заголовок запроса
-										std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ REQUEST ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
-										// Выводим параметры запроса
-										std::cout << string(request.begin(), request.end()) << std::endl << std::endl << std::flush;
-										// Если тело запроса существует
-										if(!options->http.empty(awh::http_t::suite_t::BODY))
-											// Выводим сообщение о выводе чанка тела
-											std::cout << this->_fmk->format("<body %u>", options->http.body().size()) << std::endl << std::endl << std::flush;
-										// Иначе устанавливаем перенос строки
-										else std::cout << std::endl << std::flush;
-									}
-								}
-							#endif
+					// Выполняем обработку конвейера запросов
+					this->pipeline(bid, sid);
+				}
+			}
+		}
+	}
+}
+/**
+ * @brief Метод обработки конвейера запросов накопленных в буфере клиента
+ *
+ * @param bid идентификатор брокера
+ * @param sid идентификатор схемы сети
+ */
+void awh::server::Http1::pipeline(const uint64_t bid, const uint16_t sid) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web_t::options_t * options = const_cast <scheme::web_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены и обработка данных ещё не выполняется
+	if((options != nullptr) && !options->parsing){
+		// Устанавливаем флаг выполнения обработки данных
+		options->parsing = true;
+		/**
+		 * Выполняем обработку полученных данных
+		 */
+		while(!options->close && !options->buffer.empty()){
+			// Если предыдущий запрос ещё ожидает ответа, обработка следующих запросов откладывается
+			if(options->http.is(http_t::state_t::END) || (options->reader != nullptr))
+				// Выходим из цикла
+				break;
+			// Выполняем парсинг полученных данных
+			const size_t bytes = options->http.parse(reinterpret_cast <const char *> (options->buffer.get()), options->buffer.size());
+			// Если все данные получены
+			if((bytes > 0) && options->http.is(http_t::state_t::END)){
+				// Получаем флаг постоянного подключения
+				const bool alive = options->http.is(http_t::state_t::ALIVE);
+				// Если включён режим отладки
+				#if DEBUG_MODE
+					{
+						// Получаем данные запроса
+						const auto & request = options->http.process(http_t::process_t::REQUEST, options->http.request());
+						// Если параметры запроса получены
+						if(!request.empty()){
+							// Выводим заголовок запроса
+							std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ REQUEST ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
+							// Выводим параметры запроса
+							std::cout << string(request.begin(), request.end()) << std::endl << std::endl << std::flush;
+							// Если тело запроса существует
+							if(!options->http.empty(awh::http_t::suite_t::BODY))
+								// Выводим сообщение о выводе чанка тела
+								std::cout << this->_fmk->format("<body %u>", options->http.body().size()) << std::endl << std::endl << std::flush;
+							// Иначе устанавливаем перенос строки
+							else std::cout << std::endl << std::flush;
+						}
+					}
+				#endif
+				/**
+				 * @brief Функция завершения подключения
+				 *
+				 * @param bid идентификатор брокера
+				 */
+				auto rejectFn = [alive, &options, this](const uint64_t bid) noexcept -> void {
+					// Выполняем очистку HTTP-парсера
+					options->http.clear();
+					// Выполняем сброс состояния HTTP-парсера
+					options->http.reset();
+					// Выполняем очистку буфера полученных данных
+					options->buffer.clear();
+					// Сбрасываем количество подсчитанных запросов в буфере
+					options->queued = 0;
+					// Сбрасываем объём данных с подсчитанными запросами
+					options->scanned = 0;
+					// Если подключение установленно не постоянное
+					if(!alive){
+						/**
+						 * Определяем идентичность сервера
+						 */
+						switch(static_cast <uint8_t> (this->_identity)){
+							// Если сервер соответствует HTTP-серверу
+							case static_cast <uint8_t> (http_t::identity_t::HTTP):
+								// Устанавливаем закрытие подключения
+								options->http.header("Connection", "close");
+							break;
+							// Если сервер соответствует PROXY-серверу
+							case static_cast <uint8_t> (http_t::identity_t::PROXY): {
+								// Устанавливаем закрытие подключения
+								options->http.header("Connection", "close");
+								// Устанавливаем закрытие подключения
+								options->http.header("Proxy-Connection", "close");
+							} break;
+						}
+					}
+					// Формируем запрос авторизации
+					const auto & response = options->http.reject(awh::web_t::res_t(static_cast <uint32_t> (505), "Requested protocol is not supported by this server"));
+					// Если ответ получен
+					if(!response.empty()){
+						// Тело полезной нагрузки
+						vector <char> payload;
+						/**
+						 * Если включён режим отладки
+						 */
+						#if DEBUG_MODE
+							// Выводим заголовок ответа
+							std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ RESPONSE ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
+							// Выводим параметры ответа
+							std::cout << string(response.begin(), response.end()) << std::endl << std::endl << std::flush;
+						#endif
+						// Отправляем ответ брокеру
+						const_cast <server::core_t *> (this->_core)->send(response.data(), response.size(), bid);
+						/**
+						 * Получаем тело полезной нагрузки ответа
+						 */
+						while(!(payload = options->http.payload()).empty()){
 							/**
-							 * @brief Функция завершения подключения
-							 *
-							 * @param bid идентификатор брокера
+							 * Если включён режим отладки
 							 */
-							auto rejectFn = [alive, &options, this](const uint64_t bid) noexcept -> void {
-								// Выполняем очистку HTTP-парсера
-								options->http.clear();
-								// Выполняем сброс состояния HTTP-парсера
-								options->http.reset();
-								// Выполняем очистку буфера полученных данных
-								options->buffer.clear();
+							#if DEBUG_MODE
+								// Выводим сообщение о выводе чанка полезной нагрузки
+								std::cout << this->_fmk->format("<chunk %zu>", payload.size()) << std::endl << std::endl << std::flush;
+							#endif
+							// Если тела данных для отправки больше не осталось
+							if(options->http.empty(awh::http_t::suite_t::BODY))
+								// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
+								options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
+							// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+							const auto chunk = std::make_shared <vector <char>> (std::move(payload));
+							// Выполняем отправку тела ответа клиенту
+							const_cast <server::core_t *> (this->_core)->send(chunk->data(), chunk->size(), chunk, bid);
+						}
+					// Выполняем отключение брокера
+					} else const_cast <server::core_t *> (this->_core)->close(bid);
+					// Если функция обратного вызова активности потока установлена
+					if(this->_callback.is("stream"))
+						// Выполняем функцию обратного вызова
+						this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::CLOSE);
+					// Если функция обратного вызова на на вывод ошибок установлена
+					if(this->_callback.is("error"))
+						// Выполняем функцию обратного вызова
+						this->_callback.call <void (const uint64_t, const log_t::flag_t, const http::error_t, const string &)> ("error", bid, log_t::flag_t::CRITICAL, http::error_t::HTTP1_RECV, "Requested protocol is not supported by this server");
+					// Если установлена функция отлова завершения запроса
+					if(this->_callback.is("end"))
+						// Выполняем функцию обратного вызова
+						this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::RECV);
+				};
+				// Если метод CONNECT на сервере запрещён и в данный момент он выполняется
+				if(!this->_methodConnect && (options->http.request().method == awh::web_t::method_t::CONNECT)){
+					// Выполняем закрытие подключения
+					rejectFn(bid);
+					// Завершаем обработку
+					goto Next;
+				}
+				// Если подключение не установлено как постоянное
+				if(!this->_service.alive && !options->alive){
+					// Если количество запросов ограничен
+					if(this->_maxRequests > 0)
+						// Увеличиваем количество выполненных запросов
+						options->requests++;
+					// Если количество выполненных запросов превышает максимальный
+					if(!(options->close = ((this->_maxRequests > 0) && (options->requests >= this->_maxRequests))))
+						// Получаем текущий штамп времени
+						options->respPong = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MILLISECONDS);
+				// Выполняем сброс количества выполненных запросов
+				} else options->requests = 0;
+				// Получаем флаг шифрованных данных
+				options->crypted = options->http.crypted();
+				// Получаем поддерживаемый метод компрессии
+				options->compressor = options->http.compression();
+				/**
+				 * Выполняем проверку авторизации
+				 */
+				switch(static_cast <uint8_t> (options->http.auth())){
+					// Если запрос выполнен удачно
+					case static_cast <uint8_t> (http_t::status_t::GOOD): {
+						// Если сервер соответствует HTTP-серверу
+						if(this->_identity == http_t::identity_t::HTTP){
+							// Если заголовок Upgrade установлен
+							if(options->http.is(http_t::suite_t::HEADER, "upgrade")){
+								// Выполняем извлечение заголовка Upgrade
+								const string & header = options->http.header("upgrade");
+								// Если запрашиваемый протокол соответствует Websocket
+								if(this->_webSocket && this->_fmk->compare(header, "websocket")){
+									// Снимаем приостановку чтения данных конвейером запросов перед сменой протокола
+									this->backlog(bid, true);
+									// Выполняем инициализацию Websocket-сервера
+									this->websocket(bid, sid);
+								// Если протокол запрещён или не поддерживается, выполняем закрытие подключения
+								} else rejectFn(bid);
+								// Завершаем обработку
+								goto Next;
+							}
+						}
+						// Выполняем извлечение параметров запроса
+						const auto & request = options->http.request();
+						// Если функция обратного вызова на получение удачного запроса установлена
+						if(this->_callback.is("handshake"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const agent_t)> ("handshake", 1, bid, agent_t::HTTP);
+						// Если функция обратного вызова на вывод полученного тела сообщения с сервера установлена
+						if(!options->http.empty(awh::http_t::suite_t::BODY) && this->_callback.is("entity"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const awh::web_t::method_t, const uri_t::url_t &, const vector <char> &)> ("entity", 1, bid, request.method, request.url, options->http.body());
+						// Если функция обратного вызова на вывод полученных данных запроса клиента установлена
+						if(this->_callback.is("complete"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const awh::web_t::method_t, const uri_t::url_t &, const vector <char> &, const std::unordered_multimap <string, string> &)> ("complete", 1, bid, request.method, request.url, options->http.body(), options->http.headers());
+						// Если функция обратного вызова активности потока установлена
+						if(this->_callback.is("stream"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::CLOSE);
+						// Если установлена функция отлова завершения запроса
+						if(this->_callback.is("end"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::RECV);
+						// Завершаем обработку
+						goto Next;
+					} break;
+					// Если запрос неудачный
+					case static_cast <uint8_t> (http_t::status_t::FAULT): {
+						// Ответ на запрос об авторизации
+						vector <char> response;
+						// Выполняем очистку HTTP-парсера
+						options->http.clear();
+						// Выполняем сброс состояния HTTP-парсера
+						options->http.reset();
+						// Выполняем очистку буфера полученных данных
+						options->buffer.clear();
+						// Сбрасываем количество подсчитанных запросов в буфере
+						options->queued = 0;
+						// Сбрасываем объём данных с подсчитанными запросами
+						options->scanned = 0;
+						/**
+						 * Определяем идентичность сервера
+						 */
+						switch(static_cast <uint8_t> (this->_identity)){
+							// Если сервер соответствует HTTP-серверу
+							case static_cast <uint8_t> (http_t::identity_t::HTTP): {
+								// Если подключение установленно не постоянное
+								if(!alive)
+									// Устанавливаем закрытие подключения
+									options->http.header("Connection", "close");
+								// Формируем запрос авторизации
+								response = options->http.reject(awh::web_t::res_t(static_cast <uint32_t> (401)));
+							} break;
+							// Если сервер соответствует PROXY-серверу
+							case static_cast <uint8_t> (http_t::identity_t::PROXY): {
 								// Если подключение установленно не постоянное
 								if(!alive){
-									/**
-									 * Определяем идентичность сервера
-									 */
-									switch(static_cast <uint8_t> (this->_identity)){
-										// Если сервер соответствует HTTP-серверу
-										case static_cast <uint8_t> (http_t::identity_t::HTTP):
-											// Устанавливаем закрытие подключения
-											options->http.header("Connection", "close");
-										break;
-										// Если сервер соответствует PROXY-серверу
-										case static_cast <uint8_t> (http_t::identity_t::PROXY): {
-											// Устанавливаем закрытие подключения
-											options->http.header("Connection", "close");
-											// Устанавливаем закрытие подключения
-											options->http.header("Proxy-Connection", "close");
-										} break;
-									}
+									// Устанавливаем закрытие подключения
+									options->http.header("Connection", "close");
+									// Устанавливаем закрытие подключения
+									options->http.header("Proxy-Connection", "close");
 								}
 								// Формируем запрос авторизации
-								const auto & response = options->http.reject(awh::web_t::res_t(static_cast <uint32_t> (505), "Requested protocol is not supported by this server"));
-								// Если ответ получен
-								if(!response.empty()){
-									// Тело полезной нагрузки
-									vector <char> payload;
-									/**
-									 * Если включён режим отладки
-									 */
-									#if DEBUG_MODE
-										// Выводим заголовок ответа
-										std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ RESPONSE ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
-										// Выводим параметры ответа
-										std::cout << string(response.begin(), response.end()) << std::endl << std::endl << std::flush;
-									#endif
-									// Отправляем ответ брокеру
-									const_cast <server::core_t *> (this->_core)->send(response.data(), response.size(), bid);
-									/**
-									 * Получаем тело полезной нагрузки ответа
-									 */
-									while(!(payload = options->http.payload()).empty()){
-										/**
-										 * Если включён режим отладки
-										 */
-										#if DEBUG_MODE
-											// Выводим сообщение о выводе чанка полезной нагрузки
-											std::cout << this->_fmk->format("<chunk %zu>", payload.size()) << std::endl << std::endl << std::flush;
-										#endif
-										// Если тела данных для отправки больше не осталось
-										if(options->http.empty(awh::http_t::suite_t::BODY))
-											// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
-											options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
-										// Выполняем отправку тела ответа клиенту
-										const_cast <server::core_t *> (this->_core)->send(payload.data(), payload.size(), bid);
-									}
-								// Выполняем отключение брокера
-								} else const_cast <server::core_t *> (this->_core)->close(bid);
-								// Если функция обратного вызова активности потока установлена
-								if(this->_callback.is("stream"))
-									// Выполняем функцию обратного вызова
-									this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::CLOSE);
-								// Если функция обратного вызова на на вывод ошибок установлена
-								if(this->_callback.is("error"))
-									// Выполняем функцию обратного вызова
-									this->_callback.call <void (const uint64_t, const log_t::flag_t, const http::error_t, const string &)> ("error", bid, log_t::flag_t::CRITICAL, http::error_t::HTTP1_RECV, "Requested protocol is not supported by this server");
-								// Если установлена функция отлова завершения запроса
-								if(this->_callback.is("end"))
-									// Выполняем функцию обратного вызова
-									this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::RECV);
-							};
-							// Если метод CONNECT на сервере запрещён и в данный момент он выполняется
-							if(!this->_methodConnect && (options->http.request().method == awh::web_t::method_t::CONNECT)){
-								// Выполняем закрытие подключения
-								rejectFn(bid);
-								// Завершаем обработку
-								goto Next;
-							}
-							// Если подключение не установлено как постоянное
-							if(!this->_service.alive && !options->alive){
-								// Если количество запросов ограничен
-								if(this->_maxRequests > 0)
-									// Увеличиваем количество выполненных запросов
-									options->requests++;
-								// Если количество выполненных запросов превышает максимальный
-								if(!(options->close = ((this->_maxRequests > 0) && (options->requests >= this->_maxRequests))))
-									// Получаем текущий штамп времени
-									options->respPong = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MILLISECONDS);
-							// Выполняем сброс количества выполненных запросов
-							} else options->requests = 0;
-							// Получаем флаг шифрованных данных
-							options->crypted = options->http.crypted();
-							// Получаем поддерживаемый метод компрессии
-							options->compressor = options->http.compression();
+								response = options->http.reject(awh::web_t::res_t(static_cast <uint32_t> (407)));
+							} break;
+						}
+						// Если ответ получен
+						if(!response.empty()){
+							// Тело полезной нагрузки
+							vector <char> payload;
+							/**
+							 * Если включён режим отладки
+							 */
+							#if DEBUG_MODE
+								// Выводим заголовок ответа
+								std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ RESPONSE ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
+								// Выводим параметры ответа
+								std::cout << string(response.begin(), response.end()) << std::endl << std::endl << std::flush;
+							#endif
+							// Отправляем ответ брокеру
+							const_cast <server::core_t *> (this->_core)->send(response.data(), response.size(), bid);
 							/**
-							 * Выполняем проверку авторизации
+							 * Получаем данные полезной нагрузки ответа
 							 */
-							switch(static_cast <uint8_t> (options->http.auth())){
-								// Если запрос выполнен удачно
-								case static_cast <uint8_t> (http_t::status_t::GOOD): {
-									// Если сервер соответствует HTTP-серверу
-									if(this->_identity == http_t::identity_t::HTTP){
-										// Если заголовок Upgrade установлен
-										if(options->http.is(http_t::suite_t::HEADER, "upgrade")){
-											// Выполняем извлечение заголовка Upgrade
-											const string & header = options->http.header("upgrade");
-											// Если запрашиваемый протокол соответствует Websocket
-											if(this->_webSocket && this->_fmk->compare(header, "websocket"))
-												// Выполняем инициализацию Websocket-сервера
-												this->websocket(bid, sid);
-											// Если протокол запрещён или не поддерживается, выполняем закрытие подключения
-											else rejectFn(bid);
-											// Завершаем обработку
-											goto Next;
-										}
-									}
-									// Выполняем извлечение параметров запроса
-									const auto & request = options->http.request();
-									// Если функция обратного вызова на получение удачного запроса установлена
-									if(this->_callback.is("handshake"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const agent_t)> ("handshake", 1, bid, agent_t::HTTP);
-									// Если функция обратного вызова на вывод полученного тела сообщения с сервера установлена
-									if(!options->http.empty(awh::http_t::suite_t::BODY) && this->_callback.is("entity"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const awh::web_t::method_t, const uri_t::url_t &, const vector <char> &)> ("entity", 1, bid, request.method, request.url, options->http.body());
-									// Если функция обратного вызова на вывод полученных данных запроса клиента установлена
-									if(this->_callback.is("complete"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const awh::web_t::method_t, const uri_t::url_t &, const vector <char> &, const std::unordered_multimap <string, string> &)> ("complete", 1, bid, request.method, request.url, options->http.body(), options->http.headers());
-									// Если функция обратного вызова активности потока установлена
-									if(this->_callback.is("stream"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::CLOSE);
-									// Если установлена функция отлова завершения запроса
-									if(this->_callback.is("end"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::RECV);
-									// Завершаем обработку
-									goto Next;
-								} break;
-								// Если запрос неудачный
-								case static_cast <uint8_t> (http_t::status_t::FAULT): {
-									// Ответ на запрос об авторизации
-									vector <char> response;
-									// Выполняем очистку HTTP-парсера
-									options->http.clear();
-									// Выполняем сброс состояния HTTP-парсера
-									options->http.reset();
-									// Выполняем очистку буфера полученных данных
-									options->buffer.clear();
-									/**
-									 * Определяем идентичность сервера
-									 */
-									switch(static_cast <uint8_t> (this->_identity)){
-										// Если сервер соответствует HTTP-серверу
-										case static_cast <uint8_t> (http_t::identity_t::HTTP): {
-											// Если подключение установленно не постоянное
-											if(!alive)
-												// Устанавливаем закрытие подключения
-												options->http.header("Connection", "close");
-											// Формируем запрос авторизации
-											response = options->http.reject(awh::web_t::res_t(static_cast <uint32_t> (401)));
-										} break;
-										// Если сервер соответствует PROXY-серверу
-										case static_cast <uint8_t> (http_t::identity_t::PROXY): {
-											// Если подключение установленно не постоянное
-											if(!alive){
-												// Устанавливаем закрытие подключения
-												options->http.header("Connection", "close");
-												// Устанавливаем закрытие подключения
-												options->http.header("Proxy-Connection", "close");
-											}
-											// Формируем запрос авторизации
-											response = options->http.reject(awh::web_t::res_t(static_cast <uint32_t> (407)));
-										} break;
-									}
-									// Если ответ получен
-									if(!response.empty()){
-										// Тело полезной нагрузки
-										vector <char> payload;
-										/**
-										 * Если включён режим отладки
-										 */
-										#if DEBUG_MODE
-											// Выводим заголовок ответа
-											std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ RESPONSE ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
-											// Выводим параметры ответа
-											std::cout << string(response.begin(), response.end()) << std::endl << std::endl << std::flush;
-										#endif
-										// Отправляем ответ брокеру
-										const_cast <server::core_t *> (this->_core)->send(response.data(), response.size(), bid);
-										/**
-										 * Получаем данные полезной нагрузки ответа
-										 */
-										while(!(payload = options->http.payload()).empty()){
-											/**
-											 * Если включён режим отладки
-											 */
-											#if DEBUG_MODE
-												// Выводим сообщение о выводе чанка полезной нагрузки
-												std::cout << this->_fmk->format("<chunk %zu>", payload.size()) << std::endl << std::endl << std::flush;
-											#endif
-											// Если тела данных для отправки больше не осталось
-											if(options->http.empty(awh::http_t::suite_t::BODY))
-												// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
-												options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
-											// Отправляем тело ответа клиенту
-											const_cast <server::core_t *> (this->_core)->send(payload.data(), payload.size(), bid);
-										}
-									// Выполняем отключение брокера
-									} else const_cast <server::core_t *> (this->_core)->close(bid);
-									// Если функция обратного вызова активности потока установлена
-									if(this->_callback.is("stream"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::CLOSE);
-									// Если функция обратного вызова на на вывод ошибок установлена
-									if(this->_callback.is("error"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const uint64_t, const log_t::flag_t, const http::error_t, const string &)> ("error", bid, log_t::flag_t::CRITICAL, http::error_t::HTTP1_RECV, "authorization failed");
-									// Если установлена функция отлова завершения запроса
-									if(this->_callback.is("end"))
-										// Выполняем функцию обратного вызова
-										this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::RECV);
-									// Выходим из функции
-									return;
-								}
+							while(!(payload = options->http.payload()).empty()){
+								/**
+								 * Если включён режим отладки
+								 */
+								#if DEBUG_MODE
+									// Выводим сообщение о выводе чанка полезной нагрузки
+									std::cout << this->_fmk->format("<chunk %zu>", payload.size()) << std::endl << std::endl << std::flush;
+								#endif
+								// Если тела данных для отправки больше не осталось
+								if(options->http.empty(awh::http_t::suite_t::BODY))
+									// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
+									options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
+								// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+								const auto chunk = std::make_shared <vector <char>> (std::move(payload));
+								// Отправляем тело ответа клиенту
+								const_cast <server::core_t *> (this->_core)->send(chunk->data(), chunk->size(), chunk, bid);
 							}
-						}
-						// Устанавливаем метку продолжения обработки пайплайна
-						Next:
-						// Если парсер обработал какое-то количество байт
-						if((bytes > 0) && !options->buffer.empty()){
-							// Если размер буфера больше количества удаляемых байт
-							if(options->buffer.size() >= bytes)
-								// Удаляем количество обработанных байт
-								options->buffer.erase(bytes);
-							// Если байт в буфере меньше, просто очищаем буфер
-							else options->buffer.clear();
-							// Если данных для обработки не осталось, выходим
-							if(options->buffer.empty())
-								// Выходим из цикла
-								break;
-						// Если данных для обработки недостаточно, выходим
-						} else break;
+						// Выполняем отключение брокера
+						} else const_cast <server::core_t *> (this->_core)->close(bid);
+						// Если функция обратного вызова активности потока установлена
+						if(this->_callback.is("stream"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const mode_t)> ("stream", 1, bid, mode_t::CLOSE);
+						// Если функция обратного вызова на на вывод ошибок установлена
+						if(this->_callback.is("error"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const uint64_t, const log_t::flag_t, const http::error_t, const string &)> ("error", bid, log_t::flag_t::CRITICAL, http::error_t::HTTP1_RECV, "authorization failed");
+						// Если установлена функция отлова завершения запроса
+						if(this->_callback.is("end"))
+							// Выполняем функцию обратного вызова
+							this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::RECV);
+						// Завершаем обработку конвейера
+						goto Stop;
 					}
 				}
 			}
+			// Устанавливаем метку продолжения обработки пайплайна
+			Next:
+			// Если парсер обработал какое-то количество байт
+			if((bytes > 0) && !options->buffer.empty()){
+				// Если обработанный запрос уже был подсчитан в буфере (подсчитанные запросы всегда находятся в начале буфера)
+				if((options->queued > 0) && (options->scanned >= bytes)){
+					// Уменьшаем количество подсчитанных запросов в буфере
+					options->queued--;
+					// Уменьшаем объём данных с подсчитанными запросами
+					options->scanned -= bytes;
+				// Иначе подсчёт запросов в буфере выполняется заново
+				} else {
+					// Сбрасываем количество подсчитанных запросов в буфере
+					options->queued = 0;
+					// Сбрасываем объём данных с подсчитанными запросами
+					options->scanned = 0;
+				}
+				// Если размер буфера больше количества удаляемых байт
+				if(options->buffer.size() >= bytes)
+					// Удаляем количество обработанных байт
+					options->buffer.erase(bytes);
+				// Если байт в буфере меньше, просто очищаем буфер
+				else options->buffer.clear();
+				// Если данных для обработки не осталось, выходим
+				if(options->buffer.empty())
+					// Выходим из цикла
+					break;
+			// Если данных для обработки недостаточно, выходим
+			} else break;
+		}
+		// Устанавливаем метку завершения обработки конвейера
+		Stop:
+		// Снимаем флаг выполнения обработки данных
+		options->parsing = false;
+		// Выполняем контроль глубины конвейера запросов
+		this->backlog(bid, false);
+	}
+}
+/**
+ * @brief Метод контроля глубины конвейера запросов ожидающих ответа
+ *
+ * @param bid     идентификатор брокера
+ * @param release флаг снятия приостановки чтения (подключение переходит на другой протокол)
+ */
+void awh::server::Http1::backlog(const uint64_t bid, const bool release) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web_t::options_t * options = const_cast <scheme::web_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены
+	if((this->_core != nullptr) && (options != nullptr)){
+		// Если подключение переходит на другой протокол
+		if(release){
+			// Сбрасываем количество подсчитанных запросов в буфере
+			options->queued = 0;
+			// Сбрасываем объём данных с подсчитанными запросами
+			options->scanned = 0;
+		}
+		// Получаем флаг ожидания ответа на обрабатываемый запрос
+		const bool awaiting = (!release && !options->close && (options->http.is(http_t::state_t::END) || (options->reader != nullptr)));
+		// Если запрос ожидает ответа
+		if(awaiting){
+			/**
+			 * Выполняем подсчёт полностью полученных запросов, накопленных в буфере за обрабатываемым запросом
+			 */
+			while((this->_pipelineDepth > 0) && (options->scanned < options->buffer.size()) && ((options->queued + 1) < this->_pipelineDepth)){
+				// Выполняем парсинг очередного запроса в буфере
+				const size_t bytes = options->probe.parse(reinterpret_cast <const char *> (options->buffer.get()) + options->scanned, options->buffer.size() - options->scanned);
+				// Получаем флаг полностью полученного запроса
+				const bool complete = ((bytes > 0) && options->probe.isEnd());
+				// Выполняем очистку парсера подсчёта запросов
+				options->probe.clear();
+				// Выполняем сброс состояния парсера подсчёта запросов
+				options->probe.reset();
+				// Если запрос получен не полностью
+				if(!complete)
+					// Выходим из цикла
+					break;
+				// Увеличиваем количество подсчитанных запросов в буфере
+				options->queued++;
+				// Увеличиваем объём данных с подсчитанными запросами
+				options->scanned += bytes;
+			}
+		}
+		// Получаем флаг достижения глубины конвейера или предельного объёма буфера
+		const bool full = (awaiting && (((this->_pipelineDepth > 0) && ((options->queued + 1) >= this->_pipelineDepth)) || (options->buffer.size() >= SERVER_PIPELINE_SIZE)));
+		// Если глубина конвейера достигнута, а чтение данных ещё не приостановлено
+		if(full && !options->paused){
+			// Устанавливаем флаг приостановки чтения данных конвейером запросов
+			options->paused = true;
+			// Если чтение данных не приостановлено приложением
+			if(!options->suspended)
+				// Выполняем отключение ожидания входящих данных до отправки ответа
+				const_cast <server::core_t *> (this->_core)->events(bid, awh::scheme_t::mode_t::DISABLED, engine_t::method_t::READ);
+		// Если чтение данных было приостановлено, а очередь запросов опустилась ниже глубины конвейера
+		} else if(!full && options->paused) {
+			// Снимаем флаг приостановки чтения данных конвейером запросов
+			options->paused = false;
+			// Если чтение данных не приостановлено приложением
+			if(!options->suspended)
+				// Выполняем включение ожидания входящих данных
+				const_cast <server::core_t *> (this->_core)->events(bid, awh::scheme_t::mode_t::ENABLED, engine_t::method_t::READ);
+		}
+	}
+}
+/**
+ * @brief Метод чтения и отправки очередного фрагмента тела ответа
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::Http1::pulling(const uint64_t bid) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web_t::options_t * options = const_cast <scheme::web_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены и функция чтения тела ответа установлена
+	if((options != nullptr) && (options->reader != nullptr)){
+		// Если фрагмент уже отправляется, следующий фрагмент будет прочитан после завершения отправки
+		if(options->pulling)
+			// Устанавливаем флаг ожидания следующего фрагмента
+			options->pending = true;
+		// Выполняем чтение фрагмента тела ответа
+		else {
+			// Устанавливаем флаг выполнения чтения тела ответа
+			options->pulling = true;
+			/**
+			 * Выполняем чтение фрагментов пока сокет готов принимать данные
+			 */
+			do {
+				// Размер прочитанного фрагмента
+				size_t size = 0;
+				// Снимаем флаг ожидания следующего фрагмента
+				options->pending = false;
+				// Если тело ответа ещё не передано целиком
+				if(options->chunked || (options->length > 0)){
+					// Размер заголовка чанка (размер в шестнадцатеричном виде и перенос строки)
+					const size_t head = (options->chunked ? 18 : 0);
+					// Получаем максимальный размер читаемого фрагмента
+					const size_t max = (options->chunked ? this->_chunkSize : static_cast <size_t> (std::min(static_cast <uint64_t> (this->_chunkSize), options->length)));
+					// Размер данных фрагмента для отправки
+					size_t actual = 0;
+					// Буфер фрагмента, владение которым передаётся в очередь отправки без копирования
+					std::shared_ptr <vector <char>> chunk = nullptr;
+					// Если тело ответа сжимается по мере чтения
+					if(options->http.compression() != http_t::compressor_t::NONE){
+						// Буфер прочитанных несжатых данных
+						static thread_local vector <char> LocalBody;
+						// Выделяем память для чтения фрагмента
+						LocalBody.resize(max);
+						// Выполняем чтение очередного фрагмента тела ответа
+						if((size = std::min(options->reader(LocalBody.data(), max), max)) > 0){
+							// Создаём буфер фрагмента с местом под заголовок чанка
+							chunk = std::make_shared <vector <char>> (head);
+							// Выполняем компрессию фрагмента со сбросом, чтобы клиент мог распаковать его сразу
+							if(!options->codec.write(LocalBody.data(), size, (* chunk)) || !options->codec.flush((* chunk))){
+								// Снимаем функцию чтения тела ответа
+								options->reader = nullptr;
+								// Устанавливаем флаг закрытия подключения
+								options->close = true;
+								// Выполняем отключение клиента, так как тело ответа не может быть сжато
+								const_cast <server::core_t *> (this->_core)->close(bid);
+								// Выходим из функции
+								return;
+							}
+							// Получаем размер сжатых данных
+							actual = (chunk->size() - head);
+							// Добавляем место под завершение чанка
+							chunk->resize(chunk->size() + 2);
+							// Если компрессор накопил данные без вывода, сразу читаем следующий фрагмент
+							if(actual == 0)
+								// Устанавливаем флаг ожидания следующего фрагмента
+								options->pending = true;
+						}
+					// Если тело ответа передаётся без компрессии
+					} else {
+						// Создаём буфер фрагмента
+						chunk = std::make_shared <vector <char>> (head + max + 2);
+						// Выполняем чтение очередного фрагмента тела ответа
+						actual = size = std::min(options->reader(chunk->data() + head, max), max);
+					}
+					// Если данные фрагмента получены
+					if(actual > 0){
+						// Смещение начала отправляемых данных
+						size_t offset = head;
+						// Размер отправляемых данных
+						size_t bytes = actual;
+						// Если тело передаётся чанками
+						if(options->chunked){
+							// Получаем размер чанка в шестнадцатеричном виде
+							const string & length = this->_fmk->format("%zx\r\n", actual);
+							// Смещаем начало данных на размер заголовка чанка
+							offset -= length.size();
+							// Выполняем копирование заголовка чанка перед данными
+							::memcpy(chunk->data() + offset, length.data(), length.size());
+							// Добавляем завершение чанка
+							::memcpy(chunk->data() + head + actual, "\r\n", 2);
+							// Увеличиваем размер отправляемых данных
+							bytes += (length.size() + 2);
+						// Если тело ответа передано целиком
+						} else if((options->length -= size) == 0)
+							// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
+							options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
+						/**
+						 * Если включён режим отладки
+						 */
+						#if DEBUG_MODE
+							// Выводим сообщение о выводе чанка полезной нагрузки
+							std::cout << this->_fmk->format("<chunk %zu>", actual) << std::endl << std::endl << std::flush;
+						#endif
+						// Выполняем отправку фрагмента тела ответа клиенту
+						const_cast <server::core_t *> (this->_core)->send(chunk->data() + offset, bytes, chunk, bid);
+					}
+				}
+				// Если тело ответа передано целиком
+				if(size == 0){
+					// Снимаем функцию чтения тела ответа
+					options->reader = nullptr;
+					// Восстанавливаем флаг шифрования
+					options->http.encryption(this->_encryption.mode);
+					// Если функция чтения вернула меньше данных чем указано в размере тела
+					if(!options->chunked && (options->length > 0)){
+						// Устанавливаем флаг закрытия подключения
+						options->close = true;
+						// Выполняем отключение клиента, так как тело ответа передано не полностью
+						const_cast <server::core_t *> (this->_core)->close(bid);
+						// Выходим из функции
+						return;
+					}
+					// Если тело передаётся чанками
+					if(options->chunked){
+						// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
+						options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
+						// Если тело ответа сжималось по мере чтения
+						if(options->http.compression() != http_t::compressor_t::NONE){
+							// Завершающие данные компрессора
+							vector <char> tail;
+							// Выполняем завершение потока компрессора
+							options->codec.finish(tail);
+							// Если компрессор вернул завершающие данные
+							if(!tail.empty()){
+								// Получаем размер чанка в шестнадцатеричном виде
+								const string & length = this->_fmk->format("%zx\r\n", tail.size());
+								// Добавляем заголовок чанка
+								tail.insert(tail.begin(), length.begin(), length.end());
+								// Добавляем завершение чанка
+								tail.insert(tail.end(), {'\r', '\n'});
+								// Выполняем отправку последнего чанка сжатых данных
+								const_cast <server::core_t *> (this->_core)->send(tail.data(), tail.size(), bid);
+							}
+						}
+						// Выполняем отправку завершающего чанка
+						const_cast <server::core_t *> (this->_core)->send("0\r\n\r\n", 5, bid);
+					}
+					// Если установлена функция отлова завершения запроса
+					if(this->_callback.is("end"))
+						// Выполняем функцию обратного вызова
+						this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::SEND);
+					// Если подключение остаётся открытым, а в буфере остались конвейерные запросы
+					if(!options->stopped && !options->buffer.empty())
+						// Выполняем обработку следующих запросов конвейера
+						this->pipeline(bid, this->_core->sid(bid));
+					// Иначе возобновляем чтение данных приостановленное конвейером запросов
+					else this->backlog(bid, false);
+				}
+			// Продолжаем пока сокет запрашивает следующий фрагмент
+			} while(options->pending && (options->reader != nullptr));
+			// Снимаем флаг выполнения чтения тела ответа
+			options->pulling = false;
 		}
 	}
 }
@@ -499,7 +782,9 @@ void awh::server::Http1::writeEvents(const char * buffer, const size_t size, con
 					options->close = !options->close;
 					// Принудительно выполняем отключение лкиента
 					const_cast <server::core_t *> (this->_core)->close(bid);
-				}
+				} else if(options->reader != nullptr)
+					// Выполняем отправку следующего фрагмента тела ответа
+					this->pulling(bid);
 			}
 		}
 	}
@@ -755,8 +1040,10 @@ void awh::server::Http1::websocket(const uint64_t bid, const uint16_t sid) noexc
 						if(web->http.empty(awh::http_t::suite_t::BODY))
 							// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
 							options->stopped = (!this->_service.alive && !web->alive && !web->http.is(http_t::state_t::ALIVE));
+						// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+						const auto chunk = std::make_shared <vector <char>> (std::move(payload));
 						// Выполняем отправку ответа клиенту
-						const_cast <server::core_t *> (this->_core)->send(payload.data(), payload.size(), bid);
+						const_cast <server::core_t *> (this->_core)->send(chunk->data(), chunk->size(), chunk, bid);
 					}
 					// Если получение данных нужно остановить
 					if(options->stopped)
@@ -1198,6 +1485,8 @@ int32_t awh::server::Http1::send(const uint64_t bid, const uint32_t code, const
 			if(options != nullptr){
 				// Выполняем сброс состояния HTTP-парсера
 				options->http.reset();
+				// Возобновляем чтение данных приостановленное конвейером запросов
+				this->backlog(bid, false);
 				// Выполняем очистку заголовков
 				options->http.clear(http_t::suite_t::HEADER);
 				// Устанавливаем заголовоки запроса
@@ -1259,10 +1548,19 @@ void awh::server::Http1::send(const uint64_t bid, const uint32_t code, const str
 				vector <char> payload;
 				// Получаем флаг постоянного подключения
 				const bool alive = options->http.is(http_t::state_t::ALIVE);
+				// Получаем флаг полностью полученного запроса
+				const bool complete = options->http.is(http_t::state_t::END);
 				// Выполняем сброс состояния HTTP-парсера
 				options->http.reset();
-				// Выполняем очистку буфера полученных данных
-				options->buffer.clear();
+				// Если ответ отправляется до получения запроса целиком, необработанные данные запроса больше не нужны
+				if(!complete){
+					// Выполняем очистку буфера полученных данных
+					options->buffer.clear();
+					// Сбрасываем количество подсчитанных запросов в буфере
+					options->queued = 0;
+					// Сбрасываем объём данных с подсчитанными запросами
+					options->scanned = 0;
+				}
 				// Выполняем очистку данных тела
 				options->http.clear(http_t::suite_t::BODY);
 				// Выполняем очистку заголовков
@@ -1331,8 +1629,10 @@ void awh::server::Http1::send(const uint64_t bid, const uint32_t code, const str
 						if(options->http.empty(awh::http_t::suite_t::BODY) && (options->http.trailers() == 0))
 							// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
 							options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
+						// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+						const auto chunk = std::make_shared <vector <char>> (std::move(payload));
 						// Отправляем тело ответа клиенту
-						const_cast <server::core_t *> (this->_core)->send(payload.data(), payload.size(), bid);
+						const_cast <server::core_t *> (this->_core)->send(chunk->data(), chunk->size(), chunk, bid);
 					}
 					// Если список трейлеров установлен
 					if(options->http.trailers() > 0){
@@ -1374,6 +1674,12 @@ void awh::server::Http1::send(const uint64_t bid, const uint32_t code, const str
 						// Выполняем функцию обратного вызова
 						this->_callback.call <void (const int32_t, const uint64_t, const direct_t)> ("end", 1, bid, direct_t::SEND);
 				}
+				// Если подключение остаётся открытым, а в буфере остались конвейерные запросы
+				if(!options->stopped && !options->buffer.empty())
+					// Выполняем обработку следующих запросов конвейера
+					this->pipeline(bid, this->_core->sid(bid));
+				// Иначе возобновляем чтение данных приостановленное конвейером запросов
+				else this->backlog(bid, false);
 			}
 		}
 	}
@@ -1398,6 +1704,213 @@ void awh::server::Http1::send(const uint64_t bid, const uint32_t code, const str
 		else this->send(bid, code, mess, nullptr, 0, headers);
 	}
 }
+/**
+ * @brief Метод отправки ответа, тело которого читается по мере отправки
+ *
+ * @param bid     идентификатор брокера
+ * @param code    код сообщения для брокера
+ * @param mess    отправляемое сообщение об ошибке
+ * @param reader  функция чтения очередного фрагмента тела (возвращает количество байт, 0 - конец тела)
+ * @param headers HTTP заголовки сообщения
+ * @return        результат отправки заголовков ответа
+ */
+bool awh::server::Http1::stream(const uint64_t bid, const uint32_t code, const string & mess, const scheme::web_t::reader_t & reader, const std::unordered_multimap <string, string> & headers) noexcept {
+	// Результат работы функции
+	bool result = false;
+	// Если подключение выполнено и функция чтения тела передана
+	if((this->_core != nullptr) && this->_core->working() && (reader != nullptr)){
+		// Выполняем поиск агента которому соответствует клиент
+		auto i = this->_agents.find(bid);
+		// Если агент соответствует HTTP-протоколу
+		if((i == this->_agents.end()) || (i->second == agent_t::HTTP)){
+			// Получаем параметры активного клиента
+			scheme::web_t::options_t * options = const_cast <scheme::web_t::options_t *> (this->_scheme.get(bid));
+			// Если параметры активного клиента получены и предыдущий ответ уже отправлен
+			if((options != nullptr) && (options->reader == nullptr)){
+				// Размер тела ответа
+				uint64_t length = 0;
+				// Флаг переданного размера тела ответа
+				bool known = false;
+				// Выполняем перебор всех заголовков ответа
+				for(auto & header : headers){
+					// Если заголовок соответствует размеру тела
+					if((known = this->_fmk->compare(header.first, "content-length"))){
+						/**
+						 * Выполняем отлов ошибок
+						 */
+						try {
+							// Получаем размер тела ответа
+							length = static_cast <uint64_t> (::stoull(header.second));
+						/**
+						 * Если возникает ошибка
+						 */
+						} catch(const exception &) {
+							// Сбрасываем размер тела ответа
+							length = 0;
+						}
+						// Выходим из цикла
+						break;
+					}
+				}
+				// Если клиент не поддерживает передачу чанками, а размер тела заранее не известен
+				if(!known && (options->http.request().version < 1.1)){
+					// Тело ответа
+					vector <char> entity;
+					// Буфер фрагмента тела ответа
+					vector <char> buffer(this->_chunkSize, 0);
+					// Размер прочитанного фрагмента
+					size_t size = 0;
+					// Выполняем чтение всего тела ответа
+					while((size = std::min(reader(buffer.data(), buffer.size()), buffer.size())) > 0)
+						// Добавляем фрагмент в тело ответа
+						entity.insert(entity.end(), buffer.begin(), buffer.begin() + size);
+					// Выполняем отправку ответа целиком, окончание тела определяется закрытием подключения
+					this->send(bid, code, mess, entity, headers);
+					// Выводим результат
+					return true;
+				}
+				// Получаем флаг постоянного подключения
+				const bool alive = options->http.is(http_t::state_t::ALIVE);
+				// Получаем флаг полностью полученного запроса
+				const bool complete = options->http.is(http_t::state_t::END);
+				// Выполняем сброс состояния HTTP-парсера
+				options->http.reset();
+				// Если ответ отправляется до получения запроса целиком, необработанные данные запроса больше не нужны
+				if(!complete){
+					// Выполняем очистку буфера полученных данных
+					options->buffer.clear();
+					// Сбрасываем количество подсчитанных запросов в буфере
+					options->queued = 0;
+					// Сбрасываем объём данных с подсчитанными запросами
+					options->scanned = 0;
+				}
+				// Выполняем очистку данных тела
+				options->http.clear(http_t::suite_t::BODY);
+				// Выполняем очистку заголовков
+				options->http.clear(http_t::suite_t::HEADER);
+				// Устанавливаем заголовки ответа
+				options->http.headers(headers);
+				// Получаем выбранный метод компрессии тела ответа
+				const http_t::compressor_t compressor = options->http.compression();
+				// Если размер тела известен, он относится к несжатым данным, а LZ4 в HTTP передаётся одним блоком, несовместимым с потоковым фреймом
+				if(known || (compressor == http_t::compressor_t::LZ4) || (compressor == http_t::compressor_t::NONE) ||
+				   !options->codec.init(static_cast <hash_t::method_t> (compressor), hash_t::event_t::ENCODE))
+					// Фрагменты тела отправляются без компрессии
+					options->http.compression(http_t::compressor_t::NONE);
+				// Шифрование применяется только к телу собранному целиком
+				options->http.encryption(false);
+				// Если подключение установленно не постоянное
+				if(!alive){
+					/**
+					 * Определяем идентичность сервера
+					 */
+					switch(static_cast <uint8_t> (this->_identity)){
+						// Если сервер соответствует HTTP-серверу
+						case static_cast <uint8_t> (http_t::identity_t::HTTP): {
+							// Если заголовок подключения не переопределён
+							if(!options->http.is(http_t::suite_t::HEADER, "Connection"))
+								// Устанавливаем закрытие подключения
+								options->http.header("Connection", "close");
+						} break;
+						// Если сервер соответствует PROXY-серверу
+						case static_cast <uint8_t> (http_t::identity_t::PROXY): {
+							// Если заголовок подключения не переопределён
+							if(!options->http.is(http_t::suite_t::HEADER, "Proxy-Connection"))
+								// Устанавливаем закрытие подключения
+								options->http.header("Proxy-Connection", "close");
+						} break;
+					}
+				}
+				// Если сообщение ответа не установлено
+				if(mess.empty())
+					// Выполняем установку сообщения по умолчанию
+					const_cast <string &> (mess) = options->http.message(code);
+				// Формируем заголовки ответа
+				vector <char> response = options->http.process(http_t::process_t::RESPONSE, awh::web_t::res_t(static_cast <uint32_t> (code), mess));
+				// Если заголовки ответа получены
+				if((result = (response.size() > 2))){
+					// Если код ответа не предусматривает тела ответа
+					if((code < 200) || (code == 204) || (code == 304)){
+						// Сбрасываем размер тела ответа
+						length = 0;
+						// Тело ответа не передаётся
+						known = true;
+					}
+					// Устанавливаем размер непереданного тела ответа
+					options->length = length;
+					// Устанавливаем функцию чтения тела ответа
+					options->reader = reader;
+					// Если размер тела заранее не известен, тело передаётся чанками
+					if((options->chunked = !known)){
+						// Заголовок передачи тела чанками
+						const string header = "Transfer-Encoding: chunked\r\n";
+						// Получаем значение заголовка передачи тела чанками
+						const string_view value(header.data() + 19, header.size() - 19);
+						// Если передача чанками не была объявлена вместе с методом компрессии (Transfer-Encoding: gzip, chunked)
+						if(std::search(response.begin(), response.end(), value.begin(), value.end()) == response.end())
+							// Добавляем заголовок перед завершающим разделителем заголовков
+							response.insert(response.end() - 2, header.begin(), header.end());
+					// Если тело ответа отсутствует
+					} else if(options->length == 0)
+						// Если подключение не установлено как постоянное, устанавливаем флаг завершения работы
+						options->stopped = (!this->_service.alive && !options->alive && !options->http.is(http_t::state_t::ALIVE));
+					/**
+					 * Если включён режим отладки
+					 */
+					#if DEBUG_MODE
+						// Выводим заголовок ответа
+						std::cout << "\x1B[33m\x1B[1m^^^^^^^^^ RESPONSE ^^^^^^^^^\x1B[0m" << std::endl << std::flush;
+						// Выводим параметры ответа
+						std::cout << string(response.begin(), response.end()) << std::endl << std::endl << std::flush;
+					#endif
+					// Отправляем заголовки ответа клиенту
+					const_cast <server::core_t *> (this->_core)->send(response.data(), response.size(), bid);
+					// Выполняем отправку первого фрагмента тела ответа
+					this->pulling(bid);
+				// Восстанавливаем флаг шифрования
+				} else options->http.encryption(this->_encryption.mode);
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод приостановки чтения данных клиента
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::Http1::pause(const uint64_t bid) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web_t::options_t * options = const_cast <scheme::web_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены и чтение данных ещё не приостановлено
+	if((this->_core != nullptr) && (options != nullptr) && !options->suspended){
+		// Устанавливаем флаг приостановки чтения данных приложением
+		options->suspended = true;
+		// Если чтение данных не приостановлено конвейером запросов
+		if(!options->paused)
+			// Выполняем отключение ожидания входящих данных
+			const_cast <server::core_t *> (this->_core)->events(bid, awh::scheme_t::mode_t::DISABLED, engine_t::method_t::READ);
+	}
+}
+/**
+ * @brief Метод возобновления чтения данных клиента
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::Http1::resume(const uint64_t bid) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web_t::options_t * options = const_cast <scheme::web_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены и чтение данных приостановлено
+	if((this->_core != nullptr) && (options != nullptr) && options->suspended){
+		// Снимаем флаг приостановки чтения данных приложением
+		options->suspended = false;
+		// Если чтение данных не приостановлено конвейером запросов
+		if(!options->paused)
+			// Выполняем включение ожидания входящих данных
+			const_cast <server::core_t *> (this->_core)->events(bid, awh::scheme_t::mode_t::ENABLED, engine_t::method_t::READ);
+	}
+}
 /**
  * @brief Метод установки функций обратного вызова
  *
@@ -1697,6 +2210,8 @@ void awh::server::Http1::mode(const std::set <flag_t> & flags) noexcept {
 	this->_complete = (flags.find(flag_t::NOT_STOP) == flags.end());
 	// Устанавливаем флаг поддержания автоматического подключения
 	this->_scheme.alive = (flags.find(flag_t::ALIVE) != flags.end());
+	// Устанавливаем флаг потоковой передачи тела запроса
+	this->_streaming = (flags.find(flag_t::STREAM_BODY_ENABLE) != flags.end());
 	// Устанавливаем флаг разрешающий выполнять подключение к протоколу Websocket
 	this->_webSocket = (flags.find(flag_t::WEBSOCKET_ENABLE) != flags.end());
 	// Устанавливаем флаг разрешающий выполнять метод CONNECT для сервера
@@ -1811,6 +2326,15 @@ void awh::server::Http1::maxRequests(const uint32_t max) noexcept {
 	// Устанавливаем максимальное количество запросов
 	this->_maxRequests = max;
 }
+/**
+ * @brief Метод установки максимальной глубины конвейера запросов
+ *
+ * @param depth максимальное количество запросов ожидающих ответа
+ */
+void awh::server::Http1::pipelineDepth(const uint16_t depth) noexcept {
+	// Устанавливаем максимальную глубину конвейера запросов
+	this->_pipelineDepth = depth;
+}
 /**
  * @brief Метод получения флага шифрования
  *
@@ -1878,7 +2402,7 @@ void awh::server::Http1::encryption(const string & pass, const string & salt, co
  */
 awh::server::Http1::Http1(const fmk_t * fmk, const log_t * log) noexcept :
  web_t(fmk, log), _webSocket(false), _methodConnect(false),
- _maxRequests(SERVER_MAX_REQUESTS), _identity(http_t::identity_t::HTTP), _ws1(fmk, log), _scheme(fmk, log) {}
+ _maxRequests(SERVER_MAX_REQUESTS), _pipelineDepth(SERVER_PIPELINE_DEPTH), _identity(http_t::identity_t::HTTP), _ws1(fmk, log), _scheme(fmk, log) {}
 /**
  * @brief Конструктор
  *
@@ -1888,7 +2412,7 @@ awh::server::Http1::Http1(const fmk_t * fmk, const log_t * log) noexcept :
  */
 awh::server::Http1::Http1(const server::core_t * core, const fmk_t * fmk, const log_t * log) noexcept :
  web_t(core, fmk, log), _webSocket(false), _methodConnect(false),
- _maxRequests(SERVER_MAX_REQUESTS), _identity(http_t::identity_t::HTTP), _ws1(fmk, log), _scheme(fmk, log) {
+ _maxRequests(SERVER_MAX_REQUESTS), _pipelineDepth(SERVER_PIPELINE_DEPTH), _identity(http_t::identity_t::HTTP), _ws1(fmk, log), _scheme(fmk, log) {
 	// Добавляем схему сети в сетевое ядро
 	const_cast <server::core_t *> (this->_core)->scheme(&this->_scheme);
 	// Устанавливаем событие на запуск системы
@@ -452,8 +452,10 @@ int32_t awh::server::Http2::chunkSignal(const int32_t sid, const uint64_t bid, c
 					switch(static_cast <uint8_t> (i->second)){
 						// Если протокол соответствует HTTP-протоколу
 						case static_cast <uint8_t> (agent_t::HTTP): {
-							// Добавляем полученный чанк в тело данных
-							stream->http.payload(vector <char> (buffer, buffer + size));
+							// Если тело запроса не передаётся потоком
+							if(!this->streaming(&stream->http))
+								// Добавляем полученный чанк в тело данных
+								stream->http.payload(vector <char> (buffer, buffer + size));
 							// Обновляем время отправленного пинга
 							options->sendPing = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MILLISECONDS);
 						} break;
@@ -768,8 +770,10 @@ void awh::server::Http2::prepare(const int32_t sid, const uint64_t bid) noexcept
 										if(stream->http.empty(awh::http_t::suite_t::BODY) && (stream->http.trailers() == 0))
 											// Устанавливаем флаг завершения потока
 											flag = awh::http2_t::flag_t::END_STREAM;
+										// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+										const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 										// Выполняем отправку тела запроса на сервер
-										if(!web2_t::send(sid, bid, entity.data(), entity.size(), flag))
+										if(!web2_t::send(sid, bid, chunk->data(), chunk->size(), chunk, flag))
 											// Выходим из функции
 											return;
 									}
@@ -905,8 +909,10 @@ void awh::server::Http2::prepare(const int32_t sid, const uint64_t bid) noexcept
 								if(stream->http.empty(awh::http_t::suite_t::BODY) && (stream->http.trailers() == 0))
 									// Устанавливаем флаг завершения потока
 									flag = awh::http2_t::flag_t::END_STREAM;
+								// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+								const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 								// Выполняем отправку тела запроса на сервер
-								if(!web2_t::send(sid, bid, entity.data(), entity.size(), flag))
+								if(!web2_t::send(sid, bid, chunk->data(), chunk->size(), chunk, flag))
 									// Выходим из функции
 									return;
 							}
@@ -1204,8 +1210,10 @@ void awh::server::Http2::websocket(const int32_t sid, const uint64_t bid) noexce
 							if(options->http.empty(awh::http_t::suite_t::BODY) && (options->http.trailers() == 0))
 								// Устанавливаем флаг завершения потока
 								flag = awh::http2_t::flag_t::END_STREAM;
+							// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+							const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 							// Выполняем отправку тела запроса на сервер
-							if(!web2_t::send(options->sid, bid, entity.data(), entity.size(), flag))
+							if(!web2_t::send(options->sid, bid, chunk->data(), chunk->size(), chunk, flag))
 								// Выходим из функции
 								return;
 						}
@@ -2034,8 +2042,10 @@ bool awh::server::Http2::send(const int32_t sid, const uint64_t bid, const char
 										if(end && stream->http.empty(awh::http_t::suite_t::BODY) && (stream->http.trailers() == 0))
 											// Устанавливаем флаг завершения потока
 											flag = awh::http2_t::flag_t::END_STREAM;
+										// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+										const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 										// Выполняем отправку данных на удалённый сервер
-										result = web2_t::send(sid, bid, entity.data(), entity.size(), flag);
+										result = web2_t::send(sid, bid, chunk->data(), chunk->size(), chunk, flag);
 									}
 									// Если список трейлеров установлен
 									if(result && (stream->http.trailers() > 0)){
@@ -2304,8 +2314,10 @@ void awh::server::Http2::send(const int32_t sid, const uint64_t bid, const uint3
 													if(stream->http.empty(awh::http_t::suite_t::BODY) && (stream->http.trailers() == 0))
 														// Устанавливаем флаг завершения потока
 														flag = awh::http2_t::flag_t::END_STREAM;
+													// Передаём владение чанком полезной нагрузки, чтобы он не копировался в очередь отправки
+													const auto chunk = std::make_shared <vector <char>> (std::move(entity));
 													// Выполняем отправку тела запроса на сервер
-													if(!web2_t::send(sid, bid, entity.data(), entity.size(), flag))
+													if(!web2_t::send(sid, bid, chunk->data(), chunk->size(), chunk, flag))
 														// Выходим из функции
 														return;
 												}
@@ -2371,6 +2383,71 @@ void awh::server::Http2::send(const int32_t sid, const uint64_t bid, const uint3
 		else this->send(sid, bid, code, mess, nullptr, 0, headers);
 	}
 }
+/**
+ * @brief Метод отправки ответа, тело которого читается по мере отправки
+ *
+ * @param sid     идентификатор потока HTTP
+ * @param bid     идентификатор брокера
+ * @param code    код сообщения для брокера
+ * @param mess    отправляемое сообщение об ошибке
+ * @param reader  функция чтения очередного фрагмента тела (возвращает количество байт, 0 - конец тела)
+ * @param headers HTTP заголовки сообщения
+ * @return        результат отправки заголовков ответа
+ */
+bool awh::server::Http2::stream([[maybe_unused]] const int32_t sid, const uint64_t bid, const uint32_t code, const string & mess, const scheme::web_t::reader_t & reader, const std::unordered_multimap <string, string> & headers) noexcept {
+	// Если подключение выполнено
+	if((this->_core != nullptr) && this->_core->working()){
+		// Получаем параметры активного клиента
+		scheme::web2_t::options_t * options = const_cast <scheme::web2_t::options_t *> (this->_scheme.get(bid));
+		// Если параметры активного клиента получены и протокол подключения соответствует HTTP/1.1
+		if((options != nullptr) && (options->proto == engine_t::proto_t::HTTP1_1)){
+			// Выполняем поиск агента которому соответствует клиент
+			auto i = this->_http1._agents.find(bid);
+			// Если активный агент клиента соответствует HTTP-протоколу
+			if((i != this->_http1._agents.end()) && (i->second == agent_t::HTTP))
+				// Выполняем отправку ответа клиенту через протокол HTTP/1.1
+				return this->_http1.stream(bid, code, mess, reader, headers);
+		}
+	}
+	// Для потоков HTTP/2 отправка тела через функцию чтения не поддерживается
+	return false;
+}
+/**
+ * @brief Метод приостановки чтения данных клиента
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::Http2::pause(const uint64_t bid) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web2_t::options_t * options = const_cast <scheme::web2_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены
+	if((this->_core != nullptr) && (options != nullptr)){
+		// Если протокол подключения соответствует HTTP/1.1
+		if(options->proto == engine_t::proto_t::HTTP1_1)
+			// Выполняем приостановку чтения данных клиента HTTP/1.1
+			this->_http1.pause(bid);
+		// Выполняем приостановку чтения всего подключения HTTP/2
+		else const_cast <server::core_t *> (this->_core)->events(bid, awh::scheme_t::mode_t::DISABLED, engine_t::method_t::READ);
+	}
+}
+/**
+ * @brief Метод возобновления чтения данных клиента
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::server::Http2::resume(const uint64_t bid) noexcept {
+	// Получаем параметры активного клиента
+	scheme::web2_t::options_t * options = const_cast <scheme::web2_t::options_t *> (this->_scheme.get(bid));
+	// Если параметры активного клиента получены
+	if((this->_core != nullptr) && (options != nullptr)){
+		// Если протокол подключения соответствует HTTP/1.1
+		if(options->proto == engine_t::proto_t::HTTP1_1)
+			// Выполняем возобновление чтения данных клиента HTTP/1.1
+			this->_http1.resume(bid);
+		// Выполняем возобновление чтения всего подключения HTTP/2
+		else const_cast <server::core_t *> (this->_core)->events(bid, awh::scheme_t::mode_t::ENABLED, engine_t::method_t::READ);
+	}
+}
 /**
  * @brief Метод HTTP/2 отправки клиенту сообщения корректного завершения
  *
@@ -2443,6 +2520,44 @@ bool awh::server::Http2::reject2(const int32_t sid, const uint64_t bid, const aw
 	// Выводим значение по умолчанию
 	return false;
 }
+/**
+ * @brief Метод HTTP/2 установки приоритета потока (RFC 9218)
+ *
+ * @param sid         идентификатор потока
+ * @param bid         идентификатор брокера
+ * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+ * @param incremental флаг инкрементальной обработки ответа
+ * @return            результат установки приоритета
+ */
+bool awh::server::Http2::priority2(const int32_t sid, const uint64_t bid, const uint8_t urgency, const bool incremental) noexcept {
+	// Если данные переданы верные
+	if((this->_core != nullptr) && this->_core->working()){
+		// Получаем параметры активного клиента
+		scheme::web2_t::options_t * options = const_cast <scheme::web2_t::options_t *> (this->_scheme.get(bid));
+		// Если параметры активного клиента получены
+		if(options != nullptr){
+			// Если протокол подключения соответствует HTTP/2
+			if(options->proto == engine_t::proto_t::HTTP2){
+				// Выполняем поиск агента которому соответствует клиент
+				auto i = this->_agents.find(bid);
+				// Если активный агент клиента установлен
+				if(i != this->_agents.end()){
+					/**
+					 * Определяем тип активного протокола
+					 */
+					switch(static_cast <uint8_t> (i->second)){
+						// Если протокол соответствует HTTP-протоколу
+						case static_cast <uint8_t> (agent_t::HTTP):
+							// Выполняем установку приоритета потока
+							return web2_t::priority(sid, bid, urgency, incremental);
+					}
+				}
+			}
+		}
+	}
+	// Выводим значение по умолчанию
+	return false;
+}
 /**
  * @brief Метод HTTP/2 отправки сообщения закрытия всех потоков
  *
@@ -3129,6 +3244,8 @@ void awh::server::Http2::mode(const std::set <flag_t> & flags) noexcept {
 	this->_complete = (flags.find(flag_t::NOT_STOP) == flags.end());
 	// Устанавливаем флаг поддержания автоматического подключения
 	this->_scheme.alive = (flags.find(flag_t::ALIVE) != flags.end());
+	// Устанавливаем флаг потоковой передачи тела запроса
+	this->_streaming = (flags.find(flag_t::STREAM_BODY_ENABLE) != flags.end());
 	// Устанавливаем флаг разрешающий выполнять подключение к протоколу Websocket
 	this->_webSocket = (flags.find(flag_t::WEBSOCKET_ENABLE) != flags.end());
 	// Устанавливаем флаг перехвата контекста компрессии для клиента
@@ -3199,6 +3316,8 @@ void awh::server::Http2::core(const server::core_t * core) noexcept {
 		const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", &http2_t::readEvents, this, _1, _2, _3, _4);
 		// Устанавливаем функцию записи данных
 		const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", &http2_t::writeEvents, this, _1, _2, _3, _4);
+		// Устанавливаем функцию освобождения очереди отправки брокера
+		const_cast <server::core_t *> (this->_core)->on <void (const uint64_t, const size_t)> ("drain", &http2_t::drainEvents, this, _1, _2);
 		// Добавляем событие аццепта брокера
 		const_cast <server::core_t *> (this->_core)->on <bool (const string &, const string &, const uint32_t, const uint64_t)> ("accept", &http2_t::acceptEvents, this, _1, _2, _3, _4);
 	// Если объект сетевого ядра не передан но ранее оно было добавлено
@@ -3300,6 +3419,15 @@ void awh::server::Http2::maxRequests(const uint32_t max) noexcept {
 	// Устанавливаем максимальное количество запросов для HTTP-сервера
 	this->_http1.maxRequests(max);
 }
+/**
+ * @brief Метод установки максимальной глубины конвейера запросов
+ *
+ * @param depth максимальное количество запросов ожидающих ответа
+ */
+void awh::server::Http2::pipelineDepth(const uint16_t depth) noexcept {
+	// Устанавливаем максимальную глубину конвейера запросов для HTTP-сервера
+	this->_http1.pipelineDepth(depth);
+}
 /**
  * @brief Метод установки идентификации сервера
  *
@@ -3525,6 +3653,8 @@ awh::server::Http2::Http2(const server::core_t * core, const fmk_t * fmk, const
 	const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", &http2_t::readEvents, this, _1, _2, _3, _4);
 	// Устанавливаем функцию записи данных
 	const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", &http2_t::writeEvents, this, _1, _2, _3, _4);
+	// Устанавливаем функцию освобождения очереди отправки брокера
+	const_cast <server::core_t *> (this->_core)->on <void (const uint64_t, const size_t)> ("drain", &http2_t::drainEvents, this, _1, _2);
 	// Добавляем событие аццепта брокера
 	const_cast <server::core_t *> (this->_core)->on <bool (const string &, const string &, const uint32_t, const uint64_t)> ("accept", &http2_t::acceptEvents, this, _1, _2, _3, _4);
 }
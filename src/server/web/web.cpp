@@ -130,14 +130,30 @@ bool awh::server::Web::acceptEvents(const string & ip, const string & mac, const
 void awh::server::Web::chunking(const uint64_t bid, const vector <char> & chunk, const awh::http_t * http) noexcept {
 	// Если данные получены, формируем тело сообщения
 	if(!chunk.empty()){
-		// Выполняем добавление полученного чанка в тело ответа
-		const_cast <awh::http_t *> (http)->body(chunk);
+		// Если тело запроса не передаётся потоком
+		if(!this->streaming(http))
+			// Выполняем добавление полученного чанка в тело ответа
+			const_cast <awh::http_t *> (http)->body(chunk);
 		// Если функция обратного вызова на вывода полученного чанка бинарных данных с сервера установлена
 		if(this->_callback.is("chunks"))
 			// Выполняем функцию обратного вызова
 			this->_callback.call <void (const int32_t, const uint64_t, const vector <char> &)> ("chunks", 1, bid, chunk);
 	}
 }
+/**
+ * @brief Метод проверки разрешения потоковой передачи тела запроса
+ *
+ * @param http объект модуля HTTP
+ * @return     результат проверки
+ */
+bool awh::server::Web::streaming(const awh::http_t * http) const noexcept {
+	// Если потоковая передача разрешена и функция получения чанков установлена
+	if(this->_streaming && (http != nullptr) && this->_callback.is("chunks"))
+		// Сжатое или зашифрованное тело должно быть собрано целиком для декомпрессии и дешифровки
+		return (!http->is(awh::http_t::suite_t::HEADER, "content-encoding") && !http->is(awh::http_t::suite_t::HEADER, "x-awh-encryption"));
+	// Выводим результат
+	return false;
+}
 /**
  * @brief Метод отлавливания событий контейнера функций обратного вызова
  *
@@ -474,7 +490,7 @@ void awh::server::Web::encryption(const string & pass, const string & salt, cons
 awh::server::Web::Web(const fmk_t * fmk, const log_t * log) noexcept :
  _pid(::getpid()),
  _uri(fmk, log), _callback(log), _timer(fmk, log),
- _pinging(true), _complete(true),
+ _pinging(true), _complete(true), _streaming(false),
  _chunkSize(AWH_CHUNK_SIZE), _pingInterval(PING_INTERVAL),
  _fmk(fmk), _log(log), _core(nullptr) {
 	// Выполняем отключение информационных сообщений сетевого ядра таймера
@@ -492,7 +508,7 @@ awh::server::Web::Web(const fmk_t * fmk, const log_t * log) noexcept :
 awh::server::Web::Web(const server::core_t * core, const fmk_t * fmk, const log_t * log) noexcept :
  _pid(::getpid()),
  _uri(fmk, log), _callback(log), _timer(fmk, log),
- _pinging(true), _complete(true),
+ _pinging(true), _complete(true), _streaming(false),
  _chunkSize(AWH_CHUNK_SIZE), _pingInterval(PING_INTERVAL),
  _fmk(fmk), _log(log), _core(core) {
 	// Выполняем отключение информационных сообщений сетевого ядра таймера
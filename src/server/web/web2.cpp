@@ -55,6 +55,12 @@ bool awh::server::Web2::session(const uint64_t bid, const uint16_t sid) noexcept
 				callback.on <int32_t (const int32_t)> ("begin", &web2_t::beginSignal, this, _1, bid);
 				// Выполняем установку функции обратного вызова при отправки сообщения на сервер
 				callback.on <void (const uint8_t *, const size_t)> ("send", &web2_t::sendSignal, this, bid, _1, _2);
+				// Выполняем установку функции обратного вызова при отправки данных клиенту без копирования
+				callback.on <void (const uint8_t *, const size_t, const std::shared_ptr <const void> &)> ("write", &web2_t::writeSignal, this, bid, _1, _2, _3);
+				// Выполняем установку функции обратного вызова получения объёма данных ожидающих отправки
+				callback.on <size_t (void)> ("pending", &web2_t::pendingSignal, this, bid);
+				// Выполняем установку функции обратного вызова получения объёма памяти доступной для буферов отправки
+				callback.on <size_t (void)> ("memory", &web2_t::memorySignal, this);
 				// Выполняем установку функции обратного вызова при закрытии потока
 				callback.on <int32_t (const int32_t, const http2_t::error_t)> ("close", &web2_t::closedSignal, this, _1, bid, _2);
 				// Выполняем установку функции обратного вызова при получении чанка с сервера
@@ -107,6 +113,50 @@ void awh::server::Web2::statusEvents(const awh::core_t::status_t status) noexcep
 	// Выполняем переадресацию выполняемого события в родительский модуль
 	web_t::statusEvents(status);
 }
+/**
+ * @brief Метод обратного вызова при освобождении очереди отправки брокера
+ *
+ * @param bid  идентификатор брокера
+ * @param size количество байт оставшихся в очереди отправки
+ */
+void awh::server::Web2::drainEvents(const uint64_t bid, const size_t size) noexcept {
+	// Если очередь отправки освободилась достаточно для продолжения отправки
+	if(size < static_cast <size_t> (http2_t::SEND_WATERMARK)){
+		// Выполняем поиск брокера в списке активных сессий
+		auto i = this->_sessions.find(bid);
+		// Если активная сессия найдена
+		if(i != this->_sessions.end())
+			// Выполняем отправку отложенных записей в порядке приоритетов потоков
+			i->second->dispatch();
+	}
+}
+/**
+ * @brief Метод обратного вызова при получении объёма данных ожидающих отправки HTTP/2
+ *
+ * @param bid идентификатор брокера
+ * @return    количество байт в очереди отправки брокера
+ */
+size_t awh::server::Web2::pendingSignal(const uint64_t bid) const noexcept {
+	// Если объект сетевого ядра инициализирован
+	if(this->_core != nullptr)
+		// Выводим количество байт в очереди отправки брокера
+		return this->_core->brokerAvailableSize(bid);
+	// Выводим результат
+	return 0;
+}
+/**
+ * @brief Метод обратного вызова при получении объёма памяти доступной для буферов отправки
+ *
+ * @return количество байт доступной памяти
+ */
+size_t awh::server::Web2::memorySignal() const noexcept {
+	// Если объект сетевого ядра инициализирован
+	if(this->_core != nullptr)
+		// Выводим количество байт доступной памяти
+		return this->_core->memoryAvailableSize();
+	// Выводим результат
+	return 0;
+}
 /**
  * @brief Метод обратного вызова при отправки данных HTTP/2
  *
@@ -120,6 +170,20 @@ void awh::server::Web2::sendSignal(const uint64_t bid, const uint8_t * buffer, c
 		// Выполняем отправку заголовков ответа клиенту
 		const_cast <server::core_t *> (this->_core)->send(reinterpret_cast <const char *> (buffer), size, bid);
 }
+/**
+ * @brief Метод обратного вызова при отправки данных HTTP/2 без копирования
+ *
+ * @param bid    идентификатор брокера
+ * @param buffer буфер бинарных данных
+ * @param size   размер буфера данных для отправки
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ */
+void awh::server::Web2::writeSignal(const uint64_t bid, const uint8_t * buffer, const size_t size, const std::shared_ptr <const void> & owner) noexcept {
+	// Если объект сетевого ядра инициализирован
+	if(this->_core != nullptr)
+		// Выполняем отправку тела ответа клиенту
+		const_cast <server::core_t *> (this->_core)->send(reinterpret_cast <const char *> (buffer), size, owner, bid);
+}
 /**
  * @brief Метод выполнения закрытия подключения
  *
@@ -210,6 +274,44 @@ bool awh::server::Web2::reject(const int32_t sid, const uint64_t bid, const http
 	// Выводим результат
 	return result;
 }
+/**
+ * @brief Метод установки приоритета потока (RFC 9218)
+ *
+ * @param sid         идентификатор потока
+ * @param bid         идентификатор брокера
+ * @param urgency     срочность ответа от 0 (наивысшая) до 7 (низшая)
+ * @param incremental флаг инкрементальной обработки ответа
+ * @return            результат установки приоритета
+ */
+bool awh::server::Web2::priority(const int32_t sid, const uint64_t bid, const uint8_t urgency, const bool incremental) noexcept {
+	// Выполняем поиск брокера в списке активных сессий
+	auto i = this->_sessions.find(bid);
+	// Если активная сессия найдена
+	if(i != this->_sessions.end()){
+		// Выполняем установку приоритета потока
+		i->second->priority(sid, urgency, incremental);
+		// Выводим результат
+		return true;
+	}
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод получения состояния управления потоком сессии
+ *
+ * @param bid идентификатор брокера
+ * @return    размеры окон, время приёма-передачи и оценка BDP
+ */
+awh::http2_t::flow_t awh::server::Web2::flow(const uint64_t bid) const noexcept {
+	// Выполняем поиск брокера в списке активных сессий
+	auto i = this->_sessions.find(bid);
+	// Если активная сессия найдена
+	if(i != this->_sessions.end())
+		// Выводим состояние управления потоком
+		return i->second->flow();
+	// Выводим результат
+	return http2_t::flow_t();
+}
 /**
  * @brief Метод отправки сообщения закрытия всех потоков
  *
@@ -281,6 +383,21 @@ bool awh::server::Web2::send(const int32_t sid, const uint64_t bid, const vector
  * @return       результат отправки данных указанному клиенту
  */
 bool awh::server::Web2::send(const int32_t sid, const uint64_t bid, const char * buffer, const size_t size, const http2_t::flag_t flag) noexcept {
+	// Выполняем отправку сообщения с копированием
+	return this->send(sid, bid, buffer, size, nullptr, flag);
+}
+/**
+ * @brief Метод отправки сообщения клиенту без копирования
+ *
+ * @param sid    идентификатор потока
+ * @param bid    идентификатор брокера
+ * @param buffer буфер бинарных данных передаваемых
+ * @param size   размер сообщения в байтах
+ * @param owner  владелец буфера, удерживающий данные до их отправки
+ * @param flag   флаг передаваемого потока по сети
+ * @return       результат отправки данных указанному клиенту
+ */
+bool awh::server::Web2::send(const int32_t sid, const uint64_t bid, const char * buffer, const size_t size, const std::shared_ptr <const void> & owner, const http2_t::flag_t flag) noexcept {
 	// Результат работы функции
 	bool result = false;
 	// Если флаг инициализации сессии HTTP/2 установлен и подключение выполнено
@@ -290,7 +407,7 @@ bool awh::server::Web2::send(const int32_t sid, const uint64_t bid, const char *
 		// Если активная сессия найдена
 		if((result = (i != this->_sessions.end()))){
 			// Выполняем отправку тела ответа
-			if(!(result = i->second->sendData(sid, reinterpret_cast <const uint8_t *> (buffer), size, flag))){
+			if(!(result = i->second->sendData(sid, reinterpret_cast <const uint8_t *> (buffer), size, owner, flag))){
 				// Выполняем закрытие подключения
 				const_cast <server::core_t *> (this->_core)->close(bid);
 				// Выходим из функции
@@ -438,6 +555,12 @@ void awh::server::Web2::settings(const std::map <http2_t::settings_t, uint32_t>
 	if(this->_settings.find(http2_t::settings_t::PAYLOAD_SIZE) == this->_settings.end())
 		// Выполняем установку максимального размера буфера полезной нагрузки
 		this->_settings.emplace(http2_t::settings_t::PAYLOAD_SIZE, http2_t::MAX_PAYLOAD_SIZE);
+	// Выполняем поиск максимального размера окна при автоматической подстройке
+	auto j = this->_settings.find(http2_t::settings_t::WINDOW_LIMIT);
+	// Если максимальный размер окна больше самого максимального значения
+	if((j != this->_settings.end()) && (j->second > http2_t::MAX_WINDOW_SIZE))
+		// Выполняем корректировку максимального размера окна
+		j->second = http2_t::MAX_WINDOW_SIZE;
 	// Если максимальный размер блока заголовоков не установлен
 	if(this->_settings.find(http2_t::settings_t::HEADER_TABLE_SIZE) == this->_settings.end())
 		// Выполняем установку максимального размера блока заголовоков
@@ -148,6 +148,8 @@ void awh::server::Websocket1::disconnectEvents(const uint64_t bid, const uint16_
 	if((bid > 0) && (sid > 0)){
 		// Выполняем отключение подключившегося брокера
 		this->disconnect(bid);
+		// Удаляем брокера из всех тем рассылки
+		this->_topics.erase(bid);
 		// Если функция обратного вызова при подключении/отключении установлена
 		if(this->_callback.is("active"))
 			// Выполняем функцию обратного вызова
@@ -482,8 +484,10 @@ void awh::server::Websocket1::readEvents(const char * buffer, const size_t size,
 						 * Выполняем обработку полученных данных
 						 */
 						while(!options->close && options->allow.receive && !options->buffer.payload.empty()){
-							// Выполняем чтение фрейма Websocket
-							const auto & payload = options->frame.methods.get(head, reinterpret_cast <const char *> (options->buffer.payload.get()), options->buffer.payload.size());
+							// Выполняем чтение фрейма Websocket, полезная нагрузка размаскируется прямо в буфере
+							const char * data = options->frame.methods.decode(head, options->buffer.payload.get(), options->buffer.payload.size());
+							// Получаем полезную нагрузку фрейма без копирования
+							const string_view payload(data, (data != nullptr ? static_cast <size_t> (head.payload) : 0));
 							// Если буфер данных получен
 							if(!payload.empty() || (head.optcode == ws::frame_t::opcode_t::PING) || (head.optcode == ws::frame_t::opcode_t::PONG) || (head.optcode == ws::frame_t::opcode_t::CLOSE)){
 								/**
@@ -556,10 +560,10 @@ void awh::server::Websocket1::readEvents(const char * buffer, const size_t size,
 										else {
 											// Если тредпул активирован
 											if(this->_thr.initialized())
-												// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-												this->_thr.push(std::bind(&ws1_t::extraction, this, bid, payload, (options->frame.opcode == ws::frame_t::opcode_t::TEXT)));
+												// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения брокера извлекаются по порядку
+												this->_thr.serial(bid, &ws1_t::extraction, this, bid, vector <char> (payload.begin(), payload.end()), (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 											// Если тредпул не активирован, выполняем извлечение полученных сообщений
-											else this->extraction(bid, payload, (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
+											else this->extraction(bid, vector <char> (payload.begin(), payload.end()), (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 										}
 									} break;
 									// Если ответом является CONTINUATION
@@ -572,8 +576,8 @@ void awh::server::Websocket1::readEvents(const char * buffer, const size_t size,
 											if(head.fin){
 												// Если тредпул активирован
 												if(this->_thr.initialized())
-													// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-													this->_thr.push(std::bind(&ws1_t::extraction, this, bid, options->buffer.fragments, (options->frame.opcode == ws::frame_t::opcode_t::TEXT)));
+													// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения брокера извлекаются по порядку
+													this->_thr.serial(bid, &ws1_t::extraction, this, bid, std::move(options->buffer.fragments), (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 												// Если тредпул не активирован, выполняем извлечение полученных сообщений
 												else this->extraction(bid, options->buffer.fragments, (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 												// Очищаем список фрагментированных сообщений
@@ -680,6 +684,18 @@ void awh::server::Websocket1::writeEvents(const char * buffer, const size_t size
 		}
 	}
 }
+/**
+ * @brief Метод обратного вызова при освобождении очереди отправки брокера
+ *
+ * @param bid  идентификатор брокера
+ * @param size количество байт оставшихся в очереди отправки
+ */
+void awh::server::Websocket1::drainEvents(const uint64_t bid, const size_t size) noexcept {
+	// Выполняем перебор отложенных сообщений, для которых освободилась очередь подписчика
+	for(auto & message : this->_topics.release(bid, size))
+		// Выполняем постановку сообщения в очередь подписчика
+		this->push(bid, message);
+}
 /**
  * @brief Метод вывода сообщений об ошибках работы брокера
  *
@@ -944,6 +960,12 @@ void awh::server::Websocket1::pinging(const uint16_t tid) noexcept {
 			for(auto & item : this->_scheme.get()){
 				// Если подключение клиента активно и рукопожатие не выполнено
 				if(!item.second->close && reinterpret_cast <http_t &> (item.second->http).is(http_t::state_t::HANDSHAKE)){
+					{
+						// Выполняем блокировку контекста компрессии, сообщение может сжиматься в другом потоке
+						const lock_guard <std::recursive_mutex> lock(item.second->mtx);
+						// Освобождаем простаивающий контекст компрессии
+						item.second->hash.trim();
+					}
 					// Получаем текущий штамп времени
 					const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MILLISECONDS);
 					// Если брокер не ответил на пинг больше двух интервалов, отключаем его
@@ -968,6 +990,187 @@ void awh::server::Websocket1::pinging(const uint16_t tid) noexcept {
 		}
 	}
 }
+/**
+ * @brief Метод компрессии полезной нагрузки сообщения
+ *
+ * @param options параметры активного клиента
+ * @param message буфер полезной нагрузки сообщения
+ * @param size    размер полезной нагрузки сообщения
+ * @param buffer  буфер для записи сжатых данных (пустой, если сжатие не выполнено)
+ */
+void awh::server::Websocket1::compress(scheme::ws_t::options_t * options, const char * message, const size_t size, vector <char> & buffer) const noexcept {
+	// Выполняем блокировку контекста компрессии на время сжатия
+	const lock_guard <std::recursive_mutex> lock(options->mtx);
+	/**
+	 * Определяем метод компрессии
+	 */
+	switch(static_cast <uint8_t> (options->compressor)){
+		// Если метод компрессии выбран LZ4
+		case static_cast <uint8_t> (http_t::compressor_t::LZ4):
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::LZ4, buffer);
+		break;
+		// Если метод компрессии выбран Zstandard
+		case static_cast <uint8_t> (http_t::compressor_t::ZSTD):
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::ZSTD, buffer);
+		break;
+		// Если метод компрессии выбран LZma
+		case static_cast <uint8_t> (http_t::compressor_t::LZMA):
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::LZMA, buffer);
+		break;
+		// Если метод компрессии выбран Brotli
+		case static_cast <uint8_t> (http_t::compressor_t::BROTLI):
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::BROTLI, buffer);
+		break;
+		// Если метод компрессии выбран BZip2
+		case static_cast <uint8_t> (http_t::compressor_t::BZIP2):
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::BZIP2, buffer);
+		break;
+		// Если метод компрессии выбран GZip
+		case static_cast <uint8_t> (http_t::compressor_t::GZIP):
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::GZIP, buffer);
+		break;
+		// Если метод компрессии выбран Deflate
+		case static_cast <uint8_t> (http_t::compressor_t::DEFLATE): {
+			// Устанавливаем размер скользящего окна
+			options->hash.wbit(options->server.wbit);
+			// Выполняем компрессию полученных данных
+			options->hash.compress(message, size, hash_t::method_t::DEFLATE, buffer);
+			// Удаляем хвост в полученных данных
+			options->hash.rmTail(buffer);
+		} break;
+	}
+}
+/**
+ * @brief Метод получения фреймов публикуемого сообщения
+ *
+ * @param options параметры активного клиента
+ * @param message публикуемое сообщение
+ * @return        фреймы сообщения (пустое значение, если фреймы не могут быть общими)
+ */
+std::shared_ptr <const vector <char>> awh::server::Websocket1::frames(scheme::ws_t::options_t * options, const std::shared_ptr <ws::topics_t::message_t> & message) const noexcept {
+	// Результат работы функции
+	std::shared_ptr <const vector <char>> result;
+	// Если данные зашифрованы или сжимаются со скользящим контекстом, фреймы у каждого подписчика свои
+	if((options == nullptr) || options->crypted || ((options->compressor == http_t::compressor_t::DEFLATE) && options->server.takeover))
+		// Выводим пустой результат
+		return result;
+	// Определяем нужно ли сжимать сообщение перед отправкой
+	const bool compressed = ((message->payload.size() >= 1024) && (options->compressor != http_t::compressor_t::NONE));
+	// Формируем ключ кэша фреймов из метода компрессии, размера окна и размера сегмента
+	const uint64_t key = ((compressed ? ((static_cast <uint64_t> (options->compressor) << 8) | static_cast <uint8_t> (options->server.wbit)) : 0) << 48) | (static_cast <uint64_t> (options->frame.size) & 0xFFFFFFFFFFFF);
+	// Выполняем блокировку кэша фреймов сообщения
+	const lock_guard <std::mutex> lock(message->mtx);
+	// Выполняем поиск сформированных фреймов
+	auto i = message->frames.find(key);
+	// Если фреймы уже сформированы для другого подписчика
+	if(i != message->frames.end())
+		// Выводим сформированные фреймы
+		return i->second;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Буфер сжатых данных
+		vector <char> buffer;
+		// Если необходимо сжимать сообщение перед отправкой
+		if(compressed)
+			// Выполняем компрессию полезной нагрузки
+			this->compress(options, message->payload.data(), message->payload.size(), buffer);
+		// Создаём объект заголовка для отправки
+		ws::frame_t::head_t head(true, false);
+		// Устанавливаем опкод сообщения
+		head.optcode = (message->text ? ws::frame_t::opcode_t::TEXT : ws::frame_t::opcode_t::BINARY);
+		// Указываем, что сообщение передаётся в сжатом виде
+		head.rsv[0] = !buffer.empty();
+		// Получаем данные для отправки
+		const char * data = (buffer.empty() ? message->payload.data() : buffer.data());
+		// Получаем размер данных для отправки
+		const size_t size = (buffer.empty() ? message->payload.size() : buffer.size());
+		// Получаем размер сегмента фрагментированного сообщения
+		const size_t segment = ((options->frame.size > 0) ? options->frame.size : size);
+		// Создаём буфер фреймов с запасом на заголовок каждого сегмента
+		auto frames = std::make_shared <vector <char>> (size + (((size + segment - 1) / segment) * ws::frame_t::MAX_HEAD_SIZE));
+		// Смещение в бинарном буфере, актуальный размер блока и размер записанных фреймов
+		size_t offset = 0, actual = 0, length = 0;
+		/**
+		 * Выполняем разбивку полезной нагрузки на сегменты
+		 */
+		while(offset < size){
+			// Выполняем получение актуального размера отправляемых данных
+			actual = std::min(segment, size - offset);
+			// Устанавливаем флаг финального сообщения
+			head.fin = ((offset + actual) == size);
+			// Выполняем запись фрейма сегмента
+			length += options->frame.methods.encode(head, data + offset, actual, frames->data() + length, frames->size() - length);
+			// Увеличиваем смещение в буфере
+			offset += actual;
+			// Выполняем сброс RSV1
+			head.rsv[0] = false;
+			// Устанавливаем опкод сообщения
+			head.optcode = ws::frame_t::opcode_t::CONTINUATION;
+		}
+		// Устанавливаем итоговый размер фреймов
+		frames->resize(length);
+		// Запоминаем фреймы для остальных подписчиков с такими же параметрами
+		message->frames.emplace(key, frames);
+		// Выводим сформированные фреймы
+		result = std::move(frames);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const bad_alloc &) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(message->payload.size(), message->text), log_t::flag_t::CRITICAL, "Memory allocation error");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+		#endif
+		// Выходим из приложения
+		::exit(EXIT_FAILURE);
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод постановки публикуемого сообщения в очередь подписчика
+ *
+ * @param bid     идентификатор брокера
+ * @param message публикуемое сообщение
+ * @return        результат постановки сообщения в очередь
+ */
+bool awh::server::Websocket1::push(const uint64_t bid, const std::shared_ptr <ws::topics_t::message_t> & message) noexcept {
+	// Если подключение выполнено
+	if((this->_core != nullptr) && this->_core->working() && (message != nullptr)){
+		// Получаем параметры активного клиента
+		scheme::ws_t::options_t * options = const_cast <scheme::ws_t::options_t *> (this->_scheme.get(bid));
+		// Если рукопожатие выполнено и подключение не закрывается
+		if((options != nullptr) && !options->close && !options->stopped && options->http.handshake(http_t::process_t::REQUEST)){
+			// Получаем общие фреймы сообщения
+			const auto & frames = this->frames(options, message);
+			// Если фреймы могут быть общими
+			if(frames != nullptr)
+				// Ставим фреймы в очередь брокера без копирования
+				return const_cast <server::core_t *> (this->_core)->send(frames->data(), frames->size(), frames, bid);
+			// Выполняем отправку сообщения с индивидуальными фреймами
+			return this->sendMessage(bid, message->payload.data(), message->payload.size(), message->text);
+		}
+	}
+	// Сообщаем, что сообщение не отправлено
+	return false;
+}
 /**
  * @brief Метод инициализации Websocket-сервера
  *
@@ -1101,6 +1304,8 @@ bool awh::server::Websocket1::sendMessage(const uint64_t bid, const char * messa
 				head.rsv[0] = ((size >= 1024) && (options->compressor != http_t::compressor_t::NONE));
 				// Если необходимо сжимать сообщение перед отправкой
 				if(head.rsv[0]){
+					// Выполняем блокировку контекста компрессии на время сжатия
+					const lock_guard <std::recursive_mutex> lock(options->mtx);
 					/**
 					 * Определяем метод компрессии
 					 */
@@ -1222,6 +1427,94 @@ bool awh::server::Websocket1::send(const uint64_t bid, const char * buffer, cons
 	// Сообщаем что ничего не найдено
 	return false;
 }
+/**
+ * @brief Метод подписки брокера на тему рассылки
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ * @return      результат подписки
+ */
+bool awh::server::Websocket1::subscribe(const string & topic, const uint64_t bid) noexcept {
+	// Если брокер существует
+	if(this->_scheme.get(bid) != nullptr)
+		// Выполняем подписку брокера на тему
+		return this->_topics.subscribe(topic, bid);
+	// Сообщаем, что подписка не выполнена
+	return false;
+}
+/**
+ * @brief Метод отписки брокера от темы рассылки
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ */
+void awh::server::Websocket1::unsubscribe(const string & topic, const uint64_t bid) noexcept {
+	// Выполняем отписку брокера от темы
+	this->_topics.unsubscribe(topic, bid);
+}
+/**
+ * @brief Метод установки политики обработки медленных подписчиков темы
+ *
+ * @param topic  название темы
+ * @param policy политика обработки медленных подписчиков
+ * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+ */
+void awh::server::Websocket1::policy(const string & topic, const ws::topics_t::policy_t policy, const size_t limit) noexcept {
+	// Выполняем установку политики обработки медленных подписчиков
+	this->_topics.policy(topic, policy, limit);
+}
+/**
+ * @brief Метод получения статистики темы рассылки
+ *
+ * @param topic название темы
+ * @return      статистика темы
+ */
+awh::ws::topics_t::stat_t awh::server::Websocket1::topic(const string & topic) const noexcept {
+	// Выводим статистику темы
+	return this->_topics.stat(topic);
+}
+/**
+ * @brief Метод публикации сообщения всем подписчикам темы
+ *
+ * @param topic   название темы
+ * @param message передаваемое сообщения в бинарном виде
+ * @param text    данные передаются в текстовом виде
+ * @return        количество подписчиков в очередь которых поставлено сообщение
+ */
+size_t awh::server::Websocket1::publish(const string & topic, const vector <char> & message, const bool text) noexcept {
+	// Выполняем публикацию сообщения
+	return this->publish(topic, message.data(), message.size(), text);
+}
+/**
+ * @brief Метод публикации сообщения всем подписчикам темы
+ *
+ * @param topic   название темы
+ * @param message передаваемое сообщения в бинарном виде
+ * @param size    размер передаваемого сообещния
+ * @param text    данные передаются в текстовом виде
+ * @return        количество подписчиков в очередь которых поставлено сообщение
+ */
+size_t awh::server::Websocket1::publish(const string & topic, const char * message, const size_t size, const bool text) noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если подключение выполнено
+	if((this->_core != nullptr) && this->_core->working() && (message != nullptr) && (size > 0)){
+		// Создаём сообщение, общее для всех подписчиков темы
+		const auto & item = this->_topics.message(topic, message, size, text);
+		// Если у темы есть подписчики
+		if(item != nullptr){
+			// Выполняем перебор всех подписчиков темы
+			for(auto & bid : this->_topics.subscribers(topic)){
+				// Если очередь подписчика допускает сообщение и оно поставлено в очередь
+				if(this->_topics.admit(topic, bid, this->_core->brokerAvailableSize(bid), item) && this->push(bid, item))
+					// Увеличиваем количество подписчиков получивших сообщение
+					result++;
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод установки функций обратного вызова
  *
@@ -1425,6 +1718,15 @@ void awh::server::Websocket1::multiThreads(const uint16_t count, const bool mode
 	// Выполняем завершение всех потоков
 	} else this->_thr.stop();
 }
+/**
+ * @brief Метод получения метрик пула потоков извлечения сообщений
+ *
+ * @return метрики пула потоков
+ */
+awh::exec_t::stat_t awh::server::Websocket1::executor() const noexcept {
+	// Выводим метрики пула потоков
+	return this->_thr.stat();
+}
 /**
  * @brief Метод установки максимального количества одновременных подключений
  *
@@ -1529,6 +1831,8 @@ void awh::server::Websocket1::core(const server::core_t * core) noexcept {
 		const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", &ws1_t::readEvents, this, _1, _2, _3, _4);
 		// Устанавливаем функцию записи данных
 		const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", &ws1_t::writeEvents, this, _1, _2, _3, _4);
+		// Устанавливаем функцию освобождения очереди отправки брокера
+		const_cast <server::core_t *> (this->_core)->on <void (const uint64_t, const size_t)> ("drain", &ws1_t::drainEvents, this, _1, _2);
 		// Добавляем событие аццепта брокера
 		const_cast <server::core_t *> (this->_core)->on <bool (const string &, const string &, const uint32_t, const uint64_t)> ("accept", &ws1_t::acceptEvents, this, _1, _2, _3, _4);
 	// Если объект сетевого ядра не передан но ранее оно было добавлено
@@ -1639,7 +1943,7 @@ void awh::server::Websocket1::encryption(const string & pass, const string & sal
  * @param log объект для работы с логами
  */
 awh::server::Websocket1::Websocket1(const fmk_t * fmk, const log_t * log) noexcept :
- web_t(fmk, log), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _scheme(fmk, log) {}
+ web_t(fmk, log), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _thr(log), _scheme(fmk, log), _topics(log) {}
 /**
  * @brief Конструктор
  *
@@ -1648,7 +1952,7 @@ awh::server::Websocket1::Websocket1(const fmk_t * fmk, const log_t * log) noexce
  * @param log  объект для работы с логами
  */
 awh::server::Websocket1::Websocket1(const server::core_t * core, const fmk_t * fmk, const log_t * log) noexcept :
- web_t(core, fmk, log), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _scheme(fmk, log) {
+ web_t(core, fmk, log), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _thr(log), _scheme(fmk, log), _topics(log) {
 	// Добавляем схему сети в сетевое ядро
 	const_cast <server::core_t *> (this->_core)->scheme(&this->_scheme);
 	// Устанавливаем событие на запуск системы
@@ -1661,6 +1965,8 @@ awh::server::Websocket1::Websocket1(const server::core_t * core, const fmk_t * f
 	const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", &ws1_t::readEvents, this, _1, _2, _3, _4);
 	// Устанавливаем функцию записи данных
 	const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", &ws1_t::writeEvents, this, _1, _2, _3, _4);
+	// Устанавливаем функцию освобождения очереди отправки брокера
+	const_cast <server::core_t *> (this->_core)->on <void (const uint64_t, const size_t)> ("drain", &ws1_t::drainEvents, this, _1, _2);
 	// Добавляем событие аццепта брокера
 	const_cast <server::core_t *> (this->_core)->on <bool (const string &, const string &, const uint32_t, const uint64_t)> ("accept", &ws1_t::acceptEvents, this, _1, _2, _3, _4);
 }
@@ -170,6 +170,8 @@ void awh::server::Websocket2::disconnectEvents(const uint64_t bid, const uint16_
 			i->second->close();
 		// Выполняем отключение подключившегося брокера
 		this->disconnect(bid);
+		// Удаляем брокера из всех тем рассылки
+		this->_topics.erase(bid);
 		// Если функция обратного вызова при подключении/отключении установлена
 		if(this->_callback.is("active"))
 			// Выполняем функцию обратного вызова
@@ -354,6 +356,20 @@ void awh::server::Websocket2::writeEvents(const char * buffer, const size_t size
 		}
 	}
 }
+/**
+ * @brief Метод обратного вызова при освобождении очереди отправки брокера
+ *
+ * @param bid  идентификатор брокера
+ * @param size количество байт оставшихся в очереди отправки
+ */
+void awh::server::Websocket2::drainEvents(const uint64_t bid, const size_t size) noexcept {
+	// Выполняем отправку отложенных записей HTTP/2
+	web2_t::drainEvents(bid, size);
+	// Выполняем перебор отложенных сообщений, для которых освободилась очередь подписчика
+	for(auto & message : this->_topics.release(bid, this->queued(bid)))
+		// Выполняем постановку сообщения в очередь подписчика
+		this->push(bid, message);
+}
 /**
  * @brief Метод отлавливания событий контейнера функций обратного вызова
  *
@@ -555,8 +571,10 @@ int32_t awh::server::Websocket2::frameSignal(const int32_t sid, const uint64_t b
 								 * Выполняем обработку полученных данных
 								 */
 								while(!options->close && options->allow.receive && !options->buffer.payload.empty()){
-									// Выполняем чтение фрейма Websocket
-									const auto & payload = options->frame.methods.get(head, reinterpret_cast <const char *> (options->buffer.payload.get()), options->buffer.payload.size());
+									// Выполняем чтение фрейма Websocket, полезная нагрузка размаскируется прямо в буфере
+									const char * data = options->frame.methods.decode(head, options->buffer.payload.get(), options->buffer.payload.size());
+									// Получаем полезную нагрузку фрейма без копирования
+									const string_view payload(data, (data != nullptr ? static_cast <size_t> (head.payload) : 0));
 									// Если буфер данных получен
 									if(!payload.empty() || (head.optcode == ws::frame_t::opcode_t::PING) || (head.optcode == ws::frame_t::opcode_t::PONG) || (head.optcode == ws::frame_t::opcode_t::CLOSE)){
 										/**
@@ -629,10 +647,10 @@ int32_t awh::server::Websocket2::frameSignal(const int32_t sid, const uint64_t b
 												else {
 													// Если тредпул активирован
 													if(this->_thr.initialized())
-														// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-														this->_thr.push(std::bind(&ws2_t::extraction, this, bid, payload, (options->frame.opcode == ws::frame_t::opcode_t::TEXT)));
+														// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения брокера извлекаются по порядку
+														this->_thr.serial(bid, &ws2_t::extraction, this, bid, vector <char> (payload.begin(), payload.end()), (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 													// Если тредпул не активирован, выполняем извлечение полученных сообщений
-													else this->extraction(bid, payload, (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
+													else this->extraction(bid, vector <char> (payload.begin(), payload.end()), (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 												}
 											} break;
 											// Если ответом является CONTINUATION
@@ -645,8 +663,8 @@ int32_t awh::server::Websocket2::frameSignal(const int32_t sid, const uint64_t b
 													if(head.fin){
 														// Если тредпул активирован
 														if(this->_thr.initialized())
-															// Добавляем в тредпул новую задачу на извлечение полученных сообщений
-															this->_thr.push(std::bind(&ws2_t::extraction, this, bid, options->buffer.fragments, (options->frame.opcode == ws::frame_t::opcode_t::TEXT)));
+															// Добавляем в тредпул новую задачу на извлечение полученных сообщений, сообщения брокера извлекаются по порядку
+															this->_thr.serial(bid, &ws2_t::extraction, this, bid, std::move(options->buffer.fragments), (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 														// Если тредпул не активирован, выполняем извлечение полученных сообщений
 														else this->extraction(bid, options->buffer.fragments, (options->frame.opcode == ws::frame_t::opcode_t::TEXT));
 														// Очищаем список фрагментированных сообщений
@@ -1303,6 +1321,12 @@ void awh::server::Websocket2::pinging(const uint16_t tid) noexcept {
 					else if(item.second->allow.receive) {
 						// Если рукопожатие выполнено
 						if(item.second->shake){
+							{
+								// Выполняем блокировку контекста компрессии, сообщение может сжиматься в другом потоке
+								const lock_guard <std::recursive_mutex> lock(item.second->mtx);
+								// Освобождаем простаивающий контекст компрессии
+								item.second->hash.trim();
+							}
 							// Получаем текущий штамп времени
 							const uint64_t date = this->_fmk->timestamp <uint64_t> (fmk_t::chrono_t::MILLISECONDS);
 							// Если брокер не ответил на пинг больше двух интервалов, отключаем его
@@ -1332,6 +1356,68 @@ void awh::server::Websocket2::pinging(const uint16_t tid) noexcept {
 		}
 	}
 }
+/**
+ * @brief Метод получения количества байт ожидающих отправки подписчику
+ *
+ * @param bid идентификатор брокера
+ * @return    количество байт в очереди брокера и в очереди потока HTTP/2
+ */
+size_t awh::server::Websocket2::queued(const uint64_t bid) const noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если объект сетевого ядра инициализирован
+	if(this->_core != nullptr){
+		// Получаем количество байт в очереди отправки брокера
+		result = this->_core->brokerAvailableSize(bid);
+		// Получаем параметры активного клиента
+		const scheme::ws_t::options_t * options = this->_scheme.get(bid);
+		// Если подключение работает по протоколу HTTP/2
+		if((options != nullptr) && (options->proto == engine_t::proto_t::HTTP2)){
+			// Выполняем поиск брокера в списке активных сессий
+			auto i = this->_sessions.find(bid);
+			// Если активная сессия найдена
+			if(i != this->_sessions.end())
+				// Добавляем количество байт ожидающих отправки в потоке
+				result += i->second->pending(options->sid);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод постановки публикуемого сообщения в очередь подписчика
+ *
+ * @param bid     идентификатор брокера
+ * @param message публикуемое сообщение
+ * @return        результат постановки сообщения в очередь
+ */
+bool awh::server::Websocket2::push(const uint64_t bid, const std::shared_ptr <ws::topics_t::message_t> & message) noexcept {
+	// Если подключение выполнено
+	if((this->_core != nullptr) && this->_core->working() && (message != nullptr)){
+		// Получаем параметры активного клиента
+		scheme::ws_t::options_t * options = const_cast <scheme::ws_t::options_t *> (this->_scheme.get(bid));
+		// Если параметры активного клиента получены
+		if(options != nullptr){
+			// Если переключение протокола на HTTP/2 не выполнено
+			if(options->proto != engine_t::proto_t::HTTP2)
+				// Выполняем постановку сообщения в очередь клиента Websocket
+				return this->_ws1.push(bid, message);
+			// Если рукопожатие выполнено и подключение не закрывается
+			else if(!options->close && !options->stopped && options->http.handshake(http_t::process_t::REQUEST)) {
+				// Получаем общие фреймы сообщения
+				const auto & frames = this->_ws1.frames(options, message);
+				// Если фреймы могут быть общими
+				if(frames != nullptr)
+					// Ставим фреймы в очередь потока без копирования
+					return web2_t::send(options->sid, bid, frames->data(), frames->size(), frames, http2_t::flag_t::NONE);
+				// Выполняем отправку сообщения с индивидуальными фреймами
+				return this->sendMessage(bid, message->payload.data(), message->payload.size(), message->text);
+			}
+		}
+	}
+	// Сообщаем, что сообщение не отправлено
+	return false;
+}
 /**
  * @brief Метод инициализации Websocket-сервера
  *
@@ -1472,6 +1558,8 @@ bool awh::server::Websocket2::sendMessage(const uint64_t bid, const char * messa
 					head.rsv[0] = ((size >= 1024) && (options->compressor != http_t::compressor_t::NONE));
 					// Если необходимо сжимать сообщение перед отправкой
 					if(head.rsv[0]){
+						// Выполняем блокировку контекста компрессии на время сжатия
+						const lock_guard <std::recursive_mutex> lock(options->mtx);
 						/**
 						 * Определяем метод компрессии
 						 */
@@ -1594,6 +1682,94 @@ bool awh::server::Websocket2::send(const uint64_t bid, const char * buffer, cons
 	// Сообщаем что ничего не найдено
 	return false;
 }
+/**
+ * @brief Метод подписки брокера на тему рассылки
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ * @return      результат подписки
+ */
+bool awh::server::Websocket2::subscribe(const string & topic, const uint64_t bid) noexcept {
+	// Если брокер существует
+	if(this->_scheme.get(bid) != nullptr)
+		// Выполняем подписку брокера на тему
+		return this->_topics.subscribe(topic, bid);
+	// Сообщаем, что подписка не выполнена
+	return false;
+}
+/**
+ * @brief Метод отписки брокера от темы рассылки
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ */
+void awh::server::Websocket2::unsubscribe(const string & topic, const uint64_t bid) noexcept {
+	// Выполняем отписку брокера от темы
+	this->_topics.unsubscribe(topic, bid);
+}
+/**
+ * @brief Метод установки политики обработки медленных подписчиков темы
+ *
+ * @param topic  название темы
+ * @param policy политика обработки медленных подписчиков
+ * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+ */
+void awh::server::Websocket2::policy(const string & topic, const ws::topics_t::policy_t policy, const size_t limit) noexcept {
+	// Выполняем установку политики обработки медленных подписчиков
+	this->_topics.policy(topic, policy, limit);
+}
+/**
+ * @brief Метод получения статистики темы рассылки
+ *
+ * @param topic название темы
+ * @return      статистика темы
+ */
+awh::ws::topics_t::stat_t awh::server::Websocket2::topic(const string & topic) const noexcept {
+	// Выводим статистику темы
+	return this->_topics.stat(topic);
+}
+/**
+ * @brief Метод публикации сообщения всем подписчикам темы
+ *
+ * @param topic   название темы
+ * @param message передаваемое сообщения в бинарном виде
+ * @param text    данные передаются в текстовом виде
+ * @return        количество подписчиков в очередь которых поставлено сообщение
+ */
+size_t awh::server::Websocket2::publish(const string & topic, const vector <char> & message, const bool text) noexcept {
+	// Выполняем публикацию сообщения
+	return this->publish(topic, message.data(), message.size(), text);
+}
+/**
+ * @brief Метод публикации сообщения всем подписчикам темы
+ *
+ * @param topic   название темы
+ * @param message передаваемое сообщения в бинарном виде
+ * @param size    размер передаваемого сообещния
+ * @param text    данные передаются в текстовом виде
+ * @return        количество подписчиков в очередь которых поставлено сообщение
+ */
+size_t awh::server::Websocket2::publish(const string & topic, const char * message, const size_t size, const bool text) noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если подключение выполнено
+	if((this->_core != nullptr) && this->_core->working() && (message != nullptr) && (size > 0)){
+		// Создаём сообщение, общее для всех подписчиков темы
+		const auto & item = this->_topics.message(topic, message, size, text);
+		// Если у темы есть подписчики
+		if(item != nullptr){
+			// Выполняем перебор всех подписчиков темы
+			for(auto & bid : this->_topics.subscribers(topic)){
+				// Если очередь подписчика допускает сообщение и оно поставлено в очередь
+				if(this->_topics.admit(topic, bid, this->queued(bid), item) && this->push(bid, item))
+					// Увеличиваем количество подписчиков получивших сообщение
+					result++;
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод установки функций обратного вызова
  *
@@ -1869,6 +2045,19 @@ void awh::server::Websocket2::multiThreads(const uint16_t count, const bool mode
 	// Выполняем завершение всех потоков
 	} else this->_thr.stop();
 }
+/**
+ * @brief Метод получения метрик пула потоков извлечения сообщений
+ *
+ * @return метрики пула потоков
+ */
+awh::exec_t::stat_t awh::server::Websocket2::executor() const noexcept {
+	// Получаем метрики пула потоков HTTP/2
+	exec_t::stat_t result = this->_thr.stat();
+	// Добавляем метрики пула потоков HTTP/1.1
+	result += this->_ws1._thr.stat();
+	// Выводим результат
+	return result;
+}
 /**
  * @brief Метод установки максимального количества одновременных подключений
  *
@@ -2004,6 +2193,8 @@ void awh::server::Websocket2::core(const server::core_t * core) noexcept {
 		const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", &ws2_t::readEvents, this, _1, _2, _3, _4);
 		// Устанавливаем функцию записи данных
 		const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", &ws2_t::writeEvents, this, _1, _2, _3, _4);
+		// Устанавливаем функцию освобождения очереди отправки брокера
+		const_cast <server::core_t *> (this->_core)->on <void (const uint64_t, const size_t)> ("drain", &ws2_t::drainEvents, this, _1, _2);
 		// Добавляем событие аццепта брокера
 		const_cast <server::core_t *> (this->_core)->on <bool (const string &, const string &, const uint32_t, const uint64_t)> ("accept", &ws2_t::acceptEvents, this, _1, _2, _3, _4);
 	// Если объект сетевого ядра не передан но ранее оно было добавлено
@@ -2188,7 +2379,7 @@ void awh::server::Websocket2::encryption(const string & pass, const string & sal
  * @param log объект для работы с логами
  */
 awh::server::Websocket2::Websocket2(const fmk_t * fmk, const log_t * log) noexcept :
-web2_t(fmk, log), _threads(0), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _ws1(fmk, log), _scheme(fmk, log) {
+web2_t(fmk, log), _threads(0), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _thr(log), _ws1(fmk, log), _scheme(fmk, log), _topics(log) {
 	// Выполняем установку список настроек протокола HTTP/2
 	this->settings();
 	// Если размер фрейма не установлен
@@ -2204,7 +2395,7 @@ web2_t(fmk, log), _threads(0), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERV
  * @param log  объект для работы с логами
  */
 awh::server::Websocket2::Websocket2(const server::core_t * core, const fmk_t * fmk, const log_t * log) noexcept :
- web2_t(core, fmk, log), _threads(0), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _ws1(fmk, log), _scheme(fmk, log) {
+ web2_t(core, fmk, log), _threads(0), _frameSize(AWH_CHUNK_SIZE), _waitPong(PING_INTERVAL * 2), _thr(log), _ws1(fmk, log), _scheme(fmk, log), _topics(log) {
 	// Выполняем установку список настроек протокола HTTP/2
 	this->settings();
 	// Если размер фрейма не установлен
@@ -2223,6 +2414,8 @@ awh::server::Websocket2::Websocket2(const server::core_t * core, const fmk_t * f
 	const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("read", &ws2_t::readEvents, this, _1, _2, _3, _4);
 	// Устанавливаем функцию записи данных
 	const_cast <server::core_t *> (this->_core)->on <void (const char *, const size_t, const uint64_t, const uint16_t)> ("write", &ws2_t::writeEvents, this, _1, _2, _3, _4);
+	// Устанавливаем функцию освобождения очереди отправки брокера
+	const_cast <server::core_t *> (this->_core)->on <void (const uint64_t, const size_t)> ("drain", &ws2_t::drainEvents, this, _1, _2);
 	// Добавляем событие аццепта брокера
 	const_cast <server::core_t *> (this->_core)->on <bool (const string &, const string &, const uint32_t, const uint64_t)> ("accept", &ws2_t::acceptEvents, this, _1, _2, _3, _4);
 }
@@ -88,6 +88,73 @@ bool awh::server::Websocket::sendMessage(const uint64_t bid, const char * messag
 	// Выполняем отправку сообщения клиенту
 	return this->_ws.sendMessage(bid, message, size, text);
 }
+/**
+ * @brief Метод подписки брокера на тему рассылки
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ * @return      результат подписки
+ */
+bool awh::server::Websocket::subscribe(const string & topic, const uint64_t bid) noexcept {
+	// Выполняем подписку брокера на тему
+	return this->_ws.subscribe(topic, bid);
+}
+/**
+ * @brief Метод отписки брокера от темы рассылки
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ */
+void awh::server::Websocket::unsubscribe(const string & topic, const uint64_t bid) noexcept {
+	// Выполняем отписку брокера от темы
+	this->_ws.unsubscribe(topic, bid);
+}
+/**
+ * @brief Метод установки политики обработки медленных подписчиков темы
+ *
+ * @param topic  название темы
+ * @param policy политика обработки медленных подписчиков
+ * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+ */
+void awh::server::Websocket::policy(const string & topic, const ws::topics_t::policy_t policy, const size_t limit) noexcept {
+	// Выполняем установку политики обработки медленных подписчиков
+	this->_ws.policy(topic, policy, limit);
+}
+/**
+ * @brief Метод получения статистики темы рассылки
+ *
+ * @param topic название темы
+ * @return      статистика темы
+ */
+awh::ws::topics_t::stat_t awh::server::Websocket::topic(const string & topic) const noexcept {
+	// Выводим статистику темы
+	return this->_ws.topic(topic);
+}
+/**
+ * @brief Метод публикации сообщения всем подписчикам темы
+ *
+ * @param topic   название темы
+ * @param message передаваемое сообщения в бинарном виде
+ * @param text    данные передаются в текстовом виде
+ * @return        количество подписчиков в очередь которых поставлено сообщение
+ */
+size_t awh::server::Websocket::publish(const string & topic, const vector <char> & message, const bool text) noexcept {
+	// Выполняем публикацию сообщения
+	return this->_ws.publish(topic, message, text);
+}
+/**
+ * @brief Метод публикации сообщения всем подписчикам темы
+ *
+ * @param topic   название темы
+ * @param message передаваемое сообщения в бинарном виде
+ * @param size    размер передаваемого сообещния
+ * @param text    данные передаются в текстовом виде
+ * @return        количество подписчиков в очередь которых поставлено сообщение
+ */
+size_t awh::server::Websocket::publish(const string & topic, const char * message, const size_t size, const bool text) noexcept {
+	// Выполняем публикацию сообщения
+	return this->_ws.publish(topic, message, size, text);
+}
 /**
  * @brief Метод установки функций обратного вызова
  *
@@ -227,6 +294,15 @@ void awh::server::Websocket::multiThreads(const uint16_t count, const bool mode)
 	// Выполняем активацию многопоточности
 	this->_ws.multiThreads(count, mode);
 }
+/**
+ * @brief Метод получения метрик пула потоков извлечения сообщений
+ *
+ * @return метрики пула потоков
+ */
+awh::exec_t::stat_t awh::server::Websocket::executor() const noexcept {
+	// Выводим метрики пула потоков
+	return this->_ws.executor();
+}
 /**
  * @brief Метод установки максимального количества одновременных подключений
  *
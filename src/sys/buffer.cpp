@@ -40,6 +40,8 @@ void awh::Buffer::clear() noexcept {
 	try {
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
+		// Сбрасываем курсор чтения
+		this->_offset = 0;
 		// Выполняем очистку буфера данных
 		this->_buffer.clear();
 		// Если размер выделенной памяти выше максимального размера буфера
@@ -72,7 +74,7 @@ void awh::Buffer::clear() noexcept {
  */
 bool awh::Buffer::empty() const noexcept {
 	// Выводим результат проверки
-	return this->_buffer.empty();
+	return (this->_offset >= this->_buffer.size());
 }
 /**
  * @brief Метод получения размера добавленных данных
@@ -80,8 +82,8 @@ bool awh::Buffer::empty() const noexcept {
  * @return размер всех добавленных данных
  */
 size_t awh::Buffer::size() const noexcept {
-	// Выводим размер данных в буфере
-	return this->_buffer.size();
+	// Выводим размер непрочитанных данных в буфере
+	return (this->_buffer.size() - this->_offset);
 }
 /**
  * @brief Метод получения размера выделенной памяти
@@ -186,7 +188,7 @@ T awh::Buffer::back() const noexcept {
 		// Получаем размер данных
 		const size_t size = sizeof(result);
 		// Выполняем копирование данных контейнера
-		::memcpy(&result, this->get() + (this->_buffer.size() - size), size);
+		::memcpy(&result, this->get() + (this->size() - size), size);
 	}
 	// Выводим результат
 	return result;
@@ -348,9 +350,22 @@ template void awh::Buffer::set(const double, const size_t) noexcept;
  */
 const uint8_t * awh::Buffer::get() const noexcept {
 	// Если мы не дошли до конца
-	if(!this->_buffer.empty())
-		// Выводим буфер данных
-		return this->_buffer.data();
+	if(!this->empty())
+		// Выводим буфер данных начиная с курсора чтения
+		return (this->_buffer.data() + this->_offset);
+	// Выводим пустое значение
+	return nullptr;
+}
+/**
+ * @brief Получения данных очереди для изменения на месте
+ *
+ * @return указатель на элемент очереди
+ */
+uint8_t * awh::Buffer::get() noexcept {
+	// Если мы не дошли до конца
+	if(!this->empty())
+		// Выводим буфер данных начиная с курсора чтения
+		return (this->_buffer.data() + this->_offset);
 	// Выводим пустое значение
 	return nullptr;
 }
@@ -366,14 +381,19 @@ void awh::Buffer::erase(const size_t size) noexcept {
 	try {
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
-		// Если мы не дошли до конца
-		if(!this->_buffer.empty())
-			// Выполняем удаление указанного количества байт вначале буфера
-			this->_buffer.erase(this->_buffer.begin(), this->_buffer.begin() + size);
-		// Если размер выделенной памяти выше максимального размера буфера
-		if(this->_buffer.empty() && (this->_buffer.capacity() > AWH_BUFFER_SIZE))
-			// Выполняем очистку временного буфера данных
-			vector <decltype(this->_buffer)::value_type> ().swap(this->_buffer);
+		// Выполняем сдвиг курсора чтения, данные в буфере не перемещаются
+		this->_offset += std::min(size, this->_buffer.size() - this->_offset);
+		// Если все данные буфера прочитаны
+		if(this->_offset >= this->_buffer.size()){
+			// Сбрасываем курсор чтения
+			this->_offset = 0;
+			// Выполняем очистку буфера данных
+			this->_buffer.clear();
+			// Если размер выделенной памяти выше максимального размера буфера
+			if(this->_buffer.capacity() > AWH_BUFFER_SIZE)
+				// Выполняем очистку временного буфера данных
+				vector <decltype(this->_buffer)::value_type> ().swap(this->_buffer);
+		}
 	/**
 	 * Если возникает ошибка
 	 */
@@ -405,8 +425,8 @@ void awh::Buffer::reserve(const size_t size) noexcept {
 	try {
 		// Выполняем блокировку потока
 		const lock_guard <std::mutex> lock(this->_mtx);
-		// Выделяем нужное количество памяти буферу данных
-		this->_buffer.reserve(size);
+		// Выделяем нужное количество памяти буферу данных с учётом прочитанной части
+		this->_buffer.reserve(this->_offset + size);
 	/**
 	 * Если возникает ошибка
 	 */
@@ -441,6 +461,20 @@ void awh::Buffer::push(const void * buffer, const size_t size) noexcept {
 		try {
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
+			// Если в начале буфера есть прочитанные данные и новые данные не помещаются в выделенную память
+			if((this->_offset > 0) && ((this->_buffer.size() + size) > this->_buffer.capacity())){
+				// Получаем размер непрочитанных данных
+				const size_t pending = (this->_buffer.size() - this->_offset);
+				// Если прочитанная часть не меньше оставшейся, каждый байт переносится не чаще одного раза на равный объём прочитанных
+				if(this->_offset >= pending){
+					// Выполняем перенос непрочитанных данных в начало буфера
+					::memmove(this->_buffer.data(), this->_buffer.data() + this->_offset, pending);
+					// Уменьшаем размер буфера до непрочитанных данных
+					this->_buffer.resize(pending);
+					// Сбрасываем курсор чтения
+					this->_offset = 0;
+				}
+			}
 			// Добавляем новые данные в буфер
 			this->_buffer.insert(this->_buffer.end(), reinterpret_cast <const uint8_t *> (buffer), reinterpret_cast <const uint8_t *> (buffer) + size);
 		/**
@@ -475,6 +509,8 @@ void awh::Buffer::swap(buffer_t & buffer) noexcept {
 	const lock_guard <std::mutex> lock2(buffer._mtx);
 	// Выполняем обмен буферами
 	this->_buffer.swap(buffer._buffer);
+	// Выполняем обмен курсорами чтения
+	std::swap(this->_offset, buffer._offset);
 }
 /**
  * @brief Получения размера данных в буфере
@@ -483,7 +519,7 @@ void awh::Buffer::swap(buffer_t & buffer) noexcept {
  */
 awh::Buffer::operator size_t() const noexcept {
 	// Выводим размер контейнера
-	return this->_buffer.size();
+	return this->size();
 }
 /**
  * @brief Получения бинарных данных буфера
@@ -492,7 +528,7 @@ awh::Buffer::operator size_t() const noexcept {
  */
 awh::Buffer::operator const char * () const noexcept {
 	// Выводим содержимое контейнера
-	return reinterpret_cast <const char *> (this->_buffer.data());
+	return reinterpret_cast <const char *> (this->_buffer.data() + this->_offset);
 }
 /**
  * @brief Оператор перемещения
@@ -513,6 +549,10 @@ awh::Buffer & awh::Buffer::operator = (buffer_t && buffer) noexcept {
 			const lock_guard <std::mutex> lock2(buffer._mtx);
 			// Выполняем перемещения данных буфера
 			this->_buffer = ::move(buffer._buffer);
+			// Выполняем перемещение курсора чтения
+			this->_offset = buffer._offset;
+			// Сбрасываем курсор чтения перемещённого буфера
+			buffer._offset = 0;
 		/**
 		 * Если возникает ошибка
 		 */
@@ -550,8 +590,10 @@ awh::Buffer & awh::Buffer::operator = (const buffer_t & buffer) noexcept {
 		try {
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
-			// Выполняем перемещения данных буфера
-			this->_buffer.assign(buffer._buffer.begin(), buffer._buffer.end());
+			// Выполняем копирование непрочитанных данных буфера
+			this->_buffer.assign(buffer.get(), buffer.get() + buffer.size());
+			// Сбрасываем курсор чтения
+			this->_offset = 0;
 		/**
 		 * Если возникает ошибка
 		 */
@@ -582,7 +624,7 @@ awh::Buffer & awh::Buffer::operator = (const buffer_t & buffer) noexcept {
  */
 uint8_t awh::Buffer::operator [](const size_t index) const noexcept {
 	// Если буфер не пустой и индекс существует
-	if(!this->_buffer.empty() && (index < this->_buffer.size()))
+	if(!this->empty() && (index < this->size()))
 		// Выводим индекс массива
 		return this->get()[index];
 	// Выводим пустое значение
@@ -597,8 +639,8 @@ uint8_t awh::Buffer::operator [](const size_t index) const noexcept {
 bool awh::Buffer::operator == (const buffer_t & buffer) const noexcept {
 	// Выполняем сравнение данных
 	return (
-		(this->_buffer.size() == buffer._buffer.size()) &&
-		(::memcmp(this->_buffer.data(), buffer._buffer.data(), this->_buffer.size()) == 0)
+		(this->size() == buffer.size()) &&
+		(this->empty() || (::memcmp(this->get(), buffer.get(), this->size()) == 0))
 	);
 }
 /**
@@ -606,7 +648,7 @@ bool awh::Buffer::operator == (const buffer_t & buffer) const noexcept {
  *
  * @param buffer буфер данных для перемещения
  */
-awh::Buffer::Buffer(buffer_t && buffer) noexcept {
+awh::Buffer::Buffer(buffer_t && buffer) noexcept : _offset(0), _log(buffer._log) {
 	// Если данные переданы правильно
 	if(!buffer.empty()){
 		/**
@@ -619,6 +661,10 @@ awh::Buffer::Buffer(buffer_t && buffer) noexcept {
 			const lock_guard <std::mutex> lock2(buffer._mtx);
 			// Выполняем перемещения данных буфера
 			this->_buffer = ::move(buffer._buffer);
+			// Выполняем перемещение курсора чтения
+			this->_offset = buffer._offset;
+			// Сбрасываем курсор чтения перемещённого буфера
+			buffer._offset = 0;
 		/**
 		 * Если возникает ошибка
 		 */
@@ -644,7 +690,7 @@ awh::Buffer::Buffer(buffer_t && buffer) noexcept {
  *
  * @param buffer буфер данных для копирования
  */
-awh::Buffer::Buffer(const buffer_t & buffer) noexcept {
+awh::Buffer::Buffer(const buffer_t & buffer) noexcept : _offset(0), _log(buffer._log) {
 	// Если данные переданы правильно
 	if(!buffer.empty()){
 		/**
@@ -653,8 +699,10 @@ awh::Buffer::Buffer(const buffer_t & buffer) noexcept {
 		try {
 			// Выполняем блокировку потока
 			const lock_guard <std::mutex> lock(this->_mtx);
-			// Выполняем перемещения данных буфера
-			this->_buffer.assign(buffer._buffer.begin(), buffer._buffer.end());
+			// Выполняем копирование непрочитанных данных буфера
+			this->_buffer.assign(buffer.get(), buffer.get() + buffer.size());
+			// Сбрасываем курсор чтения
+			this->_offset = 0;
 		/**
 		 * Если возникает ошибка
 		 */
@@ -0,0 +1,277 @@
+/**
+ * @file: chain.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные библиотеки
+ */
+#include <algorithm>
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <sys/chain.hpp>
+
+/**
+ * Подписываемся на стандартное пространство имён
+ */
+using namespace std;
+
+/**
+ * @brief Метод очистки всех данных цепочки
+ *
+ */
+void awh::Chain::clear() noexcept {
+	// Сбрасываем размер непрочитанных данных
+	this->_size = 0;
+	// Выполняем очистку списка сегментов
+	this->_segments.clear();
+}
+/**
+ * @brief Метод проверки на заполненность цепочки
+ *
+ * @return результат проверки
+ */
+bool awh::Chain::empty() const noexcept {
+	// Выводим результат проверки
+	return (this->_size == 0);
+}
+/**
+ * @brief Метод получения размера непрочитанных данных
+ *
+ * @return размер всех непрочитанных данных
+ */
+size_t awh::Chain::size() const noexcept {
+	// Выводим размер непрочитанных данных
+	return this->_size;
+}
+/**
+ * @brief Метод получения количества сегментов
+ *
+ * @return количество сегментов в цепочке
+ */
+size_t awh::Chain::count() const noexcept {
+	// Выводим количество сегментов
+	return this->_segments.size();
+}
+/**
+ * @brief Метод получения данных первого сегмента
+ *
+ * @return указатель на непрочитанные данные первого сегмента
+ */
+const char * awh::Chain::get() const noexcept {
+	// Если сегменты в цепочке существуют
+	if(!this->_segments.empty())
+		// Выводим непрочитанные данные первого сегмента
+		return (this->_segments.front().data + this->_segments.front().offset);
+	// Выводим пустое значение
+	return nullptr;
+}
+/**
+ * @brief Метод получения размера первого сегмента
+ *
+ * @return размер непрочитанных данных первого сегмента
+ */
+size_t awh::Chain::front() const noexcept {
+	// Если сегменты в цепочке существуют
+	if(!this->_segments.empty())
+		// Выводим размер непрочитанных данных первого сегмента
+		return (this->_segments.front().size - this->_segments.front().offset);
+	// Выводим пустое значение
+	return 0;
+}
+/**
+ * @brief Метод получения владельца данных первого сегмента
+ *
+ * @return владелец данных (пустое значение, если данные скопированы в цепочку)
+ */
+std::shared_ptr <const void> awh::Chain::owner() const noexcept {
+	// Если сегменты в цепочке существуют
+	if(!this->_segments.empty())
+		// Выводим владельца данных первого сегмента
+		return this->_segments.front().owner;
+	// Выводим пустое значение
+	return nullptr;
+}
+/**
+ * @brief Метод удаления указанного количества прочитанных байт
+ *
+ * @param size количество байт для удаления
+ */
+void awh::Chain::erase(const size_t size) noexcept {
+	// Количество оставшихся байт для удаления
+	size_t amount = std::min(size, this->_size);
+	// Уменьшаем размер непрочитанных данных
+	this->_size -= amount;
+	// Выполняем удаление прочитанных данных
+	while((amount > 0) && !this->_segments.empty()){
+		// Получаем первый сегмент цепочки
+		segment_t & segment = this->_segments.front();
+		// Получаем количество непрочитанных байт сегмента
+		const size_t bytes = (segment.size - segment.offset);
+		// Если сегмент прочитан не полностью
+		if(amount < bytes){
+			// Выполняем сдвиг смещения прочитанных данных
+			segment.offset += amount;
+			// Выходим из цикла
+			break;
+		}
+		// Уменьшаем количество оставшихся байт для удаления
+		amount -= bytes;
+		// Удаляем прочитанный сегмент, владелец данных освобождается
+		this->_segments.pop_front();
+	}
+}
+/**
+ * @brief Метод экспорта сегментов для векторной отправки
+ *
+ * @param records список записей для заполнения
+ * @param max     максимальное количество записей
+ * @param limit   максимальный размер экспортируемых данных
+ * @return        количество заполненных записей
+ */
+size_t awh::Chain::records(record_t * records, const size_t max, const size_t limit) const noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если список записей передан
+	if((records != nullptr) && (max > 0) && (limit > 0)){
+		// Размер экспортированных данных
+		size_t size = 0;
+		// Выполняем перебор всех сегментов цепочки
+		for(auto & segment : this->_segments){
+			// Если достигнуты ограничения экспорта
+			if((result >= max) || (size >= limit))
+				// Выходим из цикла
+				break;
+			// Получаем количество экспортируемых байт сегмента
+			const size_t bytes = std::min(segment.size - segment.offset, limit - size);
+			// Выполняем заполнение записи
+			records[result++] = std::make_pair(segment.data + segment.offset, bytes);
+			// Увеличиваем размер экспортированных данных
+			size += bytes;
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод добавления данных в цепочку с копированием
+ *
+ * @param buffer бинарный буфер для добавления
+ * @param size   размер бинарного буфера
+ */
+void awh::Chain::push(const void * buffer, const size_t size) noexcept {
+	// Если данные переданы правильно
+	if((buffer != nullptr) && (size > 0)){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Если последний сегмент собственный и данные помещаются в него
+			if(!this->_segments.empty() && (this->_segments.back().owner == nullptr) &&
+			  ((this->_segments.back().buffer.size() + size) <= AWH_CHAIN_SEGMENT)){
+				// Получаем последний сегмент цепочки
+				segment_t & segment = this->_segments.back();
+				// Добавляем данные в собственный буфер сегмента
+				segment.buffer.insert(segment.buffer.end(), reinterpret_cast <const char *> (buffer), reinterpret_cast <const char *> (buffer) + size);
+				// Обновляем указатель на данные, буфер мог быть перевыделен
+				segment.data = segment.buffer.data();
+				// Обновляем размер данных сегмента
+				segment.size = segment.buffer.size();
+			// Создаём новый собственный сегмент
+			} else {
+				// Создаём новый сегмент цепочки
+				this->_segments.emplace_back();
+				// Получаем последний сегмент цепочки
+				segment_t & segment = this->_segments.back();
+				// Резервируем память для объединения последующих мелких данных
+				segment.buffer.reserve(std::max(size, static_cast <size_t> (AWH_CHAIN_SEGMENT >> 2)));
+				// Выполняем копирование данных в собственный буфер сегмента
+				segment.buffer.assign(reinterpret_cast <const char *> (buffer), reinterpret_cast <const char *> (buffer) + size);
+				// Устанавливаем указатель на данные
+				segment.data = segment.buffer.data();
+				// Устанавливаем размер данных сегмента
+				segment.size = segment.buffer.size();
+			}
+			// Увеличиваем размер непрочитанных данных
+			this->_size += size;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+}
+/**
+ * @brief Метод добавления данных в цепочку по ссылке без копирования
+ *
+ * @param buffer бинарный буфер для добавления
+ * @param size   размер бинарного буфера
+ * @param owner  владелец данных, удерживающий их до отправки (если не передан или данные меньше 4Kb, данные копируются)
+ */
+void awh::Chain::push(const void * buffer, const size_t size, const std::shared_ptr <const void> & owner) noexcept {
+	// Если владелец данных не передан или данные настолько малы, что их дешевле скопировать
+	if((owner == nullptr) || (size < static_cast <size_t> (AWH_CHAIN_SEGMENT >> 2)))
+		// Выполняем добавление данных с копированием
+		this->push(buffer, size);
+	// Если данные переданы правильно
+	else if((buffer != nullptr) && (size > 0)) {
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Создаём новый сегмент цепочки
+			this->_segments.emplace_back();
+			// Получаем последний сегмент цепочки
+			segment_t & segment = this->_segments.back();
+			// Устанавливаем размер данных сегмента
+			segment.size = size;
+			// Устанавливаем владельца данных
+			segment.owner = owner;
+			// Устанавливаем указатель на данные
+			segment.data = reinterpret_cast <const char *> (buffer);
+			// Увеличиваем размер непрочитанных данных
+			this->_size += size;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+}
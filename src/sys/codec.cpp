@@ -0,0 +1,1285 @@
+/**
+ * @file: codec.cpp
+ * @date: 2025-03-02
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные библиотеки
+ */
+#include <algorithm>
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <sys/codec.hpp>
+
+/**
+ * Подписываемся на стандартное пространство имён
+ */
+using namespace std;
+
+/**
+ * Размер буфера чанка в байтах
+ */
+static constexpr uint32_t CHUNK_BUFFER_SIZE = 0x10000;
+/**
+ * Максимальный размер данных передаваемых библиотеке компрессии за один вызов
+ */
+static constexpr size_t CHUNK_INPUT_SIZE = 0x40000000;
+
+/**
+ * @brief Метод создания контекста компрессии
+ *
+ * @return результат создания контекста
+ */
+bool awh::Codec::open() noexcept {
+	// Результат работы функции
+	bool result = false;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Размер буфера промежуточных данных
+		size_t size = CHUNK_BUFFER_SIZE;
+		/**
+		 * Определяем метод компрессии
+		 */
+		switch(static_cast <uint8_t> (this->_method)){
+			// Если метод компрессии LZ4
+			case static_cast <uint8_t> (hash_t::method_t::LZ4): {
+				// Если необходимо выполнить компрессию данных
+				if(this->_event == hash_t::event_t::ENCODE){
+					// Заполняем параметры компрессора нулями
+					::memset(&this->_lz4p, 0, sizeof(this->_lz4p));
+					// Устанавливаем размер блока данных
+					this->_lz4p.frameInfo.blockSizeID = LZ4F_max64KB;
+					// Устанавливаем уровень компрессии
+					this->_lz4p.compressionLevel = this->level();
+					// Получаем размер буфера необходимый для компрессии чанка
+					size = std::max(size, ::LZ4F_compressBound(CHUNK_BUFFER_SIZE, &this->_lz4p));
+					// Выполняем создание контекста компрессора
+					result = !::LZ4F_isError(::LZ4F_createCompressionContext(&this->_lz4c, LZ4F_VERSION));
+				// Выполняем создание контекста декомпрессора
+				} else result = !::LZ4F_isError(::LZ4F_createDecompressionContext(&this->_lz4d, LZ4F_VERSION));
+			} break;
+			// Если метод компрессии LZma
+			case static_cast <uint8_t> (hash_t::method_t::LZMA): {
+				// Выполняем инициализацию потока
+				this->_lzma = LZMA_STREAM_INIT;
+				// Если необходимо выполнить компрессию данных
+				if(this->_event == hash_t::event_t::ENCODE){
+					// Опции компрессора LZma
+					lzma_options_lzma options;
+					// Если опции компрессора получены
+					if(!::lzma_lzma_preset(&options, static_cast <uint32_t> (this->level()))){
+						// Инициализируем фильтры компрессора LZma
+						lzma_filter filters[] = {
+							{LZMA_FILTER_LZMA2, &options},
+							{LZMA_VLI_UNKNOWN, nullptr}
+						};
+						// Выполняем инициализацию компрессора
+						result = (::lzma_stream_encoder(&this->_lzma, filters, LZMA_CHECK_NONE) == LZMA_OK);
+					}
+				// Выполняем инициализацию декомпрессора
+				} else result = (::lzma_stream_decoder(&this->_lzma, UINT64_MAX, 0) == LZMA_OK);
+			} break;
+			// Если метод компрессии Zstandard
+			case static_cast <uint8_t> (hash_t::method_t::ZSTD): {
+				// Если необходимо выполнить компрессию данных
+				if(this->_event == hash_t::event_t::ENCODE){
+					// Выполняем создание контекста компрессора
+					this->_zstdc = ::ZSTD_createCStream();
+					// Получаем размер буфера исходящих данных
+					size = std::max(size, ::ZSTD_CStreamOutSize());
+					// Если контекст компрессора создан, устанавливаем уровень компрессии
+					result = ((this->_zstdc != nullptr) && !::ZSTD_isError(::ZSTD_CCtx_setParameter(this->_zstdc, ZSTD_c_compressionLevel, this->level())));
+				// Если необходимо выполнить декомпрессию данных
+				} else {
+					// Выполняем создание контекста декомпрессора
+					this->_zstdd = ::ZSTD_createDStream();
+					// Получаем размер буфера исходящих данных
+					size = std::max(size, ::ZSTD_DStreamOutSize());
+					// Запоминаем результат создания контекста
+					result = (this->_zstdd != nullptr);
+				}
+			} break;
+			// Если метод компрессии GZip
+			case static_cast <uint8_t> (hash_t::method_t::GZIP):
+			// Если метод компрессии Deflate
+			case static_cast <uint8_t> (hash_t::method_t::DEFLATE): {
+				// Заполняем поток нулями
+				::memset(&this->_zlib, 0, sizeof(this->_zlib));
+				// Получаем размер скользящего окна (для GZip добавляем заголовок, для Deflate используем сырой поток)
+				const int32_t wbit = (this->_method == hash_t::method_t::GZIP ? (this->_wbit | 16) : -1 * this->_wbit);
+				// Если необходимо выполнить компрессию данных
+				if(this->_event == hash_t::event_t::ENCODE)
+					// Выполняем инициализацию компрессора
+					result = (::deflateInit2(&this->_zlib, this->level(), Z_DEFLATED, wbit, MOD_GZIP_ZLIB_CFACTOR, Z_DEFAULT_STRATEGY) == Z_OK);
+				// Выполняем инициализацию декомпрессора
+				else result = (::inflateInit2(&this->_zlib, wbit) == Z_OK);
+			} break;
+			// Если метод компрессии BZip2
+			case static_cast <uint8_t> (hash_t::method_t::BZIP2): {
+				// Заполняем поток нулями
+				::memset(&this->_bzip2, 0, sizeof(this->_bzip2));
+				// Если необходимо выполнить компрессию данных
+				if(this->_event == hash_t::event_t::ENCODE)
+					// Выполняем инициализацию компрессора
+					result = (::BZ2_bzCompressInit(&this->_bzip2, this->level(), 0, 0) == BZ_OK);
+				// Выполняем инициализацию декомпрессора
+				else result = (::BZ2_bzDecompressInit(&this->_bzip2, 0, 0) == BZ_OK);
+			} break;
+			// Если метод компрессии Brotli
+			case static_cast <uint8_t> (hash_t::method_t::BROTLI): {
+				// Если необходимо выполнить компрессию данных
+				if(this->_event == hash_t::event_t::ENCODE){
+					// Выполняем создание стейта энкодера
+					this->_brotlie = ::BrotliEncoderCreateInstance(nullptr, nullptr, nullptr);
+					// Если стейт энкодера создан, устанавливаем уровень компрессии
+					result = ((this->_brotlie != nullptr) && ::BrotliEncoderSetParameter(this->_brotlie, BROTLI_PARAM_QUALITY, static_cast <uint32_t> (this->level())));
+				// Если необходимо выполнить декомпрессию данных
+				} else {
+					// Выполняем создание стейта декодера
+					this->_brotlid = ::BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+					// Запоминаем результат создания стейта
+					result = (this->_brotlid != nullptr);
+				}
+			} break;
+		}
+		// Запоминаем результат инициализации
+		this->_init = result;
+		// Если контекст создан
+		if(result){
+			// Сбрасываем флаг завершения сообщения
+			this->_end = false;
+			// Сбрасываем флаг начала сообщения
+			this->_begin = false;
+			// Выделяем память для буфера промежуточных данных
+			this->_buffer.resize(size);
+		// Освобождаем частично созданный контекст
+		} else this->close();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		// Освобождаем частично созданный контекст
+		this->close();
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, {}, log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод освобождения контекста компрессии
+ *
+ */
+void awh::Codec::close() noexcept {
+	/**
+	 * Определяем метод компрессии
+	 */
+	switch(static_cast <uint8_t> (this->_method)){
+		// Если метод компрессии LZ4
+		case static_cast <uint8_t> (hash_t::method_t::LZ4): {
+			// Если контекст компрессора создан
+			if(this->_lz4c != nullptr)
+				// Выполняем удаление контекста компрессора
+				::LZ4F_freeCompressionContext(this->_lz4c);
+			// Если контекст декомпрессора создан
+			if(this->_lz4d != nullptr)
+				// Выполняем удаление контекста декомпрессора
+				::LZ4F_freeDecompressionContext(this->_lz4d);
+		} break;
+		// Если метод компрессии LZma
+		case static_cast <uint8_t> (hash_t::method_t::LZMA):
+			// Выполняем освобождение потока
+			::lzma_end(&this->_lzma);
+		break;
+		// Если метод компрессии Zstandard
+		case static_cast <uint8_t> (hash_t::method_t::ZSTD): {
+			// Если контекст компрессора создан
+			if(this->_zstdc != nullptr)
+				// Выполняем удаление контекста компрессора
+				::ZSTD_freeCStream(this->_zstdc);
+			// Если контекст декомпрессора создан
+			if(this->_zstdd != nullptr)
+				// Выполняем удаление контекста декомпрессора
+				::ZSTD_freeDStream(this->_zstdd);
+		} break;
+		// Если метод компрессии GZip
+		case static_cast <uint8_t> (hash_t::method_t::GZIP):
+		// Если метод компрессии Deflate
+		case static_cast <uint8_t> (hash_t::method_t::DEFLATE): {
+			// Если необходимо выполнить компрессию данных
+			if(this->_event == hash_t::event_t::ENCODE)
+				// Завершаем работу компрессора
+				::deflateEnd(&this->_zlib);
+			// Завершаем работу декомпрессора
+			else ::inflateEnd(&this->_zlib);
+		} break;
+		// Если метод компрессии BZip2
+		case static_cast <uint8_t> (hash_t::method_t::BZIP2): {
+			// Если необходимо выполнить компрессию данных
+			if(this->_event == hash_t::event_t::ENCODE)
+				// Завершаем работу компрессора
+				::BZ2_bzCompressEnd(&this->_bzip2);
+			// Завершаем работу декомпрессора
+			else ::BZ2_bzDecompressEnd(&this->_bzip2);
+		} break;
+		// Если метод компрессии Brotli
+		case static_cast <uint8_t> (hash_t::method_t::BROTLI): {
+			// Если стейт энкодера создан
+			if(this->_brotlie != nullptr)
+				// Выполняем удаление стейта энкодера
+				::BrotliEncoderDestroyInstance(this->_brotlie);
+			// Если стейт декодера создан
+			if(this->_brotlid != nullptr)
+				// Выполняем удаление стейта декодера
+				::BrotliDecoderDestroyInstance(this->_brotlid);
+		} break;
+	}
+	// Сбрасываем флаг инициализации контекста
+	this->_init = false;
+	// Сбрасываем контексты LZ4
+	this->_lz4c = nullptr;
+	this->_lz4d = nullptr;
+	// Сбрасываем контексты Zstandard
+	this->_zstdc = nullptr;
+	this->_zstdd = nullptr;
+	// Сбрасываем стейты Brotli
+	this->_brotlie = nullptr;
+	this->_brotlid = nullptr;
+}
+/**
+ * @brief Метод подготовки контекста компрессии к новому сообщению
+ *
+ * @return результат подготовки контекста
+ */
+bool awh::Codec::restart() noexcept {
+	// Сбрасываем флаг завершения сообщения
+	this->_end = false;
+	// Сбрасываем флаг начала сообщения
+	this->_begin = false;
+	/**
+	 * Определяем метод компрессии
+	 */
+	switch(static_cast <uint8_t> (this->_method)){
+		// Если метод компрессии LZ4
+		case static_cast <uint8_t> (hash_t::method_t::LZ4): {
+			// Если необходимо выполнить декомпрессию данных
+			if(this->_event == hash_t::event_t::DECODE)
+				// Выполняем сброс контекста декомпрессора
+				::LZ4F_resetDecompressionContext(this->_lz4d);
+			// Компрессор начинает новый фрейм при следующей записи
+			return true;
+		}
+		// Если метод компрессии Zstandard
+		case static_cast <uint8_t> (hash_t::method_t::ZSTD): {
+			// Если необходимо выполнить компрессию данных
+			if(this->_event == hash_t::event_t::ENCODE)
+				// Выполняем сброс сессии компрессора с сохранением параметров
+				return !::ZSTD_isError(::ZSTD_CCtx_reset(this->_zstdc, ZSTD_reset_session_only));
+			// Выполняем сброс сессии декомпрессора
+			return !::ZSTD_isError(::ZSTD_DCtx_reset(this->_zstdd, ZSTD_reset_session_only));
+		}
+		// Если метод компрессии GZip
+		case static_cast <uint8_t> (hash_t::method_t::GZIP):
+		// Если метод компрессии Deflate
+		case static_cast <uint8_t> (hash_t::method_t::DEFLATE): {
+			// Если необходимо выполнить компрессию данных
+			if(this->_event == hash_t::event_t::ENCODE)
+				// Выполняем сброс компрессора без освобождения памяти
+				return (::deflateReset(&this->_zlib) == Z_OK);
+			// Выполняем сброс декомпрессора без освобождения памяти
+			return (::inflateReset(&this->_zlib) == Z_OK);
+		}
+	}
+	// Библиотеки LZma, BZip2 и Brotli не поддерживают сброс, пересоздаём контекст
+	this->close();
+	// Выполняем создание нового контекста
+	return this->open();
+}
+/**
+ * @brief Метод получения уровня компрессии для активного метода
+ *
+ * @return уровень компрессии библиотеки
+ */
+int32_t awh::Codec::level() const noexcept {
+	// Индекс уровня компрессии
+	uint8_t index = 0;
+	/**
+	 * Определяем уровень компрессии
+	 */
+	switch(static_cast <uint8_t> (this->_level)){
+		// Если установлен максимальный уровень компрессии
+		case static_cast <uint8_t> (hash_t::level_t::BEST):
+			// Устанавливаем индекс уровня компрессии
+			index = 2;
+		break;
+		// Если установлена максимальная скорость компрессии
+		case static_cast <uint8_t> (hash_t::level_t::SPEED):
+			// Устанавливаем индекс уровня компрессии
+			index = 0;
+		break;
+		// Для остальных случаев устанавливаем нормальный уровень
+		default: index = 1;
+	}
+	/**
+	 * Определяем метод компрессии
+	 */
+	switch(static_cast <uint8_t> (this->_method)){
+		// Если метод компрессии LZ4 (отрицательный уровень задаёт ускорение, от 3 включается LZ4HC)
+		case static_cast <uint8_t> (hash_t::method_t::LZ4): {
+			// Уровни компрессии LZ4
+			static constexpr int32_t levels[3] = {-2, 0, 9};
+			// Выводим уровень компрессии
+			return levels[index];
+		}
+		// Если метод компрессии LZma
+		case static_cast <uint8_t> (hash_t::method_t::LZMA): {
+			// Уровни компрессии LZma
+			static constexpr int32_t levels[3] = {0, LZMA_PRESET_DEFAULT, 9};
+			// Выводим уровень компрессии
+			return levels[index];
+		}
+		// Если метод компрессии Zstandard
+		case static_cast <uint8_t> (hash_t::method_t::ZSTD): {
+			// Уровни компрессии Zstandard
+			static constexpr int32_t levels[3] = {1, ZSTD_CLEVEL_DEFAULT, 19};
+			// Выводим уровень компрессии
+			return levels[index];
+		}
+		// Если метод компрессии BZip2 (размер блока в сотнях килобайт)
+		case static_cast <uint8_t> (hash_t::method_t::BZIP2): {
+			// Уровни компрессии BZip2
+			static constexpr int32_t levels[3] = {1, 5, 9};
+			// Выводим уровень компрессии
+			return levels[index];
+		}
+		// Если метод компрессии Brotli
+		case static_cast <uint8_t> (hash_t::method_t::BROTLI): {
+			// Уровни компрессии Brotli
+			static constexpr int32_t levels[3] = {1, 5, BROTLI_MAX_QUALITY};
+			// Выводим уровень компрессии
+			return levels[index];
+		}
+	}
+	// Уровни компрессии GZip и Deflate
+	static constexpr int32_t levels[3] = {Z_BEST_SPEED, Z_DEFAULT_COMPRESSION, Z_BEST_COMPRESSION};
+	// Выводим уровень компрессии
+	return levels[index];
+}
+/**
+ * @brief Метод обработки данных активным методом компрессии
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::process(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Результат работы функции
+	bool status = false;
+	// Если контекст компрессии создан
+	if(this->_init){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Если предыдущее сообщение декодировано полностью, а пришли новые данные
+			if((this->_event == hash_t::event_t::DECODE) && this->_end && (size > 0) && !this->restart())
+				// Выводим результат
+				return status;
+			// Смещение в буфере данных
+			size_t offset = 0;
+			/**
+			 * Выполняем обработку данных частями допустимыми для библиотек компрессии
+			 */
+			do {
+				// Получаем размер обрабатываемой части данных
+				const size_t actual = std::min(size - offset, CHUNK_INPUT_SIZE);
+				// Получаем режим обработки части данных (сброс выполняется только для последней части)
+				const mode_t current = ((offset + actual) < size ? mode_t::WRITE : mode);
+				// Получаем указатель на обрабатываемую часть данных
+				const char * data = (buffer != nullptr ? buffer + offset : nullptr);
+				/**
+				 * Определяем метод компрессии
+				 */
+				switch(static_cast <uint8_t> (this->_method)){
+					// Если метод компрессии LZ4
+					case static_cast <uint8_t> (hash_t::method_t::LZ4):
+						// Выполняем обработку данных
+						status = this->lz4(data, actual, current, result);
+					break;
+					// Если метод компрессии LZma
+					case static_cast <uint8_t> (hash_t::method_t::LZMA):
+						// Выполняем обработку данных
+						status = this->lzma(data, actual, current, result);
+					break;
+					// Если метод компрессии Zstandard
+					case static_cast <uint8_t> (hash_t::method_t::ZSTD):
+						// Выполняем обработку данных
+						status = this->zstd(data, actual, current, result);
+					break;
+					// Если метод компрессии GZip
+					case static_cast <uint8_t> (hash_t::method_t::GZIP):
+					// Если метод компрессии Deflate
+					case static_cast <uint8_t> (hash_t::method_t::DEFLATE):
+						// Выполняем обработку данных
+						status = this->zlib(data, actual, current, result);
+					break;
+					// Если метод компрессии BZip2
+					case static_cast <uint8_t> (hash_t::method_t::BZIP2):
+						// Выполняем обработку данных
+						status = this->bzip2(data, actual, current, result);
+					break;
+					// Если метод компрессии Brotli
+					case static_cast <uint8_t> (hash_t::method_t::BROTLI):
+						// Выполняем обработку данных
+						status = this->brotli(data, actual, current, result);
+					break;
+				}
+				// Увеличиваем смещение в буфере данных
+				offset += actual;
+			/**
+			 * Продолжаем пока все данные не обработаны
+			 */
+			} while(status && (offset < size));
+			// Если данные переданы, отмечаем начало сообщения
+			if(size > 0)
+				// Устанавливаем флаг начала сообщения
+				this->_begin = true;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const exception & error) {
+			// Сбрасываем результат обработки
+			status = false;
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, static_cast <uint16_t> (mode)), log_t::flag_t::CRITICAL, error.what());
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+			#endif
+		}
+	}
+	// Выводим результат
+	return status;
+}
+/**
+ * @brief Метод обработки данных компрессором LZ4
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::lz4(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Размер полученных данных
+	size_t bytes = 0;
+	/**
+	 * Определяем событие выполнения операции
+	 */
+	switch(static_cast <uint8_t> (this->_event)){
+		// Если необходимо выполнить компрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::ENCODE): {
+			// Если фрейм ещё не начат
+			if(!this->_begin){
+				// Выполняем формирование заголовка фрейма
+				bytes = ::LZ4F_compressBegin(this->_lz4c, this->_buffer.data(), this->_buffer.size(), &this->_lz4p);
+				// Если заголовок не сформирован
+				if(::LZ4F_isError(bytes))
+					// Выводим результат
+					return false;
+				// Добавляем заголовок фрейма в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + bytes);
+				// Устанавливаем флаг начала сообщения
+				this->_begin = true;
+			}
+			/**
+			 * Выполняем компрессию данных частями размером не больше чанка
+			 */
+			for(size_t offset = 0, actual = 0; offset < size; offset += actual){
+				// Получаем размер обрабатываемой части данных
+				actual = std::min(size - offset, static_cast <size_t> (CHUNK_BUFFER_SIZE));
+				// Выполняем компрессию данных
+				bytes = ::LZ4F_compressUpdate(this->_lz4c, this->_buffer.data(), this->_buffer.size(), buffer + offset, actual, nullptr);
+				// Если компрессия не выполнена
+				if(::LZ4F_isError(bytes))
+					// Выводим результат
+					return false;
+				// Добавляем сжатые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + bytes);
+			}
+			/**
+			 * Определяем режим обработки данных
+			 */
+			switch(static_cast <uint8_t> (mode)){
+				// Если необходимо выполнить сброс буферов
+				case static_cast <uint8_t> (mode_t::FLUSH):
+					// Выполняем сброс буферов компрессора
+					bytes = ::LZ4F_flush(this->_lz4c, this->_buffer.data(), this->_buffer.size(), nullptr);
+				break;
+				// Если необходимо завершить сообщение
+				case static_cast <uint8_t> (mode_t::FINISH):
+					// Выполняем завершение фрейма
+					bytes = ::LZ4F_compressEnd(this->_lz4c, this->_buffer.data(), this->_buffer.size(), nullptr);
+				break;
+				// Иначе данные остаются в буфере компрессора
+				default: bytes = 0;
+			}
+			// Если сброс не выполнен
+			if(::LZ4F_isError(bytes))
+				// Выводим результат
+				return false;
+			// Добавляем сжатые данные в результат
+			result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + bytes);
+		} break;
+		// Если необходимо выполнить декомпрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::DECODE): {
+			// Смещение во входящих данных
+			size_t offset = 0;
+			/**
+			 * Выполняем декомпрессию пока есть входящие данные или декомпрессор заполняет буфер
+			 */
+			for(;;){
+				// Размер входящих и исходящих данных
+				size_t input = (size - offset), output = this->_buffer.size();
+				// Выполняем декомпрессию данных
+				bytes = ::LZ4F_decompress(this->_lz4d, this->_buffer.data(), &output, (buffer != nullptr ? buffer + offset : nullptr), &input, nullptr);
+				// Если декомпрессия не выполнена
+				if(::LZ4F_isError(bytes))
+					// Выводим результат
+					return false;
+				// Увеличиваем смещение во входящих данных
+				offset += input;
+				// Добавляем извлечённые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + output);
+				// Если данные обработаны, запоминаем завершён ли фрейм (следующий фрейм начинается автоматически)
+				if((input > 0) || (output > 0))
+					// Устанавливаем флаг завершения сообщения
+					this->_end = (bytes == 0);
+				// Если все данные обработаны и буфер не заполнен
+				if((offset >= size) && (output < this->_buffer.size()))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки данных компрессором LZma
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::lzma(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Результат выполнения операции
+	lzma_ret rv = LZMA_OK;
+	// Устанавливаем количество доступных данных
+	this->_lzma.avail_in = size;
+	// Устанавливаем буфер входящих данных
+	this->_lzma.next_in = reinterpret_cast <const uint8_t *> (buffer);
+	/**
+	 * Определяем событие выполнения операции
+	 */
+	switch(static_cast <uint8_t> (this->_event)){
+		// Если необходимо выполнить компрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::ENCODE): {
+			// Действие компрессора
+			lzma_action action = LZMA_RUN;
+			/**
+			 * Определяем режим обработки данных
+			 */
+			switch(static_cast <uint8_t> (mode)){
+				// Если необходимо выполнить сброс буферов
+				case static_cast <uint8_t> (mode_t::FLUSH):
+					// Устанавливаем действие сброса буферов
+					action = LZMA_SYNC_FLUSH;
+				break;
+				// Если необходимо завершить сообщение
+				case static_cast <uint8_t> (mode_t::FINISH):
+					// Устанавливаем действие завершения потока
+					action = LZMA_FINISH;
+				break;
+			}
+			/**
+			 * Выполняем компрессию всех данных
+			 */
+			for(;;){
+				// Устанавливаем буфер исходящих данных
+				this->_lzma.next_out = reinterpret_cast <uint8_t *> (this->_buffer.data());
+				// Устанавливаем размер буфера исходящих данных
+				this->_lzma.avail_out = this->_buffer.size();
+				// Выполняем компрессию данных
+				rv = ::lzma_code(&this->_lzma, action);
+				// Если произошла ошибка компрессии
+				if((rv != LZMA_OK) && (rv != LZMA_STREAM_END) && (rv != LZMA_BUF_ERROR))
+					// Выводим результат
+					return false;
+				// Добавляем сжатые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - this->_lzma.avail_out));
+				// Если выполняется сброс или завершение, ожидаем окончания операции
+				if(action != LZMA_RUN){
+					// Если операция завершена
+					if((rv == LZMA_STREAM_END) || (rv == LZMA_BUF_ERROR))
+						// Выходим из цикла
+						break;
+				// Если все данные переданы компрессору и буфер не заполнен
+				} else if((this->_lzma.avail_in == 0) && (this->_lzma.avail_out > 0))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+		// Если необходимо выполнить декомпрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::DECODE): {
+			/**
+			 * Выполняем декомпрессию всех данных
+			 */
+			for(;;){
+				// Устанавливаем буфер исходящих данных
+				this->_lzma.next_out = reinterpret_cast <uint8_t *> (this->_buffer.data());
+				// Устанавливаем размер буфера исходящих данных
+				this->_lzma.avail_out = this->_buffer.size();
+				// Выполняем декомпрессию данных
+				rv = ::lzma_code(&this->_lzma, LZMA_RUN);
+				// Если произошла ошибка декомпрессии
+				if((rv != LZMA_OK) && (rv != LZMA_STREAM_END) && (rv != LZMA_BUF_ERROR))
+					// Выводим результат
+					return false;
+				// Добавляем извлечённые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - this->_lzma.avail_out));
+				// Если поток завершён
+				if(rv == LZMA_STREAM_END){
+					// Запоминаем оставшиеся данные следующего потока
+					const uint8_t * next = this->_lzma.next_in;
+					// Запоминаем размер оставшихся данных
+					const size_t avail = this->_lzma.avail_in;
+					// Устанавливаем флаг завершения сообщения
+					this->_end = true;
+					// Если данных следующего потока нет
+					if(avail == 0)
+						// Выходим из цикла
+						break;
+					// Выполняем подготовку контекста к новому потоку
+					if(!this->restart())
+						// Выводим результат
+						return false;
+					// Восстанавливаем буфер входящих данных
+					this->_lzma.next_in = next;
+					// Восстанавливаем количество доступных данных
+					this->_lzma.avail_in = avail;
+				// Если все данные обработаны и буфер не заполнен
+				} else if(((this->_lzma.avail_in == 0) && (this->_lzma.avail_out > 0)) || (rv == LZMA_BUF_ERROR))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки данных компрессором Zstandard
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::zstd(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Результат выполнения операции
+	size_t rv = 0;
+	// Выполняем создание буфера входящих данных
+	ZSTD_inBuffer input = {buffer, size, 0};
+	/**
+	 * Определяем событие выполнения операции
+	 */
+	switch(static_cast <uint8_t> (this->_event)){
+		// Если необходимо выполнить компрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::ENCODE): {
+			// Директива компрессора
+			ZSTD_EndDirective directive = ZSTD_e_continue;
+			/**
+			 * Определяем режим обработки данных
+			 */
+			switch(static_cast <uint8_t> (mode)){
+				// Если необходимо выполнить сброс буферов
+				case static_cast <uint8_t> (mode_t::FLUSH):
+					// Устанавливаем директиву сброса буферов
+					directive = ZSTD_e_flush;
+				break;
+				// Если необходимо завершить сообщение
+				case static_cast <uint8_t> (mode_t::FINISH):
+					// Устанавливаем директиву завершения фрейма
+					directive = ZSTD_e_end;
+				break;
+			}
+			/**
+			 * Выполняем компрессию всех данных
+			 */
+			for(;;){
+				// Выполняем создание буфера исходящих данных
+				ZSTD_outBuffer output = {this->_buffer.data(), this->_buffer.size(), 0};
+				// Выполняем компрессию данных
+				rv = ::ZSTD_compressStream2(this->_zstdc, &output, &input, directive);
+				// Если произошла ошибка компрессии
+				if(::ZSTD_isError(rv))
+					// Выводим результат
+					return false;
+				// Добавляем сжатые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + output.pos);
+				// Если все данные переданы компрессору (а при сбросе, все данные выведены)
+				if(directive == ZSTD_e_continue ? (input.pos == input.size) : (rv == 0))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+		// Если необходимо выполнить декомпрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::DECODE): {
+			// Смещение во входящих данных
+			size_t offset = 0;
+			/**
+			 * Выполняем декомпрессию всех данных
+			 */
+			for(;;){
+				// Выполняем создание буфера исходящих данных
+				ZSTD_outBuffer output = {this->_buffer.data(), this->_buffer.size(), 0};
+				// Выполняем декомпрессию данных
+				rv = ::ZSTD_decompressStream(this->_zstdd, &output, &input);
+				// Если произошла ошибка декомпрессии
+				if(::ZSTD_isError(rv))
+					// Выводим результат
+					return false;
+				// Добавляем извлечённые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + output.pos);
+				// Если данные обработаны, запоминаем завершён ли фрейм (следующий фрейм начинается автоматически)
+				if((input.pos > offset) || (output.pos > 0))
+					// Устанавливаем флаг завершения сообщения
+					this->_end = (rv == 0);
+				// Запоминаем смещение во входящих данных
+				offset = input.pos;
+				// Если все данные обработаны и буфер не заполнен
+				if((input.pos == input.size) && (output.pos < output.size))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки данных компрессором ZLib (GZip и Deflate)
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::zlib(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Результат выполнения операции
+	int32_t rv = Z_OK;
+	// Устанавливаем количество доступных данных
+	this->_zlib.avail_in = static_cast <uint32_t> (size);
+	// Устанавливаем буфер входящих данных
+	this->_zlib.next_in = const_cast <Bytef *> (reinterpret_cast <const Bytef *> (buffer));
+	/**
+	 * Определяем событие выполнения операции
+	 */
+	switch(static_cast <uint8_t> (this->_event)){
+		// Если необходимо выполнить компрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::ENCODE): {
+			// Режим сброса компрессора
+			int32_t flush = Z_NO_FLUSH;
+			/**
+			 * Определяем режим обработки данных
+			 */
+			switch(static_cast <uint8_t> (mode)){
+				// Если необходимо выполнить сброс буферов
+				case static_cast <uint8_t> (mode_t::FLUSH):
+					// Устанавливаем режим сброса буферов
+					flush = Z_SYNC_FLUSH;
+				break;
+				// Если необходимо завершить сообщение
+				case static_cast <uint8_t> (mode_t::FINISH):
+					// Устанавливаем режим завершения потока
+					flush = Z_FINISH;
+				break;
+			}
+			/**
+			 * Выполняем компрессию пока компрессор заполняет буфер
+			 */
+			do {
+				// Устанавливаем буфер исходящих данных
+				this->_zlib.next_out = reinterpret_cast <Bytef *> (this->_buffer.data());
+				// Устанавливаем размер буфера исходящих данных
+				this->_zlib.avail_out = static_cast <uint32_t> (this->_buffer.size());
+				// Выполняем компрессию данных
+				rv = ::deflate(&this->_zlib, flush);
+				// Если произошла ошибка компрессии
+				if(rv == Z_STREAM_ERROR)
+					// Выводим результат
+					return false;
+				// Добавляем сжатые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - this->_zlib.avail_out));
+			/**
+			 * Если буфер исходящих данных заполнен полностью
+			 */
+			} while(this->_zlib.avail_out == 0);
+		} break;
+		// Если необходимо выполнить декомпрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::DECODE): {
+			/**
+			 * Выполняем декомпрессию всех данных
+			 */
+			for(;;){
+				// Устанавливаем буфер исходящих данных
+				this->_zlib.next_out = reinterpret_cast <Bytef *> (this->_buffer.data());
+				// Устанавливаем размер буфера исходящих данных
+				this->_zlib.avail_out = static_cast <uint32_t> (this->_buffer.size());
+				// Выполняем декомпрессию данных
+				rv = ::inflate(&this->_zlib, Z_NO_FLUSH);
+				// Если произошла ошибка декомпрессии
+				if((rv != Z_OK) && (rv != Z_STREAM_END) && (rv != Z_BUF_ERROR))
+					// Выводим результат
+					return false;
+				// Добавляем извлечённые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - this->_zlib.avail_out));
+				// Если поток завершён
+				if(rv == Z_STREAM_END){
+					// Запоминаем оставшиеся данные следующего потока
+					Bytef * next = this->_zlib.next_in;
+					// Запоминаем размер оставшихся данных
+					const uint32_t avail = this->_zlib.avail_in;
+					// Устанавливаем флаг завершения сообщения
+					this->_end = true;
+					// Если данных следующего потока нет
+					if(avail == 0)
+						// Выходим из цикла
+						break;
+					// Выполняем подготовку контекста к новому потоку
+					if(!this->restart())
+						// Выводим результат
+						return false;
+					// Восстанавливаем буфер входящих данных
+					this->_zlib.next_in = next;
+					// Восстанавливаем количество доступных данных
+					this->_zlib.avail_in = avail;
+				// Если все данные обработаны и буфер не заполнен
+				} else if(((this->_zlib.avail_in == 0) && (this->_zlib.avail_out > 0)) || (rv == Z_BUF_ERROR))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки данных компрессором BZip2
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::bzip2(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Результат выполнения операции
+	int32_t rv = BZ_OK;
+	// Устанавливаем количество доступных данных
+	this->_bzip2.avail_in = static_cast <uint32_t> (size);
+	// Устанавливаем буфер входящих данных
+	this->_bzip2.next_in = const_cast <char *> (buffer);
+	/**
+	 * Определяем событие выполнения операции
+	 */
+	switch(static_cast <uint8_t> (this->_event)){
+		// Если необходимо выполнить компрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::ENCODE): {
+			// Действие компрессора
+			int32_t action = BZ_RUN;
+			/**
+			 * Определяем режим обработки данных
+			 */
+			switch(static_cast <uint8_t> (mode)){
+				// Если необходимо выполнить сброс буферов (блоки BZip2 не выровнены по байтам, поэтому хвост блока станет доступен получателю только со следующим блоком)
+				case static_cast <uint8_t> (mode_t::FLUSH):
+					// Устанавливаем действие сброса буферов
+					action = BZ_FLUSH;
+				break;
+				// Если необходимо завершить сообщение
+				case static_cast <uint8_t> (mode_t::FINISH):
+					// Устанавливаем действие завершения потока
+					action = BZ_FINISH;
+				break;
+				// Если данных для компрессии нет (BZip2 считает пустой вызов ошибкой)
+				default: {
+					// Если данные не переданы
+					if(size == 0)
+						// Выводим результат
+						return true;
+				}
+			}
+			/**
+			 * Выполняем компрессию всех данных
+			 */
+			for(;;){
+				// Устанавливаем буфер исходящих данных
+				this->_bzip2.next_out = this->_buffer.data();
+				// Устанавливаем размер буфера исходящих данных
+				this->_bzip2.avail_out = static_cast <uint32_t> (this->_buffer.size());
+				// Выполняем компрессию данных
+				rv = ::BZ2_bzCompress(&this->_bzip2, action);
+				// Если произошла ошибка компрессии
+				if(rv < 0)
+					// Выводим результат
+					return false;
+				// Добавляем сжатые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - this->_bzip2.avail_out));
+				// Если все данные переданы компрессору, сброс буферов или завершение потока выполнены
+				if(((action == BZ_RUN) && (this->_bzip2.avail_in == 0)) ||
+				   ((action == BZ_FLUSH) && (rv == BZ_RUN_OK)) ||
+				   ((action == BZ_FINISH) && (rv == BZ_STREAM_END)))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+		// Если необходимо выполнить декомпрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::DECODE): {
+			// Если данных для декомпрессии нет, извлекать нечего
+			if(size == 0)
+				// Выводим результат
+				return true;
+			/**
+			 * Выполняем декомпрессию всех данных
+			 */
+			for(;;){
+				// Устанавливаем буфер исходящих данных
+				this->_bzip2.next_out = this->_buffer.data();
+				// Устанавливаем размер буфера исходящих данных
+				this->_bzip2.avail_out = static_cast <uint32_t> (this->_buffer.size());
+				// Выполняем декомпрессию данных
+				rv = ::BZ2_bzDecompress(&this->_bzip2);
+				// Если произошла ошибка декомпрессии
+				if((rv != BZ_OK) && (rv != BZ_STREAM_END))
+					// Выводим результат
+					return false;
+				// Добавляем извлечённые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - this->_bzip2.avail_out));
+				// Если поток завершён
+				if(rv == BZ_STREAM_END){
+					// Запоминаем оставшиеся данные следующего потока
+					char * next = this->_bzip2.next_in;
+					// Запоминаем размер оставшихся данных
+					const uint32_t avail = this->_bzip2.avail_in;
+					// Устанавливаем флаг завершения сообщения
+					this->_end = true;
+					// Если данных следующего потока нет
+					if(avail == 0)
+						// Выходим из цикла
+						break;
+					// Выполняем подготовку контекста к новому потоку
+					if(!this->restart())
+						// Выводим результат
+						return false;
+					// Восстанавливаем буфер входящих данных
+					this->_bzip2.next_in = next;
+					// Восстанавливаем количество доступных данных
+					this->_bzip2.avail_in = avail;
+				// Если все данные обработаны и буфер не заполнен
+				} else if((this->_bzip2.avail_in == 0) && (this->_bzip2.avail_out > 0))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод обработки данных компрессором Brotli
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param mode   режим обработки данных
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::brotli(const char * buffer, const size_t size, const mode_t mode, vector <char> & result) noexcept {
+	// Размер доступных входящих данных
+	size_t availIn = size;
+	// Буфер входящих данных
+	const uint8_t * nextIn = reinterpret_cast <const uint8_t *> (buffer);
+	/**
+	 * Определяем событие выполнения операции
+	 */
+	switch(static_cast <uint8_t> (this->_event)){
+		// Если необходимо выполнить компрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::ENCODE): {
+			// Операция энкодера
+			BrotliEncoderOperation operation = BROTLI_OPERATION_PROCESS;
+			/**
+			 * Определяем режим обработки данных
+			 */
+			switch(static_cast <uint8_t> (mode)){
+				// Если необходимо выполнить сброс буферов
+				case static_cast <uint8_t> (mode_t::FLUSH):
+					// Устанавливаем операцию сброса буферов
+					operation = BROTLI_OPERATION_FLUSH;
+				break;
+				// Если необходимо завершить сообщение
+				case static_cast <uint8_t> (mode_t::FINISH):
+					// Устанавливаем операцию завершения потока
+					operation = BROTLI_OPERATION_FINISH;
+				break;
+			}
+			/**
+			 * Выполняем компрессию всех данных
+			 */
+			for(;;){
+				// Получаем размер буфера исходящих данных
+				size_t availOut = this->_buffer.size();
+				// Получаем буфер исходящих данных
+				uint8_t * nextOut = reinterpret_cast <uint8_t *> (this->_buffer.data());
+				// Выполняем компрессию данных
+				if(!::BrotliEncoderCompressStream(this->_brotlie, operation, &availIn, &nextIn, &availOut, &nextOut, nullptr))
+					// Выводим результат
+					return false;
+				// Добавляем сжатые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - availOut));
+				// Если все данные переданы энкодеру и выведены (а при завершении, поток закрыт)
+				if((availIn == 0) && !::BrotliEncoderHasMoreOutput(this->_brotlie) &&
+				   ((operation != BROTLI_OPERATION_FINISH) || ::BrotliEncoderIsFinished(this->_brotlie)))
+					// Выходим из цикла
+					break;
+			}
+		} break;
+		// Если необходимо выполнить декомпрессию данных
+		case static_cast <uint8_t> (hash_t::event_t::DECODE): {
+			/**
+			 * Выполняем декомпрессию всех данных
+			 */
+			for(;;){
+				// Получаем размер буфера исходящих данных
+				size_t availOut = this->_buffer.size();
+				// Получаем буфер исходящих данных
+				uint8_t * nextOut = reinterpret_cast <uint8_t *> (this->_buffer.data());
+				// Выполняем декомпрессию данных
+				const BrotliDecoderResult rv = ::BrotliDecoderDecompressStream(this->_brotlid, &availIn, &nextIn, &availOut, &nextOut, nullptr);
+				// Если произошла ошибка декомпрессии
+				if(rv == BROTLI_DECODER_RESULT_ERROR)
+					// Выводим результат
+					return false;
+				// Добавляем извлечённые данные в результат
+				result.insert(result.end(), this->_buffer.data(), this->_buffer.data() + (this->_buffer.size() - availOut));
+				// Если поток завершён
+				if(rv == BROTLI_DECODER_RESULT_SUCCESS){
+					// Устанавливаем флаг завершения сообщения
+					this->_end = true;
+					// Если данных следующего потока нет
+					if(availIn == 0)
+						// Выходим из цикла
+						break;
+					// Выполняем подготовку контекста к новому потоку
+					if(!this->restart())
+						// Выводим результат
+						return false;
+				// Если декодеру требуются новые данные
+				} else if(rv == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT)
+					// Выходим из цикла
+					break;
+			}
+		} break;
+	}
+	// Выводим результат
+	return true;
+}
+/**
+ * @brief Метод инициализации потокового компрессора
+ *
+ * @param method метод компрессии
+ * @param event  событие выполнения операции (компрессия или декомпрессия)
+ * @param level  уровень компрессии
+ * @return       результат инициализации
+ */
+bool awh::Codec::init(const hash_t::method_t method, const hash_t::event_t event, const hash_t::level_t level) noexcept {
+	// Если контекст уже создан с теми же параметрами
+	if(this->_init && (this->_method == method) && (this->_event == event) && (this->_level == level))
+		// Подготавливаем контекст к новому сообщению
+		return this->restart();
+	// Освобождаем предыдущий контекст
+	this->close();
+	// Устанавливаем событие выполнения операции
+	this->_event = event;
+	// Устанавливаем уровень компрессии
+	this->_level = level;
+	// Устанавливаем метод компрессии
+	this->_method = method;
+	// Если параметры компрессии переданы
+	if((method != hash_t::method_t::NONE) && (event != hash_t::event_t::NONE))
+		// Выполняем создание контекста
+		return this->open();
+	// Выводим результат
+	return false;
+}
+/**
+ * @brief Метод сброса текущего сообщения
+ *
+ */
+void awh::Codec::reset() noexcept {
+	// Если контекст компрессии создан
+	if(this->_init)
+		// Подготавливаем контекст к новому сообщению
+		this->restart();
+}
+/**
+ * @brief Метод очистки контекста компрессора
+ *
+ */
+void awh::Codec::clear() noexcept {
+	// Освобождаем контекст компрессии
+	this->close();
+	// Сбрасываем метод компрессии
+	this->_method = hash_t::method_t::NONE;
+	// Выполняем очистку буфера промежуточных данных
+	this->_buffer.clear();
+	// Выполняем освобождение памяти буфера
+	vector <char> ().swap(this->_buffer);
+}
+/**
+ * @brief Метод добавления данных в поток
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::write(const char * buffer, const size_t size, vector <char> & result) noexcept {
+	// Если данные переданы
+	if((buffer != nullptr) && (size > 0))
+		// Выполняем обработку данных
+		return this->process(buffer, size, mode_t::WRITE, result);
+	// Выводим результат
+	return this->_init;
+}
+/**
+ * @brief Метод сброса буферов потока (все переданные данные становятся доступны получателю)
+ *
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных
+ */
+bool awh::Codec::flush(vector <char> & result) noexcept {
+	// Выполняем сброс буферов
+	return this->process(nullptr, 0, mode_t::FLUSH, result);
+}
+/**
+ * @brief Метод завершения текущего сообщения (контекст готов к следующему сообщению)
+ *
+ * @param result буфер куда следует добавить результат
+ * @return       результат обработки данных (для декомпрессии, целостность сообщения)
+ */
+bool awh::Codec::finish(vector <char> & result) noexcept {
+	// Выполняем завершение сообщения
+	bool status = this->process(nullptr, 0, mode_t::FINISH, result);
+	// Если выполняется декомпрессия, проверяем что сообщение получено целиком
+	if(status && (this->_event == hash_t::event_t::DECODE))
+		// Сообщение должно быть завершено или не начато вовсе
+		status = (this->_end || !this->_begin);
+	// Если контекст компрессии создан
+	if(this->_init)
+		// Подготавливаем контекст к следующему сообщению
+		status = (this->restart() && status);
+	// Выводим результат
+	return status;
+}
+/**
+ * @brief Метод получения события выполнения операции
+ *
+ * @return событие выполнения операции
+ */
+awh::hash_t::event_t awh::Codec::event() const noexcept {
+	// Выводим событие выполнения операции
+	return this->_event;
+}
+/**
+ * @brief Метод получения метода компрессии
+ *
+ * @return метод компрессии
+ */
+awh::hash_t::method_t awh::Codec::method() const noexcept {
+	// Выводим метод компрессии
+	return this->_method;
+}
+/**
+ * @brief Метод установки размера скользящего окна (применяется при инициализации)
+ *
+ * @param wbit размер скользящего окна
+ */
+void awh::Codec::wbit(const int16_t wbit) noexcept {
+	// Устанавливаем размер скользящего окна
+	this->_wbit = wbit;
+}
+/**
+ * @brief Конструктор
+ *
+ * @param log объект для работы с логами
+ */
+awh::Codec::Codec(const log_t * log) noexcept :
+ _init(false), _end(false), _begin(false), _wbit(MAX_WBITS),
+ _event(hash_t::event_t::NONE), _level(hash_t::level_t::NORMAL), _method(hash_t::method_t::NONE),
+ _lz4c(nullptr), _lz4d(nullptr), _zstdc(nullptr), _zstdd(nullptr), _brotlie(nullptr), _brotlid(nullptr), _log(log) {
+	// Заполняем поток ZLib нулями
+	::memset(&this->_zlib, 0, sizeof(this->_zlib));
+	// Заполняем поток BZip2 нулями
+	::memset(&this->_bzip2, 0, sizeof(this->_bzip2));
+	// Заполняем параметры компрессора LZ4 нулями
+	::memset(&this->_lz4p, 0, sizeof(this->_lz4p));
+	// Выполняем инициализацию потока LZma
+	this->_lzma = LZMA_STREAM_INIT;
+}
+/**
+ * @brief Деструктор
+ *
+ */
+awh::Codec::~Codec() noexcept {
+	// Освобождаем контекст компрессии
+	this->close();
+}
@@ -0,0 +1,529 @@
+/**
+ * @file: executor.cpp
+ * @date: 2025-03-11
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Стандартные модули
+ */
+#include <chrono>
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <sys/executor.hpp>
+
+/**
+ * Исполнитель, которому принадлежит текущий поток
+ */
+static thread_local const awh::exec_t * currentExecutor = nullptr;
+/**
+ * Индекс текущего рабочего потока в исполнителе
+ */
+static thread_local size_t currentWorker = 0;
+
+/**
+ * @brief Функция обновления максимального значения
+ *
+ * @param target атомарное максимальное значение
+ * @param value  новое значение
+ */
+static void maximum(std::atomic <uint64_t> & target, const uint64_t value) noexcept {
+	// Получаем текущее максимальное значение
+	uint64_t current = target.load(std::memory_order_relaxed);
+	/**
+	 * Выполняем замену пока новое значение больше текущего
+	 */
+	while((value > current) && !target.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+/**
+ * @brief Метод получения текущего времени в наносекундах
+ *
+ * @return текущее время в наносекундах
+ */
+uint64_t awh::Exec::now() noexcept {
+	// Выводим текущее время монотонных часов
+	return static_cast <uint64_t> (std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+/**
+ * @brief Метод обработки очереди заданий в одном потоке
+ *
+ * @param index индекс рабочего потока
+ */
+void awh::Exec::work(const size_t index) noexcept {
+	// Запоминаем исполнителя текущего потока
+	currentExecutor = this;
+	// Запоминаем индекс текущего рабочего потока
+	currentWorker = index;
+	/**
+	 * Запускаем бесконечный цикл
+	 */
+	for(;;){
+		// Создаём текущее задание
+		job_t job;
+		// Если задание получено из собственной очереди или забрано у другого потока
+		if(this->pop(index, job) || this->steal(index, job)){
+			// Если это задание исполнения цепочки задач
+			if(job.strand)
+				// Выполняем исполнение цепочки задач ключа
+				this->drain(job.key);
+			// Выполняем исполнение задачи
+			else this->execute(job);
+			// Продолжаем обработку заданий
+			continue;
+		}
+		// Выполняем блокировку уникальным мютексом
+		unique_lock <std::mutex> lock(this->_locker);
+		// Если это остановка работы исполнителя
+		if(this->_stop)
+			// Выходим из функции
+			break;
+		// Если ожидается завершение всех задач и заданий больше нет
+		if(this->_wait && (this->_pending == 0))
+			// Выходим из функции
+			break;
+		// Увеличиваем количество ожидающих потоков
+		this->_sleeping++;
+		// Ожидаем появления заданий, остановки или завершения работы
+		this->_cv.wait(lock, [this]{
+			// Выводим результат проверки
+			return (this->_stop || this->_wait || (this->_pending > 0));
+		});
+		// Уменьшаем количество ожидающих потоков
+		this->_sleeping--;
+	}
+	// Сбрасываем исполнителя текущего потока
+	currentExecutor = nullptr;
+}
+/**
+ * @brief Метод исполнения задачи
+ *
+ * @param job задание для исполнения
+ */
+void awh::Exec::execute(job_t & job) noexcept {
+	// Получаем время начала исполнения задачи
+	const uint64_t start = now();
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Выполняем задачу
+		job.task();
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const bad_alloc &) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(job.key), log_t::flag_t::CRITICAL, "Memory allocation error");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+		#endif
+		// Выходим из приложения
+		::exit(EXIT_FAILURE);
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const exception & error) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(job.key), log_t::flag_t::CRITICAL, error.what());
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, error.what());
+		#endif
+	/**
+	 * Если возникает неизвестная ошибка
+	 */
+	} catch(...) {
+		/**
+		 * Если включён режим отладки
+		 */
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(job.key), log_t::flag_t::CRITICAL, "Unknown error while executing the task");
+		/**
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			this->_log->print("%s", log_t::flag_t::CRITICAL, "Unknown error while executing the task");
+		#endif
+	}
+	// Получаем время завершения исполнения задачи
+	const uint64_t finish = now();
+	// Уменьшаем количество задач ожидающих исполнения
+	this->_queued.fetch_sub(1, std::memory_order_relaxed);
+	// Увеличиваем количество исполненных задач
+	this->_completed.fetch_add(1, std::memory_order_relaxed);
+	// Увеличиваем суммарное время ожидания исполнения задач
+	this->_delay.fetch_add(start - job.stamp, std::memory_order_relaxed);
+	// Увеличиваем суммарное время исполнения задач
+	this->_latency.fetch_add(finish - job.stamp, std::memory_order_relaxed);
+	// Обновляем максимальное время ожидания исполнения задачи
+	maximum(this->_delayMax, start - job.stamp);
+	// Обновляем максимальное время исполнения задачи
+	maximum(this->_latencyMax, finish - job.stamp);
+}
+/**
+ * @brief Метод исполнения цепочки задач ключа
+ *
+ * @param key ключ цепочки задач
+ */
+void awh::Exec::drain(const uint64_t key) noexcept {
+	/**
+	 * Выполняем ограниченное количество задач, чтобы цепочка одного ключа не занимала поток бесконечно
+	 */
+	for(size_t i = 0; i < BATCH; i++){
+		// Создаём текущее задание
+		job_t job;
+		{
+			// Выполняем блокировку цепочек задач
+			const lock_guard <std::mutex> lock(this->_strandMtx);
+			// Выполняем поиск цепочки задач ключа
+			auto j = this->_strands.find(key);
+			// Если цепочка не найдена, значит исполнитель был остановлен
+			if(j == this->_strands.end())
+				// Выходим из функции
+				return;
+			// Если задач в цепочке больше нет
+			if(j->second.empty()){
+				// Удаляем цепочку, следующая задача ключа создаст её заново
+				this->_strands.erase(j);
+				// Выходим из функции
+				return;
+			}
+			// Извлекаем первую задачу цепочки
+			job = std::move(j->second.front());
+			// Удаляем извлечённую задачу из цепочки
+			j->second.pop_front();
+		}
+		// Выполняем исполнение задачи
+		this->execute(job);
+	}
+	// Создаём задание продолжения исполнения цепочки
+	job_t job;
+	// Устанавливаем флаг задания исполнения цепочки
+	job.strand = true;
+	// Устанавливаем ключ цепочки задач
+	job.key = key;
+	// Возвращаем цепочку в очередь, она остаётся активной, поэтому порядок задач сохраняется
+	this->schedule(std::move(job));
+}
+/**
+ * @brief Метод добавления задания в очередь рабочего потока
+ *
+ * @param job задание для добавления
+ */
+void awh::Exec::schedule(job_t && job) noexcept {
+	// Индекс очереди для добавления задания
+	size_t index = 0;
+	// Если задание добавляется из рабочего потока этого исполнителя
+	if(currentExecutor == this)
+		// Добавляем задание в собственную очередь потока
+		index = currentWorker;
+	// Иначе распределяем задания по очередям по кругу
+	else index = (this->_index.fetch_add(1, std::memory_order_relaxed) % this->_queues.size());
+	{
+		// Получаем рабочий поток
+		worker_t * worker = this->_queues[index].get();
+		// Выполняем блокировку очереди рабочего потока
+		const lock_guard <std::mutex> lock(worker->mtx);
+		// Добавляем задание в очередь
+		worker->jobs.push_back(std::move(job));
+		// Увеличиваем количество заданий
+		this->_pending++;
+	}
+	// Если есть ожидающие рабочие потоки
+	if(this->_sleeping > 0){
+		{
+			// Выполняем блокировку, чтобы поток не пропустил уведомление между проверкой и ожиданием
+			const lock_guard <std::mutex> lock(this->_locker);
+		}
+		// Сообщаем потоку, что появилось задание
+		this->_cv.notify_one();
+	}
+}
+/**
+ * @brief Метод извлечения задания из собственной очереди
+ *
+ * @param index индекс рабочего потока
+ * @param job   извлечённое задание
+ * @return      результат извлечения
+ */
+bool awh::Exec::pop(const size_t index, job_t & job) noexcept {
+	// Получаем рабочий поток
+	worker_t * worker = this->_queues[index].get();
+	// Выполняем блокировку очереди рабочего потока
+	const lock_guard <std::mutex> lock(worker->mtx);
+	// Если очередь пустая
+	if(worker->jobs.empty())
+		// Сообщаем, что задание не извлечено
+		return false;
+	// Извлекаем самое старое задание
+	job = std::move(worker->jobs.front());
+	// Удаляем извлечённое задание
+	worker->jobs.pop_front();
+	// Уменьшаем количество заданий
+	this->_pending--;
+	// Сообщаем, что задание извлечено
+	return true;
+}
+/**
+ * @brief Метод извлечения задания из очереди другого рабочего потока
+ *
+ * @param index индекс рабочего потока
+ * @param job   извлечённое задание
+ * @return      результат извлечения
+ */
+bool awh::Exec::steal(const size_t index, job_t & job) noexcept {
+	// Получаем количество очередей
+	const size_t count = this->_queues.size();
+	// Выполняем перебор очередей других рабочих потоков
+	for(size_t i = 1; i < count; i++){
+		// Получаем рабочий поток
+		worker_t * worker = this->_queues[(index + i) % count].get();
+		// Выполняем блокировку очереди рабочего потока
+		const lock_guard <std::mutex> lock(worker->mtx);
+		// Если очередь не пустая
+		if(!worker->jobs.empty()){
+			// Забираем самое новое задание, владелец очереди продолжает со старых
+			job = std::move(worker->jobs.back());
+			// Удаляем забранное задание
+			worker->jobs.pop_back();
+			// Уменьшаем количество заданий
+			this->_pending--;
+			// Увеличиваем количество забранных задач
+			this->_stolen.fetch_add(1, std::memory_order_relaxed);
+			// Сообщаем, что задание извлечено
+			return true;
+		}
+	}
+	// Сообщаем, что задание не извлечено
+	return false;
+}
+/**
+ * @brief Метод добавления задачи
+ *
+ * @param strand флаг задачи с ключом
+ * @param key    ключ цепочки задач
+ * @param task   объект задачи
+ * @return       результат добавления
+ */
+bool awh::Exec::submit(const bool strand, const uint64_t key, task_t && task) noexcept {
+	// Если исполнитель не запущен или останавливается
+	if(this->_workers.empty() || this->_stop)
+		// Сообщаем, что задача не добавлена
+		return false;
+	// Создаём задание
+	job_t job;
+	// Устанавливаем ключ цепочки задач
+	job.key = key;
+	// Устанавливаем время добавления задачи
+	job.stamp = now();
+	// Устанавливаем объект задачи
+	job.task = std::move(task);
+	// Увеличиваем количество добавленных задач
+	this->_submitted.fetch_add(1, std::memory_order_relaxed);
+	// Увеличиваем количество задач ожидающих исполнения
+	this->_queued.fetch_add(1, std::memory_order_relaxed);
+	// Если задача должна исполняться в порядке очереди ключа
+	if(strand){
+		{
+			// Выполняем блокировку цепочек задач
+			const lock_guard <std::mutex> lock(this->_strandMtx);
+			// Выполняем поиск цепочки задач ключа
+			auto i = this->_strands.find(key);
+			// Если цепочка уже исполняется
+			if(i != this->_strands.end()){
+				// Добавляем задачу в конец цепочки, её исполнит активная цепочка
+				i->second.push_back(std::move(job));
+				// Сообщаем, что задача добавлена
+				return true;
+			}
+			// Создаём цепочку задач ключа
+			this->_strands[key].push_back(std::move(job));
+		}
+		// Создаём задание исполнения цепочки
+		job_t runner;
+		// Устанавливаем флаг задания исполнения цепочки
+		runner.strand = true;
+		// Устанавливаем ключ цепочки задач
+		runner.key = key;
+		// Добавляем задание исполнения цепочки в очередь
+		this->schedule(std::move(runner));
+	// Добавляем задание в очередь
+	} else this->schedule(std::move(job));
+	// Сообщаем, что задача добавлена
+	return true;
+}
+/**
+ * @brief Метод получения метрик исполнителя
+ *
+ * @return метрики исполнителя
+ */
+awh::Exec::stat_t awh::Exec::stat() const noexcept {
+	// Создаём объект метрик
+	stat_t result;
+	// Получаем количество забранных задач
+	result.stolen = this->_stolen.load(std::memory_order_relaxed);
+	// Получаем количество задач ожидающих исполнения
+	result.pending = this->_queued.load(std::memory_order_relaxed);
+	// Получаем количество добавленных задач
+	result.submitted = this->_submitted.load(std::memory_order_relaxed);
+	// Получаем количество исполненных задач
+	result.completed = this->_completed.load(std::memory_order_relaxed);
+	// Получаем суммарное время ожидания исполнения задач
+	result.delay = this->_delay.load(std::memory_order_relaxed);
+	// Получаем суммарное время исполнения задач
+	result.latency = this->_latency.load(std::memory_order_relaxed);
+	// Получаем максимальное время ожидания исполнения задачи
+	result.delayMax = this->_delayMax.load(std::memory_order_relaxed);
+	// Получаем максимальное время исполнения задачи
+	result.latencyMax = this->_latencyMax.load(std::memory_order_relaxed);
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод проверки на инициализацию исполнителя
+ *
+ * @return результат проверки
+ */
+bool awh::Exec::initialized() const noexcept {
+	// Выводим результат проверки
+	return !this->_workers.empty();
+}
+/**
+ * @brief Метод ожидания выполнения задач
+ *
+ */
+void awh::Exec::wait() noexcept {
+	{
+		// Выполняем блокировку ожидания рабочих потоков
+		const lock_guard <std::mutex> lock(this->_locker);
+		// Устанавливаем флаг ожидания выполнения всех задач
+		this->_wait = true;
+	}
+	// Сообщаем всем потокам, что нужно завершить работу после исполнения задач
+	this->_cv.notify_all();
+	// Ожидаем завершение работы каждого воркера
+	for(auto & worker : this->_workers)
+		// Выполняем ожидание завершения работы потоков
+		worker.join();
+	// Очищаем список потоков
+	this->_workers.clear();
+	// Очищаем список очередей рабочих потоков
+	this->_queues.clear();
+	// Очищаем список цепочек задач
+	this->_strands.clear();
+	// Сбрасываем количество заданий
+	this->_pending = 0;
+	// Сбрасываем количество задач ожидающих исполнения
+	this->_queued = 0;
+	// Сбрасываем флаг ожидания выполнения всех задач
+	this->_wait = false;
+}
+/**
+ * @brief Метод завершения выполнения задач
+ *
+ * Рабочие потоки перед завершением исполняют все задачи, оставшиеся в очередях
+ *
+ */
+void awh::Exec::stop() noexcept {
+	{
+		// Выполняем блокировку ожидания рабочих потоков
+		const lock_guard <std::mutex> lock(this->_locker);
+		// Останавливаем работу потоков
+		this->_stop = true;
+	}
+	// Сообщаем всем что мы завершаем работу
+	this->_cv.notify_all();
+	// Ожидаем завершение работы каждого воркера
+	for(auto & worker : this->_workers)
+		// Выполняем ожидание завершения работы потоков
+		worker.join();
+	// Очищаем список потоков
+	this->_workers.clear();
+	// Очищаем список очередей рабочих потоков, все задачи уже исполнены рабочими потоками
+	this->_queues.clear();
+	{
+		// Выполняем блокировку цепочек задач
+		const lock_guard <std::mutex> lock(this->_strandMtx);
+		// Очищаем список цепочек задач
+		this->_strands.clear();
+	}
+	// Сбрасываем количество заданий
+	this->_pending = 0;
+	// Сбрасываем количество задач ожидающих исполнения
+	this->_queued = 0;
+	// Восстанавливаем работу потоков
+	this->_stop = false;
+}
+/**
+ * @brief Метод инициализации работы исполнителя
+ *
+ * @param count количество потоков
+ */
+void awh::Exec::init(const uint16_t count) noexcept {
+	// Если количество потоков передано
+	if(count > 0)
+		// Устанавливаем количество потоков
+		this->_threads = count;
+	// Если количество потоков установлено и исполнитель ещё не запущен
+	if((this->_threads > 0) && this->_workers.empty()){
+		// Выполняем создание очередей рабочих потоков
+		for(uint16_t i = 0; i < this->_threads; i++)
+			// Добавляем очередь рабочего потока
+			this->_queues.push_back(std::make_unique <worker_t> ());
+		// Выполняем запуск рабочих потоков
+		for(uint16_t i = 0; i < this->_threads; i++)
+			// Добавляем новый рабочий поток
+			this->_workers.emplace_back(&Exec::work, this, static_cast <size_t> (i));
+	}
+}
+/**
+ * @brief Конструктор
+ *
+ * @param log   объект для работы с логами
+ * @param count количество потоков
+ */
+awh::Exec::Exec(const log_t * log, const uint16_t count) noexcept :
+ _threads(0), _stop(false), _wait(false), _index(0), _pending(0), _sleeping(0),
+ _stolen(0), _queued(0), _submitted(0), _completed(0), _delay(0), _latency(0), _delayMax(0), _latencyMax(0), _log(log) {
+	// Если количество потоков передано
+	if(count > 0)
+		// Устанавливаем количество потоков
+		this->_threads = count;
+	// Если количество потоков не установлено
+	else this->_threads = static_cast <uint16_t> (std::thread::hardware_concurrency());
+}
+/**
+ * @brief Деструктор
+ *
+ */
+awh::Exec::~Exec() noexcept {
+	// Выполняем остановку исполнителя
+	this->stop();
+}
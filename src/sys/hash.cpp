@@ -31,6 +31,27 @@ static constexpr uint16_t DEFAULT_MEM_LEVEL = 4;
  */
 static constexpr uint32_t CHUNK_BUFFER_SIZE = 0x4000;
 
+/**
+ * Мютекс для блокировки пула контекстов
+ */
+std::mutex awh::Hash::_mtx;
+/**
+ * Время простоя контекста компрессии до его освобождения
+ */
+std::atomic <time_t> awh::Hash::_idle{0};
+/**
+ * Максимальный размер пула контекстов
+ */
+size_t awh::Hash::_capacity = 0;
+/**
+ * Пул готовых контекстов ZLib
+ */
+vector <awh::Hash::context_t> awh::Hash::_pool;
+/**
+ * Количество созданных контекстов ZLib
+ */
+std::atomic <size_t> awh::Hash::_contexts{0};
+
 /**
  * @brief Шаблон функции хэширования текста
  *
@@ -1296,14 +1317,12 @@ template <typename T>
  *
  * @param buffer   буфер данных для компрессии
  * @param size     размер данных для компрессии
- * @param level    уровень компрессии
- * @param wbit     размер скользящего окна
  * @param takeOver флаг переиспользования контекста
  * @param stream   объект потока для работы компрессора
  * @param event    событие выполнения операции
  * @param result   строка куда следует положить результат
  */
-static void deflate(const char * buffer, const size_t size, const uint32_t level, const int16_t wbit, const bool takeOver, z_stream & stream, const awh::hash_t::event_t event, T & result) noexcept {
+static void deflate(const char * buffer, const size_t size, const bool takeOver, z_stream & stream, const awh::hash_t::event_t event, T & result) noexcept {
 	// Если буфер данных передан
 	if((buffer != nullptr) && (size > 0)){
 		/**
@@ -1314,125 +1333,61 @@ static void deflate(const char * buffer, const size_t size, const uint32_t level
 			result.clear();
 			// Результат проверки декомпрессии
 			int32_t rv = Z_OK;
-			// Создаем поток zip
-			z_stream zs = {0};
-			// Обнуляем структуру
-			zs.zfree  = Z_NULL;
-			zs.zalloc = Z_NULL;
-			zs.opaque = Z_NULL;
 			// Буфер выходных данных
 			vector <Bytef> tmp(size, 0);
+			// Устанавливаем количество доступных данных
+			stream.avail_in = static_cast <uint32_t> (size);
+			// Устанавливаем буфер с данными для обработки
+			stream.next_in = const_cast <Bytef *> (reinterpret_cast <const Bytef *> (buffer));
 			/**
 			 * Определяем событие выполнения операции
 			 */
 			switch(static_cast <uint8_t> (event)){
 				// Если необходимо выполнить компрессию данных
 				case static_cast <uint8_t> (awh::hash_t::event_t::ENCODE): {
-					// Если поток инициализировать не удалось, выходим
-					if(takeOver || (::deflateInit2(&zs, level, Z_DEFLATED, -1 * wbit, DEFAULT_MEM_LEVEL, Z_HUFFMAN_ONLY) == Z_OK)){
-						// Если поток декомпрессора не создан ранее
-						if(!takeOver){
-							// Устанавливаем количество доступных данных
-							zs.avail_in = static_cast <uint32_t> (size);
-							// Устанавливаем буфер с данными для шифрования
-							zs.next_in = const_cast <Bytef *> (reinterpret_cast <const Bytef *> (buffer));
-						// Если нужно переиспользовать поток декомпрессора
-						} else {
-							// Устанавливаем количество доступных данных
-							stream.avail_in = static_cast <uint32_t> (size);
-							// Устанавливаем буфер с данными для шифрования
-							stream.next_in = const_cast <Bytef *> (reinterpret_cast <const Bytef *> (buffer));
-						}
-						/**
-						 * Выполняем компрессию всех данных
-						 */
-						do {
-							// Если поток декомпрессора не создан ранее
-							if(!takeOver){
-								// Устанавливаем буфер для записи шифрованных данных
-								zs.next_out = tmp.data();
-								// Устанавливаем количество доступных данных для записи
-								zs.avail_out = static_cast <uint32_t> (tmp.size());
-								// Выполняем сжатие данных
-								rv = ::deflate(&zs, Z_SYNC_FLUSH);
-							// Если нужно переиспользовать поток декомпрессора
-							} else {
-								// Устанавливаем буфер для записи шифрованных данных
-								stream.next_out = tmp.data();
-								// Устанавливаем количество доступных данных для записи
-								stream.avail_out = static_cast <uint32_t> (tmp.size());
-								// Выполняем сжатие данных
-								rv = ::deflate(&stream, Z_FULL_FLUSH);
-							}
-							// Если данные обработаны удачно
-							if((rv == Z_OK) || (rv == Z_STREAM_END))
-								// Добавляем оставшиеся данные в список
-								result.insert(result.end(), tmp.begin(), tmp.begin() + (static_cast <uint32_t> (tmp.size()) - (!takeOver ? zs.avail_out : stream.avail_out)));
-							// Если данные не могут быть обработанны, то выходим
-							else break;
-						/**
-						 * Если ещё не все данные сжаты
-						 */
-						} while(rv != Z_STREAM_END);
-						// Закрываем поток
-						if(!takeOver)
-							// Завершаем работу
-							::deflateEnd(&zs);
-					}
+					/**
+					 * Выполняем компрессию всех данных
+					 */
+					do {
+						// Устанавливаем буфер для записи шифрованных данных
+						stream.next_out = tmp.data();
+						// Устанавливаем количество доступных данных для записи
+						stream.avail_out = static_cast <uint32_t> (tmp.size());
+						// Выполняем сжатие данных
+						rv = ::deflate(&stream, (takeOver ? Z_FULL_FLUSH : Z_SYNC_FLUSH));
+						// Если данные обработаны удачно
+						if((rv == Z_OK) || (rv == Z_STREAM_END))
+							// Добавляем оставшиеся данные в список
+							result.insert(result.end(), tmp.begin(), tmp.begin() + (static_cast <uint32_t> (tmp.size()) - stream.avail_out));
+						// Если данные не могут быть обработанны, то выходим
+						else break;
+					/**
+					 * Если ещё не все данные сжаты
+					 */
+					} while(rv != Z_STREAM_END);
 				} break;
 				// Если необходимо выполнить декомпрессию данных
 				case static_cast <uint8_t> (awh::hash_t::event_t::DECODE): {
-					// Если поток инициализировать не удалось, выходим
-					if(takeOver || (::inflateInit2(&zs, -1 * wbit) == Z_OK)){
-						// Если поток декомпрессора не создан ранее
-						if(!takeOver){
-							// Устанавливаем количество доступных данных
-							zs.avail_in = static_cast <uint32_t> (size);
-							// Копируем входящий буфер для дешифровки
-							zs.next_in = const_cast <Bytef *> (reinterpret_cast <const Bytef *> (buffer));
-						// Если нужно переиспользовать поток декомпрессора
-						} else {
-							// Устанавливаем количество доступных данных
-							stream.avail_in = static_cast <uint32_t> (size);
-							// Копируем входящий буфер для дешифровки
-							stream.next_in = const_cast <Bytef *> (reinterpret_cast <const Bytef *> (buffer));
-						}
-						/**
-						 * Выполняем декомпрессию всех данных
-						 */
-						do {
-							// Если поток декомпрессора не создан ранее
-							if(!takeOver){
-								// Устанавливаем буфер для записи дешифрованных данных
-								zs.next_out = tmp.data();
-								// Устанавливаем количество доступных данных для записи
-								zs.avail_out = static_cast <uint32_t> (tmp.size());
-								// Выполняем декомпрессию данных
-								rv = ::inflate(&zs, Z_NO_FLUSH);
-							// Если нужно переиспользовать поток декомпрессора
-							} else {
-								// Устанавливаем буфер для записи дешифрованных данных
-								stream.next_out = tmp.data();
-								// Устанавливаем количество доступных данных для записи
-								stream.avail_out = static_cast <uint32_t> (tmp.size());
-								// Выполняем декомпрессию данных
-								rv = ::inflate(&stream, Z_SYNC_FLUSH);
-							}
-							// Если данные обработаны удачно
-							if((rv == Z_OK) || (rv == Z_STREAM_END))
-								// Добавляем оставшиеся данные в список
-								result.insert(result.end(), tmp.begin(), tmp.begin() + (static_cast <uint32_t> (tmp.size()) - (!takeOver ? zs.avail_out : stream.avail_out)));
-							// Если данные не могут быть обработанны, то выходим
-							else break;
-						/**
-						 * Если ещё не все данные извлечены
-						 */
-						} while(rv != Z_STREAM_END);
-						// Очищаем выделенную память для декомпрессора
-						if(!takeOver)
-							// Завершаем работу
-							::inflateEnd(&zs);
-					}
+					/**
+					 * Выполняем декомпрессию всех данных
+					 */
+					do {
+						// Устанавливаем буфер для записи дешифрованных данных
+						stream.next_out = tmp.data();
+						// Устанавливаем количество доступных данных для записи
+						stream.avail_out = static_cast <uint32_t> (tmp.size());
+						// Выполняем декомпрессию данных
+						rv = ::inflate(&stream, (takeOver ? Z_SYNC_FLUSH : Z_NO_FLUSH));
+						// Если данные обработаны удачно
+						if((rv == Z_OK) || (rv == Z_STREAM_END))
+							// Добавляем оставшиеся данные в список
+							result.insert(result.end(), tmp.begin(), tmp.begin() + (static_cast <uint32_t> (tmp.size()) - stream.avail_out));
+						// Если данные не могут быть обработанны, то выходим
+						else break;
+					/**
+					 * Если ещё не все данные извлечены
+					 */
+					} while(rv != Z_STREAM_END);
 				} break;
 			}
 		/**
@@ -1442,8 +1397,21 @@ static void deflate(const char * buffer, const size_t size, const uint32_t level
 			// Выполняем очистку блока с результатом
 			result.clear();
 		}
+		// Входящий буфер принадлежит вызывающей стороне, сбрасываем ссылку на него
+		stream.next_in = Z_NULL;
+		// Сбрасываем количество доступных данных
+		stream.avail_in = 0;
 	}
 }
+/**
+ * @brief Функция получения текущего штампа времени для контроля простоя контекстов
+ *
+ * @return штамп времени в миллисекундах
+ */
+static uint64_t timestamp() noexcept {
+	// Выводим монотонное время в миллисекундах
+	return static_cast <uint64_t> (chrono::duration_cast <chrono::milliseconds> (chrono::steady_clock::now().time_since_epoch()).count());
+}
 /**
  * @brief Метод инициализации AES шифрования
  *
@@ -1530,6 +1498,181 @@ bool awh::Hash::cipher(const cipher_t cipher) noexcept {
 	// Сообщаем что всё удачно
 	return true;
 }
+/**
+ * @brief Метод получения контекста ZLib из пула или создания нового
+ *
+ * @param event событие выполнения операции
+ * @param wbit  размер скользящего окна
+ * @param level уровень компрессии
+ * @param log   объект для работы с логами
+ * @return      поток ZLib
+ */
+z_stream * awh::Hash::acquire(const event_t event, const int16_t wbit, const int32_t level, const log_t * log) noexcept {
+	// Результат работы функции
+	z_stream * result = nullptr;
+	// Выполняем блокировку пула контекстов
+	_mtx.lock();
+	/**
+	 * Выполняем поиск подходящего контекста, начиная с последнего возвращённого
+	 */
+	for(auto i = _pool.rbegin(); i != _pool.rend(); ++i){
+		// Если параметры контекста совпадают с запрошенными
+		if((i->event == event) && (i->wbit == wbit) && ((event == event_t::DECODE) || (i->level == level))){
+			// Получаем поток ZLib
+			result = i->stream;
+			// Перемещаем последний контекст пула на место извлечённого
+			(* i) = _pool.back();
+			// Удаляем последний контекст пула
+			_pool.pop_back();
+			// Выходим из цикла
+			break;
+		}
+	}
+	// Выполняем разблокировку пула контекстов
+	_mtx.unlock();
+	// Если подходящего контекста в пуле нет
+	if(result == nullptr){
+		// Выделяем память для потока ZLib
+		result = new (nothrow) z_stream;
+		// Если память выделена
+		if(result != nullptr){
+			// Заполняем поток нулями
+			::memset(result, 0, sizeof(z_stream));
+			// Обнуляем структуру потока
+			result->zalloc = Z_NULL;
+			result->zfree  = Z_NULL;
+			result->opaque = Z_NULL;
+			// Выполняем инициализацию потока
+			const int32_t rv = (
+				event == event_t::ENCODE ?
+				::deflateInit2(result, level, Z_DEFLATED, -1 * wbit, DEFAULT_MEM_LEVEL, Z_HUFFMAN_ONLY) :
+				::inflateInit2(result, -1 * wbit)
+			);
+			// Если поток инициализирован
+			if(rv == Z_OK)
+				// Увеличиваем количество созданных контекстов
+				_contexts.fetch_add(1, std::memory_order_relaxed);
+			// Если поток инициализировать не удалось
+			else {
+				// Выводим сообщение об ошибке
+				log->print("%s stream is not create", log_t::flag_t::CRITICAL, (event == event_t::ENCODE ? "Deflate" : "Inflate"));
+				// Освобождаем выделенную память
+				delete result;
+				// Сбрасываем результат
+				result = nullptr;
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод возврата контекста ZLib в пул или его освобождения
+ *
+ * @param stream поток ZLib
+ * @param event  событие выполнения операции
+ * @param wbit   размер скользящего окна
+ * @param level  уровень компрессии
+ */
+void awh::Hash::release(z_stream * stream, const event_t event, const int16_t wbit, const int32_t level) noexcept {
+	// Если поток передан
+	if(stream != nullptr){
+		// Флаг возврата контекста в пул
+		bool pooled = false;
+		// Выполняем блокировку пула контекстов
+		_mtx.lock();
+		// Если в пуле есть свободное место и контекст удалось сбросить в начальное состояние
+		if((_pool.size() < _capacity) && ((event == event_t::ENCODE ? ::deflateReset(stream) : ::inflateReset(stream)) == Z_OK)){
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				// Создаём объект контекста
+				context_t context;
+				// Устанавливаем размер скользящего окна
+				context.wbit = wbit;
+				// Устанавливаем уровень компрессии
+				context.level = level;
+				// Устанавливаем событие выполнения операции
+				context.event = event;
+				// Устанавливаем поток ZLib
+				context.stream = stream;
+				// Добавляем контекст в пул
+				_pool.push_back(std::move(context));
+				// Запоминаем что контекст возвращён в пул
+				pooled = true;
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const bad_alloc &) {
+				// Контекст будет освобождён
+				pooled = false;
+			}
+		}
+		// Выполняем разблокировку пула контекстов
+		_mtx.unlock();
+		// Если контекст не возвращён в пул
+		if(!pooled){
+			// Если это контекст компрессора
+			if(event == event_t::ENCODE)
+				// Очищаем выделенную память для компрессора
+				::deflateEnd(stream);
+			// Очищаем выделенную память для декомпрессора
+			else ::inflateEnd(stream);
+			// Освобождаем память потока
+			delete stream;
+			// Уменьшаем количество созданных контекстов
+			_contexts.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+}
+/**
+ * @brief Шаблон метода компрессии и декомпрессии методом Deflate
+ *
+ * @tparam T тип буфера результата
+ */
+template <typename T>
+/**
+ * @brief Метод компрессии и декомпрессии методом Deflate
+ *
+ * @param buffer буфер данных для обработки
+ * @param size   размер данных для обработки
+ * @param event  событие выполнения операции
+ * @param result буфер куда следует положить результат
+ */
+void awh::Hash::deflate(const char * buffer, const size_t size, const event_t event, T & result) const noexcept {
+	// Поток ZLib для обработки данных
+	z_stream * stream = nullptr;
+	// Получаем флаг переиспользования контекста
+	const bool takeOver = (event == event_t::ENCODE ? this->_takeOverCompress : this->_takeOverDecompress);
+	// Получаем уровень компрессии (контекст с переиспользованием создаётся с уровнем по умолчанию)
+	const int32_t level = (event == event_t::DECODE ? 0 : (takeOver ? Z_DEFAULT_COMPRESSION : static_cast <int32_t> (this->_level[1])));
+	// Если нужно переиспользовать контекст
+	if(takeOver){
+		// Получаем контекст соединения
+		z_stream *& context = (event == event_t::ENCODE ? this->_zdef : this->_zinf);
+		// Если контекст ещё не создан, создаём его при первом использовании
+		if(context == nullptr)
+			// Получаем контекст из пула или создаём новый
+			context = acquire(event, this->_wbit, level, this->_log);
+		// Запоминаем поток для обработки данных
+		stream = context;
+		// Если выполняется компрессия
+		if(event == event_t::ENCODE)
+			// Запоминаем время последнего использования контекста компрессии
+			this->_used = ::timestamp();
+	// Получаем временный контекст из пула или создаём новый
+	} else stream = acquire(event, this->_wbit, level, this->_log);
+	// Если поток получен
+	if(stream != nullptr){
+		// Выполняем обработку данных
+		::deflate(buffer, size, takeOver, (* stream), event, result);
+		// Если контекст не переиспользуется
+		if(!takeOver)
+			// Возвращаем временный контекст в пул
+			release(stream, event, this->_wbit, level);
+	}
+}
 /**
  * @brief Метод удаления хвостовых данных
  *
@@ -2035,7 +2178,7 @@ void awh::Hash::compress(const char * buffer, const size_t size, const method_t
 			// Если метод компрессии установлен Deflate
 			case static_cast <uint8_t> (method_t::DEFLATE): {
 				// Выполняем компрессию данных методом Deflate
-				::deflate(buffer, size, this->_level[1], this->_wbit, this->_takeOverCompress, this->_zdef, event_t::ENCODE, result);
+				this->deflate(buffer, size, event_t::ENCODE, result);
 				// Если результат не получен
 				if(result.empty())
 					// Выводим сообщение об ошибке
@@ -2121,7 +2264,7 @@ void awh::Hash::compress(const char * buffer, const size_t size, const method_t
 			// Если метод компрессии установлен Deflate
 			case static_cast <uint8_t> (method_t::DEFLATE): {
 				// Выполняем компрессию данных методом Deflate
-				::deflate(buffer, size, this->_level[1], this->_wbit, this->_takeOverCompress, this->_zdef, event_t::ENCODE, result);
+				this->deflate(buffer, size, event_t::ENCODE, result);
 				// Если результат не получен
 				if(result.empty())
 					// Выводим сообщение об ошибке
@@ -2236,7 +2379,7 @@ void awh::Hash::decompress(const char * buffer, const size_t size, const method_
 			// Если метод декомпрессии установлен Deflate
 			case static_cast <uint8_t> (method_t::DEFLATE): {
 				// Выполняем декомпрессию данных методом Deflate
-				::deflate(buffer, size, this->_level[1], this->_wbit, this->_takeOverDecompress, this->_zinf, event_t::DECODE, result);
+				this->deflate(buffer, size, event_t::DECODE, result);
 				// Если результат не получен
 				if(result.empty())
 					// Выводим сообщение об ошибке
@@ -2322,7 +2465,7 @@ void awh::Hash::decompress(const char * buffer, const size_t size, const method_
 			// Если метод декомпрессии установлен Deflate
 			case static_cast <uint8_t> (method_t::DEFLATE): {
 				// Выполняем декомпрессию данных методом Deflate
-				::deflate(buffer, size, this->_level[1], this->_wbit, this->_takeOverDecompress, this->_zinf, event_t::DECODE, result);
+				this->deflate(buffer, size, event_t::DECODE, result);
 				// Если результат не получен
 				if(result.empty())
 					// Выводим сообщение об ошибке
@@ -2342,12 +2485,17 @@ void awh::Hash::decompress(const char * buffer, const size_t size, const method_
  * @param wbit размер скользящего окна
  */
 void awh::Hash::wbit(const int16_t wbit) noexcept {
+	// Если размер скользящего окна изменился
+	if(this->_wbit != wbit){
+		// Освобождаем контекст компрессии, созданный для прежнего размера окна
+		release(this->_zdef, event_t::ENCODE, this->_wbit, Z_DEFAULT_COMPRESSION);
+		// Освобождаем контекст декомпрессии, созданный для прежнего размера окна
+		release(this->_zinf, event_t::DECODE, this->_wbit, 0);
+		// Сбрасываем контексты, они будут созданы при первом использовании
+		this->_zdef = this->_zinf = nullptr;
+	}
 	// Устанавливаем размер скользящего окна
 	this->_wbit = wbit;
-	// Выполняем пересборку контекстов LZ77 для компрессии
-	this->takeoverCompress(this->_takeOverCompress);
-	// Выполняем пересборку контекстов LZ77 для декомпрессии
-	this->takeoverDecompress(this->_takeOverDecompress);
 }
 /**
  * @brief Метод установки количества раундов шифрования
@@ -2421,37 +2569,10 @@ void awh::Hash::password(const string & password) noexcept {
  * @param flag флаг переиспользования контекста компрессии
  */
 void awh::Hash::takeoverCompress(const bool flag) noexcept {
-	// Если флаг установлен
-	if(this->_takeOverCompress && !flag)
-		// Очищаем выделенную память для компрессора
-		::deflateEnd(&this->_zdef);
-	// Если флаг установлен
-	if(!this->_takeOverCompress && flag){
-		// Заполняем его нулями потока для компрессора
-		::memset(&this->_zdef, 0, sizeof(this->_zdef));
-		// Обнуляем структуру потока для компрессора
-		this->_zdef.zalloc = Z_NULL;
-		this->_zdef.zfree  = Z_NULL;
-		this->_zdef.opaque = Z_NULL;
-		// Если поток инициализировать не удалось, выходим
-		if(::deflateInit2(&this->_zdef, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -1 * this->_wbit, DEFAULT_MEM_LEVEL, Z_HUFFMAN_ONLY) != Z_OK){
-			// Выводим сообщение об ошибке
-			this->_log->print("Deflate stream is not create", log_t::flag_t::CRITICAL);
-			/**
-			 * Для операционной системы не являющейся MS Windows
-			 */
-			#if !_WIN32 && !_WIN64
-				// Выходим из приложения
-				::raise(SIGINT);
-			/**
-			 * Для операционной системы MS Windows
-			 */
-			#else
-				// Выходим из приложения
-				::exit(EXIT_FAILURE);
-			#endif
-		}
-	}
+	// Освобождаем контекст прежнего соединения, новый будет создан при первом использовании
+	release(this->_zdef, event_t::ENCODE, this->_wbit, Z_DEFAULT_COMPRESSION);
+	// Сбрасываем контекст компрессии
+	this->_zdef = nullptr;
 	// Устанавливаем переданный флаг
 	this->_takeOverCompress = flag;
 }
@@ -2461,42 +2582,77 @@ void awh::Hash::takeoverCompress(const bool flag) noexcept {
  * @param flag флаг переиспользования контекста декомпрессии
  */
 void awh::Hash::takeoverDecompress(const bool flag) noexcept {
-	// Если флаг установлен
-	if(this->_takeOverDecompress && !flag)
-		// Очищаем выделенную память для декомпрессора
-		::inflateEnd(&this->_zinf);
-	// Если флаг установлен
-	if(!this->_takeOverDecompress && flag){
-		// Заполняем его нулями потока для декомпрессора
-		::memset(&this->_zinf, 0, sizeof(this->_zinf));
-		// Обнуляем структуру потока для декомпрессора
-		this->_zinf.avail_in = 0;
-		this->_zinf.zalloc   = Z_NULL;
-		this->_zinf.zfree    = Z_NULL;
-		this->_zinf.opaque   = Z_NULL;
-		this->_zinf.next_in  = Z_NULL;
-		// Если поток инициализировать не удалось, выходим
-		if(::inflateInit2(&this->_zinf, -1 * this->_wbit) != Z_OK){
-			// Выводим сообщение об ошибке
-			this->_log->print("Inflate stream is not create", log_t::flag_t::CRITICAL);
-			/**
-			 * Для операционной системы не являющейся MS Windows
-			 */
-			#if !_WIN32 && !_WIN64
-				// Выходим из приложения
-				::raise(SIGINT);
-			/**
-			 * Для операционной системы MS Windows
-			 */
-			#else
-				// Выходим из приложения
-				::exit(EXIT_FAILURE);
-			#endif
-		}
-	}
+	// Освобождаем контекст прежнего соединения, новый будет создан при первом использовании
+	release(this->_zinf, event_t::DECODE, this->_wbit, 0);
+	// Сбрасываем контекст декомпрессии
+	this->_zinf = nullptr;
 	// Устанавливаем переданный флаг
 	this->_takeOverDecompress = flag;
 }
+/**
+ * @brief Метод освобождения контекста компрессии, простаивающего дольше допустимого
+ *
+ */
+void awh::Hash::trim() noexcept {
+	// Получаем время простоя контекста компрессии до его освобождения
+	const time_t idle = _idle.load(std::memory_order_relaxed);
+	// Если контекст компрессии создан и простаивает дольше допустимого
+	if((idle > 0) && (this->_zdef != nullptr) && ((::timestamp() - this->_used) >= static_cast <uint64_t> (idle))){
+		/**
+		 * Удалённая сторона продолжает декомпрессию в своём контексте, поэтому новый контекст
+		 * компрессии просто не будет ссылаться на ранее переданные данные
+		 */
+		release(this->_zdef, event_t::ENCODE, this->_wbit, Z_DEFAULT_COMPRESSION);
+		// Сбрасываем контекст компрессии
+		this->_zdef = nullptr;
+	}
+}
+/**
+ * @brief Метод получения количества созданных контекстов ZLib (включая контексты в пуле)
+ *
+ * @return количество созданных контекстов
+ */
+size_t awh::Hash::contexts() noexcept {
+	// Выводим количество созданных контекстов
+	return _contexts.load(std::memory_order_relaxed);
+}
+/**
+ * @brief Метод установки времени простоя контекста компрессии до его освобождения
+ *
+ * @param msec время простоя в миллисекундах (0 - контекст не освобождается)
+ */
+void awh::Hash::idle(const time_t msec) noexcept {
+	// Устанавливаем время простоя контекста компрессии
+	_idle.store(msec, std::memory_order_relaxed);
+}
+/**
+ * @brief Метод установки максимального размера пула готовых контекстов ZLib
+ *
+ * @param size максимальный размер пула (0 - пул не используется)
+ */
+void awh::Hash::pool(const size_t size) noexcept {
+	// Выполняем блокировку пула контекстов
+	const lock_guard <std::mutex> lock(_mtx);
+	// Устанавливаем максимальный размер пула
+	_capacity = size;
+	/**
+	 * Выполняем освобождение контекстов, не помещающихся в пул
+	 */
+	while(_pool.size() > _capacity){
+		// Если это контекст компрессора
+		if(_pool.back().event == event_t::ENCODE)
+			// Очищаем выделенную память для компрессора
+			::deflateEnd(_pool.back().stream);
+		// Очищаем выделенную память для декомпрессора
+		else ::inflateEnd(_pool.back().stream);
+		// Освобождаем память потока
+		delete _pool.back().stream;
+		// Удаляем контекст из пула
+		_pool.pop_back();
+		// Уменьшаем количество созданных контекстов
+		_contexts.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
 /**
  * @brief Конструктор
  *
@@ -2506,18 +2662,14 @@ awh::Hash::Hash(const log_t * log) noexcept :
  _wbit(MAX_WBITS), _rounds(5),
  _level{1, Z_DEFAULT_COMPRESSION, ZSTD_CLEVEL_DEFAULT},
  _salt{""}, _password{""}, _takeOverCompress(false), _takeOverDecompress(false),
- _btype{0x00, 0x00, 0xFF, 0xFF}, _zinf({0}), _zdef({0}), _log(log) {}
+ _btype{0x00, 0x00, 0xFF, 0xFF}, _used(0), _zinf(nullptr), _zdef(nullptr), _log(log) {}
 /**
  * @brief Деструктор
  *
  */
 awh::Hash::~Hash() noexcept {
-	// Очищаем выделенную память для компрессора
-	if(this->_takeOverCompress)
-		// Завершаем работу
-		::deflateEnd(&this->_zdef);
-	// Очищаем выделенную память для декомпрессора
-	if(this->_takeOverDecompress)
-		// Завершаем работу
-		::inflateEnd(&this->_zinf);
+	// Освобождаем контекст компрессии
+	release(this->_zdef, event_t::ENCODE, this->_wbit, Z_DEFAULT_COMPRESSION);
+	// Освобождаем контекст декомпрессии
+	release(this->_zinf, event_t::DECODE, this->_wbit, 0);
 }
@@ -35,6 +35,32 @@
 	#include <arpa/inet.h>
 #endif
 
+/**
+ * Если используется набор инструкций AVX2
+ */
+#if defined(__AVX2__)
+	/**
+	 * Подключаем модуль инструкций AVX2
+	 */
+	#include <immintrin.h>
+/**
+ * Если используется набор инструкций SSE2
+ */
+#elif defined(__SSE2__)
+	/**
+	 * Подключаем модуль инструкций SSE2
+	 */
+	#include <emmintrin.h>
+/**
+ * Если используется набор инструкций NEON
+ */
+#elif defined(__ARM_NEON)
+	/**
+	 * Подключаем модуль инструкций NEON
+	 */
+	#include <arm_neon.h>
+#endif
+
 /**
  * Подписываемся на стандартное пространство имён
  */
@@ -174,9 +200,10 @@ awh::ws::Message::Message(const uint16_t code, const string & text) noexcept : c
  * @param head   объект для извлечения заголовка
  * @param buffer буфер с данными заголовка
  * @param size   размер передаваемого буфера
+ * @param limit  максимальный допустимый размер полезной нагрузки
  * @param log    объект для работы с логами
  */
-static void head(frame_t::head_t & head, const void * buffer, const size_t size, const log_t * log) noexcept {
+static void head(frame_t::head_t & head, const void * buffer, const size_t size, const uint64_t limit, const log_t * log) noexcept {
 	// Если данные переданы
 	if((buffer != nullptr) && (log != nullptr) && (size >= 2)){
 		/**
@@ -213,10 +240,16 @@ static void head(frame_t::head_t & head, const void * buffer, const size_t size,
 			} else if((head.payload == 0x07F) && (size >= 10)) {
 				// Получаем размер блока заголовков
 				head.size = 10;
-				// Получаем размер данных
-				::memcpy(&head.payload, reinterpret_cast <const uint8_t *> (buffer) + 2, sizeof(head.payload));
-				// Преобразуем сетевой порядок расположения байтов
-				head.payload = static_cast <uint64_t> (ntohl(head.payload));
+				// Сбрасываем размер полезной нагрузки
+				head.payload = 0;
+				// Выполняем сборку 64-битного размера данных из сетевого порядка байт
+				for(uint8_t i = 0; i < 8; i++)
+					// Добавляем очередной байт размера данных
+					head.payload = ((head.payload << 8) | static_cast <uint64_t> (reinterpret_cast <const uint8_t *> (buffer)[2 + i]));
+				// Если старший бит размера установлен (запрещено RFC 6455) или размер превышает допустимый
+				if((head.payload & 0x8000000000000000ULL) || (head.payload > limit))
+					// Устанавливаем статус битого фрейма
+					head.state = frame_t::state_t::BAD;
 			}
 		/**
 		 * Если возникает ошибка
@@ -239,104 +272,163 @@ static void head(frame_t::head_t & head, const void * buffer, const size_t size,
 	}
 }
 /**
- * frame Шаблон функции создания бинарного фрейма
- * @tparam T тип контейнера
+ * @brief Функция получения первого байта фрейма
+ *
+ * @param head заголовки фрейма
+ * @return     первый байт фрейма (флаги и опкод)
  */
-template <typename T>
+static uint8_t first(const frame_t::head_t & head) noexcept {
+	/**
+	 * rsv[0] должен быть установлен в TRUE для первого сообщения в GZip,
+	 * и установлен в FALSE для всех остальных сообщений, в рамках одной сессии
+	 */
+	return static_cast <uint8_t> (
+		(head.fin ? 0x080 : 0x00) |
+		(head.rsv[0] ? 0x040 : 0x00) |
+		(head.rsv[1] ? 0x020 : 0x00) |
+		(head.rsv[2] ? 0x010 : 0x00) |
+		(0x00F & static_cast <uint8_t> (head.optcode))
+	);
+}
+/**
+ * @brief Функция генерации ключа маски
+ *
+ * @param key буфер для записи ключа маски из 4-х байт
+ */
+static void key(uint8_t * key) noexcept {
+	// Генератор случайных чисел потока, инициализируется один раз
+	thread_local mt19937 engine {std::random_device {}()};
+	// Получаем случайное число
+	const uint32_t value = static_cast <uint32_t> (engine());
+	// Устанавливаем ключ маски
+	::memcpy(key, &value, sizeof(value));
+}
+/**
+ * @brief Функция записи заголовка фрейма
+ *
+ * @param output буфер для записи заголовка (не менее MAX_HEAD_SIZE байт)
+ * @param first  первый байт фрейма (флаги и опкод)
+ * @param size   размер полезной нагрузки
+ * @param key    ключ маски (nullptr, если маскирование не требуется)
+ * @return       размер записанного заголовка
+ */
+static size_t header(uint8_t * output, const uint8_t first, const size_t size, const uint8_t * key) noexcept {
+	// Размер записанного заголовка
+	size_t result = 2;
+	// Устанавливаем первый байт фрейма
+	output[0] = first;
+	// Если размер строки меньше 126 байт, значит строка умещается во второй байт
+	if(size < 0x07E)
+		// Устанавливаем размер строки
+		output[1] = static_cast <uint8_t> (0x07F & size);
+	// Если строка не помещается во второй байт
+	else if(size < 0x10000) {
+		// Заполняем второй байт значением 16-битного размера
+		output[1] = 0x07E;
+		// Устанавливаем размер строки в следующие 2 байта в сетевом порядке
+		output[2] = static_cast <uint8_t> (size >> 8);
+		output[3] = static_cast <uint8_t> (size);
+		// Увеличиваем размер заголовка
+		result = 4;
+	// Если сообщение очень большого размера
+	} else {
+		// Заполняем второй байт значением 64-битного размера
+		output[1] = 0x07F;
+		// Устанавливаем размер строки в следующие 8 байт в сетевом порядке
+		for(uint8_t i = 0; i < 8; i++)
+			// Устанавливаем очередной байт размера
+			output[2 + i] = static_cast <uint8_t> (static_cast <uint64_t> (size) >> (56 - (i * 8)));
+		// Увеличиваем размер заголовка
+		result = 10;
+	}
+	// Если нужно выполнить маскировку сообщения
+	if(key != nullptr){
+		// Устанавливаем флаг маскировки
+		output[1] |= 0x080;
+		// Устанавливаем ключ маски
+		::memcpy(output + result, key, 4);
+		// Увеличиваем размер заголовка
+		result += 4;
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Функция записи фрейма в буфер
+ *
+ * @param output буфер для записи фрейма (не менее size + MAX_HEAD_SIZE байт)
+ * @param first  первый байт фрейма (флаги и опкод)
+ * @param buffer бинарные данные полезной нагрузки
+ * @param size   размер полезной нагрузки
+ * @param mask   флаг выполнения маскировки сообщения
+ * @return       размер записанного фрейма
+ */
+static size_t write(uint8_t * output, const uint8_t first, const void * buffer, const size_t size, const bool mask) noexcept {
+	// Ключ маски
+	uint8_t code[4];
+	// Если нужно выполнить маскировку сообщения
+	if(mask)
+		// Выполняем генерацию ключа маски
+		::key(code);
+	// Выполняем запись заголовка фрейма
+	const size_t offset = ::header(output, first, size, (mask ? code : nullptr));
+	// Если полезная нагрузка передана
+	if((buffer != nullptr) && (size > 0)){
+		// Если нужно выполнить маскировку сообщения
+		if(mask)
+			// Копируем полезную нагрузку с наложением маски, исходные данные не изменяются
+			frame_t::mask(output + offset, buffer, size, code);
+		// Копируем полезную нагрузку как есть
+		else ::memcpy(output + offset, buffer, size);
+		// Выводим результат
+		return (offset + size);
+	}
+	// Выводим результат
+	return offset;
+}
 /**
  * @brief Функция создания бинарного фрейма
  *
- * @param payload бинарный буфер фрейма
- * @param buffer  бинарные данные полезной нагрузки
- * @param size    размер передаваемого буфера
- * @param mask    флаг выполнения маскировки сообщения
- * @param log     объект для работы с логами
+ * @param first  первый байт фрейма (флаги и опкод)
+ * @param buffer бинарные данные полезной нагрузки
+ * @param size   размер передаваемого буфера
+ * @param mask   флаг выполнения маскировки сообщения
+ * @param log    объект для работы с логами
+ * @return       бинарные данные фрейма
  */
-static void frame(T & payload, const void * buffer, const size_t size, const bool mask, const log_t * log) noexcept {
-	// Если данные переданы
-	if(!payload.empty() && (buffer != nullptr) && (log != nullptr) && (size > 0)){
+static vector <char> build(const uint8_t first, const void * buffer, const size_t size, const bool mask, const log_t * log) noexcept {
+	// Результат работы функции
+	vector <char> result;
+	/**
+	 * Выполняем отлов ошибок
+	 */
+	try {
+		// Выделяем память для фрейма
+		result.resize(((buffer != nullptr) ? size : 0) + frame_t::MAX_HEAD_SIZE);
+		// Выполняем запись фрейма и устанавливаем фактический размер
+		result.resize(::write(reinterpret_cast <uint8_t *> (result.data()), first, buffer, ((buffer != nullptr) ? size : 0), mask));
+	/**
+	 * Если возникает ошибка
+	 */
+	} catch(const bad_alloc &) {
 		/**
-		 * Выполняем отлов ошибок
+		 * Если включён режим отладки
 		 */
-		try {
-			// Размер смещения в буфере и размер передаваемых данных
-			uint8_t offset = 0;
-			// Если размер строки меньше 126 байт, значит строка умещается во второй байт
-			if(size < 0x07E){
-				// Устанавливаем смещение в буфере
-				offset = 2;
-				// Устанавливаем размер строки
-				payload.back() = (static_cast <uint8_t> (mask ? 0x080 : 0x00) | (0x07F & size));
-			// Если строка не помещается во второй байт
-			} else if(size < 0x10000) {
-				// Устанавливаем смещение в буфере
-				offset = 4;
-				// Заполняем второй байт максимальным значением
-				payload.back() = (static_cast <uint8_t> (mask ? 0x080 : 0x00) | (0x07F & 0x07E));
-				// Увеличиваем память ещё на два байта
-				payload.resize(offset, 0x00);
-				// Выполняем перерасчёт размера передаваемых данных
-				const uint16_t bytes = static_cast <uint64_t> (htons(static_cast <uint16_t> (size)));
-				// Устанавливаем размер строки в следующие 2 байта
-				::memcpy(payload.data() + 2, &bytes, sizeof(bytes));
-			// Если сообщение очень большого размера
-			} else {
-				// Устанавливаем смещение в буфере
-				offset = 10;
-				// Заполняем второй байт максимальным значением
-				payload.back() = (static_cast <uint8_t> (mask ? 0x080 : 0x00) | 0x07F);
-				// Увеличиваем память ещё на восемь байт
-				payload.resize(offset, 0x00);
-				// Выполняем перерасчёт размера передаваемых данных
-				const uint64_t bytes = static_cast <uint64_t> (htonl(size));
-				// Устанавливаем размер строки в следующие 8 байт
-				::memcpy(payload.data() + 2, &bytes, sizeof(bytes));
-			}
-			// Если нужно выполнить маскировку сообщения
-			if(mask){
-				// Получаем генератор случайных чисел
-				std::random_device randev;
-				// Бинарные данные маски
-				vector <uint8_t> mask(4);
-				// Подключаем генератор к двигателю
-				mt19937 engine {randev()};
-				// Устанавливаем диапазон генератора случайных чисел
-				uniform_int_distribution <uint8_t> dist {0, 255};
-				// Выполняем заполнение маски случайными числами
-				std::generate(mask.begin(), mask.end(), [&dist, &engine]() noexcept -> uint8_t {
-					// Выполняем генерирование случайного числа
-					return dist(engine);
-				});
-				// Выполняем перебор всех байт передаваемых данных
-				for(size_t i = 0; i < size; i++)
-					// Выполняем шифрование данных
-					const_cast <uint8_t *> (reinterpret_cast <const uint8_t *> (buffer))[i] ^= mask[i % 4];
-				// Увеличиваем память ещё на четыре байта
-				payload.resize(offset + 4, 0x00);
-				// Устанавливаем сгенерированную маску
-				::memcpy(payload.data() + offset, mask.data(), mask.size());
-			}
-			// Выполняем копирования оставшихся данных в буфер
-			payload.insert(payload.end(), reinterpret_cast <const uint8_t *> (buffer), reinterpret_cast <const uint8_t *> (buffer) + size);
+		#if DEBUG_MODE
+			// Выводим сообщение об ошибке
+			log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, mask), log_t::flag_t::CRITICAL, "Memory allocation error");
 		/**
-		 * Если возникает ошибка
-		 */
-		} catch(const exception & error) {
-			/**
-			 * Если включён режим отладки
-			 */
-			#if DEBUG_MODE
-				// Выводим сообщение об ошибке
-				log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(buffer, size, mask), log_t::flag_t::CRITICAL, error.what());
-			/**
-			* Если режим отладки не включён
-			*/
-			#else
-				// Выводим сообщение об ошибке
-				log->print("%s", log_t::flag_t::CRITICAL, error.what());
-			#endif
-		}
+		* Если режим отладки не включён
+		*/
+		#else
+			// Выводим сообщение об ошибке
+			log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+		#endif
+		// Выходим из приложения
+		::exit(EXIT_FAILURE);
 	}
+	// Выводим результат
+	return result;
 }
 /**
  * @brief Метод создание фрейма сообщения
@@ -489,6 +581,10 @@ awh::ws::mess_t awh::ws::Frame::message(const head_t & head, const uint16_t code
 	else if(!head.fin && (static_cast <uint8_t> (head.optcode) > 0x007) && (static_cast <uint8_t> (head.optcode) < 0x00B))
 		// Создаём сообщение
 		return mess_t(1002, "FIN must be set");
+	// Если размер полезной нагрузки недопустим
+	else if(head.payload > MAX_FRAME_SIZE)
+		// Создаём сообщение
+		return mess_t(1009, "Frame payload is too large");
 	// Выводим результат
 	return (head.state == state_t::BAD ? mess_t(code == 0 ? 1005 : code) : mess_t(code));
 }
@@ -500,14 +596,8 @@ awh::ws::mess_t awh::ws::Frame::message(const head_t & head, const uint16_t code
  * @return     бинарные данные фрейма
  */
 vector <char> awh::ws::Frame::ping(const string & mess, const bool mask) const noexcept {
-	// Создаём тело запроса и устанавливаем первый байт PING с пустой полезной нагрузкой
-	vector <char> result = {static_cast <char> (0x080) | (0x00F & static_cast <char> (opcode_t::PING)), 0x00};
-	// Если сообщение передано
-	if(!mess.empty())
-		// Выполняем формирование фрейма
-		::frame(result, mess.data(), mess.size(), mask, this->_log);
-	// Выводим результат
-	return result;
+	// Выполняем формирование фрейма PING
+	return ::build(static_cast <uint8_t> (0x080 | static_cast <uint8_t> (opcode_t::PING)), mess.data(), mess.size(), mask, this->_log);
 }
 /**
  * @brief Метод создания фрейма пинга
@@ -518,14 +608,8 @@ vector <char> awh::ws::Frame::ping(const string & mess, const bool mask) const n
  * @return       бинарные данные фрейма
  */
 vector <char> awh::ws::Frame::ping(const void * buffer, const size_t size, const bool mask) const noexcept {
-	// Создаём тело запроса и устанавливаем первый байт PING с пустой полезной нагрузкой
-	vector <char> result = {static_cast <char> (0x080) | (0x00F & static_cast <char> (opcode_t::PING)), 0x00};
-	// Если сообщение передано
-	if((buffer != nullptr) && (size > 0))
-		// Выполняем формирование фрейма
-		::frame(result, buffer, size, mask, this->_log);
-	// Выводим результат
-	return result;
+	// Выполняем формирование фрейма PING
+	return ::build(static_cast <uint8_t> (0x080 | static_cast <uint8_t> (opcode_t::PING)), buffer, size, mask, this->_log);
 }
 /**
  * @brief Метод создания фрейма понга
@@ -535,14 +619,8 @@ vector <char> awh::ws::Frame::ping(const void * buffer, const size_t size, const
  * @return     бинарные данные фрейма
  */
 vector <char> awh::ws::Frame::pong(const string & mess, const bool mask) const noexcept {
-	// Создаём тело запроса и устанавливаем первый байт PONG с пустой полезной нагрузкой
-	vector <char> result = {static_cast <char> (0x080) | (0x00F & static_cast <char> (opcode_t::PONG)), 0x00};
-	// Если сообщение передано
-	if(!mess.empty())
-		// Выполняем формирование фрейма
-		::frame(result, mess.data(), mess.size(), mask, this->_log);
-	// Выводим результат
-	return result;
+	// Выполняем формирование фрейма PONG
+	return ::build(static_cast <uint8_t> (0x080 | static_cast <uint8_t> (opcode_t::PONG)), mess.data(), mess.size(), mask, this->_log);
 }
 /**
  * @brief Метод создания фрейма понга
@@ -553,12 +631,180 @@ vector <char> awh::ws::Frame::pong(const string & mess, const bool mask) const n
  * @return       бинарные данные фрейма
  */
 vector <char> awh::ws::Frame::pong(const void * buffer, const size_t size, const bool mask) const noexcept {
-	// Создаём тело запроса и устанавливаем первый байт PONG с пустой полезной нагрузкой
-	vector <char> result = {static_cast <char> (0x080) | (0x00F & static_cast <char> (opcode_t::PONG)), 0x00};
-	// Если сообщение передано
-	if((buffer != nullptr) && (size > 0))
-		// Выполняем формирование фрейма
-		::frame(result, buffer, size, mask, this->_log);
+	// Выполняем формирование фрейма PONG
+	return ::build(static_cast <uint8_t> (0x080 | static_cast <uint8_t> (opcode_t::PONG)), buffer, size, mask, this->_log);
+}
+/**
+ * @brief Метод наложения маски на данные
+ *
+ * Данные обрабатываются векторами AVX2, SSE2 или NEON (в зависимости от архитектуры)
+ * и машинными словами по 64 бита, входной и выходной буферы могут совпадать
+ *
+ * @param output буфер для записи результата
+ * @param input  буфер данных для маскирования
+ * @param size   размер данных для маскирования
+ * @param key    ключ маски из 4-х байт
+ */
+void awh::ws::Frame::mask(void * output, const void * input, const size_t size, const uint8_t * key) noexcept {
+	// Если данные переданы
+	if((output != nullptr) && (input != nullptr) && (key != nullptr) && (size > 0)){
+		// Позиция в буфере данных
+		size_t offset = 0;
+		// Получаем буфер для записи результата
+		uint8_t * dest = reinterpret_cast <uint8_t *> (output);
+		// Получаем буфер данных для маскирования
+		const uint8_t * source = reinterpret_cast <const uint8_t *> (input);
+		/**
+		 * Если используется набор инструкций AVX2
+		 */
+		#if defined(__AVX2__)
+			// Выравнивание буфера записи для векторных инструкций
+			constexpr size_t align = 32;
+		/**
+		 * Если используется набор инструкций SSE2 или NEON
+		 */
+		#elif defined(__SSE2__) || defined(__ARM_NEON)
+			// Выравнивание буфера записи для векторных инструкций
+			constexpr size_t align = 16;
+		/**
+		 * Если векторные инструкции не используются
+		 */
+		#else
+			// Выравнивание буфера записи для машинных слов
+			constexpr size_t align = 8;
+		#endif
+		// Получаем количество байт до выровненного адреса буфера записи
+		const size_t head = std::min(size, ((align - (reinterpret_cast <uintptr_t> (dest) % align)) % align));
+		// Выполняем маскирование байт до выровненного адреса
+		for(; offset < head; offset++)
+			// Накладываем маску на байт данных
+			dest[offset] = (source[offset] ^ key[offset % 4]);
+		// Шаблон маски, сдвинутый на позицию выровненного адреса
+		alignas(32) uint8_t pattern[32];
+		// Выполняем заполнение шаблона маски
+		for(uint8_t i = 0; i < 32; i++)
+			// Устанавливаем очередной байт шаблона
+			pattern[i] = key[(head + i) % 4];
+		/**
+		 * Если используется набор инструкций AVX2
+		 */
+		#if defined(__AVX2__)
+			// Загружаем шаблон маски в вектор
+			const __m256i vector = _mm256_load_si256(reinterpret_cast <const __m256i *> (pattern));
+			// Выполняем маскирование блоками по 32 байта
+			for(; (offset + 32) <= size; offset += 32)
+				// Накладываем маску на блок и записываем его по выровненному адресу
+				_mm256_store_si256(reinterpret_cast <__m256i *> (dest + offset), _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast <const __m256i *> (source + offset)), vector));
+		/**
+		 * Если используется набор инструкций SSE2
+		 */
+		#elif defined(__SSE2__)
+			// Загружаем шаблон маски в вектор
+			const __m128i vector = _mm_load_si128(reinterpret_cast <const __m128i *> (pattern));
+			// Выполняем маскирование блоками по 16 байт
+			for(; (offset + 16) <= size; offset += 16)
+				// Накладываем маску на блок и записываем его по выровненному адресу
+				_mm_store_si128(reinterpret_cast <__m128i *> (dest + offset), _mm_xor_si128(_mm_loadu_si128(reinterpret_cast <const __m128i *> (source + offset)), vector));
+		/**
+		 * Если используется набор инструкций NEON
+		 */
+		#elif defined(__ARM_NEON)
+			// Загружаем шаблон маски в вектор
+			const uint8x16_t vector = vld1q_u8(pattern);
+			// Выполняем маскирование блоками по 16 байт
+			for(; (offset + 16) <= size; offset += 16)
+				// Накладываем маску на блок и записываем его
+				vst1q_u8(dest + offset, veorq_u8(vld1q_u8(source + offset), vector));
+		#endif
+		// Машинное слово маски
+		uint64_t word = 0, data = 0;
+		// Получаем машинное слово маски из шаблона
+		::memcpy(&word, pattern, sizeof(word));
+		// Выполняем маскирование оставшихся данных словами по 64 бита
+		for(; (offset + 8) <= size; offset += 8){
+			// Загружаем слово данных
+			::memcpy(&data, source + offset, sizeof(data));
+			// Накладываем маску на слово данных
+			data ^= word;
+			// Записываем полученное слово
+			::memcpy(dest + offset, &data, sizeof(data));
+		}
+		// Выполняем маскирование оставшихся байт
+		for(; offset < size; offset++)
+			// Накладываем маску на байт данных
+			dest[offset] = (source[offset] ^ key[offset % 4]);
+	}
+}
+/**
+ * @brief Метод разбора заголовка фрейма и проверки его целостности
+ *
+ * @param head   заголовки фрейма
+ * @param buffer бинарные данные фрейма
+ * @param size   размер передаваемого буфера
+ * @param key    буфер для записи ключа маски
+ * @return       смещение полезной нагрузки в буфере (0, если фрейм получен не полностью или испорчен)
+ */
+size_t awh::ws::Frame::parse(head_t & head, const void * buffer, const size_t size, uint8_t * key) const noexcept {
+	// Результат работы функции
+	size_t result = 0;
+	// Если данные переданы в достаточном объёме
+	if((buffer != nullptr) && (size > 0)){
+		// Устанавливаем стейт фрейма
+		head.state = state_t::GOOD;
+		// Выполняем чтение заголовков
+		::head(head, buffer, size, MAX_FRAME_SIZE, this->_log);
+		// Если размер полезной нагрузки недопустим
+		if(head.state == state_t::BAD)
+			// Выводим результат
+			return result;
+		// Получаем размер смещения
+		head.frame = static_cast <uint64_t> (head.size);
+		// Если данные переданы в достаточном объёме для проверки входящих данных (сравнение без переполнения)
+		if((head.frame <= size) && (head.payload <= (size - head.frame))){
+			// Если входящие данные не являются мусоромы
+			if((head.optcode == opcode_t::TEXT) || (head.optcode == opcode_t::BINARY) ||
+			   (head.optcode == opcode_t::PING) || (head.optcode == opcode_t::PONG) ||
+			   (head.optcode == opcode_t::CLOSE) || (head.optcode == opcode_t::CONTINUATION)){
+				// Если ожидаемых байт фрейма достаточно для обработки (с учётом ключа маски)
+				if(!head.mask || ((size - head.frame - head.payload) >= 4)){
+					// Если маска требуется, маскируем данные
+					if(head.mask){
+						// Считываем ключ маски
+						::memcpy(key, reinterpret_cast <const uint8_t *> (buffer) + head.frame, 4);
+						// Увеличиваем размер смещения
+						head.frame += 4;
+					}
+					// Запоминаем смещение полезной нагрузки
+					result = static_cast <size_t> (head.frame);
+					// Увеличиваем размер смещения
+					head.frame += head.payload;
+					// Если размер не установлен
+					if((head.payload == 0) && ((head.optcode != opcode_t::PING) &&
+					  (head.optcode != opcode_t::PONG) && (head.optcode != opcode_t::CLOSE)))
+						// Устанавливаем статус битого фрейма
+						head.state = state_t::BAD;
+					// Проверяем состояние флагов RSV2 и RSV3
+					else if(head.rsv[1] || head.rsv[2])
+						// Устанавливаем статус битого фрейма
+						head.state = state_t::BAD;
+					// Если флаг компресси включён а данные пришли не сжатые
+					else if(head.rsv[0] && ((head.optcode == opcode_t::CONTINUATION) ||
+					       ((static_cast <uint8_t> (head.optcode) > 0x007) && (static_cast <uint8_t> (head.optcode) < 0x00B))))
+						// Устанавливаем статус битого фрейма
+						head.state = state_t::BAD;
+					// Если опкоды требуют финального фрейма
+					else if(!head.fin && (static_cast <uint8_t> (head.optcode) > 0x007) && (static_cast <uint8_t> (head.optcode) < 0x00B))
+						// Устанавливаем статус битого фрейма
+						head.state = state_t::BAD;
+					// Если фрейм испорчен
+					if(head.state == state_t::BAD)
+						// Сбрасываем смещение полезной нагрузки
+						result = 0;
+				}
+			// Устанавливаем статус битого фрейма
+			} else head.state = state_t::BAD;
+		}
+	}
 	// Выводим результат
 	return result;
 }
@@ -573,90 +819,24 @@ vector <char> awh::ws::Frame::pong(const void * buffer, const size_t size, const
 vector <char> awh::ws::Frame::get(head_t & head, const void * buffer, const size_t size) const noexcept {
 	// Результат работы функции
 	vector <char> result;
-	// Если данные переданы в достаточном объёме
-	if((buffer != nullptr) && (size > 0)){
+	// Ключ маски
+	uint8_t key[4];
+	// Выполняем разбор заголовка фрейма
+	const size_t offset = this->parse(head, buffer, size, key);
+	// Если фрейм получен полностью и полезная нагрузка существует
+	if((offset > 0) && (head.payload > 0)){
 		/**
 		 * Выполняем отлов ошибок
 		 */
 		try {
-			// Выполняем чтение заголовков
-			::head(head, buffer, size, this->_log);
-			// Устанавливаем стейт фрейма
-			head.state = state_t::GOOD;
-			// Получаем размер смещения
-			head.frame = static_cast <uint64_t> (head.size);
-			// Получаем общее количество байтов
-			uint64_t bytes = (head.payload + head.frame);
-			// Если данные переданы в достаточном объёме для проверки входящих данных
-			if(static_cast <size_t> (bytes) <= size){
-				// Если входящие данные не являются мусоромы
-				if((head.optcode == opcode_t::TEXT) || (head.optcode == opcode_t::BINARY) ||
-				   (head.optcode == opcode_t::PING) || (head.optcode == opcode_t::PONG) ||
-				   (head.optcode == opcode_t::CLOSE) || (head.optcode == opcode_t::CONTINUATION)){
-					// Если маска требуется, маскируем данные
-					if(head.mask)
-						// Увеличиваем количество ожидаемых байт
-						bytes += 4;
-					// Если ожидаемых байт фрейма достаточно для обработки
-					if(static_cast <size_t> (bytes) <= size){
-						// Бинарные данные маски
-						uint8_t mask[4];
-						// Если маска требуется, маскируем данные
-						if(head.mask){
-							// Считываем ключ маски
-							::memcpy(mask, reinterpret_cast <const uint8_t *> (buffer) + head.frame, 4);
-							// Увеличиваем размер смещения
-							head.frame += 4;
-						}
-						// Если полезная нагрузка получена
-						if(head.payload > 0){
-							// Получаем оставшиеся данные полезной нагрузки
-							result.assign(
-								reinterpret_cast <const char *> (buffer) + head.frame,
-								reinterpret_cast <const char *> (buffer) + (head.payload + head.frame)
-							);
-							// Если маска требуется, размаскируем данные
-							if(head.mask){
-								// Выполняем перебор всех байт передаваемых данных
-								for(size_t i = 0; i < result.size(); i++)
-									// Выполняем шифрование данных
-									result.at(i) ^= mask[i % 4];
-							}
-						}
-						// Увеличиваем размер смещения
-						head.frame += head.payload;
-						// Если размер не установлен
-						if((head.payload == 0) && ((head.optcode != opcode_t::PING) &&
-						  (head.optcode != opcode_t::PONG) && (head.optcode != opcode_t::CLOSE)))
-							// Устанавливаем статус битого фрейма
-							head.state = state_t::BAD;
-						// Проверяем состояние флагов RSV2 и RSV3
-						else if(head.rsv[1] || head.rsv[2])
-							// Устанавливаем статус битого фрейма
-							head.state = state_t::BAD;
-						// Если флаг компресси включён а данные пришли не сжатые
-						else if(head.rsv[0] && ((head.optcode == opcode_t::CONTINUATION) ||
-						       ((static_cast <uint8_t> (head.optcode) > 0x007) && (static_cast <uint8_t> (head.optcode) < 0x00B))))
-							// Устанавливаем статус битого фрейма
-							head.state = state_t::BAD;
-						// Если опкоды требуют финального фрейма
-						else if(!head.fin && (static_cast <uint8_t> (head.optcode) > 0x007) && (static_cast <uint8_t> (head.optcode) < 0x00B))
-							// Устанавливаем статус битого фрейма
-							head.state = state_t::BAD;
-						// Если фрейм испорчен
-						if(head.state == state_t::BAD){
-							// Очищаем результирующий буфер
-							result.clear();
-							// Выполняем очистку выделенной памяти
-							vector <decltype(result)::value_type> ().swap(result);
-						}
-					}
-				// Устанавливаем статус битого фрейма
-				} else head.state = state_t::BAD;
-			// Если размер данных уже слишком большой, выводим сообщение об ошибке
-			} else if((size > sizeof(head_t)) && (head.payload > MAX_FRAME_SIZE))
-				// Устанавливаем статус битого фрейма
-				head.state = state_t::BAD;
+			// Выделяем память для полезной нагрузки
+			result.resize(static_cast <size_t> (head.payload));
+			// Если маска требуется, размаскируем данные при копировании
+			if(head.mask)
+				// Копируем полезную нагрузку со снятием маски
+				this->mask(result.data(), reinterpret_cast <const char *> (buffer) + offset, result.size(), key);
+			// Копируем полезную нагрузку как есть
+			else ::memcpy(result.data(), reinterpret_cast <const char *> (buffer) + offset, result.size());
 		/**
 		 * Если возникает ошибка
 		 */
@@ -688,25 +868,56 @@ vector <char> awh::ws::Frame::get(head_t & head, const void * buffer, const size
  * @return       бинарные данные фрейма
  */
 vector <char> awh::ws::Frame::set(const head_t & head, const void * buffer, const size_t size) const noexcept {
-	/**
-	 * rsv[0] должен быть установлен в TRUE для первого сообщения в GZip,
-	 * и установлен в FALSE для всех остальных сообщений, в рамках одной сессии
-	 */
-	vector <char> result = {
-		(
-			static_cast <char> (
-				(head.fin ? 0x080 : 0x00) |
-				(head.rsv[0] ? 0x040 : 0x00) |
-				(head.rsv[1] ? 0x020 : 0x00) |
-				(head.rsv[2] ? 0x010 : 0x00) |
-				(0x00F & static_cast <int32_t> (head.optcode))
-			)
-		), 0x00
-	};
-	// Если данные переданы
-	if((buffer != nullptr) && (size > 0))
-		// Выполняем формирование фрейма
-		::frame(result, buffer, size, head.mask, this->_log);
+	// Выполняем формирование фрейма
+	return ::build(::first(head), buffer, size, head.mask, this->_log);
+}
+/**
+ * @brief Метод извлечения данных фрейма с размаскированием внутри переданного буфера
+ *
+ * @param head   заголовки фрейма
+ * @param buffer бинарные данные фрейма для извлечения
+ * @param size   размер передаваемого буфера
+ * @return       указатель на полезную нагрузку размером head.payload внутри буфера
+ */
+const char * awh::ws::Frame::decode(head_t & head, void * buffer, const size_t size) const noexcept {
+	// Ключ маски
+	uint8_t key[4];
+	// Выполняем разбор заголовка фрейма
+	const size_t offset = this->parse(head, buffer, size, key);
+	// Если фрейм получен полностью
+	if(offset > 0){
+		// Получаем полезную нагрузку внутри буфера
+		char * result = (reinterpret_cast <char *> (buffer) + offset);
+		// Если маска требуется и полезная нагрузка существует
+		if(head.mask && (head.payload > 0))
+			// Снимаем маску с полезной нагрузки прямо в буфере
+			this->mask(result, result, static_cast <size_t> (head.payload), key);
+		// Выводим результат
+		return result;
+	}
 	// Выводим результат
-	return result;
+	return nullptr;
+}
+/**
+ * @brief Метод создания фрейма в буфере вызывающей стороны
+ *
+ * @param head     заголовки фрейма
+ * @param buffer   бинарные данные полезной нагрузки
+ * @param size     размер передаваемого буфера
+ * @param output   буфер для записи фрейма (достаточно size + MAX_HEAD_SIZE байт)
+ * @param capacity размер буфера для записи фрейма
+ * @return         размер записанного фрейма (0, если места в буфере недостаточно)
+ */
+size_t awh::ws::Frame::encode(const head_t & head, const void * buffer, const size_t size, void * output, const size_t capacity) const noexcept {
+	// Получаем размер полезной нагрузки
+	const size_t length = ((buffer != nullptr) ? size : 0);
+	// Получаем размер заголовка фрейма
+	const size_t offset = ((length < 0x07E ? 2 : (length < 0x10000 ? 4 : 10)) + (head.mask ? 4 : 0));
+	// Если буфер для записи фрейма передан и его размера достаточно
+	if((output != nullptr) && (capacity >= (offset + length))){
+		// Выполняем запись фрейма
+		return ::write(reinterpret_cast <uint8_t *> (output), ::first(head), buffer, length, head.mask);
+	}
+	// Выводим результат
+	return 0;
 }
@@ -0,0 +1,473 @@
+/**
+ * @file: topics.cpp
+ * @date: 2025-03-10
+ * @license: GPL-3.0
+ *
+ * @telegram: @forman
+ * @author: Yuriy Lobarev
+ * @phone: +7 (910) 983-95-90
+ * @email: forman@anyks.com
+ * @site: https://anyks.com
+ *
+ * @copyright: Copyright © 2025
+ */
+
+/**
+ * Подключаем заголовочный файл
+ */
+#include <ws/topics.hpp>
+
+/**
+ * Подписываемся на стандартное пространство имён
+ */
+using namespace std;
+
+/**
+ * @brief Метод очистки реестра тем
+ *
+ */
+void awh::ws::Topics::clear() noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем очистку списка тем
+	this->_topics.clear();
+	// Выполняем очистку списка тем брокеров
+	this->_brokers.clear();
+	// Выполняем очистку списка отложенных сообщений
+	this->_deferred.clear();
+}
+/**
+ * @brief Метод удаления брокера из всех тем
+ *
+ * @param bid идентификатор брокера
+ */
+void awh::ws::Topics::erase(const uint64_t bid) noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Удаляем отложенные сообщения брокера
+	this->_deferred.erase(bid);
+	// Выполняем поиск тем на которые подписан брокер
+	auto i = this->_brokers.find(bid);
+	// Если брокер подписан на темы
+	if(i != this->_brokers.end()){
+		// Выполняем перебор всех тем брокера
+		for(auto & topic : i->second){
+			// Выполняем поиск темы
+			auto j = this->_topics.find(topic);
+			// Если тема найдена
+			if(j != this->_topics.end()){
+				// Удаляем брокера из списка подписчиков
+				j->second.subscribers.erase(bid);
+				// Обновляем количество подписчиков темы
+				j->second.stat.subscribers = j->second.subscribers.size();
+			}
+		}
+		// Удаляем список тем брокера
+		this->_brokers.erase(i);
+	}
+}
+/**
+ * @brief Метод подписки брокера на тему
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ * @return      результат подписки
+ */
+bool awh::ws::Topics::subscribe(const string & topic, const uint64_t bid) noexcept {
+	// Если данные переданы верные
+	if(!topic.empty() && (bid > 0)){
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем тему рассылки
+			topic_t & item = this->_topics[topic];
+			// Добавляем брокера в список подписчиков
+			item.subscribers.emplace(bid);
+			// Обновляем количество подписчиков темы
+			item.stat.subscribers = item.subscribers.size();
+			// Добавляем тему в список тем брокера
+			this->_brokers[bid].emplace(topic);
+			// Сообщаем, что подписка выполнена
+			return true;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(topic, bid), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+	// Сообщаем, что подписка не выполнена
+	return false;
+}
+/**
+ * @brief Метод отписки брокера от темы
+ *
+ * @param topic название темы
+ * @param bid   идентификатор брокера
+ */
+void awh::ws::Topics::unsubscribe(const string & topic, const uint64_t bid) noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем поиск темы
+	auto i = this->_topics.find(topic);
+	// Если тема найдена
+	if(i != this->_topics.end()){
+		// Удаляем брокера из списка подписчиков
+		i->second.subscribers.erase(bid);
+		// Обновляем количество подписчиков темы
+		i->second.stat.subscribers = i->second.subscribers.size();
+	}
+	// Выполняем поиск тем брокера
+	auto j = this->_brokers.find(bid);
+	// Если брокер подписан на темы
+	if(j != this->_brokers.end()){
+		// Удаляем тему из списка тем брокера
+		j->second.erase(topic);
+		// Если брокер больше ни на что не подписан
+		if(j->second.empty())
+			// Удаляем список тем брокера
+			this->_brokers.erase(j);
+	}
+	// Выполняем поиск отложенных сообщений брокера
+	auto k = this->_deferred.find(bid);
+	// Если отложенные сообщения найдены
+	if(k != this->_deferred.end()){
+		// Удаляем отложенное сообщение темы
+		k->second.erase(topic);
+		// Если отложенных сообщений больше нет
+		if(k->second.empty())
+			// Удаляем список отложенных сообщений брокера
+			this->_deferred.erase(k);
+	}
+}
+/**
+ * @brief Метод установки политики обработки медленных подписчиков
+ *
+ * @param topic  название темы
+ * @param policy политика обработки медленных подписчиков
+ * @param limit  размер очереди подписчика в байтах, после которого применяется политика
+ */
+void awh::ws::Topics::policy(const string & topic, const policy_t policy, const size_t limit) noexcept {
+	// Если название темы передано
+	if(!topic.empty()){
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Получаем тему рассылки
+			topic_t & item = this->_topics[topic];
+			// Устанавливаем размер очереди подписчика
+			item.limit = limit;
+			// Устанавливаем политику обработки медленных подписчиков
+			item.policy = policy;
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(topic, static_cast <uint16_t> (policy), limit), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+}
+/**
+ * @brief Метод получения статистики темы
+ *
+ * @param topic название темы
+ * @return      статистика темы
+ */
+awh::ws::Topics::stat_t awh::ws::Topics::stat(const string & topic) const noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем поиск темы
+	auto i = this->_topics.find(topic);
+	// Если тема найдена
+	if(i != this->_topics.end())
+		// Выводим статистику темы
+		return i->second.stat;
+	// Выводим пустой результат
+	return stat_t();
+}
+/**
+ * @brief Метод создания публикуемого сообщения
+ *
+ * @param topic  название темы
+ * @param buffer буфер полезной нагрузки сообщения
+ * @param size   размер полезной нагрузки сообщения
+ * @param text   данные передаются в текстовом виде
+ * @return       публикуемое сообщение (пустое значение, если у темы нет подписчиков)
+ */
+std::shared_ptr <awh::ws::Topics::message_t> awh::ws::Topics::message(const string & topic, const char * buffer, const size_t size, const bool text) noexcept {
+	// Результат работы функции
+	std::shared_ptr <message_t> result;
+	// Если данные переданы верные
+	if((buffer != nullptr) && (size > 0)){
+		// Выполняем блокировку потока
+		const lock_guard <std::recursive_mutex> lock(this->_mtx);
+		// Выполняем поиск темы
+		auto i = this->_topics.find(topic);
+		// Если у темы есть подписчики
+		if((i != this->_topics.end()) && !i->second.subscribers.empty()){
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				// Создаём публикуемое сообщение
+				result = std::make_shared <message_t> ();
+				// Устанавливаем флаг текстового сообщения
+				result->text = text;
+				// Выполняем копирование полезной нагрузки, она разделяется всеми подписчиками
+				result->payload.assign(buffer, buffer + size);
+				// Увеличиваем количество опубликованных сообщений
+				i->second.stat.published++;
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const bad_alloc &) {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(topic, size, text), log_t::flag_t::CRITICAL, "Memory allocation error");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+				#endif
+				// Выходим из приложения
+				::exit(EXIT_FAILURE);
+			}
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод получения списка подписчиков темы
+ *
+ * @param topic название темы
+ * @return      список идентификаторов брокеров подписчиков
+ */
+vector <uint64_t> awh::ws::Topics::subscribers(const string & topic) const noexcept {
+	// Результат работы функции
+	vector <uint64_t> result;
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем поиск темы
+	auto i = this->_topics.find(topic);
+	// Если тема найдена
+	if(i != this->_topics.end()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Копируем список подписчиков, отправка выполняется без блокировки реестра
+			result.assign(i->second.subscribers.begin(), i->second.subscribers.end());
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(topic), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+	// Выводим результат
+	return result;
+}
+/**
+ * @brief Метод проверки допуска сообщения в очередь подписчика
+ *
+ * @param topic   название темы
+ * @param bid     идентификатор брокера подписчика
+ * @param queued  количество байт в очереди отправки подписчика
+ * @param message публикуемое сообщение
+ * @return        сообщение следует отправить подписчику немедленно
+ */
+bool awh::ws::Topics::admit(const string & topic, const uint64_t bid, const size_t queued, const std::shared_ptr <message_t> & message) noexcept {
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем поиск темы
+	auto i = this->_topics.find(topic);
+	// Если тема не найдена
+	if(i == this->_topics.end())
+		// Сообщение не отправляем
+		return false;
+	// Выполняем поиск отложенных сообщений брокера
+	auto j = this->_deferred.find(bid);
+	// Если у брокера есть отложенное сообщение темы
+	if((j != this->_deferred.end()) && (j->second.count(topic) > 0)){
+		// Новое сообщение заменяет отложенное
+		i->second.stat.coalesced++;
+		// Если очередь подписчика освободилась
+		if(queued < i->second.limit){
+			// Удаляем отложенное сообщение темы
+			j->second.erase(topic);
+			// Если отложенных сообщений больше нет
+			if(j->second.empty())
+				// Удаляем список отложенных сообщений брокера
+				this->_deferred.erase(j);
+		}
+	}
+	// Если очередь подписчика не ограничена или не переполнена
+	if((i->second.limit == 0) || (queued < i->second.limit) || (i->second.policy == policy_t::NONE)){
+		// Увеличиваем количество отправленных сообщений
+		i->second.stat.sent++;
+		// Сообщаем, что сообщение нужно отправить
+		return true;
+	}
+	/**
+	 * Определяем политику обработки медленных подписчиков
+	 */
+	switch(static_cast <uint8_t> (i->second.policy)){
+		// Если сообщение нужно пропустить
+		case static_cast <uint8_t> (policy_t::DROP):
+			// Увеличиваем количество пропущенных сообщений
+			i->second.stat.dropped++;
+		break;
+		// Если нужно сохранить только последнее сообщение
+		case static_cast <uint8_t> (policy_t::COALESCE): {
+			/**
+			 * Выполняем отлов ошибок
+			 */
+			try {
+				// Запоминаем сообщение, оно будет отправлено после освобождения очереди
+				this->_deferred[bid][topic] = message;
+			/**
+			 * Если возникает ошибка
+			 */
+			} catch(const bad_alloc &) {
+				/**
+				 * Если включён режим отладки
+				 */
+				#if DEBUG_MODE
+					// Выводим сообщение об ошибке
+					this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(topic, bid, queued), log_t::flag_t::CRITICAL, "Memory allocation error");
+				/**
+				* Если режим отладки не включён
+				*/
+				#else
+					// Выводим сообщение об ошибке
+					this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+				#endif
+				// Выходим из приложения
+				::exit(EXIT_FAILURE);
+			}
+		} break;
+	}
+	// Сообщение не отправляем
+	return false;
+}
+/**
+ * @brief Метод извлечения отложенных сообщений подписчика
+ *
+ * @param bid    идентификатор брокера подписчика
+ * @param queued количество байт в очереди отправки подписчика
+ * @return       список сообщений, которые можно отправить подписчику
+ */
+vector <std::shared_ptr <awh::ws::Topics::message_t>> awh::ws::Topics::release(const uint64_t bid, const size_t queued) noexcept {
+	// Результат работы функции
+	vector <std::shared_ptr <message_t>> result;
+	// Выполняем блокировку потока
+	const lock_guard <std::recursive_mutex> lock(this->_mtx);
+	// Выполняем поиск отложенных сообщений брокера
+	auto i = this->_deferred.find(bid);
+	// Если отложенные сообщения найдены
+	if(i != this->_deferred.end()){
+		/**
+		 * Выполняем отлов ошибок
+		 */
+		try {
+			// Выполняем перебор всех отложенных сообщений
+			for(auto j = i->second.begin(); j != i->second.end();){
+				// Выполняем поиск темы
+				auto k = this->_topics.find(j->first);
+				// Если тема удалена
+				if(k == this->_topics.end())
+					// Удаляем отложенное сообщение
+					j = i->second.erase(j);
+				// Если очередь подписчика освободилась
+				else if(queued < k->second.limit) {
+					// Добавляем сообщение в список для отправки
+					result.push_back(std::move(j->second));
+					// Увеличиваем количество отправленных сообщений
+					k->second.stat.sent++;
+					// Удаляем отложенное сообщение
+					j = i->second.erase(j);
+				// Продолжаем ожидание освобождения очереди
+				} else ++j;
+			}
+			// Если отложенных сообщений больше нет
+			if(i->second.empty())
+				// Удаляем список отложенных сообщений брокера
+				this->_deferred.erase(i);
+		/**
+		 * Если возникает ошибка
+		 */
+		} catch(const bad_alloc &) {
+			/**
+			 * Если включён режим отладки
+			 */
+			#if DEBUG_MODE
+				// Выводим сообщение об ошибке
+				this->_log->debug("%s", __PRETTY_FUNCTION__, std::make_tuple(bid, queued), log_t::flag_t::CRITICAL, "Memory allocation error");
+			/**
+			* Если режим отладки не включён
+			*/
+			#else
+				// Выводим сообщение об ошибке
+				this->_log->print("%s", log_t::flag_t::CRITICAL, "Memory allocation error");
+			#endif
+			// Выходим из приложения
+			::exit(EXIT_FAILURE);
+		}
+	}
+	// Выводим результат
+	return result;
+}